@@ -11,10 +11,11 @@
     #include "RType/Network/INetwork.hpp"
     #include "RType/Network/Packet.hpp"
     #include "RType/Network/IEventPublisher.hpp"
+    #include "RType/Network/ReliableChannel.hpp"
+    #include "RType/Thread/MpscRing.hpp"
 
     #include <memory>
     #include <optional>
-    #include <deque>
     #include <mutex>
     #include <asio.hpp>
     #include <thread>
@@ -66,15 +67,29 @@ namespace rtp::client {
             /**
              * @brief Send a packet to the server
              * @param packet Packet to be sent
-             * @param mode Network mode (TCP or UDP)
+             * @param mode Network mode (TCP, UDP or ReliableUDP)
+             * @note ReliableUDP packets are queued until flushReliable()
              */
             void sendPacket(const net::Packet &packet, net::NetworkMode mode);
 
+            /**
+             * @brief Send the reliable channel's due messages, resends and acks
+             * @note Called once per frame from the game thread
+             */
+            void flushReliable(void);
+
             /**
              * @brief Poll for a network event
              * @return Optional NetworkEvent if available
              */
             std::optional<net::NetworkEvent> pollEvent(void) override;
+
+            /**
+             * @brief Drain up to out.size() network events in one call
+             * @param out Slots the events are moved into, oldest first
+             * @return Number of events written to out
+             */
+            size_t pollEvents(std::span<net::NetworkEvent> out) override;
  
             /**
              * @brief Publish a network event
@@ -82,12 +97,6 @@ namespace rtp::client {
              */
             void publishEvent(net::NetworkEvent event);
 
-            /**
-             * @brief Check if there are pending packets in the event queue
-             * @return Vector of pending packets
-             */
-            std::vector<net::Packet> hasPendingPackets(void);
-
             /**
              * @brief Pop a packet from the event queue
              * @return Packet popped from the queue
@@ -131,8 +140,8 @@ namespace rtp::client {
 
             std::thread _ioThread;                      /**< Thread for running the I/O context */
 
-            std::mutex _eventQueueMutex;                /**< Mutex for event queue synchronization */
-            std::deque<net::NetworkEvent> _eventQueue;  /**< Queue of network events */
+            thread::MpscRing<net::NetworkEvent> _eventQueue{
+                net::EVENT_QUEUE_CAPACITY};             /**< I/O thread to game thread event queue */
 
             net::Header _tcpHeader;                     /**< TCP packet header */
             net::Header _udpHeader;                     /**< UDP packet header */
@@ -142,6 +151,10 @@ namespace rtp::client {
             bool _udpBound = false;                     /**< Flag indicating if UDP is bound */
             
             std::array<char, 65536> _udpBuffer;         /**< Buffer for UDP packets */
+
+            net::ReliableChannel _reliable;             /**< Reliable-ordered gameplay channel over UDP */
+            std::vector<net::Packet> _reliableDelivered; /**< Messages released by the channel (I/O thread) */
+            std::vector<net::Packet> _reliableOut;      /**< Datagrams built on flush (game thread) */
             asio::ip::udp::endpoint _udpSenderEndpoint; /**< Endpoint of the UDP sender */
 
      };
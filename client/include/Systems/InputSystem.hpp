@@ -12,11 +12,13 @@
 #include "RType/ECS/Registry.hpp"
 #include "Core/Settings.hpp"
 #include "Network/ClientNetwork.hpp"
+#include "Systems/NetworkSyncSystem.hpp"
 #include "RType/Network/Packet.hpp"
 #include <SFML/Graphics/RenderWindow.hpp>
 
 #include <SFML/Window/Keyboard.hpp>
 #include <cstdint>
+#include <vector>
 
 namespace rtp::client {
 
@@ -28,21 +30,38 @@ class InputSystem : public ecs::ISystem
          * @param r Reference to the entity registry
          * @param settings Reference to the client settings
          * @param net Reference to the client network manager
+         * @param sync Reference to the network sync system, owner of the prediction
          * @param window Reference to the SFML render window
          */
         explicit InputSystem(ecs::Registry& r,
                             ecs::Registry& uiRegistry,
                             Settings& settings,
                             ClientNetwork& net,
+                            NetworkSyncSystem& sync,
                             sf::RenderWindow& window);
         
         /**
          * @brief Update input system logic for one frame
          * @param deltaTime Time elapsed since last update in seconds
+         * @note In game, input is sampled once per server tick and predicted
+         *       locally. Every INPUT_SEND_INTERVAL steps the last
+         *       INPUT_REDUNDANCY steps are sent, so a lost datagram costs no
+         *       input and the packet rate does not follow the frame rate.
          */
-        void update(float) override;
+        void update(float dt) override;
 
     private:
+        /**
+         * @brief Read keyboard and gamepad into an input mask
+         * @return Mask of InputBits, 0 while unfocused or typing
+         */
+        uint8_t sampleMask(void) const;
+
+        /**
+         * @brief Send the most recent input steps in one InputTick
+         */
+        void sendInputHistory(void);
+
         void playShotSound();
         enum InputBits : uint8_t {              /**< Bitmask for input directions */
             MoveUp    = 1 << 0,
@@ -58,9 +77,15 @@ class InputSystem : public ecs::ISystem
         ecs::Registry& _uiRegistry;        /**< Reference to the UI registry */
         Settings& _settings;                    /**< Reference to the client settings */
         ClientNetwork& _net;                    /**< Reference to the client network manager */
+        NetworkSyncSystem& _sync;               /**< Reference to the network sync system */
         sf::RenderWindow& _window;              /**< Reference to the SFML render window */
 
-        uint8_t _lastMask = 0;                  /**< Last sent input mask */
+        static constexpr size_t INPUT_SEND_INTERVAL = 2;    /**< Steps between two InputTick, 30 Hz */
+        static constexpr uint32_t INPUT_REDUNDANCY = 6;     /**< Steps repeated in each InputTick */
+
+        uint8_t _lastMask = 0;                  /**< Mask sampled last frame, for the shot sound */
+        size_t _stepsSinceSend = 0;             /**< Input steps taken since the last InputTick */
+        std::vector<net::InputPayload> _inputHistory; /**< Reused storage for the sent steps */
     };
 
 } // namespace rtp::client
@@ -17,6 +17,8 @@
     #include "RType/ECS/Components/Sprite.hpp"
     #include "RType/ECS/Components/Animation.hpp"
     #include "RType/Network/Packet.hpp"
+    #include "RType/Network/SnapshotBuffer.hpp"
+    #include "RType/Game/PlayerPredictor.hpp"
 
     #include "Game/EntityBuilder.hpp"
 
@@ -195,6 +197,12 @@ namespace rtp::client {
              */
             bool isInGame(void) const;
 
+            /**
+             * @brief Prediction of the locally controlled ship
+             * @return Predictor fed by InputSystem and reconciled with snapshots
+             */
+            game::PlayerPredictor& getPredictor(void);
+
             /**
              * @brief Get the current state of the client
              * @return Current State enum value
@@ -230,6 +238,15 @@ namespace rtp::client {
             ecs::Registry& _registry;                                 /**< Reference to the entity registry */
             std::unordered_map<uint32_t, ecs::Entity> _netIdToEntity; /**< Map of network IDs to entities */
             EntityBuilder _builder;                                        /**< Entity builder for spawning entities */
+            static constexpr std::size_t EVENT_BATCH_SIZE = 128;           /**< Events drained per pollEvents call */
+            std::vector<net::NetworkEvent> _eventBatch;                    /**< Reused slots for drained events */
+            std::vector<net::EntitySpawnPayload> _spawnBatch;              /**< Reused storage for EntitySpawnBatch */
+            std::vector<net::EntityDeathPayload> _deathBatch;              /**< Reused storage for EntityDeathBatch */
+            net::InterpolationClock _interpolationClock;                   /**< Server tick rendered this frame */
+            std::unordered_map<uint32_t,
+                net::SnapshotBuffer> _snapshotBuffers;                     /**< Recent snapshots per network ID */
+            game::PlayerPredictor _predictor;                              /**< Prediction of the controlled ship */
+            uint32_t _controlledNetId = 0;                                 /**< Network ID of the controlled ship */
 
         private:
             bool _isInRoom = false;                                        /**< Flag indicating if the client is in a room */
@@ -278,10 +295,50 @@ namespace rtp::client {
 
             void onSpawnEntityFromServer(net::Packet& packet);
 
+            void onEntitySpawnBatch(net::Packet& packet);
+
             void onEntityDeath(net::Packet& packet);
 
+            void onEntityDeathBatch(net::Packet& packet);
+
+            /**
+             * @brief Create the local entity described by a spawn notification
+             * @param payload Spawn notification from the server
+             */
+            void spawnEntity(const net::EntitySpawnPayload& payload);
+
+            /**
+             * @brief Destroy the local entity named by a death notification
+             * @param payload Death notification from the server
+             */
+            void applyEntityDeath(const net::EntityDeathPayload& payload);
+
+            /**
+             * @brief Buffer a room snapshot for interpolation
+             * @param packet RoomUpdate packet
+             * @note Transforms are written by applyInterpolation, not here. The
+             *       controlled ship is not buffered, its snapshot reconciles
+             *       the prediction instead.
+             */
             void onRoomUpdate(net::Packet& packet);
 
+            /**
+             * @brief Move networked entities to their state at the render tick
+             * @param dt Frame time in seconds
+             * @note Renders InterpolationClock's delay behind the newest
+             *       snapshot, so late or reordered snapshots do not show. The
+             *       controlled ship is drawn at its predicted position.
+             */
+            void applyInterpolation(float dt);
+
+            /**
+             * @brief Keep an owner's beams attached in front of it
+             * @param ownerNetId Network ID of the beam owner
+             * @param ownerEntity Local entity of the owner
+             * @param position Rendered position of the owner
+             */
+            void updateBeamTransforms(uint32_t ownerNetId, ecs::Entity ownerEntity, const Vec2f& position);
+
             void onRoomChatReceived(net::Packet& packet);
 
             void pushChatMessage(const std::string& message);
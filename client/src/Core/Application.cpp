@@ -85,8 +85,8 @@ namespace rtp::client
 
     void Application::initWorldSystems(void)
     {
-        _worldSystemManager.add<NetworkSyncSystem>(_clientNetwork, _worldRegistry, _worldEntityBuilder);
-        _worldSystemManager.add<InputSystem>(_worldRegistry, _uiRegistry, _settings, _clientNetwork, _window);
+        auto& networkSync = _worldSystemManager.add<NetworkSyncSystem>(_clientNetwork, _worldRegistry, _worldEntityBuilder);
+        _worldSystemManager.add<InputSystem>(_worldRegistry, _uiRegistry, _settings, _clientNetwork, networkSync, _window);
         _worldSystemManager.add<ParallaxSystem>(_worldRegistry);
         _worldSystemManager.add<AnimationSystem>(_worldRegistry);
         _worldSystemManager.add<ShieldSystem>(_worldRegistry);
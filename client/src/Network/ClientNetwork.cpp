@@ -21,9 +21,7 @@ namespace rtp::client {
         _tcpSocket(_ioContext),
         _udpSocket(_ioContext),
         _serverEndpoint(),
-        _ioThread(),
-        _eventQueueMutex(),
-        _eventQueue()
+        _ioThread()
     {
     }
 
@@ -82,6 +80,14 @@ namespace rtp::client {
 
     void ClientNetwork::sendPacket(const net::Packet &packet, net::NetworkMode mode)
     {
+        if (mode == net::NetworkMode::ReliableUDP) {
+            if (_udpBound) {
+                _reliable.send(packet);
+                return;
+            }
+            mode = net::NetworkMode::TCP;
+        }
+
         asio::error_code ec;
         if (mode == net::NetworkMode::TCP) {
             asio::write(_tcpSocket, packet.getBufferSequence(), ec);
@@ -100,44 +106,43 @@ namespace rtp::client {
         }
     }
 
-    std::optional<net::NetworkEvent> ClientNetwork::pollEvent(void)
+    void ClientNetwork::flushReliable(void)
     {
-        std::lock_guard<std::mutex> lock(_eventQueueMutex);
-        
-        if (!_eventQueue.empty()) {
-            net::NetworkEvent event = std::move(_eventQueue.front());
-            _eventQueue.pop_front();
-            return event;
+        if (!_udpBound) {
+            return;
+        }
+        _reliableOut.clear();
+        _reliable.flush(net::ReliableChannel::Clock::now(), _reliableOut);
+        for (const auto &datagram : _reliableOut) {
+            sendPacket(datagram, net::NetworkMode::UDP);
         }
+        _reliableOut.clear();
+    }
 
-        return std::nullopt;
+    std::optional<net::NetworkEvent> ClientNetwork::pollEvent(void)
+    {
+        return _eventQueue.tryPop();
     }
 
-    void ClientNetwork::publishEvent(net::NetworkEvent event)
+    size_t ClientNetwork::pollEvents(std::span<net::NetworkEvent> out)
     {
-        std::lock_guard<std::mutex> lock(_eventQueueMutex);
-        _eventQueue.push_back(std::move(event));
+        return _eventQueue.popBatch(out);
     }
 
-    std::vector<net::Packet> ClientNetwork::hasPendingPackets(void)
+    void ClientNetwork::publishEvent(net::NetworkEvent event)
     {
-        std::lock_guard<std::mutex> lock(_eventQueueMutex);
-        std::vector<net::Packet> packets;
-        for (const auto& event : _eventQueue) {
-            packets.push_back(event.packet);
+        if (!_eventQueue.tryPush(std::move(event))) {
+            log::warning("Client event queue full, dropping packet");
         }
-        return packets;
     }
 
     net::Packet ClientNetwork::popPacket(void)
     {
-        std::lock_guard<std::mutex> lock(_eventQueueMutex);
-        if (_eventQueue.empty()) {
+        auto event = _eventQueue.tryPop();
+        if (!event) {
             throw std::runtime_error("No packets available to pop.");
         }
-        net::Packet packet = std::move(_eventQueue.front().packet);
-        _eventQueue.pop_front();
-        return packet;
+        return std::move(event->packet);
     }
 
     void ClientNetwork::readTcpHeader(void)
@@ -181,7 +186,7 @@ namespace rtp::client {
                         log::error("Welcome packet without sessionId body");
                     }
 
-                    publishEvent({0, packet});
+                    publishEvent({0, std::move(packet)});
                     readTcpHeader();
                 }
             }
@@ -204,7 +209,7 @@ namespace rtp::client {
 
                 net::Packet packet;
                 packet.header = _tcpHeader;
-                packet.body   = _tcpBody;
+                packet.body.assign(_tcpBody.begin(), _tcpBody.end());
 
                 if (_tcpHeader.opCode == net::OpCode::Welcome) {
                     uint32_t sessionId = 0;
@@ -217,7 +222,7 @@ namespace rtp::client {
                     this->sendUdpHandshake();
                 }
 
-                publishEvent({0, packet});
+                publishEvent({0, std::move(packet)});
                 readTcpHeader();
             }
         );
@@ -272,7 +277,29 @@ namespace rtp::client {
                     header.bodySize
                 );
 
-                publishEvent({ header.sessionId, packet });
+                if (header.opCode == net::OpCode::Reliable) {
+                    _reliableDelivered.clear();
+                    if (!_reliable.receive(packet, net::ReliableChannel::Clock::now(),
+                                           _reliableDelivered)) {
+                        log::error("Malformed reliable datagram");
+                    }
+                    for (auto &message : _reliableDelivered) {
+                        publishEvent({ header.sessionId, std::move(message) });
+                    }
+                    readUdp();
+                    return;
+                }
+
+                if (header.opCode == net::OpCode::Ping) {
+                    // Server RTT probe, echoed here so the frame rate does not inflate it
+                    packet.header.opCode = net::OpCode::Pong;
+                    asio::error_code ec;
+                    _udpSocket.send_to(packet.getBufferSequence(), _udpSenderEndpoint, 0, ec);
+                    readUdp();
+                    return;
+                }
+
+                publishEvent({ header.sessionId, std::move(packet) });
                 readUdp();
             }
         );
@@ -11,6 +11,8 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Window/Joystick.hpp>
 
+#include <algorithm>
+
 namespace rtp::client {
 
     //////////////////////////////////////////////////////////////////////////
@@ -21,29 +23,46 @@ namespace rtp::client {
                          ecs::Registry& uiRegistry,
                          Settings& settings,
                          ClientNetwork& net,
+                         NetworkSyncSystem& sync,
                          sf::RenderWindow& window)
-        : _r(r), _uiRegistry(uiRegistry), _settings(settings), _net(net), _window(window) {}
+        : _r(r), _uiRegistry(uiRegistry), _settings(settings), _net(net), _sync(sync), _window(window) {}
 
-    void InputSystem::update(float)
+    void InputSystem::update(float dt)
     {
-        if (!_window.hasFocus())
-            return;
         if (!_net.isUdpReady())
             return;
+        if (!_sync.isInGame()) {
+            _lastMask = 0;
+            return;
+        }
+
+        const uint8_t mask = sampleMask();
+        if ((mask & InputBits::Shoot) && !(_lastMask & InputBits::Shoot)) {
+            playShotSound();
+        }
+        _lastMask = mask;
+
+        _stepsSinceSend += _sync.getPredictor().advance(dt, mask);
+        if (_stepsSinceSend >= INPUT_SEND_INTERVAL) {
+            _stepsSinceSend = 0;
+            sendInputHistory();
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private API
+    //////////////////////////////////////////////////////////////////////////
+
+    uint8_t InputSystem::sampleMask(void) const
+    {
+        if (!_window.hasFocus())
+            return 0;
 
         if (auto inputsOpt = _uiRegistry.get<ecs::components::ui::TextInput>()) {
             auto &inputs = inputsOpt.value().get();
             for (const auto &e : inputs.entities()) {
-                if (inputs[e].isFocused) {
-                    if (_lastMask != 0) {
-                        net::Packet p(net::OpCode::InputTick);
-                        net::InputPayload payload{0};
-                        p << payload;
-                        _net.sendPacket(p, net::NetworkMode::UDP);
-                        _lastMask = 0;
-                    }
-                    return;
-                }
+                if (inputs[e].isFocused)
+                    return 0;
             }
         }
 
@@ -59,8 +78,7 @@ namespace rtp::client {
         if (sf::Keyboard::isKeyPressed(_settings.getKey(KeyAction::MoveRight)))
             mask |= InputBits::MoveRight;
         
-        bool shootPressed = sf::Keyboard::isKeyPressed(_settings.getKey(KeyAction::Shoot));
-        if (shootPressed)
+        if (sf::Keyboard::isKeyPressed(_settings.getKey(KeyAction::Shoot)))
             mask |= InputBits::Shoot;
         
         if (sf::Keyboard::isKeyPressed(_settings.getKey(KeyAction::Reload)))
@@ -99,29 +117,28 @@ namespace rtp::client {
                 mask |= InputBits::MoveRight;
             
             // Buttons: Configurable
-            if (sf::Joystick::isButtonPressed(0, _settings.getGamepadShootButton())) {
-                shootPressed = true;
+            if (sf::Joystick::isButtonPressed(0, _settings.getGamepadShootButton()))
                 mask |= InputBits::Shoot;
-            }
             if (sf::Joystick::isButtonPressed(0, _settings.getGamepadReloadButton()))
                 mask |= InputBits::Reload;
         }
 
-        if ((mask & InputBits::Shoot) && !(_lastMask & InputBits::Shoot)) {
-            playShotSound();
-        }
-
-        if (mask == _lastMask)
-            return;
+        return mask;
+    }
 
-        _lastMask = mask;
+    void InputSystem::sendInputHistory(void)
+    {
+        const auto &predictor = _sync.getPredictor();
+        const uint32_t newest = predictor.getSequence();
+        const uint32_t count = std::min<uint32_t>(newest, INPUT_REDUNDANCY);
 
-        log::info("Sending InputTick with mask: {}", (int)mask);
+        _inputHistory.clear();
+        for (uint32_t seq = newest - count + 1; seq <= newest; ++seq) {
+            _inputHistory.push_back({ predictor.getInput(seq), seq });
+        }
 
         net::Packet p(net::OpCode::InputTick);
-        net::InputPayload payload{ mask };
-        p << payload;
-
+        p << _inputHistory;
         _net.sendPacket(p, net::NetworkMode::UDP);
     }
 
@@ -31,7 +31,8 @@ namespace rtp::client {
     //////////////////////////////////////////////////////////////////////////
 
     NetworkSyncSystem::NetworkSyncSystem(ClientNetwork& network, ecs::Registry& registry, EntityBuilder builder)
-        : _network(network), _registry(registry), _builder(builder) {}
+        : _network(network), _registry(registry), _builder(builder),
+          _eventBatch(EVENT_BATCH_SIZE) {}
 
     void NetworkSyncSystem::update(float dt)
     {
@@ -50,9 +51,15 @@ namespace rtp::client {
             packet << payload;
             _network.sendPacket(packet, net::NetworkMode::UDP);
         }
-        while (auto eventOpt = _network.pollEvent()) {
-            handleEvent(*eventOpt);
+        _network.flushReliable();
+
+        size_t count = 0;
+        while ((count = _network.pollEvents(_eventBatch)) > 0) {
+            for (size_t i = 0; i < count; ++i) {
+                handleEvent(_eventBatch[i]);
+            }
         }
+        applyInterpolation(dt);
     }
 
     void NetworkSyncSystem::tryLogin(const std::string& username, const std::string& password, uint8_t weaponKind) const
@@ -201,6 +208,11 @@ namespace rtp::client {
         return _availableRooms;
     }
 
+    game::PlayerPredictor& NetworkSyncSystem::getPredictor(void)
+    {
+        return _predictor;
+    }
+
     bool NetworkSyncSystem::isInGame(void) const
     {
         return _currentState == State::InGame;
@@ -333,6 +345,9 @@ namespace rtp::client {
             case net::OpCode::StartGame: {
                 log::info("Received StartGame notification from server.");
                 _currentState = State::InGame;
+                _interpolationClock.reset();
+                _predictor.reset();
+                _controlledNetId = 0;
                 break;
             }
             case net::OpCode::EntitySpawn: {
@@ -343,6 +358,14 @@ namespace rtp::client {
                 onEntityDeath(event.packet);
                 break;
             }
+            case net::OpCode::EntitySpawnBatch: {
+                onEntitySpawnBatch(event.packet);
+                break;
+            }
+            case net::OpCode::EntityDeathBatch: {
+                onEntityDeathBatch(event.packet);
+                break;
+            }
             case net::OpCode::RoomUpdate:
                 onRoomUpdate(event.packet);
                 break;
@@ -528,7 +551,22 @@ namespace rtp::client {
 
         log::info("Spawning entity from server: NetID={}, Type={}, Position=({}, {})",
             payload.netId, static_cast<int>(payload.type), payload.posX, payload.posY);
+        spawnEntity(payload);
+    }
+
+    void NetworkSyncSystem::onEntitySpawnBatch(net::Packet& packet)
+    {
+        packet >> _spawnBatch;
+
+        log::debug("Spawning {} entities from server batch", _spawnBatch.size());
+        _netIdToEntity.reserve(_netIdToEntity.size() + _spawnBatch.size());
+        for (const auto &payload : _spawnBatch) {
+            spawnEntity(payload);
+        }
+    }
 
+    void NetworkSyncSystem::spawnEntity(const net::EntitySpawnPayload& payload)
+    {
         const Vec2f pos{payload.posX, payload.posY};
 
         EntityTemplate t;
@@ -741,7 +779,21 @@ namespace rtp::client {
     {
         net::EntityDeathPayload payload{};
         packet >> payload;
+        applyEntityDeath(payload);
+    }
+
+    void NetworkSyncSystem::onEntityDeathBatch(net::Packet& packet)
+    {
+        packet >> _deathBatch;
+
+        log::debug("Removing {} entities from server batch", _deathBatch.size());
+        for (const auto &payload : _deathBatch) {
+            applyEntityDeath(payload);
+        }
+    }
 
+    void NetworkSyncSystem::applyEntityDeath(const net::EntityDeathPayload& payload)
+    {
         auto it = _netIdToEntity.find(payload.netId);
         if (it == _netIdToEntity.end()) {
             return;
@@ -821,76 +873,120 @@ namespace rtp::client {
         
         _registry.kill(entity);
         _netIdToEntity.erase(it);
+        _snapshotBuffers.erase(payload.netId);
+        if (payload.netId == _controlledNetId) {
+            _predictor.reset();
+            _controlledNetId = 0;
+        }
     }
 
     void NetworkSyncSystem::onRoomUpdate(net::Packet& packet)
     {
         net::RoomSnapshotPayload header{};
+        net::InputAckPayload ack{};
         std::vector<net::EntitySnapshotPayload> snapshots;
 
-        packet >> header >> snapshots;
+        packet >> header >> ack >> snapshots;
 
+        _interpolationClock.onSnapshot(header.serverTick, std::chrono::steady_clock::now());
+        if (ack.netId != _controlledNetId) {
+            _predictor.reset();
+            _controlledNetId = ack.netId;
+        }
         for (const auto& snap : snapshots) {
-            auto it = _netIdToEntity.find(snap.netId);
-            if (it == _netIdToEntity.end()) {
+            if (!_netIdToEntity.contains(snap.netId)) {
+                continue;
+            }
+            if (snap.netId == _controlledNetId) {
+                _predictor.reconcile(header.serverTick, ack.sequence, {snap.position, snap.velocity});
                 continue;
             }
+            _snapshotBuffers[snap.netId].push({
+                header.serverTick, snap.position, snap.velocity, snap.rotation
+            });
+        }
+    }
 
-            const ecs::Entity e = it->second;
+    void NetworkSyncSystem::applyInterpolation(float dt)
+    {
+        if (!_interpolationClock.isSynced())
+            return;
+
+        const double renderTick = _interpolationClock.advance(dt);
+        const float tickRate = _interpolationClock.getTickRate();
+
+        auto transformsOpt = _registry.get<ecs::components::Transform>();
+        if (!transformsOpt)
+            return;
+        auto &transforms = transformsOpt.value().get();
+
+        if (auto it = _netIdToEntity.find(_controlledNetId);
+            it != _netIdToEntity.end() && _predictor.isActive() && transforms.has(it->second)) {
+            const Vec2f position = _predictor.getRenderPosition();
+            transforms[it->second].position.x = position.x;
+            transforms[it->second].position.y = position.y;
+            if (_beamEntities.contains(_controlledNetId))
+                updateBeamTransforms(_controlledNetId, it->second, position);
+        }
 
-            auto transformsOpt = _registry.get<ecs::components::Transform>();
-            if (!transformsOpt)
+        net::SnapshotBuffer::Sample state{};
+        for (const auto& [netId, buffer] : _snapshotBuffers) {
+            auto it = _netIdToEntity.find(netId);
+            if (it == _netIdToEntity.end()) {
                 continue;
+            }
 
-            auto &transforms = transformsOpt.value().get();
-            if (!transforms.has(e))
+            const ecs::Entity e = it->second;
+            if (!transforms.has(e) || !buffer.sample(renderTick, tickRate, state))
                 continue;
 
-            transforms[e].position.x = snap.position.x;
-            transforms[e].position.y = snap.position.y;
-            transforms[e].rotation   = snap.rotation;
-            auto beamIt = _beamEntities.find(snap.netId);
-            if (beamIt != _beamEntities.end()) {
-                auto &vec = beamIt->second; // vector<pair<Entity, offsetY>>
-                if (auto tOpt2 = _registry.get<ecs::components::Transform>(); tOpt2) {
-                    auto &transforms2 = tOpt2.value().get();
-                    const float spriteW = 81.0f;
-
-                    // Compute frontOffset from player's sprite width
-                    float frontOffset = 20.0f;
-                    ecs::Entity ownerEntity = e;
-                    if (auto sOpt = _registry.get<ecs::components::Sprite>(); sOpt) {
-                        auto &sprites = sOpt.value().get();
-                        if (sprites.has(ownerEntity)) {
-                            const float playerSpriteW = static_cast<float>(sprites[ownerEntity].rectWidth);
-                            if (auto t3Opt = _registry.get<ecs::components::Transform>(); t3Opt) {
-                                auto &transforms3 = t3Opt.value().get();
-                                if (transforms3.has(ownerEntity)) {
-                                    const float playerScaleX = std::abs(transforms3[ownerEntity].scale.x);
-                                    frontOffset = (playerSpriteW * playerScaleX) * 0.5f + 4.0f;
-                                }
-                            }
-                        }
-                    }
+            transforms[e].position.x = state.position.x;
+            transforms[e].position.y = state.position.y;
+            transforms[e].rotation   = state.rotation;
+            if (_beamEntities.contains(netId))
+                updateBeamTransforms(netId, e, state.position);
+        }
+    }
 
-                    auto lenIt = _beamLengths.find(snap.netId);
-                    for (size_t i = 0; i < vec.size(); ++i) {
-                        ecs::Entity beamEntity = vec[i].first;
-                        float offsetY = vec[i].second;
-                        float length = 0.0f;
-                        if (lenIt != _beamLengths.end() && i < lenIt->second.size()) length = lenIt->second[i];
-
-                        if (!transforms2.has(beamEntity)) continue;
-                            float scaleMag = (length > 0.0f) ? (length / spriteW) : std::abs(transforms2[beamEntity].scale.x);
-                            transforms2[beamEntity].rotation = 0.0f;
-                            transforms2[beamEntity].scale.x = -std::abs(scaleMag);
-                            const float scaledWidth = spriteW * std::abs(transforms2[beamEntity].scale.x);
-                        transforms2[beamEntity].position.x = snap.position.x + frontOffset + (scaledWidth * 0.5f);
-                        transforms2[beamEntity].position.y = snap.position.y + offsetY;
-                    }
-                }
+    void NetworkSyncSystem::updateBeamTransforms(uint32_t ownerNetId, ecs::Entity ownerEntity, const Vec2f& position)
+    {
+        auto beamIt = _beamEntities.find(ownerNetId);
+        if (beamIt == _beamEntities.end())
+            return;
+
+        auto &vec = beamIt->second; // vector<pair<Entity, offsetY>>
+        auto tOpt = _registry.get<ecs::components::Transform>();
+        if (!tOpt)
+            return;
+        auto &transforms = tOpt.value().get();
+        const float spriteW = 81.0f;
+
+        // Compute frontOffset from player's sprite width
+        float frontOffset = 20.0f;
+        if (auto sOpt = _registry.get<ecs::components::Sprite>(); sOpt) {
+            auto &sprites = sOpt.value().get();
+            if (sprites.has(ownerEntity) && transforms.has(ownerEntity)) {
+                const float playerSpriteW = static_cast<float>(sprites[ownerEntity].rectWidth);
+                const float playerScaleX = std::abs(transforms[ownerEntity].scale.x);
+                frontOffset = (playerSpriteW * playerScaleX) * 0.5f + 4.0f;
             }
         }
+
+        auto lenIt = _beamLengths.find(ownerNetId);
+        for (size_t i = 0; i < vec.size(); ++i) {
+            ecs::Entity beamEntity = vec[i].first;
+            float offsetY = vec[i].second;
+            float length = 0.0f;
+            if (lenIt != _beamLengths.end() && i < lenIt->second.size()) length = lenIt->second[i];
+
+            if (!transforms.has(beamEntity)) continue;
+            float scaleMag = (length > 0.0f) ? (length / spriteW) : std::abs(transforms[beamEntity].scale.x);
+            transforms[beamEntity].rotation = 0.0f;
+            transforms[beamEntity].scale.x = -std::abs(scaleMag);
+            const float scaledWidth = spriteW * std::abs(transforms[beamEntity].scale.x);
+            transforms[beamEntity].position.x = position.x + frontOffset + (scaledWidth * 0.5f);
+            transforms[beamEntity].position.y = position.y + offsetY;
+        }
     }
 
     void NetworkSyncSystem::onRoomChatReceived(net::Packet& packet)
@@ -8,6 +8,8 @@
 #ifndef RTYPE_ECS_COMPONENTS_SERVER_INPUTCOMPONENT_HPP_
     #define RTYPE_ECS_COMPONENTS_SERVER_INPUTCOMPONENT_HPP_
 
+    #include "RType/Game/InputQueue.hpp"
+
     #include <cstdint>
 
 /**
@@ -38,6 +40,8 @@ namespace rtp::ecs::components::server
         uint8_t lastMask = 0;                      /**< Previous input mask for edge detection */
         uint32_t lastProcessedTick = 0;            /**< Last processed server tick for input */
         float chargeTime = 0.0f;                   /**< Accumulated charge time for shoot */
+        game::InputQueue pending;                  /**< Sequenced inputs not applied yet */
+        uint32_t lastInputSeq = 0;                 /**< Sequence of the applied input, acked in snapshots */
     };
 } // namespace rtp::ecs::components::server
 
@@ -8,6 +8,8 @@
 #ifndef RTYPE_ECS_COMPONENTS_NETWORKID_HPP_
     #define RTYPE_ECS_COMPONENTS_NETWORKID_HPP_
 
+    #include "RType/ECS/Entity.hpp"
+
     #include <cstdint>
 
 /**
@@ -20,7 +22,31 @@ namespace rtp::ecs::components {
      * @brief Component representing a network identifier for an entity.
      */
     struct NetworkId {
+        static constexpr uint32_t INDEX_BITS = 20;  /**< Entity index bits of an ID */
+        static constexpr uint32_t INDEX_MASK = (1u << INDEX_BITS) - 1;
+
         uint32_t id;     /**< Unique network identifier for the entity */
+
+        /**
+         * @brief Network identifier of an entity
+         * @param entity Entity of a room registry
+         * @return Index in the low bits, generation above, so a recycled
+         *         index never shows up under the ID of its previous entity
+         */
+        static constexpr uint32_t of(Entity entity)
+        {
+            return (entity.generation() << INDEX_BITS) | (entity.index() & INDEX_MASK);
+        }
+
+        /**
+         * @brief Entity index encoded in a network identifier
+         * @param id Identifier built by of()
+         * @return Entity index, the generation is left out
+         */
+        static constexpr uint32_t indexOf(uint32_t id)
+        {
+            return id & INDEX_MASK;
+        }
     };
 } // namespace rtp::ecs::components
 
@@ -15,6 +15,7 @@
     #include "RType/Logger.hpp"
     #include "RType/Error.hpp"
 
+    #include <algorithm>
     #include <array>
     #include <concepts>
     #include <deque>
@@ -44,6 +45,9 @@ namespace rtp::ecs
 
     class Registry {
         public:
+            // Index 0 is reserved: Entity(0, 0) is NullEntity, so the first
+            // spawned entity would otherwise read as "no entity".
+            Registry(void);
             ~Registry() noexcept = default;
 
             [[nodiscard]]
@@ -51,6 +55,17 @@ namespace rtp::ecs
 
             void kill(Entity entity);
 
+            // Next generation of a live entity, components are kept. Old
+            // handles die as after kill(), NullEntity if entity is dead.
+            [[nodiscard]]
+            Entity renew(Entity entity);
+
+            // Same as renew() for an entity whose only components are in
+            // arrays: they are rebound without visiting every array.
+            template <Component... Ts>
+            [[nodiscard]]
+            Entity renew(Entity entity, SparseArray<Ts> &...arrays);
+
             template <Component T, typename Self>
             auto subscribe(this Self &self)
                 -> std::expected<std::reference_wrapper<ConstLike<Self,
@@ -60,6 +75,11 @@ namespace rtp::ecs
             [[nodiscard]]
             bool isAlive(Entity entity) const noexcept;
 
+            // Handle holding an index now, NullEntity if the index was never
+            // spawned. A freed index is returned too: check a component.
+            [[nodiscard]]
+            Entity entityAt(std::uint32_t index) const noexcept;
+
             template <Component T, typename... Args>
             auto add(Entity entity, Args &&...args)
                 -> std::expected<std::reference_wrapper<T>, rtp::Error>;
@@ -99,9 +119,11 @@ namespace rtp::ecs
 
 
         private:
+            static constexpr std::size_t RESERVED_INDICES = 1; /**< Slot 0 backs NullEntity */
+
             std::unordered_map<std::type_index,
                                std::unique_ptr<ISparseArray>> _arrays; /**< Registered component arrays */
-            std::vector<std::uint32_t> _generations; /**< Generation counters for entities */
+            std::vector<std::uint32_t> _generations; /**< Generation counters for entities, slot 0 reserved */
             std::deque<std::size_t> _freeIndices; /**< Recyclable entity indices */
             mutable std::shared_mutex _mutex; /**< Mutex for thread-safe operations */
 
@@ -119,6 +141,12 @@ namespace rtp::ecs
             [[nodiscard]]
             bool hasAllComponents(Entity entity) const noexcept;
 
+            // Unlocked, checks renew(entity, arrays...) misses no component
+            template <Component... Ts>
+            [[nodiscard]]
+            bool holdsOnly(Entity entity,
+                           const SparseArray<Ts> &...arrays) const noexcept;
+
     };
 }
 
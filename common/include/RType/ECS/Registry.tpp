@@ -115,6 +115,27 @@ namespace rtp::ecs
         }
     }
 
+    template <Component... Ts>
+    Entity Registry::renew(Entity entity, SparseArray<Ts> &...arrays)
+    {
+        std::unique_lock lock{this->_mutex};
+
+        std::uint32_t idx = entity.index();
+
+        if (entity.isNull() || idx >= this->_generations.size() ||
+            this->_generations[idx] != entity.generation())
+            return NullEntity;
+
+        RTP_ASSERT(this->holdsOnly(entity, arrays...),
+                   "Registry: Entity {} holds a component renew() does not rebind",
+                   idx);
+
+        Entity renewed(idx, ++this->_generations[idx]);
+
+        (arrays.rebind(entity, renewed), ...);
+        return renewed;
+    }
+
     template <Component... Ts, typename Self>
     auto Registry::view(this Self &self)
     {
@@ -200,4 +221,14 @@ namespace rtp::ecs
     {
         return (... && this->has<Ts>(entity));
     }
+
+    template <Component... Ts>
+    bool Registry::holdsOnly(Entity entity,
+                             const SparseArray<Ts> &...arrays) const noexcept
+    {
+        return std::ranges::none_of(this->_arrays, [&](const auto &pair) {
+            const ISparseArray *array = pair.second.get();
+            return ((array != &arrays) && ...) && array->has(entity);
+        });
+    }
 }
@@ -74,6 +74,13 @@ namespace rtp::ecs
              * @return true if the entity has this component
              */
             virtual bool has(Entity entity) const = 0;
+
+            /**
+             * @brief Move a component to a new handle of the same index
+             * @param from The handle currently owning the component
+             * @param to The handle to own it, same index as from
+             */
+            virtual void rebind(Entity from, Entity to) = 0;
             
             /**
              * @brief Remove all components
@@ -121,6 +128,15 @@ namespace rtp::ecs
             [[nodiscard]]
             bool has(Entity entity) const noexcept override final;
 
+            /**
+             * @brief Move a component to a new handle of the same index
+             * @param from The handle currently owning the component
+             * @param to The handle to own it, same index as from
+             * @note The component value is kept, nothing is moved in the
+             * dense storage. Does nothing if from has no component.
+             */
+            void rebind(Entity from, Entity to) noexcept override final;
+
             /**
              * @brief Remove all components
              */
@@ -73,6 +73,19 @@ namespace rtp::ecs
             && this->_dense[this->_sparse[entity.index()]] == entity;
     }
 
+    template <Component T>
+    void SparseArray<T>::rebind(Entity from, Entity to) noexcept
+    {
+        RTP_ASSERT(from.index() == to.index(),
+                   "SparseArray: Cannot rebind entity {} to index {}",
+                   from.index(), to.index());
+
+        if (!this->has(from))
+            return;
+
+        this->_dense[this->_sparse[from.index()]] = to;
+    }
+
     template <Component T>
     void SparseArray<T>::clear(void) noexcept
     {
@@ -0,0 +1,93 @@
+/**
+ * File   : InputQueue.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_GAME_INPUTQUEUE_HPP_
+    #define RTYPE_GAME_INPUTQUEUE_HPP_
+
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+
+/**
+ * @namespace rtp::game
+ * @brief Gameplay rules shared by the server simulation and client prediction
+ */
+namespace rtp::game
+{
+    /**
+     * @class InputQueue
+     * @brief Sequenced player inputs waiting to be applied, one per tick
+     *
+     * Clients repeat their last few inputs in every datagram, so the same
+     * sequence usually arrives several times and sometimes out of order.
+     * Only sequences newer than everything queued so far are accepted,
+     * which applies each input once and in order whatever the network did.
+     *
+     * Every accepted input is applied: the server's ack never runs ahead
+     * of the steps it simulated, so the client predictor replays exactly
+     * what the server did. A backlog left by jitter or a loss burst is
+     * drained CATCH_UP inputs per tick instead of being skipped. Only a
+     * burst past CAPACITY loses inputs.
+     */
+    class InputQueue final {
+        public:
+            static constexpr size_t CAPACITY = 16;      /**< Inputs buffered at most */
+            static constexpr size_t MAX_BACKLOG = 4;    /**< Queued inputs above which the queue is behind */
+            static constexpr size_t CATCH_UP = 2;       /**< Inputs applied per tick while behind */
+
+            /**
+             * @struct Input
+             * @brief Input mask of one client step
+             */
+            struct Input {
+                uint32_t sequence = 0;  /**< Client step counter */
+                uint8_t mask = 0;       /**< Input mask of that step */
+            };
+
+            /**
+             * @brief Queue an input unless it was already seen
+             * @param input Received input
+             * @return false if its sequence is not newer than the newest queued
+             * @note When full, the oldest input is dropped
+             */
+            bool push(const Input &input);
+
+            /**
+             * @brief Number of inputs to apply this tick
+             * @return 0 when empty, CATCH_UP above MAX_BACKLOG, 1 otherwise
+             * @note Each one is a full step of its own, see PlayerMouvementSystem
+             */
+            size_t due(void) const;
+
+            /**
+             * @brief Take the oldest queued input
+             * @param out Oldest queued input
+             * @return false if nothing is queued
+             */
+            bool pop(Input &out);
+
+            /**
+             * @brief Number of queued inputs
+             * @return Queue size
+             */
+            size_t size(void) const;
+
+            /**
+             * @brief Newest sequence ever accepted
+             * @return Sequence, 0 before the first input
+             */
+            uint32_t getNewest(void) const;
+
+        private:
+            std::array<Input, CAPACITY> _inputs{};  /**< Ring of queued inputs */
+            size_t _head = 0;                       /**< Index of the oldest input */
+            size_t _count = 0;                      /**< Number of queued inputs */
+            uint32_t _newest = 0;                   /**< Newest sequence accepted */
+    };
+}
+
+#endif /* !RTYPE_GAME_INPUTQUEUE_HPP_ */
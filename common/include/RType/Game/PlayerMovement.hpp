@@ -0,0 +1,67 @@
+/**
+ * File   : PlayerMovement.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_GAME_PLAYERMOVEMENT_HPP_
+    #define RTYPE_GAME_PLAYERMOVEMENT_HPP_
+
+    #include "RType/Math/Vec2.hpp"
+
+    #include <cstdint>
+
+/**
+ * @namespace rtp::game
+ * @brief Gameplay rules shared by the server simulation and client prediction
+ */
+namespace rtp::game
+{
+    constexpr float PLAYER_SPEED = 200.0f;      /**< Base player speed, units per second */
+    constexpr float PLAYER_WIDTH = 32.0f;       /**< Player bounding box width */
+    constexpr float PLAYER_HEIGHT = 16.0f;      /**< Player bounding box height */
+    constexpr float PLAYER_ACCEL = 8.0f;        /**< Velocity convergence rate while steering */
+    constexpr float PLAYER_DECEL = 10.0f;       /**< Velocity convergence rate when released */
+    constexpr float ARENA_WIDTH = 1280.0f;      /**< Width players are kept in */
+    constexpr float ARENA_HEIGHT = 720.0f;      /**< Height players are kept in */
+
+    /**
+     * @struct PlayerMotion
+     * @brief Kinematic state of a player ship
+     */
+    struct PlayerMotion {
+        Vec2f position{};   /**< Top-left corner of the ship */
+        Vec2f velocity{};   /**< Velocity, units per second */
+    };
+
+    /**
+     * @brief Steer a player's velocity toward the direction its input asks for
+     * @param velocity Velocity to update, units per second
+     * @param mask Input mask, InputComponent::InputBits
+     * @param speed Top speed, units per second
+     * @param dt Tick duration in seconds
+     */
+    void steerPlayer(Vec2f &velocity, uint8_t mask, float speed, float dt);
+
+    /**
+     * @brief Keep a player's bounding box inside the arena
+     * @param position Top-left corner to clamp
+     * @param width Bounding box width
+     * @param height Bounding box height
+     */
+    void clampToArena(Vec2f &position, float width, float height);
+
+    /**
+     * @brief Simulate one server tick of a player's movement
+     * @param motion State to advance
+     * @param mask Input mask applied during the tick
+     * @param speed Top speed, units per second
+     * @param dt Tick duration in seconds
+     * @note Same order as the server tick: PlayerMouvementSystem steers,
+     *       then MovementSystem integrates and clamps.
+     */
+    void stepPlayer(PlayerMotion &motion, uint8_t mask, float speed, float dt);
+}
+
+#endif /* !RTYPE_GAME_PLAYERMOVEMENT_HPP_ */
@@ -0,0 +1,116 @@
+/**
+ * File   : PlayerPredictor.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_GAME_PLAYERPREDICTOR_HPP_
+    #define RTYPE_GAME_PLAYERPREDICTOR_HPP_
+
+    #include "RType/Game/PlayerMovement.hpp"
+
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+
+/**
+ * @namespace rtp::game
+ * @brief Gameplay rules shared by the server simulation and client prediction
+ */
+namespace rtp::game
+{
+    /**
+     * @class PlayerPredictor
+     * @brief Client-side prediction of the locally controlled ship
+     *
+     * Input is sampled at the server tick rate; every step gets a sequence
+     * number, is sent to the server and simulated locally with the server's
+     * movement rules. Snapshots ack the last sequence the server applied:
+     * the prediction restarts from that authoritative state and replays the
+     * steps the server has not seen yet. The difference to the previous
+     * prediction is blended out over a few frames instead of snapped.
+     */
+    class PlayerPredictor final {
+        public:
+            static constexpr float STEP = 1.0f / 60.0f;         /**< One server tick, in seconds */
+            static constexpr size_t HISTORY = 128;              /**< Unacked steps that can be replayed */
+            static constexpr size_t MAX_STEPS = 8;              /**< Steps simulated per frame at most */
+            static constexpr float SNAP_DISTANCE = 64.0f;       /**< Larger corrections are not smoothed */
+            static constexpr float CORRECTION_DECAY = 15.0f;    /**< Correction blend-out rate, per second */
+
+            /**
+             * @brief Sample input for the elapsed frame time
+             * @param dt Frame time in seconds
+             * @param mask Input mask held during the frame
+             * @return Number of steps taken; they carry the sequences
+             *         getSequence() - n + 1 to getSequence(), all with mask
+             */
+            size_t advance(float dt, uint8_t mask);
+
+            /**
+             * @brief Correct the prediction with the server's state of the ship
+             * @param serverTick Tick of the snapshot, older snapshots are ignored
+             * @param ackSequence Last input sequence the server applied
+             * @param server Ship state in that snapshot
+             */
+            void reconcile(uint32_t serverTick, uint32_t ackSequence, const PlayerMotion &server);
+
+            /**
+             * @brief Stop predicting until the next reconcile
+             * @note Sequence numbers keep increasing, the server drops stale ones
+             */
+            void reset(void);
+
+            /**
+             * @brief Whether the prediction has been seeded by the server
+             * @return true once a snapshot was reconciled
+             */
+            bool isActive(void) const;
+
+            /**
+             * @brief Newest input sequence
+             * @return Sequence of the last step taken
+             */
+            uint32_t getSequence(void) const;
+
+            /**
+             * @brief Input mask of a recent step
+             * @param sequence Step sequence, at most HISTORY steps old
+             * @return Mask sampled for that step
+             */
+            uint8_t getInput(uint32_t sequence) const;
+
+            /**
+             * @brief Predicted state after the last step
+             * @return Ship state
+             */
+            const PlayerMotion &getMotion(void) const;
+
+            /**
+             * @brief Position to draw this frame
+             * @return Predicted position, interpolated within the current step
+             *         and offset by the correction being blended out
+             */
+            Vec2f getRenderPosition(void) const;
+
+        private:
+            /**
+             * @brief Predicted position without the correction offset
+             * @return Position interpolated within the current step
+             */
+            Vec2f _interpolatedPosition(void) const;
+
+        private:
+            std::array<uint8_t, HISTORY> _masks{};  /**< Input mask of each step, by sequence */
+            uint32_t _sequence = 0;                 /**< Newest sequence */
+            uint32_t _serverTick = 0;               /**< Tick of the last reconciled snapshot */
+            bool _active = false;                   /**< Seeded by a snapshot */
+            float _accumulator = 0.0f;              /**< Frame time not simulated yet */
+            PlayerMotion _motion{};                 /**< State after the newest step */
+            PlayerMotion _previous{};               /**< State before the newest step */
+            Vec2f _correction{};                    /**< Render offset left by the last correction */
+    };
+}
+
+#endif /* !RTYPE_GAME_PLAYERPREDICTOR_HPP_ */
@@ -8,7 +8,9 @@
 #ifndef RTYPE_NETWORK_INETWORK_HPP_
     #define RTYPE_NETWORK_INETWORK_HPP_
 
+    #include <cstddef>
     #include <optional>
+    #include <span>
     #include "RType/Network/Packet.hpp"
 
 /**
@@ -20,11 +22,14 @@ namespace rtp::net {
     /**
      * @enum NetworkMode
      * @brief Enum representing network transmission modes
-     * @note TCP will be used for reliable data, UDP for real-time data
+     * @note TCP is kept for login and lobby traffic, UDP for real-time
+     *       snapshots, ReliableUDP for gameplay events that must arrive in
+     *       order without head-of-line blocking the snapshots
      */
     enum class NetworkMode {
         TCP,
-        UDP
+        UDP,
+        ReliableUDP
     };
 
     /**
@@ -36,6 +41,12 @@ namespace rtp::net {
         Packet packet;
     };
 
+    /**
+     * @brief Capacity of the lock-free queue between the I/O threads and the game thread
+     * @note Events published while the queue is full are dropped
+     */
+    constexpr size_t EVENT_QUEUE_CAPACITY = 16384;
+
     /**
      * @class INetwork
      * @brief Interface for network operations
@@ -67,6 +78,13 @@ namespace rtp::net {
              * @return True if an event was polled, false otherwise
              */
             virtual std::optional<NetworkEvent> pollEvent(void) = 0;
+
+            /**
+             * @brief Drain up to out.size() network events in one call
+             * @param out Slots the events are moved into, oldest first
+             * @return Number of events written to out
+             */
+            virtual size_t pollEvents(std::span<NetworkEvent> out) = 0;
     };
 }
 
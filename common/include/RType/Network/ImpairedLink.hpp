@@ -0,0 +1,155 @@
+/**
+ * File   : ImpairedLink.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_NETWORK_IMPAIREDLINK_HPP_
+    #define RTYPE_NETWORK_IMPAIREDLINK_HPP_
+
+    #include <array>
+    #include <chrono>
+    #include <cstddef>
+    #include <cstdint>
+    #include <random>
+
+/**
+ * @namespace rtp::net
+ * @brief Network layer for R-Type protocol
+ */
+namespace rtp::net
+{
+    /**
+     * @struct Impairment
+     * @brief Conditions applied to one direction of a simulated link
+     */
+    struct Impairment {
+        std::chrono::microseconds delay{0};         /**< One-way base latency */
+        std::chrono::microseconds jitter{0};        /**< Latency varies by up to this much either way */
+        double loss = 0.0;                          /**< Probability a datagram is dropped */
+        double duplicate = 0.0;                     /**< Probability a datagram is delivered twice */
+        double reorder = 0.0;                       /**< Probability a datagram is held back */
+        std::chrono::microseconds reorderGap{20000};/**< Extra latency of a held back datagram */
+        uint64_t bandwidth = 0;                     /**< Bytes per second, 0 for unlimited */
+        size_t queueLimit = 64 * 1024;              /**< Bytes queued behind the cap before datagrams are dropped */
+    };
+
+    /**
+     * @class ImpairedLink
+     * @brief Decides when, and whether, traffic crosses a bad network
+     *
+     * The link does no I/O: it is given the time a packet is sent and
+     * returns the time it arrives. A proxy drives it with the real clock;
+     * tests drive it with virtual time, which makes runs reproducible for
+     * a given seed.
+     *
+     * Datagrams can be lost, duplicated or held back. Stream chunks are
+     * never lost or reordered, like TCP: a chunk that would be lost waits
+     * for a retransmission instead and holds back everything behind it.
+     * Both share the bandwidth cap, modelled as a serialisation queue.
+     */
+    class ImpairedLink final {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            static constexpr Clock::duration MIN_RETRANSMIT =
+                std::chrono::milliseconds(200);     /**< Retransmission timeout floor of a lost stream chunk */
+
+            /**
+             * @struct Stats
+             * @brief What the link did to the traffic so far
+             */
+            struct Stats {
+                uint64_t packets = 0;       /**< Datagrams and chunks submitted */
+                uint64_t delivered = 0;     /**< Copies scheduled for delivery */
+                uint64_t bytes = 0;         /**< Bytes scheduled for delivery */
+                uint64_t dropped = 0;       /**< Datagrams lost or tail dropped */
+                uint64_t duplicated = 0;    /**< Datagrams delivered twice */
+                uint64_t reordered = 0;     /**< Datagrams held back */
+                uint64_t retransmits = 0;   /**< Stream chunks delayed by a simulated loss */
+            };
+
+            /**
+             * @brief Constructor for ImpairedLink
+             * @param impairment Conditions to apply
+             * @param seed Seed of the random decisions
+             */
+            explicit ImpairedLink(const Impairment &impairment = {}, uint32_t seed = 1);
+
+            /**
+             * @brief Change the conditions, effective for the next packet
+             * @param impairment Conditions to apply
+             */
+            void setImpairment(const Impairment &impairment);
+
+            /**
+             * @brief Conditions in effect
+             * @return Impairment
+             */
+            const Impairment &getImpairment(void) const;
+
+            /**
+             * @brief Schedule a datagram
+             * @param now Time it is sent
+             * @param bytes Datagram size
+             * @param out Arrival time of each copy
+             * @return Number of copies written to out: 0 when lost, 2 when duplicated
+             */
+            size_t scheduleDatagram(Clock::time_point now, size_t bytes,
+                                    std::array<Clock::time_point, 2> &out);
+
+            /**
+             * @brief Schedule a chunk of a byte stream
+             * @param now Time it is sent
+             * @param bytes Chunk size
+             * @return Arrival time, never before the previous chunk's
+             */
+            Clock::time_point scheduleStream(Clock::time_point now, size_t bytes);
+
+            /**
+             * @brief Counters since construction
+             * @return Stats
+             */
+            Stats getStats(void) const;
+
+        private:
+            /**
+             * @brief Put bytes through the bandwidth cap
+             * @param now Time they are sent
+             * @param bytes Size
+             * @return Time the last byte leaves the queue
+             */
+            Clock::time_point _serialize(Clock::time_point now, size_t bytes);
+
+            /**
+             * @brief Whether the cap's queue is too full for a datagram
+             * @param now Time it is sent
+             * @param bytes Datagram size
+             * @return true if it must be tail dropped
+             */
+            bool _queueFull(Clock::time_point now, size_t bytes) const;
+
+            /**
+             * @brief Draw a one-way latency
+             * @return delay with jitter applied, never negative
+             */
+            Clock::duration _latency(void);
+
+            /**
+             * @brief Draw a random decision
+             * @param probability Chance of returning true
+             * @return Outcome
+             */
+            bool _chance(double probability);
+
+        private:
+            Impairment _impairment;                 /**< Conditions in effect */
+            std::mt19937 _rng;                      /**< Source of every random decision */
+            Clock::time_point _linkFree{};          /**< When the cap's queue is empty */
+            Clock::time_point _lastStream{};        /**< Arrival of the previous stream chunk */
+            Stats _stats{};                         /**< Counters */
+    };
+}
+
+#endif /* !RTYPE_NETWORK_IMPAIREDLINK_HPP_ */
@@ -16,6 +16,8 @@
 
     #include "RType/ECS/ComponentConcept.hpp"
     #include "RType/Math/Vec2.hpp"
+    #include "RType/Network/PacketBufferPool.hpp"
+    #include "RType/Network/PacketSchema.hpp"
 
     #include <bit>
     #include <cstdint>
@@ -71,6 +73,12 @@ namespace rtp::net
      */
     constexpr uint32_t MAX_BODY_SIZE   = 64 * 1024;
 
+    /**
+     * @brief Maximum entities per EntitySpawnBatch / EntityDeathBatch packet
+     * @note 48 spawn payloads (22 bytes each) keep a batch under MTU_SIZE
+     */
+    constexpr uint32_t ENTITY_BATCH_SIZE = 48;
+
     /**
      * @enum OpCode
      * @brief Operation codes for different packet types
@@ -102,7 +110,7 @@ namespace rtp::net
         StartGame = 0x0D,               /**< Notification to start the game */
 
         // Gameplay (C -> S)
-        InputTick = 0x10,               /**< Client input state */
+        InputTick = 0x10,               /**< Client input history, vector of InputPayload */
         UpdateSelectedWeapon = 0x11,    /**< Client selected weapon changed */
 
         // Game State (S -> C)
@@ -118,7 +126,12 @@ namespace rtp::net
         BeamState = 0x28,              /**< Beam start/stop notification */
         ScoreUpdate = 0x29,            /**< Player score update */
         GameOver = 0x2A,               /**< Game over summary */
-        HealthUpdate = 0x2B            /**< Player health update */
+        HealthUpdate = 0x2B,           /**< Player health update */
+        EntitySpawnBatch = 0x2C,       /**< Vector of EntitySpawnPayload emitted at tick end */
+        EntityDeathBatch = 0x2D,       /**< Vector of EntityDeathPayload emitted at tick end */
+
+        // Transport
+        Reliable = 0x30                /**< Bundle of reliable-ordered messages over UDP */
     };
 
     #pragma pack(push, 1)
@@ -301,6 +314,17 @@ namespace rtp::net
         uint8_t inGame;                 /**< Is the game in progress */
     };
 
+    /**
+     * @struct InputAckPayload
+     * @brief Receiver's own ship and the last input the server applied to it
+     * @callergraph Server
+     * @related RoomUpdate OpCode, sent between RoomSnapshotPayload and the snapshots
+     */
+    struct InputAckPayload {
+        uint32_t netId;                 /**< Ship controlled by the receiver, 0 if none */
+        uint32_t sequence;              /**< Last applied InputPayload::sequence */
+    };
+
     /**
      * @struct SetReadyPayload
      * @brief Data for setting player readiness status
@@ -464,6 +488,7 @@ namespace rtp::net
      */
     struct InputPayload {
         uint8_t inputMask;              /**< Bitmask of input states */
+        uint32_t sequence{0};           /**< Client step counter, 0 if unsequenced */
     };
 
     /**
@@ -480,8 +505,9 @@ namespace rtp::net
 
             /**
              * @brief Default constructor
+             * @note The body is taken from the PacketBufferPool
              */
-            Packet() = default;
+            Packet();
             
             /**
              * @brief Construct packet with specific operation code
@@ -489,6 +515,37 @@ namespace rtp::net
              */
             explicit Packet(OpCode op);
 
+            /**
+             * @brief Copy constructor, copies the body into a pooled buffer
+             * @param other Packet to copy
+             */
+            Packet(const Packet &other);
+
+            /**
+             * @brief Move constructor, steals the body buffer
+             * @param other Packet to move from
+             */
+            Packet(Packet &&other) noexcept;
+
+            /**
+             * @brief Copy assignment, reuses the current body capacity
+             * @param other Packet to copy
+             * @return Reference to this packet
+             */
+            Packet &operator=(const Packet &other);
+
+            /**
+             * @brief Move assignment, recycles the current body buffer
+             * @param other Packet to move from
+             * @return Reference to this packet
+             */
+            Packet &operator=(Packet &&other) noexcept;
+
+            /**
+             * @brief Destructor, gives the body buffer back to the pool
+             */
+            ~Packet();
+
             /**
              * @brief Reset read position to beginning of body
              */
@@ -552,6 +609,7 @@ namespace rtp::net
              * @tparam T Serializable type
              * @param vec Vector to serialize
              * @return Reference to this packet for chaining
+             * @note Arrays of schema::IS_BULK types are copied and byte-swapped in one pass
              */
             template <typename T>
             auto operator<<(const std::vector<T> &vec) -> Packet &;
@@ -588,9 +646,68 @@ namespace rtp::net
              */
             auto operator>>(std::string &str) -> Packet &;
 
+            /**
+             * @brief Append raw bytes to the body, without length prefix or byte swap
+             * @param bytes Bytes to append
+             * @throw std::length_error if the body would exceed MAX_BODY_SIZE
+             */
+            void writeBytes(std::span<const uint8_t> bytes);
+
+            /**
+             * @brief Read raw bytes from the body and advance the read position
+             * @param size Number of bytes to read
+             * @return View into the body, valid until the body is modified
+             * @throw std::out_of_range if the body is too short
+             */
+            std::span<const uint8_t> readBytes(size_t size);
+
         private:
-            void _bumpBodySizeOrThrow(); /**< Increment body size and check for overflow */
-            
+            /**
+             * @brief Grow the body by size bytes, bounded by MAX_BODY_SIZE
+             * @param size Number of bytes about to be written
+             * @return Pointer to the first byte of the grown region
+             * @throw std::length_error if the body would exceed MAX_BODY_SIZE
+             */
+            uint8_t *_bumpBodySizeOrThrow(size_t size);
+
+            /**
+             * @brief Check that size bytes can be read from the current position
+             * @param size Number of bytes about to be read
+             * @return Pointer to the first byte to read
+             * @throw std::out_of_range if the body is too short
+             */
+            const uint8_t *_readableOrThrow(size_t size) const;
+
+            /**
+             * @brief Serialize a fixed char array as a length-prefixed string
+             * @param str Null-terminated (or full) char array
+             */
+            template <size_t N>
+            void _writeFixedString(const char (&str)[N]);
+
+            /**
+             * @brief Deserialize a length-prefixed string straight into a char array
+             * @param str Destination array, always null-terminated and zero-padded
+             * @note Longer strings are truncated, the read position still skips them
+             */
+            template <size_t N>
+            void _readFixedString(char (&str)[N]);
+
+            /**
+             * @brief Serialize a payload from its Schema
+             * @param data Payload to serialize
+             * @note Fixed-size payloads grow the body once and are encoded in place
+             */
+            template <typename T>
+            void _writeSchema(const T &data);
+
+            /**
+             * @brief Deserialize a payload from its Schema
+             * @param data Payload to fill
+             */
+            template <typename T>
+            void _readSchema(T &data);
+
             size_t _readPos = 0;         /**< Current read position in body */
 
             mutable Header _cacheHeader; /**< Cached header with network endianness */
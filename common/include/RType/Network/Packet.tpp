@@ -6,605 +6,399 @@
 */
 
 #pragma once
+#include <algorithm>
 #include <cstring>
 #include <stdexcept>
 #include <vector>
 #include <string>
+#include <tuple>
 #include <type_traits>
 
 namespace rtp::net
 {
     ///////////////////////////////////////////////////////////////////////////
-    // Simple Template Implementations
+    // Payload Schemas
     ///////////////////////////////////////////////////////////////////////////
 
-    template <typename T>
-    auto Packet::operator<<(T data) -> Packet &
-    {
-        T network_data = to_network(data);
-
-        size_t dataSize = sizeof(T);
-        size_t currentSize = body.size();
-        body.resize(currentSize + dataSize);
-
-        std::memcpy(body.data() + currentSize, &network_data, dataSize);
-
-        header.bodySize = static_cast<uint32_t>(body.size());
-
-        return *this;
-    }
-
-    template <typename T>
-    auto Packet::operator>>(T &data) -> Packet &
-    {
-        if (_readPos + sizeof(T) > body.size()) {
-            throw std::out_of_range("Packet read overflow");
-        }
-
-        T network_data{};
-        std::memcpy(&network_data, body.data() + _readPos, sizeof(T));
-        _readPos += sizeof(T);
-
-        data = from_network(network_data);
-
-        return *this;
-    }
-
-    //////////////////////////////////////////////////////////////////////////
-    // Specialized Template Implementations
-    //////////////////////////////////////////////////////////////////////////
-
-    template <typename T>
-    inline auto Packet::operator<<(const std::vector<T> &vec) -> Packet &
-    {
-        uint32_t vecSize = static_cast<uint32_t>(vec.size());
-        *this << vecSize;
-        for (const auto &item : vec) {
-            *this << item;
-        }
-        return *this;
-    }
-
-    template <typename T>
-    inline auto Packet::operator>>(std::vector<T> &vec) -> Packet &
-    {
-        uint32_t vecSize;
-        *this >> vecSize;
-
-        vec.clear();
-        if (vecSize > 4096) throw std::runtime_error("Vector too large");
-        vec.reserve(vecSize);
-
-        for (uint32_t i = 0; i < vecSize; ++i) {
-            T item{};
-            *this >> item;
-            vec.push_back(std::move(item));
-        }
-        return *this;
-    }
-
-    inline auto Packet::operator<<(std::string_view str) -> Packet &
-    {
-        uint32_t strSize = static_cast<uint32_t>(str.size());
-
-        *this << strSize;
-
-        size_t currentSize = body.size();
-        body.resize(currentSize + strSize);
-
-        std::memcpy(body.data() + currentSize, str.data(), strSize);
-
-        header.bodySize = static_cast<uint32_t>(body.size());
-
-        return *this;
-    }
-
-    inline auto Packet::operator>>(std::string &str) -> Packet &
-    {
-        uint32_t strSize;
-        *this >> strSize;
-
-        if (strSize > 4096) throw std::runtime_error("String too large");
-
-        if (_readPos + strSize > body.size()) {
-            throw std::out_of_range("Packet read overflow");
-        }
-
-        str.assign(reinterpret_cast<const char *>(body.data() + _readPos), strSize);
-        _readPos += strSize;
-        return *this;
-    }
-
-    //////////////////////////////////////////////////////////////////////////
-    // Batching Operations
-    //////////////////////////////////////////////////////////////////////////
-
     template <>
-    inline auto Packet::operator<<(ConnectPayload data) -> Packet &
-    {
-        *this << data.sessionId;
-        return *this;
-    }
+    struct Schema<Vec2f> {
+        static constexpr auto fields = std::tuple{&Vec2f::x, &Vec2f::y};
+    };
 
     template <>
-    inline auto Packet::operator>>(ConnectPayload &data) -> Packet &
-    {
-        *this >> data.sessionId;
-        return *this;
-    }
+    struct Schema<ConnectPayload> {
+        static constexpr auto fields = std::tuple{&ConnectPayload::sessionId};
+    };
 
     template <>
-    inline auto Packet::operator<<(LoginPayload data) -> Packet &
-    {
-        *this << std::string_view(data.username, strnlen(data.username, sizeof(data.username)));
-        *this << std::string_view(data.password, strnlen(data.password, sizeof(data.password)));
-        *this << data.weaponKind;
-        return *this;
-    }
+    struct Schema<BooleanPayload> {
+        static constexpr auto fields = std::tuple{&BooleanPayload::status};
+    };
 
     template <>
-    inline auto Packet::operator>>(LoginPayload &data) -> Packet &
-    {
-        std::string username;
-        std::string password;
-        *this >> username;
-        *this >> password;
-        std::strncpy(data.username, username.c_str(), sizeof(data.username));
-        data.username[sizeof(data.username) - 1] = '\0';
-        std::strncpy(data.password, password.c_str(), sizeof(data.password));
-        data.password[sizeof(data.password) - 1] = '\0';
-        *this >> data.weaponKind;
-        return *this;
-    }
+    struct Schema<LoginPayload> {
+        static constexpr auto fields = std::tuple{
+            &LoginPayload::username, &LoginPayload::password, &LoginPayload::weaponKind};
+    };
 
     template <>
-    inline auto Packet::operator<<(RegisterPayload data) -> Packet &
-    {
-        *this << std::string_view(data.username, strnlen(data.username, sizeof(data.username)));
-        *this << std::string_view(data.password, strnlen(data.password, sizeof(data.password)));
-        return *this;
-    }
+    struct Schema<RegisterPayload> {
+        static constexpr auto fields = std::tuple{
+            &RegisterPayload::username, &RegisterPayload::password};
+    };
 
     template <>
-    inline auto Packet::operator>>(RegisterPayload &data) -> Packet &
-    {
-        std::string username;
-        std::string password;
-        *this >> username;
-        *this >> password;
-        std::strncpy(data.username, username.c_str(), sizeof(data.username));
-        data.username[sizeof(data.username) - 1] = '\0';
-        std::strncpy(data.password, password.c_str(), sizeof(data.password));
-        data.password[sizeof(data.password) - 1] = '\0';
-        return *this;
-    }
+    struct Schema<LoginResponsePayload> {
+        static constexpr auto fields = std::tuple{
+            &LoginResponsePayload::success, &LoginResponsePayload::username};
+    };
 
     template <>
-    inline auto Packet::operator<<(LoginResponsePayload data) -> Packet &
-    {
-        *this << data.success;
-        *this << std::string_view(data.username, strnlen(data.username, sizeof(data.username)));
-        return *this;
-    }
+    struct Schema<RegisterResponsePayload> {
+        static constexpr auto fields = std::tuple{
+            &RegisterResponsePayload::success, &RegisterResponsePayload::username};
+    };
 
+    /** roomType is not part of the RoomList wire format */
     template <>
-    inline auto Packet::operator>>(LoginResponsePayload &data) -> Packet &
-    {
-        *this >> data.success;
-        std::string username;
-        *this >> username;
-        std::strncpy(data.username, username.c_str(), sizeof(data.username));
-        data.username[sizeof(data.username) - 1] = '\0';
-        return *this;
-    }
+    struct Schema<RoomInfo> {
+        static constexpr auto fields = std::tuple{
+            &RoomInfo::roomId, &RoomInfo::roomName, &RoomInfo::currentPlayers,
+            &RoomInfo::maxPlayers, &RoomInfo::inGame, &RoomInfo::difficulty,
+            &RoomInfo::speed, &RoomInfo::duration, &RoomInfo::seed, &RoomInfo::levelId};
+    };
 
     template <>
-    inline auto Packet::operator<<(RegisterResponsePayload data) -> Packet &
-    {
-        *this << data.success;
-        *this << std::string_view(data.username, strnlen(data.username, sizeof(data.username)));
-        return *this;
-    }
+    struct Schema<CreateRoomPayload> {
+        static constexpr auto fields = std::tuple{
+            &CreateRoomPayload::roomName, &CreateRoomPayload::maxPlayers,
+            &CreateRoomPayload::difficulty, &CreateRoomPayload::speed,
+            &CreateRoomPayload::levelId, &CreateRoomPayload::seed,
+            &CreateRoomPayload::duration, &CreateRoomPayload::roomType};
+    };
 
     template <>
-    inline auto Packet::operator>>(RegisterResponsePayload &data) -> Packet &
-    {
-        *this >> data.success;
-        std::string username;
-        *this >> username;
-        std::strncpy(data.username, username.c_str(), sizeof(data.username));
-        data.username[sizeof(data.username) - 1] = '\0';
-        return *this;
-    }
+    struct Schema<JoinRoomPayload> {
+        static constexpr auto fields = std::tuple{
+            &JoinRoomPayload::roomId, &JoinRoomPayload::isSpectator};
+    };
 
     template <>
-    inline auto Packet::operator<<(RoomInfo data) -> Packet &
-    {
-        *this << data.roomId;
-        *this << std::string_view(data.roomName, strnlen(data.roomName, sizeof(data.roomName)));
-        *this << data.currentPlayers;
-        *this << data.maxPlayers;
-        *this << data.inGame;
-        *this << data.difficulty;
-        *this << data.speed;
-        *this << data.duration;
-        *this << data.seed;
-        *this << data.levelId;
-        return *this;
-    }
+    struct Schema<RoomSnapshotPayload> {
+        static constexpr auto fields = std::tuple{
+            &RoomSnapshotPayload::roomId, &RoomSnapshotPayload::currentPlayers,
+            &RoomSnapshotPayload::serverTick, &RoomSnapshotPayload::entityCount,
+            &RoomSnapshotPayload::inGame};
+    };
 
     template <>
-    inline auto Packet::operator>>(RoomInfo &data) -> Packet &
-    {
-        *this >> data.roomId;
-
-        std::string roomName;
-        *this >> roomName;
-        std::strncpy(data.roomName, roomName.c_str(), sizeof(data.roomName));
-        data.roomName[sizeof(data.roomName) - 1] = '\0';
-
-        *this >> data.currentPlayers;
-        *this >> data.maxPlayers;
-        *this >> data.inGame;
-        *this >> data.difficulty;
-        *this >> data.speed;
-        *this >> data.duration;
-        *this >> data.seed;
-        *this >> data.levelId;
-        return *this;
-    }
+    struct Schema<InputAckPayload> {
+        static constexpr auto fields = std::tuple{&InputAckPayload::netId,
+                                                  &InputAckPayload::sequence};
+    };
 
     template <>
-    inline auto Packet::operator<<(CreateRoomPayload data) -> Packet &
-    {
-        *this << std::string_view(data.roomName, strnlen(data.roomName, sizeof(data.roomName)));
-        *this << data.maxPlayers;
-        *this << data.difficulty;
-        *this << data.speed;
-        *this << data.levelId;
-        *this << data.seed;
-        *this << data.duration;
-        *this << data.roomType;
-        return *this;
-    }
+    struct Schema<SetReadyPayload> {
+        static constexpr auto fields = std::tuple{&SetReadyPayload::isReady};
+    };
 
     template <>
-    inline auto Packet::operator>>(CreateRoomPayload &data) -> Packet &
-    {
-        std::string roomName;
-        *this >> roomName;
-        std::strncpy(data.roomName, roomName.c_str(), sizeof(data.roomName));
-        data.roomName[sizeof(data.roomName) - 1] = '\0';
-
-        *this >> data.maxPlayers;
-        *this >> data.difficulty;
-        *this >> data.speed;
-        *this >> data.levelId;
-        *this >> data.seed;
-        *this >> data.duration;
-        *this >> data.roomType;
-        return *this;
-    }
+    struct Schema<RoomChatPayload> {
+        static constexpr auto fields = std::tuple{&RoomChatPayload::message};
+    };
 
     template <>
-    inline auto Packet::operator<<(JoinRoomPayload data) -> Packet &
-    {
-        *this << data.roomId;
-        *this << data.isSpectator;
-        return *this;
-    }
+    struct Schema<RoomChatReceivedPayload> {
+        static constexpr auto fields = std::tuple{
+            &RoomChatReceivedPayload::sessionId, &RoomChatReceivedPayload::username,
+            &RoomChatReceivedPayload::message};
+    };
 
     template <>
-    inline auto Packet::operator>>(JoinRoomPayload &data) -> Packet &
-    {
-        *this >> data.roomId;
-        *this >> data.isSpectator;
-        return *this;
-    }
-
-    // template <>
-    // inline auto Packet::operator<<(LeaveRoomPayload data) -> Packet &
-    // {
-    //     *this << data.roomId;
-    //     return *this;
-    // }
-
-    // template <>
-    // inline auto Packet::operator>>(LeaveRoomPayload &data) -> Packet &
-    // {
-    //     *this >> data.roomId;
-    //     return *this;
-    // }
+    struct Schema<EntitySnapshotPayload> {
+        static constexpr auto fields = std::tuple{
+            &EntitySnapshotPayload::netId, &EntitySnapshotPayload::position,
+            &EntitySnapshotPayload::velocity, &EntitySnapshotPayload::rotation};
+    };
 
     template <>
-    inline auto Packet::operator<<(RoomSnapshotPayload data) -> Packet &
-    {
-        *this << data.roomId;
-        *this << data.currentPlayers;
-        *this << data.serverTick;
-        *this << data.entityCount;
-        *this << data.inGame;
-        return *this;
-    }
+    struct Schema<EntitySpawnPayload> {
+        static constexpr auto fields = std::tuple{
+            &EntitySpawnPayload::netId, &EntitySpawnPayload::type,
+            &EntitySpawnPayload::posX, &EntitySpawnPayload::posY,
+            &EntitySpawnPayload::sizeX, &EntitySpawnPayload::sizeY,
+            &EntitySpawnPayload::weaponKind};
+    };
 
     template <>
-    inline auto Packet::operator>>(RoomSnapshotPayload &data) -> Packet &
-    {
-        *this >> data.roomId;
-        *this >> data.currentPlayers;
-        *this >> data.serverTick;
-        *this >> data.entityCount;
-        *this >> data.inGame;
-        return *this;
-    }
+    struct Schema<EntityDeathPayload> {
+        static constexpr auto fields = std::tuple{
+            &EntityDeathPayload::netId, &EntityDeathPayload::type,
+            &EntityDeathPayload::position};
+    };
 
     template <>
-    inline auto Packet::operator<<(SetReadyPayload data) -> Packet &
-    {
-        *this << data.isReady;
-        return *this;
-    }
+    struct Schema<AmmoUpdatePayload> {
+        static constexpr auto fields = std::tuple{
+            &AmmoUpdatePayload::current, &AmmoUpdatePayload::max,
+            &AmmoUpdatePayload::isReloading, &AmmoUpdatePayload::cooldownRemaining};
+    };
 
     template <>
-    inline auto Packet::operator>>(SetReadyPayload &data) -> Packet &
-    {
-        *this >> data.isReady;
-        return *this;
-    }
+    struct Schema<BeamStatePayload> {
+        static constexpr auto fields = std::tuple{
+            &BeamStatePayload::ownerNetId, &BeamStatePayload::active,
+            &BeamStatePayload::timeRemaining, &BeamStatePayload::length,
+            &BeamStatePayload::offsetY};
+    };
 
     template <>
-    inline auto Packet::operator<<(RoomChatPayload data) -> Packet &
-    {
-        *this << std::string_view(data.message, strnlen(data.message, sizeof(data.message)));
-        return *this;
-    }
+    struct Schema<ScoreUpdatePayload> {
+        static constexpr auto fields = std::tuple{&ScoreUpdatePayload::score};
+    };
 
     template <>
-    inline auto Packet::operator>>(RoomChatPayload &data) -> Packet &
-    {
-        std::string msg;
-        *this >> msg;
-        std::strncpy(data.message, msg.c_str(), sizeof(data.message));
-        data.message[sizeof(data.message) - 1] = '\0';
-        return *this;
-    }
+    struct Schema<GameOverPayload> {
+        static constexpr auto fields = std::tuple{
+            &GameOverPayload::bestPlayer, &GameOverPayload::bestScore,
+            &GameOverPayload::playerScore, &GameOverPayload::isWin};
+    };
 
     template <>
-    inline auto Packet::operator<<(RoomChatReceivedPayload data) -> Packet &
-    {
-        *this << data.sessionId;
-        *this << std::string_view(data.username, strnlen(data.username, sizeof(data.username)));
-        *this << std::string_view(data.message, strnlen(data.message, sizeof(data.message)));
-        return *this;
-    }
+    struct Schema<HealthUpdatePayload> {
+        static constexpr auto fields = std::tuple{
+            &HealthUpdatePayload::current, &HealthUpdatePayload::max};
+    };
 
     template <>
-    inline auto Packet::operator>>(RoomChatReceivedPayload &data) -> Packet &
-    {
-        *this >> data.sessionId;
+    struct Schema<PingPayload> {
+        static constexpr auto fields = std::tuple{&PingPayload::clientTimeMs};
+    };
 
-        std::string username;
-        std::string message;
-        *this >> username;
-        *this >> message;
-
-        std::strncpy(data.username, username.c_str(), sizeof(data.username));
-        data.username[sizeof(data.username) - 1] = '\0';
+    template <>
+    struct Schema<DebugModePayload> {
+        static constexpr auto fields = std::tuple{&DebugModePayload::enabled};
+    };
 
-        std::strncpy(data.message, message.c_str(), sizeof(data.message));
-        data.message[sizeof(data.message) - 1] = '\0';
+    template <>
+    struct Schema<InputPayload> {
+        static constexpr auto fields = std::tuple{&InputPayload::inputMask,
+                                                  &InputPayload::sequence};
+    };
 
-        return *this;
-    }
+    ///////////////////////////////////////////////////////////////////////////
+    // Simple Template Implementations
+    ///////////////////////////////////////////////////////////////////////////
 
-    template <>
-    inline auto Packet::operator<<(EntitySpawnPayload data) -> Packet &
+    inline uint8_t *Packet::_bumpBodySizeOrThrow(size_t size)
     {
-        *this << data.netId;
-        *this << data.type;
-        *this << data.posX;
-        *this << data.posY;
-        *this << data.sizeX;
-        *this << data.sizeY;
-        *this << data.weaponKind;
-        return *this;
+        const size_t offset = body.size();
+        if (offset + size > MAX_BODY_SIZE) {
+            throw std::length_error("Packet write overflow");
+        }
+        body.resize(offset + size);
+        header.bodySize = static_cast<uint32_t>(body.size());
+        return body.data() + offset;
     }
 
-    template <>
-    inline auto Packet::operator>>(EntitySpawnPayload &data) -> Packet &
+    inline const uint8_t *Packet::_readableOrThrow(size_t size) const
     {
-        *this >> data.netId;
-        *this >> data.type;
-        *this >> data.posX;
-        *this >> data.posY;
-        *this >> data.sizeX;
-        *this >> data.sizeY;
-        *this >> data.weaponKind;
-        return *this;
+        if (_readPos + size > body.size()) {
+            throw std::out_of_range("Packet read overflow");
+        }
+        return body.data() + _readPos;
     }
 
-    template <>
-    inline auto Packet::operator<<(EntityDeathPayload data) -> Packet &
+    inline void Packet::writeBytes(std::span<const uint8_t> bytes)
     {
-        *this << data.netId;
-        *this << data.type;
-        *this << data.position.x;
-        *this << data.position.y;
-        return *this;
+        if (!bytes.empty())
+            std::memcpy(_bumpBodySizeOrThrow(bytes.size()), bytes.data(), bytes.size());
     }
 
-    template <>
-    inline auto Packet::operator>>(EntityDeathPayload &data) -> Packet &
+    inline std::span<const uint8_t> Packet::readBytes(size_t size)
     {
-        *this >> data.netId;
-        *this >> data.type;
-        *this >> data.position.x;
-        *this >> data.position.y;
-        return *this;
+        const uint8_t *src = _readableOrThrow(size);
+        _readPos += size;
+        return {src, size};
     }
 
-    template <>
-    inline auto Packet::operator<<(AmmoUpdatePayload data) -> Packet &
+    template <typename T>
+    auto Packet::operator<<(T data) -> Packet &
     {
-        *this << data.current;
-        *this << data.max;
-        *this << data.isReloading;
-        *this << data.cooldownRemaining;
+        if constexpr (HasSchema<T>) {
+            _writeSchema(data);
+        } else {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                          "Declare a Schema<T> to serialize this type");
+            T network_data = to_network(data);
+            std::memcpy(_bumpBodySizeOrThrow(sizeof(T)), &network_data, sizeof(T));
+        }
         return *this;
     }
 
-    template <>
-    inline auto Packet::operator>>(AmmoUpdatePayload &data) -> Packet &
+    template <typename T>
+    auto Packet::operator>>(T &data) -> Packet &
     {
-        *this >> data.current;
-        *this >> data.max;
-        *this >> data.isReloading;
-        *this >> data.cooldownRemaining;
-        return *this;
-    }
+        if constexpr (HasSchema<T>) {
+            _readSchema(data);
+        } else {
+            static_assert(std::is_arithmetic_v<T> || std::is_enum_v<T>,
+                          "Declare a Schema<T> to deserialize this type");
+            T network_data{};
+            std::memcpy(&network_data, _readableOrThrow(sizeof(T)), sizeof(T));
+            _readPos += sizeof(T);
 
-    template <>
-    inline auto Packet::operator<<(BeamStatePayload data) -> Packet &
-    {
-        *this << data.ownerNetId;
-        *this << data.active;
-        *this << data.timeRemaining;
-        *this << data.length;
-        *this << data.offsetY;
+            data = from_network(network_data);
+        }
         return *this;
     }
 
-    template <>
-    inline auto Packet::operator>>(BeamStatePayload &data) -> Packet &
-    {
-        *this >> data.ownerNetId;
-        *this >> data.active;
-        *this >> data.timeRemaining;
-        *this >> data.length;
-        *this >> data.offsetY;
-        return *this;
+    template <typename T>
+    void Packet::_writeSchema(const T &data)
+    {
+        if constexpr (constexpr size_t size = schema::wireSize<T>(); size != 0) {
+            schema::encode(_bumpBodySizeOrThrow(size), data);
+        } else {
+            schema::forEachField<T>([&](auto member) {
+                using F = typename schema::MemberTraits<decltype(member)>::Type;
+                if constexpr (std::is_array_v<F>) {
+                    _writeFixedString(data.*member);
+                } else if constexpr (std::is_same_v<F, bool>) {
+                    *this << static_cast<uint8_t>(schema::load(data, member) ? 1 : 0);
+                } else {
+                    *this << schema::load(data, member);
+                }
+            });
+        }
     }
 
-    template <>
-    inline auto Packet::operator<<(ScoreUpdatePayload data) -> Packet &
-    {
-        *this << data.score;
-        return *this;
+    template <typename T>
+    void Packet::_readSchema(T &data)
+    {
+        if constexpr (constexpr size_t size = schema::wireSize<T>(); size != 0) {
+            schema::decode(_readableOrThrow(size), data);
+            _readPos += size;
+        } else {
+            schema::forEachField<T>([&](auto member) {
+                using F = typename schema::MemberTraits<decltype(member)>::Type;
+                if constexpr (std::is_array_v<F>) {
+                    _readFixedString(data.*member);
+                } else if constexpr (std::is_same_v<F, bool>) {
+                    uint8_t flag = 0;
+                    *this >> flag;
+                    schema::store(data, member, flag != 0);
+                } else {
+                    F field{};
+                    *this >> field;
+                    schema::store(data, member, field);
+                }
+            });
+        }
     }
 
-    template <>
-    inline auto Packet::operator>>(ScoreUpdatePayload &data) -> Packet &
+    template <size_t N>
+    void Packet::_writeFixedString(const char (&str)[N])
     {
-        *this >> data.score;
-        return *this;
+        *this << std::string_view(str, strnlen(str, N));
     }
 
-    template <>
-    inline auto Packet::operator<<(GameOverPayload data) -> Packet &
+    template <size_t N>
+    void Packet::_readFixedString(char (&str)[N])
     {
-        *this << std::string_view(data.bestPlayer, strnlen(data.bestPlayer, sizeof(data.bestPlayer)));
-        *this << data.bestScore;
-        *this << data.playerScore;
-        *this << static_cast<uint8_t>(data.isWin ? 1 : 0);
-        return *this;
-    }
+        uint32_t strSize;
+        *this >> strSize;
 
-    template <>
-    inline auto Packet::operator>>(GameOverPayload &data) -> Packet &
-    {
-        std::string bestPlayer;
-        *this >> bestPlayer;
-        std::strncpy(data.bestPlayer, bestPlayer.c_str(), sizeof(data.bestPlayer) - 1);
-        data.bestPlayer[sizeof(data.bestPlayer) - 1] = '\0';
-        *this >> data.bestScore;
-        *this >> data.playerScore;
-        uint8_t winFlag = 0;
-        *this >> winFlag;
-        data.isWin = (winFlag != 0);
-        return *this;
-    }
+        if (strSize > MAX_STRING_SIZE) throw std::runtime_error("String too large");
 
-    template <>
-    inline auto Packet::operator<<(HealthUpdatePayload data) -> Packet &
-    {
-        *this << data.current;
-        *this << data.max;
-        return *this;
+        const uint8_t *src = _readableOrThrow(strSize);
+        const size_t copied = std::min<size_t>(strSize, N - 1);
+        std::memcpy(str, src, copied);
+        std::memset(str + copied, 0, N - copied);
+        _readPos += strSize;
     }
 
-    template <>
-    inline auto Packet::operator>>(HealthUpdatePayload &data) -> Packet &
-    {
-        *this >> data.current;
-        *this >> data.max;
-        return *this;
-    }
+    //////////////////////////////////////////////////////////////////////////
+    // Specialized Template Implementations
+    //////////////////////////////////////////////////////////////////////////
 
-    template <>
-    inline auto Packet::operator<<(PingPayload data) -> Packet &
+    template <typename T>
+    inline auto Packet::operator<<(const std::vector<T> &vec) -> Packet &
     {
-        *this << data.clientTimeMs;
+        uint32_t vecSize = static_cast<uint32_t>(vec.size());
+        if constexpr (schema::IS_BULK<T>) {
+            const size_t bytes = vec.size() * sizeof(T);
+            if (body.size() + sizeof(vecSize) + bytes > MAX_BODY_SIZE) {
+                throw std::length_error("Packet write overflow");
+            }
+            *this << vecSize;
+            if (bytes != 0) {
+                schema::copySwapped<T>(_bumpBodySizeOrThrow(bytes),
+                                       reinterpret_cast<const uint8_t *>(vec.data()), vec.size());
+            }
+        } else {
+            body.reserve(std::min<size_t>(body.size() + sizeof(vecSize) + vec.size() * sizeof(T),
+                                          MAX_BODY_SIZE));
+            *this << vecSize;
+            for (const auto &item : vec) {
+                *this << item;
+            }
+        }
         return *this;
     }
 
-    template <>
-    inline auto Packet::operator>>(PingPayload &data) -> Packet &
+    template <typename T>
+    inline auto Packet::operator>>(std::vector<T> &vec) -> Packet &
     {
-        *this >> data.clientTimeMs;
-        return *this;
-    }
+        uint32_t vecSize;
+        *this >> vecSize;
 
-    template <>
-    inline auto Packet::operator<<(DebugModePayload data) -> Packet &
-    {
-        *this << data.enabled;
+        vec.clear();
+        if (vecSize > MAX_VECTOR_SIZE) throw std::runtime_error("Vector too large");
+        if (vecSize > body.size() - _readPos) {
+            throw std::out_of_range("Packet read overflow");
+        }
+
+        if constexpr (schema::IS_BULK<T>) {
+            const size_t bytes = static_cast<size_t>(vecSize) * sizeof(T);
+            const uint8_t *src = _readableOrThrow(bytes);
+            vec.resize(vecSize);
+            if (bytes != 0) {
+                schema::copySwapped<T>(reinterpret_cast<uint8_t *>(vec.data()), src, vecSize);
+            }
+            _readPos += bytes;
+        } else {
+            vec.reserve(vecSize);
+            for (uint32_t i = 0; i < vecSize; ++i) {
+                T item{};
+                *this >> item;
+                vec.push_back(std::move(item));
+            }
+        }
         return *this;
     }
 
-    template <>
-    inline auto Packet::operator>>(DebugModePayload &data) -> Packet &
+    inline auto Packet::operator<<(std::string_view str) -> Packet &
     {
-        *this >> data.enabled;
-        return *this;
-    }
+        uint32_t strSize = static_cast<uint32_t>(str.size());
 
-    // template <>
-    // inline auto Packet::operator<<(WorldSnapshotPayload data) -> Packet &
-    // {
-    //     *this << data.serverTick;
-    //     *this << data.entityCount;
-    //     return *this;
-    // }
-
-    // template <>
-    // inline auto Packet::operator>>(WorldSnapshotPayload &data) -> Packet &
-    // {
-    //     *this >> data.serverTick;
-    //     *this >> data.entityCount;
-    //     return *this;
-    // }
+        if (strSize > MAX_STRING_SIZE) throw std::length_error("String too large");
+
+        *this << strSize;
+        std::memcpy(_bumpBodySizeOrThrow(strSize), str.data(), strSize);
 
-    template <>
-    inline auto Packet::operator<<(EntitySnapshotPayload data) -> Packet &
-    {
-        *this << data.netId;
-        *this << data.position.x;
-        *this << data.position.y;
-        *this << data.velocity.x;
-        *this << data.velocity.y;
-        *this << data.rotation;
         return *this;
     }
 
-    template <>
-    inline auto Packet::operator>>(EntitySnapshotPayload &data) -> Packet &
+    inline auto Packet::operator>>(std::string &str) -> Packet &
     {
-        *this >> data.netId;
-        *this >> data.position.x;
-        *this >> data.position.y;
-        *this >> data.velocity.x;
-        *this >> data.velocity.y;
-        *this >> data.rotation;
+        uint32_t strSize;
+        *this >> strSize;
+
+        if (strSize > MAX_STRING_SIZE) throw std::runtime_error("String too large");
+
+        str.assign(reinterpret_cast<const char *>(_readableOrThrow(strSize)), strSize);
+        _readPos += strSize;
         return *this;
     }
+
 } // namespace rtp::net
@@ -0,0 +1,69 @@
+/**
+ * File   : PacketBufferPool.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_NETWORK_PACKETBUFFERPOOL_HPP_
+    #define RTYPE_NETWORK_PACKETBUFFERPOOL_HPP_
+
+    #include <cstddef>
+    #include <cstdint>
+    #include <vector>
+
+/**
+ * @namespace rtp::net
+ * @brief Network layer for R-Type protocol
+ */
+namespace rtp::net
+{
+    /**
+     * @class PacketBufferPool
+     * @brief Recycles packet body buffers to keep steady-state traffic allocation free
+     *
+     * Every buffer handed out has at least MTU_SIZE bytes of capacity reserved.
+     * Released buffers go to a thread-local freelist first; when that list is
+     * full, or empty on acquire, a batch is moved to/from a shared freelist so
+     * that buffers produced on the I/O thread and consumed on the game thread
+     * keep circulating instead of being freed and reallocated.
+     */
+    class PacketBufferPool final {
+        public:
+            using Buffer = std::vector<uint8_t>; /**< Pooled body storage */
+
+            /**
+             * @brief Get an empty buffer with at least MTU_SIZE capacity
+             * @return A cleared buffer, recycled when one is available
+             */
+            [[nodiscard]]
+            static Buffer acquire(void);
+
+            /**
+             * @brief Give a buffer back to the pool
+             * @param buffer Buffer to recycle, left empty on return
+             * @note Buffers below MTU_SIZE or above MAX_BODY_SIZE capacity
+             *       are simply freed
+             */
+            static void release(Buffer &&buffer) noexcept;
+
+            /**
+             * @brief Number of buffers cached by the calling thread
+             * @return Size of the thread-local freelist
+             */
+            static std::size_t localCount(void) noexcept;
+
+            /**
+             * @brief Number of buffers cached in the shared freelist
+             * @return Size of the shared freelist
+             */
+            static std::size_t sharedCount(void) noexcept;
+
+        public:
+            static constexpr std::size_t LOCAL_LIMIT = 64;      /**< Max buffers per thread freelist */
+            static constexpr std::size_t TRANSFER_BATCH = 32;   /**< Buffers moved per shared-list exchange */
+            static constexpr std::size_t SHARED_LIMIT = 4096;   /**< Max buffers in the shared freelist */
+    };
+}
+
+#endif /* !RTYPE_NETWORK_PACKETBUFFERPOOL_HPP_ */
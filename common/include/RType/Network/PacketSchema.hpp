@@ -0,0 +1,413 @@
+/**
+ * File   : PacketSchema.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_NETWORK_PACKETSCHEMA_HPP_
+    #define RTYPE_NETWORK_PACKETSCHEMA_HPP_
+
+    #include <array>
+    #include <bit>
+    #include <cstddef>
+    #include <cstdint>
+    #include <cstring>
+    #include <tuple>
+    #include <type_traits>
+
+    #if defined(__SSE2__)
+        #include <emmintrin.h>
+    #endif
+
+/**
+ * @namespace rtp::net
+ * @brief Network layer for R-Type protocol
+ */
+namespace rtp::net
+{
+    /**
+     * @struct Schema
+     * @brief Declared wire layout of a payload
+     *
+     * Specializations list the serialized members, in wire order:
+     * @code
+     * template <>
+     * struct Schema<PingPayload> {
+     *     static constexpr auto fields = std::tuple{&PingPayload::clientTimeMs};
+     * };
+     * @endcode
+     * Supported member types are arithmetic types and enums (network byte
+     * order), bool (one byte), char arrays (length-prefixed string) and
+     * other types with a Schema.
+     */
+    template <typename T>
+    struct Schema;
+
+    /**
+     * @brief Types whose serializer is generated from their Schema
+     */
+    template <typename T>
+    concept HasSchema = requires { Schema<T>::fields; };
+
+    /**
+     * @namespace rtp::net::schema
+     * @brief Compile-time helpers walking a Schema
+     */
+    namespace schema
+    {
+        template <typename M>
+        struct MemberTraits;
+
+        template <typename C, typename F>
+        struct MemberTraits<F C::*> {
+            using Type = F; /**< Type of the pointed-to member */
+        };
+
+        /**
+         * @brief Types stored as their own bytes in network byte order
+         */
+        template <typename F>
+        constexpr bool IS_SCALAR = (std::is_arithmetic_v<F> || std::is_enum_v<F>) &&
+                                   !std::is_same_v<F, bool>;
+
+        /**
+         * @brief Call fn with every schema member pointer of T, in wire order
+         * @param fn Callable taking a pointer to member
+         * @note Payloads are packed: callers copy members in and out through
+         *       the pointer instead of binding references to them.
+         */
+        template <typename T, typename Fn>
+        constexpr void forEachField(Fn &&fn)
+        {
+            std::apply([&](auto... members) { (fn(members), ...); }, Schema<T>::fields);
+        }
+
+        /**
+         * @brief Read a possibly misaligned member of a packed payload
+         */
+        template <typename T, typename F>
+        inline F load(const T &value, F T::*member)
+        {
+            F field;
+            std::memcpy(&field, &(value.*member), sizeof(F));
+            return field;
+        }
+
+        /**
+         * @brief Write a possibly misaligned member of a packed payload
+         */
+        template <typename T, typename F>
+        inline void store(T &value, F T::*member, const F &field)
+        {
+            std::memcpy(&(value.*member), &field, sizeof(F));
+        }
+
+        /**
+         * @brief Call fn with std::type_identity of every schema member type
+         */
+        template <typename T, typename Fn>
+        constexpr void forEachFieldType(Fn &&fn)
+        {
+            std::apply([&](auto... members) {
+                (fn(std::type_identity<typename MemberTraits<decltype(members)>::Type>{}), ...);
+            }, Schema<T>::fields);
+        }
+
+        /**
+         * @brief Encoded size of F
+         * @return Size in bytes, 0 when F has a variable size (strings)
+         */
+        template <typename F>
+        consteval size_t wireSize(void)
+        {
+            if constexpr (std::is_same_v<F, bool>) {
+                return sizeof(uint8_t);
+            } else if constexpr (IS_SCALAR<F>) {
+                return sizeof(F);
+            } else if constexpr (HasSchema<F>) {
+                size_t total = 0;
+                bool variable = false;
+                forEachFieldType<F>([&]<typename M>(std::type_identity<M>) {
+                    const size_t size = wireSize<M>();
+                    variable = variable || size == 0;
+                    total += size;
+                });
+                return variable ? 0 : total;
+            } else {
+                return 0;
+            }
+        }
+
+        /**
+         * @brief Whether F only holds scalars, directly or through nested schemas
+         */
+        template <typename F>
+        consteval bool isPlain(void)
+        {
+            if constexpr (IS_SCALAR<F>) {
+                return true;
+            } else if constexpr (HasSchema<F>) {
+                bool plain = true;
+                forEachFieldType<F>([&]<typename M>(std::type_identity<M>) {
+                    plain = plain && isPlain<M>();
+                });
+                return plain;
+            } else {
+                return false;
+            }
+        }
+
+        /**
+         * @brief Width shared by every scalar of a plain type
+         * @return Width in bytes, 0 when the scalars have mixed widths
+         */
+        template <typename F>
+        consteval size_t uniformWidth(void)
+        {
+            if constexpr (IS_SCALAR<F>) {
+                return sizeof(F);
+            } else {
+                size_t width = 0;
+                bool mixed = false;
+                forEachFieldType<F>([&]<typename M>(std::type_identity<M>) {
+                    const size_t member = uniformWidth<M>();
+                    mixed = mixed || member == 0 || (width != 0 && member != width);
+                    width = member;
+                });
+                return mixed ? 0 : width;
+            }
+        }
+
+        /**
+         * @struct ScalarSlot
+         * @brief Position of one scalar inside the encoding of a plain type
+         */
+        struct ScalarSlot {
+            uint16_t offset;            /**< Byte offset in the encoding */
+            uint8_t width;              /**< Scalar size in bytes */
+        };
+
+        template <typename F>
+        consteval size_t scalarCount(void)
+        {
+            if constexpr (IS_SCALAR<F>) {
+                return 1;
+            } else {
+                size_t count = 0;
+                forEachFieldType<F>([&]<typename M>(std::type_identity<M>) {
+                    count += scalarCount<M>();
+                });
+                return count;
+            }
+        }
+
+        template <typename F>
+        constexpr void collectSlots(ScalarSlot *slots, size_t &index, size_t &offset)
+        {
+            if constexpr (IS_SCALAR<F>) {
+                slots[index++] = {static_cast<uint16_t>(offset), static_cast<uint8_t>(sizeof(F))};
+                offset += sizeof(F);
+            } else {
+                forEachFieldType<F>([&]<typename M>(std::type_identity<M>) {
+                    collectSlots<M>(slots, index, offset);
+                });
+            }
+        }
+
+        /**
+         * @brief Every scalar of a plain type, in wire order
+         */
+        template <typename F>
+        consteval auto scalarSlots(void)
+        {
+            std::array<ScalarSlot, scalarCount<F>()> slots{};
+            size_t index = 0;
+            size_t offset = 0;
+            collectSlots<F>(slots.data(), index, offset);
+            return slots;
+        }
+
+        /**
+         * @brief Give each scalar of value a distinct byte pattern and record
+         *        the bytes its wire encoding would have
+         */
+        template <typename F>
+        constexpr void markScalars(F &value, uint8_t &marker, uint8_t *expected, size_t &offset)
+        {
+            if constexpr (IS_SCALAR<F>) {
+                std::array<uint8_t, sizeof(F)> bytes{};
+                bytes.fill(++marker);
+                value = std::bit_cast<F>(bytes);
+                for (uint8_t byte : bytes) {
+                    expected[offset++] = byte;
+                }
+            } else {
+                forEachField<F>([&](auto member) {
+                    auto field = value.*member;
+                    markScalars(field, marker, expected, offset);
+                    value.*member = field;
+                });
+            }
+        }
+
+        /**
+         * @brief Whether the object representation of T is its wire encoding
+         *        up to byte order: plain, packed, and declared in memory order
+         */
+        template <typename T>
+        consteval bool layoutIsWire(void)
+        {
+            if constexpr (!isPlain<T>() || wireSize<T>() != sizeof(T) ||
+                          !std::is_trivially_copyable_v<T>) {
+                return false;
+            } else {
+                T value{};
+                std::array<uint8_t, sizeof(T)> expected{};
+                uint8_t marker = 0;
+                size_t offset = 0;
+                markScalars(value, marker, expected.data(), offset);
+                return std::bit_cast<std::array<uint8_t, sizeof(T)>>(value) == expected;
+            }
+        }
+
+        /**
+         * @brief Types whose arrays are copied to and from the wire in bulk
+         */
+        template <typename T>
+        constexpr bool IS_BULK = IS_SCALAR<T> || layoutIsWire<T>();
+
+        /**
+         * @brief Swap one W-byte scalar between host and network byte order
+         * @param bytes First byte of the scalar, unaligned
+         */
+        template <size_t W>
+        inline void swapScalar(uint8_t *bytes)
+        {
+            if constexpr (W > 1 && std::endian::native == std::endian::little) {
+                using Word = std::conditional_t<W == 2, uint16_t,
+                             std::conditional_t<W == 4, uint32_t, uint64_t>>;
+                static_assert(sizeof(Word) == W, "Unsupported scalar width");
+                Word word;
+                std::memcpy(&word, bytes, W);
+                word = std::byteswap(word);
+                std::memcpy(bytes, &word, W);
+            }
+        }
+
+        /**
+         * @brief Copy words W-byte scalars, swapping their byte order
+         * @note 16 bytes per iteration with SSE2, the tail goes through swapScalar
+         */
+        template <size_t W>
+        inline void copySwappedWords(uint8_t *dst, const uint8_t *src, size_t words)
+        {
+            size_t i = 0;
+    #if defined(__SSE2__)
+            constexpr size_t lanes = sizeof(__m128i) / W;
+            for (; i + lanes <= words; i += lanes) {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i * W));
+                if constexpr (W == 4) {
+                    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+                    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(2, 3, 0, 1));
+                } else if constexpr (W == 8) {
+                    v = _mm_shufflelo_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+                    v = _mm_shufflehi_epi16(v, _MM_SHUFFLE(0, 1, 2, 3));
+                }
+                v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + i * W), v);
+            }
+    #endif
+            for (; i < words; ++i) {
+                std::memcpy(dst + i * W, src + i * W, W);
+                swapScalar<W>(dst + i * W);
+            }
+        }
+
+        /**
+         * @brief Copy count packed T, swapping every scalar between host and network byte order
+         * @param dst Destination bytes, must not overlap src
+         * @param src Object representation (or wire encoding) of the T array
+         * @param count Number of T
+         * @note Types with a single scalar width are copied as a flat word
+         *       array in one vectorized pass.
+         */
+        template <typename T>
+        inline void copySwapped(uint8_t *dst, const uint8_t *src, size_t count)
+            requires IS_BULK<T>
+        {
+            constexpr size_t width = uniformWidth<T>();
+
+            if constexpr (std::endian::native == std::endian::big || width == 1) {
+                std::memcpy(dst, src, count * sizeof(T));
+            } else if constexpr (width != 0) {
+                copySwappedWords<width>(dst, src, count * (sizeof(T) / width));
+            } else {
+                static constexpr auto slots = scalarSlots<T>();
+                std::memcpy(dst, src, count * sizeof(T));
+                for (size_t i = 0; i < count; ++i, dst += sizeof(T)) {
+                    for (const ScalarSlot &slot : slots) {
+                        switch (slot.width) {
+                            case 2: swapScalar<2>(dst + slot.offset); break;
+                            case 4: swapScalar<4>(dst + slot.offset); break;
+                            case 8: swapScalar<8>(dst + slot.offset); break;
+                            default: break;
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Encode a fixed-size value
+         * @param out Destination, at least wireSize<F>() bytes
+         * @param value Value to encode
+         * @return Pointer past the last written byte
+         */
+        template <typename F>
+        inline uint8_t *encode(uint8_t *out, const F &value)
+        {
+            if constexpr (std::is_same_v<F, bool>) {
+                *out = value ? 1 : 0;
+                return out + 1;
+            } else if constexpr (IS_SCALAR<F>) {
+                std::memcpy(out, &value, sizeof(F));
+                swapScalar<sizeof(F)>(out);
+                return out + sizeof(F);
+            } else {
+                forEachField<F>([&](auto member) { out = encode(out, load(value, member)); });
+                return out;
+            }
+        }
+
+        /**
+         * @brief Decode a fixed-size value
+         * @param in Source, at least wireSize<F>() bytes
+         * @param value Value to fill
+         * @return Pointer past the last read byte
+         */
+        template <typename F>
+        inline const uint8_t *decode(const uint8_t *in, F &value)
+        {
+            if constexpr (std::is_same_v<F, bool>) {
+                value = (*in != 0);
+                return in + 1;
+            } else if constexpr (IS_SCALAR<F>) {
+                std::array<uint8_t, sizeof(F)> bytes;
+                std::memcpy(bytes.data(), in, sizeof(F));
+                swapScalar<sizeof(F)>(bytes.data());
+                value = std::bit_cast<F>(bytes);
+                return in + sizeof(F);
+            } else {
+                forEachField<F>([&](auto member) {
+                    auto field = load(value, member);
+                    in = decode(in, field);
+                    store(value, member, field);
+                });
+                return in;
+            }
+        }
+    }
+}
+
+#endif /* !RTYPE_NETWORK_PACKETSCHEMA_HPP_ */
@@ -0,0 +1,210 @@
+/**
+ * File   : ReliableChannel.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_NETWORK_RELIABLECHANNEL_HPP_
+    #define RTYPE_NETWORK_RELIABLECHANNEL_HPP_
+
+    #include "RType/Network/Packet.hpp"
+
+    #include <array>
+    #include <chrono>
+    #include <cstddef>
+    #include <cstdint>
+    #include <deque>
+    #include <mutex>
+    #include <utility>
+    #include <vector>
+
+/**
+ * @namespace rtp::net
+ * @brief Network layer for R-Type protocol
+ */
+namespace rtp::net
+{
+    /**
+     * @class ReliableChannel
+     * @brief Reliable, ordered message stream on top of unreliable datagrams
+     *
+     * Every datagram produced by flush() is an OpCode::Reliable packet:
+     *  - Header::sequenceId is the datagram sequence number,
+     *  - Header::ackId is the most recent datagram sequence received from the peer,
+     *    only meaningful when bit 0 of Header::reserved is set,
+     *  - the body starts with a 32-bit ack bitfield for the 32 sequences
+     *    before ackId, followed by the packed messages
+     *    ([u16 messageId][u8 opCode][u16 size][bytes] each).
+     *
+     * Messages are resent in new datagrams until one of the datagrams that
+     * carried them is acknowledged, and delivered to the receiver strictly
+     * in send order. A lost datagram only delays the messages it carried;
+     * unreliable traffic on the same socket is never blocked.
+     *
+     * All methods are thread-safe: the I/O thread calls receive() while the
+     * game thread calls send() and flush().
+     */
+    class ReliableChannel final {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            /**
+             * @brief Maximum number of unacknowledged messages and tracked datagrams
+             * @note Messages sent beyond the window wait in a backlog
+             */
+            static constexpr size_t WINDOW_SIZE = 1024;
+
+            /**
+             * @brief Maximum number of messages packed in one datagram
+             */
+            static constexpr size_t MAX_MESSAGES_PER_DATAGRAM = 64;
+
+            /**
+             * @brief Counters exposed for diagnostics and tests
+             */
+            struct Stats {
+                uint64_t messagesSent = 0;      /**< Messages handed to send() */
+                uint64_t messagesResent = 0;    /**< Message retransmissions */
+                uint64_t messagesDelivered = 0; /**< Messages delivered in order */
+                uint64_t datagramsSent = 0;     /**< Datagrams produced by flush() */
+                uint64_t datagramsReceived = 0; /**< Datagrams accepted by receive() */
+            };
+
+            /**
+             * @brief Constructor for ReliableChannel
+             */
+            ReliableChannel(void);
+
+            /**
+             * @brief Queue a message for reliable, ordered delivery
+             * @param message Packet whose opCode and body are carried over
+             */
+            void send(const Packet &message);
+
+            /**
+             * @brief Build the datagrams due at the given time
+             * @param now Current time, drives the resend timers
+             * @param out Datagrams to put on the wire are appended here
+             * @return Number of datagrams appended
+             * @note Emits an ack-only datagram when something was received
+             *       since the last flush and no message is due.
+             */
+            size_t flush(Clock::time_point now, std::vector<Packet> &out);
+
+            /**
+             * @brief Process a datagram received from the peer
+             * @param datagram OpCode::Reliable packet, header in host order
+             * @param now Reception time, used for RTT samples
+             * @param delivered Messages that became deliverable, in order, are appended here
+             * @return false if the datagram was malformed and ignored
+             */
+            bool receive(Packet &datagram, Clock::time_point now,
+                         std::vector<Packet> &delivered);
+
+            /**
+             * @brief Smoothed round-trip time estimated from acknowledgements
+             * @return RTT estimate
+             */
+            Clock::duration getRtt(void) const;
+
+            /**
+             * @brief Number of messages sent but not acknowledged yet, backlog included
+             * @return Pending message count
+             */
+            size_t getPendingCount(void) const;
+
+            /**
+             * @brief Get a copy of the channel counters
+             * @return Channel statistics
+             */
+            Stats getStats(void) const;
+
+        private:
+            struct OutgoingMessage {
+                bool used = false;                       /**< Slot holds an unacked message */
+                uint16_t id = 0;                         /**< Message id */
+                bool everSent = false;                   /**< Already put in a datagram once */
+                Clock::time_point lastSent{};            /**< Last transmission time */
+                OpCode opCode = OpCode::None;            /**< Message opCode */
+                std::vector<uint8_t> body;               /**< Message body */
+            };
+
+            struct SentDatagram {
+                bool used = false;                       /**< Slot describes a sent datagram */
+                bool acked = false;                      /**< Peer acknowledged it */
+                uint16_t sequence = 0;                   /**< Datagram sequence */
+                Clock::time_point sentAt{};              /**< Transmission time */
+                std::vector<uint16_t> messageIds;        /**< Messages carried */
+            };
+
+            struct IncomingMessage {
+                bool used = false;                       /**< Slot holds an undelivered message */
+                uint16_t id = 0;                         /**< Message id */
+                OpCode opCode = OpCode::None;            /**< Message opCode */
+                std::vector<uint8_t> body;               /**< Message body */
+            };
+
+            /**
+             * @brief Move backlog messages into the window while there is room
+             */
+            void _admitBacklog(void);
+
+            /**
+             * @brief Handle an acknowledgement for one of our datagrams
+             * @param sequence Acknowledged datagram sequence
+             * @param now Reception time of the ack
+             */
+            void _onDatagramAcked(uint16_t sequence, Clock::time_point now);
+
+            /**
+             * @brief Record a received datagram sequence for future acks
+             * @param sequence Sequence of the received datagram
+             * @return false if the sequence was already received
+             */
+            bool _recordReceived(uint16_t sequence);
+
+            /**
+             * @brief Build the ack bitfield for the sequences before _remoteSequence
+             * @return Bit i set when _remoteSequence - 1 - i was received
+             */
+            uint32_t _ackBits(void) const;
+
+            /**
+             * @brief Compute the resend delay from the current RTT estimate
+             * @return Delay before an unacked message is sent again
+             */
+            Clock::duration _resendDelay(void) const;
+
+            /**
+             * @brief Start a new datagram with the current ack state
+             * @return Datagram with header and ack bitfield written
+             */
+            Packet _beginDatagram(void);
+
+        private:
+            mutable std::mutex _mutex;                               /**< Guards all channel state */
+
+            std::array<OutgoingMessage, WINDOW_SIZE> _outgoing;      /**< Unacked messages by id % WINDOW_SIZE */
+            std::deque<std::pair<OpCode,
+                std::vector<uint8_t>>> _backlog;                     /**< Messages waiting for window room */
+            uint16_t _nextMessageId = 0;                             /**< Id given to the next admitted message */
+            uint16_t _oldestUnacked = 0;                             /**< Lowest id still in the window */
+
+            std::array<SentDatagram, WINDOW_SIZE> _sent;             /**< Sent datagrams by sequence % WINDOW_SIZE */
+            uint16_t _nextSequence = 0;                              /**< Sequence of the next datagram */
+
+            std::array<int32_t, WINDOW_SIZE> _received;              /**< Received sequences by sequence % WINDOW_SIZE, -1 if none */
+            uint16_t _remoteSequence = 0;                            /**< Most recent sequence received */
+            bool _hasRemote = false;                                 /**< At least one datagram received */
+            bool _ackPending = false;                                /**< Something to acknowledge on next flush */
+
+            std::array<IncomingMessage, WINDOW_SIZE> _incoming;      /**< Out-of-order messages by id % WINDOW_SIZE */
+            uint16_t _nextDeliverId = 0;                             /**< Next id to deliver */
+
+            Clock::duration _rtt = std::chrono::milliseconds(100);   /**< Smoothed round-trip time */
+            Stats _stats{};                                          /**< Channel counters */
+    };
+}
+
+#endif /* !RTYPE_NETWORK_RELIABLECHANNEL_HPP_ */
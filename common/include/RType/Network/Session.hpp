@@ -9,18 +9,50 @@
     #define RTYPE_NETWORK_SESSION_HPP_
 
     #include <asio.hpp>
+    #include <atomic>
+    #include <chrono>
     #include <cstdint>
     #include <memory>
-    #include <deque>
     #include <mutex>
+    #include <span>
+    #include <vector>
     #include "RType/Network/Packet.hpp"
     #include "RType/Network/INetwork.hpp"
     #include "RType/Network/IEventPublisher.hpp"
+    #include "RType/Network/ReliableChannel.hpp"
+    #include "RType/Network/TrafficStats.hpp"
 
 namespace rtp::net
 {
+    /**
+     * @enum TcpFlushPolicy
+     * @brief When queued TCP packets are handed to the session writer
+     */
+    enum class TcpFlushPolicy : uint8_t {
+        Immediate,  /**< Wake the writer on every send */
+        EndOfTick   /**< Wait for flush(), called once per server tick */
+    };
+
     class Session : public std::enable_shared_from_this<Session> {
         public:
+            /**
+             * @brief TCP writer counters
+             */
+            struct WriteStats {
+                uint64_t writes = 0;    /**< Gathered write syscalls (writev) */
+                uint64_t packets = 0;   /**< Packets written */
+                uint64_t bytes = 0;     /**< Bytes written, headers included */
+            };
+
+            /**
+             * @brief Link health counters
+             */
+            struct LinkStats {
+                uint32_t rttUs = 0;             /**< Smoothed Ping/Pong round trip, 0 before the first Pong */
+                size_t writeQueueDepth = 0;     /**< TCP packets queued and not handed to the writer */
+                size_t writeQueuePeak = 0;      /**< Highest writeQueueDepth seen */
+            };
+
             /**
              * @brief Constructor for Session
              * @param id Unique identifier for the session
@@ -53,10 +85,53 @@ namespace rtp::net
             /**
              * @brief Send a packet to the client
              * @param packet Packet to be sent
-             * @param mode Network mode (TCP or UDP) for sending the packet
+             * @param mode Network mode for sending the packet
+             * @note ReliableUDP only queues the packet on the reliable channel,
+             *       it goes out on the next flush. Before the UDP Hello it
+             *       falls back to TCP. With TcpFlushPolicy::EndOfTick, TCP
+             *       packets wait for flush().
              */
             void send(const Packet& packet, NetworkMode mode);
 
+            /**
+             * @brief Hand every queued TCP packet to the writer
+             * @note The writer gathers them into scatter-gather writes of up
+             *       to 64 buffers, i.e. one writev for up to 32 packets
+             */
+            void flush(void);
+
+            /**
+             * @brief Choose when queued TCP packets are written
+             * @param policy Flush policy, Immediate by default
+             */
+            void setFlushPolicy(TcpFlushPolicy policy);
+
+            /**
+             * @brief Get the TCP writer counters
+             * @return Write statistics of the session
+             */
+            WriteStats getWriteStats(void) const;
+
+            /**
+             * @brief Count this session's TCP traffic, and its UDP sends, in a shared table
+             * @param counters Table owned by the server, nullptr to stop counting
+             * @note Must be called before start()
+             */
+            void setTrafficCounters(TrafficCounters *counters);
+
+            /**
+             * @brief Feed a Ping/Pong round trip into the smoothed RTT
+             * @param sample Measured round trip
+             * @note Called from the I/O thread the session's UDP flow is pinned to
+             */
+            void recordRtt(std::chrono::microseconds sample);
+
+            /**
+             * @brief Get the RTT and TCP queue counters
+             * @return Link statistics of the session
+             */
+            LinkStats getLinkStats(void) const;
+
             /**
              * @brief Set the unique identifier for the session
              * @param id New identifier for the session
@@ -81,12 +156,32 @@ namespace rtp::net
              */
             void setUdpEndpoint(const asio::ip::udp::endpoint& endpoint);
 
+            /**
+             * @brief Set the UDP endpoint and pin the session to the socket that received it
+             * @param endpoint New UDP endpoint for the session
+             * @param socket Server UDP socket used for this session's datagrams
+             */
+            void setUdpEndpoint(const asio::ip::udp::endpoint& endpoint,
+                                asio::ip::udp::socket& socket);
+
             /**
              * @brief Get the UDP endpoint for the session
              * @return Current UDP endpoint of the session
              */
             asio::ip::udp::endpoint getUdpEndpoint() const { return _udpEndpoint; }
 
+            /**
+             * @brief Check if a UDP endpoint has been bound to the session
+             * @return true once the client's UDP Hello has been received
+             */
+            bool hasUdpEndpoint() const { return _hasUdp; }
+
+            /**
+             * @brief Get the reliable-ordered channel multiplexed on the session's UDP flow
+             * @return Reliable channel of the session
+             */
+            ReliableChannel &getReliableChannel() { return _reliable; }
+
         private:
             /**
              * @brief Asynchronous reader coroutine for the session
@@ -96,24 +191,44 @@ namespace rtp::net
 
             /**
              * @brief Asynchronous writer coroutine for the session
-             * @note Continuously writes packets to the TCP socket
+             * @note Writes every flushed packet with gathered async_write_some calls
              */
             asio::awaitable<void> writer(void);
 
+            /**
+             * @brief Wake the writer on its executor, at most once per batch
+             * @note _writeMutex must be held
+             */
+            void requestWrite(void);
+
         private:
             uint32_t _id;                             /**< Unique identifier for the session */
             bool _stopped = false;                    /**< Flag indicating if the session is stopped */
             
             asio::ip::tcp::socket _socket;            /**< TCP socket associated with the session */
-            asio::ip::udp::socket& _serverUdpSocket;  /**< Reference to the server's UDP socket */
+            asio::ip::udp::socket* _serverUdpSocket;  /**< Server UDP socket the session is pinned to */
             IEventPublisher& _publisher;              /**< Reference to the event publisher for network events */
             
             asio::ip::udp::endpoint _udpEndpoint{};   /**< UDP endpoint associated with the session */
             bool _hasUdp = false;                     /**< Flag indicating if UDP endpoint is set */
+            ReliableChannel _reliable;                /**< Reliable-ordered gameplay channel over UDP */
 
             std::mutex _writeMutex;                   /**< Mutex for synchronizing write operations */
             asio::steady_timer _timer;                /**< Timer for managing write operations */
-            std::deque<Packet> _writeQueue{};         /**< Queue of packets to be written to the TCP socket */
+            std::vector<Packet> _writeQueue{};        /**< Queue of packets to be written to the TCP socket */
+            std::vector<Packet> _writeBatch{};        /**< Packets owned by the in-flight write */
+            std::vector<asio::const_buffer> _writeBuffers{}; /**< Gathered header/body buffers of _writeBatch */
+            bool _writeRequested = false;             /**< Writer wake-up already posted */
+            TcpFlushPolicy _flushPolicy = TcpFlushPolicy::Immediate; /**< When send() wakes the writer */
+
+            std::atomic<uint64_t> _writeCalls{0};     /**< Write syscalls issued */
+            std::atomic<uint64_t> _packetsWritten{0}; /**< Packets written */
+            std::atomic<uint64_t> _bytesWritten{0};   /**< Bytes written */
+
+            TrafficCounters *_traffic = nullptr;      /**< Shared per-OpCode counters, optional */
+            std::atomic<uint32_t> _rttUs{0};          /**< Smoothed round trip in microseconds */
+            std::atomic<size_t> _writeQueueDepth{0};  /**< Size of _writeQueue */
+            std::atomic<size_t> _writeQueuePeak{0};   /**< Highest _writeQueueDepth */
     };
 }
 
@@ -0,0 +1,165 @@
+/**
+ * File   : SnapshotBuffer.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_NETWORK_SNAPSHOTBUFFER_HPP_
+    #define RTYPE_NETWORK_SNAPSHOTBUFFER_HPP_
+
+    #include "RType/Math/Vec2.hpp"
+
+    #include <array>
+    #include <chrono>
+    #include <cstddef>
+    #include <cstdint>
+
+/**
+ * @namespace rtp::net
+ * @brief Network layer for R-Type protocol
+ */
+namespace rtp::net
+{
+    /**
+     * @class SnapshotBuffer
+     * @brief Short history of one entity's snapshots, ordered by server tick
+     *
+     * Snapshots arriving late or twice are merged in tick order, so the
+     * client can render any tick between the oldest and the newest sample
+     * whatever the network did to their arrival order.
+     */
+    class SnapshotBuffer final {
+        public:
+            /**
+             * @brief Number of samples kept, the oldest is dropped first
+             */
+            static constexpr size_t CAPACITY = 8;
+
+            /**
+             * @brief Longest extrapolation past the newest sample, in seconds
+             */
+            static constexpr float MAX_EXTRAPOLATION = 0.1f;
+
+            /**
+             * @struct Sample
+             * @brief Entity state stamped by the server
+             */
+            struct Sample {
+                uint32_t tick = 0;      /**< Server tick of the snapshot */
+                Vec2f position{};       /**< Entity position */
+                Vec2f velocity{};       /**< Entity velocity, units per second */
+                float rotation = 0.0f;  /**< Entity rotation */
+            };
+
+            /**
+             * @brief Insert a sample at its tick position
+             * @param sample Snapshot to insert
+             * @return false if it was a duplicate or older than the whole buffer
+             */
+            bool push(const Sample &sample);
+
+            /**
+             * @brief Entity state at a fractional server tick
+             * @param tick Tick to render
+             * @param tickRate Server ticks per second, scales the extrapolation
+             * @param out Interpolated state, tick set to the rendered tick
+             * @return false if the buffer is empty
+             * @note Before the oldest sample the oldest is returned; past the
+             *       newest the state is extrapolated along its velocity for at
+             *       most MAX_EXTRAPOLATION seconds.
+             */
+            bool sample(double tick, float tickRate, Sample &out) const;
+
+            /**
+             * @brief Drop every sample
+             */
+            void clear(void);
+
+            /**
+             * @brief Number of samples held
+             * @return Sample count
+             */
+            size_t size(void) const;
+
+        private:
+            std::array<Sample, CAPACITY> _samples{};    /**< Samples, oldest first */
+            size_t _count = 0;                          /**< Number of valid samples */
+    };
+
+    /**
+     * @class InterpolationClock
+     * @brief Server tick the client renders, a fixed delay behind the newest snapshot
+     *
+     * The clock advances with local frame time and is pulled smoothly toward
+     * newest tick - delay, so snapshot jitter shifts it by a fraction of a
+     * tick instead of making entities jump. The server tick rate is measured
+     * from the snapshots themselves.
+     */
+    class InterpolationClock final {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            /**
+             * @brief Constructor for InterpolationClock
+             * @param delay Render delay behind the newest snapshot, in seconds
+             * @param tickRate Initial guess of the server tick rate
+             */
+            explicit InterpolationClock(float delay = 0.1f, float tickRate = 60.0f);
+
+            /**
+             * @brief Record the tick of a received snapshot
+             * @param tick Server tick stamped on the snapshot
+             * @param now Reception time
+             */
+            void onSnapshot(uint32_t tick, Clock::time_point now);
+
+            /**
+             * @brief Advance the render tick by one frame
+             * @param dt Frame time in seconds
+             * @return Tick to render this frame
+             */
+            double advance(float dt);
+
+            /**
+             * @brief Forget every snapshot, the next one resynchronizes the clock
+             */
+            void reset(void);
+
+            /**
+             * @brief Whether a snapshot was received since the last reset
+             * @return true once the render tick is meaningful
+             */
+            bool isSynced(void) const;
+
+            /**
+             * @brief Tick rendered by the last advance()
+             * @return Fractional server tick
+             */
+            double getRenderTick(void) const;
+
+            /**
+             * @brief Estimated server tick rate
+             * @return Ticks per second
+             */
+            float getTickRate(void) const;
+
+        private:
+            /**
+             * @brief Tick the clock converges to
+             * @return Newest tick minus the render delay
+             */
+            double _targetTick(void) const;
+
+        private:
+            float _delay;                       /**< Render delay in seconds */
+            float _tickRate;                    /**< Estimated server ticks per second */
+            bool _synced = false;               /**< A snapshot was received */
+            uint32_t _newestTick = 0;           /**< Newest tick received */
+            double _renderTick = 0.0;           /**< Tick rendered this frame */
+            uint32_t _anchorTick = 0;           /**< Tick at the start of the rate window */
+            Clock::time_point _anchorTime{};    /**< Time at the start of the rate window */
+    };
+}
+
+#endif /* !RTYPE_NETWORK_SNAPSHOTBUFFER_HPP_ */
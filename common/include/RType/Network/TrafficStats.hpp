@@ -0,0 +1,132 @@
+/**
+ * File   : TrafficStats.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_NETWORK_TRAFFICSTATS_HPP_
+    #define RTYPE_NETWORK_TRAFFICSTATS_HPP_
+
+    #include "RType/Network/INetwork.hpp"
+    #include "RType/Network/Packet.hpp"
+
+    #include <array>
+    #include <atomic>
+    #include <cstddef>
+    #include <cstdint>
+    #include <string_view>
+
+/**
+ * @namespace rtp::net
+ * @brief Network layer for R-Type protocol
+ */
+namespace rtp::net
+{
+    /**
+     * @enum TrafficDirection
+     * @brief Side of the socket a packet was counted on
+     */
+    enum class TrafficDirection : uint8_t {
+        Inbound,    /**< Received from a peer */
+        Outbound    /**< Sent to a peer */
+    };
+
+    /**
+     * @struct TrafficCount
+     * @brief Packets and wire bytes, headers included
+     */
+    struct TrafficCount {
+        uint64_t packets = 0;   /**< Packets counted */
+        uint64_t bytes = 0;     /**< Header and body bytes */
+    };
+
+    /**
+     * @struct TrafficSnapshot
+     * @brief Copy of a TrafficCounters table at one point in time
+     */
+    struct TrafficSnapshot {
+        static constexpr size_t OPCODES = 256;              /**< One slot per OpCode value */
+        static constexpr size_t CELLS = 2 * 2 * OPCODES;    /**< Direction x transport x OpCode */
+
+        std::array<TrafficCount, CELLS> cells{};            /**< Counts, see index() */
+
+        /**
+         * @brief Counts of one OpCode
+         * @param direction Inbound or outbound
+         * @param transport TCP, or UDP for both UDP modes
+         * @param opCode Packet type
+         * @return Counts
+         */
+        const TrafficCount &at(TrafficDirection direction, NetworkMode transport,
+                               OpCode opCode) const;
+
+        /**
+         * @brief Sum over every OpCode
+         * @param direction Inbound or outbound
+         * @param transport TCP, or UDP for both UDP modes
+         * @return Counts
+         */
+        TrafficCount total(TrafficDirection direction, NetworkMode transport) const;
+
+        /**
+         * @brief Position of a counter in cells
+         * @param direction Inbound or outbound
+         * @param transport TCP, or UDP for both UDP modes
+         * @param opCode Packet type
+         * @return Cell index
+         */
+        static size_t index(TrafficDirection direction, NetworkMode transport,
+                            OpCode opCode) noexcept;
+    };
+
+    /**
+     * @class TrafficCounters
+     * @brief Lock-free packet and byte counters per OpCode, direction and transport
+     *
+     * record() is a pair of relaxed atomic increments, so it can stay on in
+     * production. Packets are counted as they appear on the wire: reliable
+     * messages show up inside OpCode::Reliable datagrams. Inbound cells are
+     * written by the I/O threads and outbound cells mostly by the game
+     * thread, so the two halves of the table do not share cache lines.
+     */
+    class TrafficCounters {
+        public:
+            /**
+             * @brief Count one packet
+             * @param direction Inbound or outbound
+             * @param transport TCP, or UDP for both UDP modes
+             * @param opCode Packet type
+             * @param bytes Header and body bytes
+             */
+            void record(TrafficDirection direction, NetworkMode transport,
+                        OpCode opCode, size_t bytes) noexcept;
+
+            /**
+             * @brief Copy every counter
+             * @return Snapshot, each cell read atomically but not the table as a whole
+             */
+            TrafficSnapshot snapshot(void) const;
+
+        private:
+            /**
+             * @struct Cell
+             * @brief Counters of one OpCode in one direction and transport
+             */
+            struct Cell {
+                std::atomic<uint64_t> packets{0};   /**< Packets counted */
+                std::atomic<uint64_t> bytes{0};     /**< Header and body bytes */
+            };
+
+            std::array<Cell, TrafficSnapshot::CELLS> _cells{};  /**< Same layout as TrafficSnapshot */
+    };
+
+    /**
+     * @brief Name of an OpCode, for logs
+     * @param opCode Packet type
+     * @return Enumerator name, or "Unknown"
+     */
+    std::string_view toString(OpCode opCode) noexcept;
+}
+
+#endif /* !RTYPE_NETWORK_TRAFFICSTATS_HPP_ */
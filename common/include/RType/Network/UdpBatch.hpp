@@ -0,0 +1,134 @@
+/**
+ * File   : UdpBatch.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_NETWORK_UDPBATCH_HPP_
+    #define RTYPE_NETWORK_UDPBATCH_HPP_
+
+    #include "RType/Network/Packet.hpp"
+
+    #include <asio.hpp>
+    #include <array>
+    #include <cstddef>
+    #include <cstdint>
+    #include <span>
+    #include <vector>
+
+    #if defined(__linux__)
+        #include <sys/socket.h>
+        #include <sys/uio.h>
+        #define RTYPE_HAS_UDP_MMSG 1
+    #endif
+
+/**
+ * @namespace rtp::net
+ * @brief Network layer for R-Type protocol
+ */
+namespace rtp::net
+{
+    /**
+     * @brief Maximum number of datagrams moved per recvmmsg/sendmmsg call
+     */
+    constexpr size_t UDP_BATCH_SIZE = 32;
+
+    /**
+     * @brief Size of each receive slot, datagrams above it are truncated
+     */
+    constexpr size_t UDP_DATAGRAM_CAPACITY = 4096;
+
+    #if defined(RTYPE_HAS_UDP_MMSG)
+
+    /**
+     * @class UdpBatchReceiver
+     * @brief Drains up to UDP_BATCH_SIZE datagrams per syscall with recvmmsg
+     *
+     * The receiver owns one slot per datagram; the data returned by
+     * data() stays valid until the next call to receive().
+     */
+    class UdpBatchReceiver {
+        public:
+            /**
+             * @brief Constructor for UdpBatchReceiver
+             * @note Pre-wires the iovecs and message headers to the slots
+             */
+            UdpBatchReceiver(void);
+
+            /**
+             * @brief Receive every datagram already queued on the socket, up to UDP_BATCH_SIZE
+             * @param socket Bound UDP socket to read from, never blocks
+             * @param ec Set to the socket error, would_block when nothing is queued
+             * @return Number of datagrams received
+             */
+            size_t receive(asio::ip::udp::socket &socket, asio::error_code &ec);
+
+            /**
+             * @brief Get the payload of a received datagram
+             * @param index Datagram index, below the last receive() result
+             * @return View of the datagram bytes
+             */
+            std::span<const uint8_t> data(size_t index) const;
+
+            /**
+             * @brief Get the sender of a received datagram
+             * @param index Datagram index, below the last receive() result
+             * @return Endpoint the datagram came from
+             */
+            const asio::ip::udp::endpoint &endpoint(size_t index) const;
+
+        private:
+            std::array<std::array<uint8_t, UDP_DATAGRAM_CAPACITY>,
+                UDP_BATCH_SIZE> _slots{};                             /**< Datagram storage */
+            std::array<asio::ip::udp::endpoint, UDP_BATCH_SIZE> _endpoints{}; /**< Sender of each slot */
+            std::array<size_t, UDP_BATCH_SIZE> _sizes{};              /**< Received size of each slot */
+            std::array<::iovec, UDP_BATCH_SIZE> _iovecs{};            /**< One iovec per slot */
+            std::array<::mmsghdr, UDP_BATCH_SIZE> _messages{};        /**< recvmmsg message headers */
+    };
+
+    /**
+     * @class UdpBatchSender
+     * @brief Queues outgoing packets and sends them with as few sendmmsg calls as possible
+     *
+     * Packets are copied into pooled buffers on push(), so callers can reuse
+     * theirs immediately. flush() is meant to run once per server tick.
+     */
+    class UdpBatchSender {
+        public:
+            /**
+             * @brief Queue a packet for the next flush
+             * @param endpoint Destination endpoint
+             * @param packet Packet to send
+             */
+            void push(const asio::ip::udp::endpoint &endpoint, const Packet &packet);
+
+            /**
+             * @brief Send every queued packet and empty the queue
+             * @param socket UDP socket to send from, never blocks
+             * @param ec Set to the first socket error, remaining packets are dropped
+             * @return Number of datagrams handed to the kernel
+             */
+            size_t flush(asio::ip::udp::socket &socket, asio::error_code &ec);
+
+            /**
+             * @brief Number of packets waiting for the next flush
+             * @return Queue size
+             */
+            size_t pending(void) const;
+
+        private:
+            struct Datagram {
+                asio::ip::udp::endpoint endpoint;                    /**< Destination */
+                Packet packet;                                       /**< Pooled copy of the packet */
+            };
+
+            std::vector<Datagram> _queue;                            /**< Packets waiting for flush */
+            std::array<::iovec, UDP_BATCH_SIZE * 2> _iovecs{};       /**< Header and body iovec per message */
+            std::array<::mmsghdr, UDP_BATCH_SIZE> _messages{};       /**< sendmmsg message headers */
+    };
+
+    #endif /* RTYPE_HAS_UDP_MMSG */
+}
+
+#endif /* !RTYPE_NETWORK_UDPBATCH_HPP_ */
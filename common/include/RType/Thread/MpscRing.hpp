@@ -0,0 +1,142 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MpscRing.hpp, MpscRing class declaration
+*/
+
+/*
+** MIT License
+**
+** Copyright (c) 2025 Robin Toillon
+**
+** Permission is hereby granted, free of charge, to any person obtaining
+** a copy of this software and associated documentation files (the
+** "Software"), to deal in the Software without restriction, including
+** without limitation the rights to use, copy, modify, merge, publish,
+** distribute, sublicense, and/or sell copies of the Software, and to
+** permit persons to whom the Software is furnished to do so, subject to
+** the following conditions:
+**
+** The above copyright notice and this permission notice shall be
+** included in all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+** EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+** MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+** IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+** CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+** TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+** SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file MpscRing.hpp
+ * @brief MpscRing class declaration
+ * @author Robin Toillon
+ * @details This file contains the declaration of the MpscRing class, a
+ * bounded lock-free queue accepting any number of producer threads and
+ * a single consumer thread. It is used to hand network events from the
+ * I/O threads to the game thread without locking.
+ */
+
+#ifndef RTYPE_MPSCRING_HPP_
+    #define RTYPE_MPSCRING_HPP_
+
+    #include <atomic>
+    #include <concepts>
+    #include <cstddef>
+    #include <memory>
+    #include <new>
+    #include <optional>
+    #include <span>
+    #include <type_traits>
+
+namespace rtp::thread
+{
+    /**
+     * @class MpscRing
+     * @brief Bounded lock-free multi-producer single-consumer ring
+     * @tparam T Element type, must be default constructible and
+     * nothrow movable
+     * @details Each cell carries a sequence number telling producers
+     * whether it is free and the consumer whether it is published.
+     * Producers claim a slot with a single CAS on the write cursor, the
+     * consumer never performs a read-modify-write. Elements are moved in
+     * and out, never copied. When the ring is full, tryPush() fails
+     * instead of blocking so the caller decides the overflow policy.
+     */
+    template<typename T>
+        requires std::default_initializable<T> && std::movable<T>
+    class MpscRing final {
+        public:
+            MpscRing(const MpscRing &) = delete;
+            MpscRing &operator=(const MpscRing &) = delete;
+
+            /**
+             * @brief Creates a ring holding at least capacity elements
+             * @param capacity Requested capacity, rounded up to a power of
+             * two (minimum 2)
+             */
+            explicit MpscRing(size_t capacity);
+
+            /**
+             * @brief Moves an element into the ring
+             * @param value Element to push, left untouched on failure
+             * @return true if pushed, false if the ring is full
+             * @note Safe to call from any number of threads concurrently
+             */
+            [[nodiscard]]
+            bool tryPush(T &&value) noexcept;
+
+            /**
+             * @brief Moves the oldest element out of the ring
+             * @return The element, or std::nullopt if the ring is empty
+             * @note Must only be called from the consumer thread
+             */
+            [[nodiscard]]
+            std::optional<T> tryPop(void) noexcept;
+
+            /**
+             * @brief Moves up to out.size() elements out of the ring
+             * @param out Destination slots, move assigned in FIFO order
+             * @return Number of elements written to out
+             * @note Must only be called from the consumer thread
+             */
+            size_t popBatch(std::span<T> out) noexcept;
+
+            /**
+             * @brief Gets the number of elements the ring can hold
+             * @return The ring capacity
+             */
+            [[nodiscard]]
+            size_t capacity(void) const noexcept;
+
+        private:
+            static_assert(std::is_nothrow_move_assignable_v<T> &&
+                          std::is_nothrow_move_constructible_v<T>,
+                          "a throwing move would leave a claimed cell "
+                          "unpublished and stall the ring");
+
+            static constexpr size_t CACHE_LINE = 64;
+
+            struct Cell {
+                std::atomic<size_t> sequence; /**< Publication state of the
+                                                   cell */
+                T value;                      /**< Stored element */
+            };
+
+            std::unique_ptr<Cell[]> _cells; /**< Ring storage */
+            size_t _mask;                   /**< capacity - 1 */
+            alignas(CACHE_LINE) std::atomic<size_t> _tail{0};
+                                            /**< Next slot claimed by a
+                                                 producer */
+            alignas(CACHE_LINE) size_t _head{0};
+                                            /**< Next slot read by the
+                                                 consumer */
+    };
+}
+
+    #include "MpscRing.tpp" /* MpscRing template implementation */
+
+#endif /* !RTYPE_MPSCRING_HPP_ */
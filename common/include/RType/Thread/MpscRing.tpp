@@ -0,0 +1,128 @@
+/*
+** EPITECH PROJECT, 2025
+** R-Type
+** File description:
+** MpscRing.tpp, MpscRing class template implementation
+*/
+
+/*
+** MIT License
+**
+** Copyright (c) 2025 Robin Toillon
+**
+** Permission is hereby granted, free of charge, to any person obtaining
+** a copy of this software and associated documentation files (the
+** "Software"), to deal in the Software without restriction, including
+** without limitation the rights to use, copy, modify, merge, publish,
+** distribute, sublicense, and/or sell copies of the Software, and to
+** permit persons to whom the Software is furnished to do so, subject to
+** the following conditions:
+**
+** The above copyright notice and this permission notice shall be
+** included in all copies or substantial portions of the Software.
+**
+** THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+** EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+** MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.
+** IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY
+** CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT,
+** TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+** SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+/**
+ * @file MpscRing.tpp
+ * @brief MpscRing class template implementation
+ * @author Robin Toillon
+ * @details Bounded queue after Dmitry Vyukov's design, specialised for
+ * a single consumer: the read cursor is a plain integer owned by the
+ * consumer thread.
+ */
+
+#include <bit>
+#include <utility>
+
+namespace rtp::thread
+{
+    template<typename T>
+        requires std::default_initializable<T> && std::movable<T>
+    MpscRing<T>::MpscRing(size_t capacity)
+    {
+        const size_t size = std::bit_ceil(capacity < 2 ? size_t{2} : capacity);
+
+        this->_cells = std::make_unique<Cell[]>(size);
+        this->_mask = size - 1;
+        for (size_t i = 0; i < size; ++i)
+            this->_cells[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    template<typename T>
+        requires std::default_initializable<T> && std::movable<T>
+    bool MpscRing<T>::tryPush(T &&value) noexcept
+    {
+        size_t pos = this->_tail.load(std::memory_order_relaxed);
+        Cell *cell = nullptr;
+
+        for (;;) {
+            cell = &this->_cells[pos & this->_mask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::ptrdiff_t>(sequence)
+                            - static_cast<std::ptrdiff_t>(pos);
+
+            if (diff == 0) {
+                if (this->_tail.compare_exchange_weak(pos, pos + 1,
+                                                      std::memory_order_relaxed))
+                    break;
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = this->_tail.load(std::memory_order_relaxed);
+            }
+        }
+
+        cell->value = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    template<typename T>
+        requires std::default_initializable<T> && std::movable<T>
+    std::optional<T> MpscRing<T>::tryPop(void) noexcept
+    {
+        Cell &cell = this->_cells[this->_head & this->_mask];
+
+        if (cell.sequence.load(std::memory_order_acquire) != this->_head + 1)
+            return std::nullopt;
+
+        std::optional<T> value{std::move(cell.value)};
+        cell.sequence.store(this->_head + this->_mask + 1,
+                            std::memory_order_release);
+        ++this->_head;
+        return value;
+    }
+
+    template<typename T>
+        requires std::default_initializable<T> && std::movable<T>
+    size_t MpscRing<T>::popBatch(std::span<T> out) noexcept
+    {
+        size_t count = 0;
+
+        while (count < out.size()) {
+            Cell &cell = this->_cells[this->_head & this->_mask];
+            if (cell.sequence.load(std::memory_order_acquire) != this->_head + 1)
+                break;
+            out[count++] = std::move(cell.value);
+            cell.sequence.store(this->_head + this->_mask + 1,
+                                std::memory_order_release);
+            ++this->_head;
+        }
+        return count;
+    }
+
+    template<typename T>
+        requires std::default_initializable<T> && std::movable<T>
+    size_t MpscRing<T>::capacity(void) const noexcept
+    {
+        return this->_mask + 1;
+    }
+}
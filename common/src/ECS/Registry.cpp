@@ -48,6 +48,11 @@ namespace rtp::ecs
     // Public API
     ///////////////////////////////////////////////////////////////////////////
 
+    Registry::Registry(void)
+        : _generations(RESERVED_INDICES, 0)
+    {
+    }
+
     auto Registry::spawn(void) -> std::expected<Entity, rtp::Error>
     {
         std::unique_lock lock(this->_mutex);
@@ -76,7 +81,7 @@ namespace rtp::ecs
 
         std::uint32_t idx = entity.index();
 
-        if (idx >= this->_generations.size() ||
+        if (entity.isNull() || idx >= this->_generations.size() ||
             this->_generations[idx] != entity.generation())
             return;
 
@@ -87,18 +92,46 @@ namespace rtp::ecs
         this->_freeIndices.push_back(idx);
     }
 
+    Entity Registry::renew(Entity entity)
+    {
+        std::unique_lock lock(this->_mutex);
+
+        std::uint32_t idx = entity.index();
+
+        if (entity.isNull() || idx >= this->_generations.size() ||
+            this->_generations[idx] != entity.generation())
+            return NullEntity;
+
+        Entity renewed(idx, ++this->_generations[idx]);
+
+        for (auto &pair : this->_arrays)
+            pair.second->rebind(entity, renewed);
+
+        return renewed;
+    }
+
     bool Registry::isAlive(Entity entity) const noexcept
     {
         std::shared_lock lock(this->_mutex);
 
         std::uint32_t idx = entity.index();
         
-        if (idx >= this->_generations.size())
+        if (entity.isNull() || idx >= this->_generations.size())
             return false;
             
         return this->_generations[idx] == entity.generation();
     }
 
+    Entity Registry::entityAt(std::uint32_t index) const noexcept
+    {
+        std::shared_lock lock(this->_mutex);
+
+        if (index >= this->_generations.size())
+            return NullEntity;
+
+        return Entity(index, this->_generations[index]);
+    }
+
     void Registry::clear(void) noexcept
     {
         std::unique_lock lock(this->_mutex);
@@ -106,7 +139,7 @@ namespace rtp::ecs
         for (auto &pair : this->_arrays)
             pair.second->clear();
 
-        this->_generations.clear();
+        this->_generations.assign(RESERVED_INDICES, 0);
         this->_freeIndices.clear();
     }
 
@@ -127,6 +160,7 @@ namespace rtp::ecs
     std::size_t Registry::entityCount(void) const noexcept
     {
         std::shared_lock lock(this->_mutex);
-        return this->_generations.size() - this->_freeIndices.size();
+        return this->_generations.size() - this->_freeIndices.size()
+             - RESERVED_INDICES;
     }
 }
@@ -0,0 +1,53 @@
+/**
+ * File   : InputQueue.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Game/InputQueue.hpp"
+
+namespace rtp::game
+{
+    bool InputQueue::push(const Input &input)
+    {
+        if (input.sequence <= _newest)
+            return false;
+        if (_count == CAPACITY) {
+            _head = (_head + 1) % CAPACITY;
+            --_count;
+        }
+        _inputs[(_head + _count) % CAPACITY] = input;
+        ++_count;
+        _newest = input.sequence;
+        return true;
+    }
+
+    size_t InputQueue::due(void) const
+    {
+        if (_count > MAX_BACKLOG)
+            return CATCH_UP;
+        return _count > 0 ? 1 : 0;
+    }
+
+    bool InputQueue::pop(Input &out)
+    {
+        if (_count == 0)
+            return false;
+
+        out = _inputs[_head];
+        _head = (_head + 1) % CAPACITY;
+        --_count;
+        return true;
+    }
+
+    size_t InputQueue::size(void) const
+    {
+        return _count;
+    }
+
+    uint32_t InputQueue::getNewest(void) const
+    {
+        return _newest;
+    }
+}
@@ -0,0 +1,66 @@
+/**
+ * File   : PlayerMovement.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Game/PlayerMovement.hpp"
+#include "RType/ECS/Components/InputComponent.hpp"
+
+#include <cmath>
+
+namespace rtp::game
+{
+    void steerPlayer(Vec2f &velocity, uint8_t mask, float speed, float dt)
+    {
+        using Bits = ecs::components::server::InputComponent::InputBits;
+
+        float dx = 0.f, dy = 0.f;
+        if (mask & Bits::MoveUp)
+            dy -= 1.f;
+        if (mask & Bits::MoveDown)
+            dy += 1.f;
+        if (mask & Bits::MoveLeft)
+            dx -= 1.f;
+        if (mask & Bits::MoveRight)
+            dx += 1.f;
+
+        const float len = std::sqrt(dx * dx + dy * dy);
+        if (len > 0.f) {
+            dx /= len;
+            dy /= len;
+        }
+
+        const float targetX = dx * speed;
+        const float targetY = dy * speed;
+
+        if (dx != 0.f || dy != 0.f) {
+            velocity.x += (targetX - velocity.x) * PLAYER_ACCEL * dt;
+            velocity.y += (targetY - velocity.y) * PLAYER_ACCEL * dt;
+        } else {
+            velocity.x += (0.0f - velocity.x) * PLAYER_DECEL * dt;
+            velocity.y += (0.0f - velocity.y) * PLAYER_DECEL * dt;
+        }
+    }
+
+    void clampToArena(Vec2f &position, float width, float height)
+    {
+        if (position.x < 0.0f) position.x = 0.0f;
+        if (position.y < 0.0f) position.y = 0.0f;
+
+        const float maxX = ARENA_WIDTH - width;
+        const float maxY = ARENA_HEIGHT - height;
+
+        if (position.x > maxX) position.x = maxX;
+        if (position.y > maxY) position.y = maxY;
+    }
+
+    void stepPlayer(PlayerMotion &motion, uint8_t mask, float speed, float dt)
+    {
+        steerPlayer(motion.velocity, mask, speed, dt);
+        motion.position.x += motion.velocity.x * dt;
+        motion.position.y += motion.velocity.y * dt;
+        clampToArena(motion.position, PLAYER_WIDTH, PLAYER_HEIGHT);
+    }
+}
@@ -0,0 +1,118 @@
+/**
+ * File   : PlayerPredictor.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Game/PlayerPredictor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rtp::game
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    size_t PlayerPredictor::advance(float dt, uint8_t mask)
+    {
+        _accumulator = std::min(_accumulator + dt, STEP * MAX_STEPS);
+
+        size_t steps = 0;
+        while (_accumulator >= STEP) {
+            _accumulator -= STEP;
+            ++_sequence;
+            _masks[_sequence % HISTORY] = mask;
+            if (_active) {
+                _previous = _motion;
+                stepPlayer(_motion, mask, PLAYER_SPEED, STEP);
+            }
+            ++steps;
+        }
+
+        const float decay = std::exp(-CORRECTION_DECAY * dt);
+        _correction.x *= decay;
+        _correction.y *= decay;
+        return steps;
+    }
+
+    void PlayerPredictor::reconcile(uint32_t serverTick, uint32_t ackSequence,
+                                    const PlayerMotion &server)
+    {
+        if (_active && serverTick <= _serverTick)
+            return;
+        if (ackSequence > _sequence)
+            return;
+        _serverTick = serverTick;
+
+        const Vec2f before = getRenderPosition();
+
+        _motion = server;
+        _previous = server;
+        const uint32_t oldest = _sequence >= HISTORY ? _sequence - HISTORY + 1 : 1;
+        for (uint32_t seq = std::max(ackSequence + 1, oldest); seq <= _sequence; ++seq) {
+            _previous = _motion;
+            stepPlayer(_motion, _masks[seq % HISTORY], PLAYER_SPEED, STEP);
+        }
+
+        if (!_active) {
+            _active = true;
+            _correction = {};
+            return;
+        }
+
+        const Vec2f after = _interpolatedPosition();
+        const float errX = before.x - after.x;
+        const float errY = before.y - after.y;
+        if (errX * errX + errY * errY > SNAP_DISTANCE * SNAP_DISTANCE)
+            _correction = {};
+        else
+            _correction = {errX, errY};
+    }
+
+    void PlayerPredictor::reset(void)
+    {
+        _active = false;
+        _serverTick = 0;
+        _correction = {};
+    }
+
+    bool PlayerPredictor::isActive(void) const
+    {
+        return _active;
+    }
+
+    uint32_t PlayerPredictor::getSequence(void) const
+    {
+        return _sequence;
+    }
+
+    uint8_t PlayerPredictor::getInput(uint32_t sequence) const
+    {
+        return _masks[sequence % HISTORY];
+    }
+
+    const PlayerMotion &PlayerPredictor::getMotion(void) const
+    {
+        return _motion;
+    }
+
+    Vec2f PlayerPredictor::getRenderPosition(void) const
+    {
+        const Vec2f position = _interpolatedPosition();
+        return {position.x + _correction.x, position.y + _correction.y};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    Vec2f PlayerPredictor::_interpolatedPosition(void) const
+    {
+        const float alpha = _accumulator / STEP;
+        return {_previous.position.x + (_motion.position.x - _previous.position.x) * alpha,
+                _previous.position.y + (_motion.position.y - _previous.position.y) * alpha};
+    }
+}
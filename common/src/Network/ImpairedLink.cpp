@@ -0,0 +1,123 @@
+/**
+ * File   : ImpairedLink.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Network/ImpairedLink.hpp"
+
+#include <algorithm>
+
+namespace rtp::net
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    ImpairedLink::ImpairedLink(const Impairment &impairment, uint32_t seed)
+        : _impairment(impairment), _rng(seed)
+    {
+    }
+
+    void ImpairedLink::setImpairment(const Impairment &impairment)
+    {
+        _impairment = impairment;
+    }
+
+    const Impairment &ImpairedLink::getImpairment(void) const
+    {
+        return _impairment;
+    }
+
+    size_t ImpairedLink::scheduleDatagram(Clock::time_point now, size_t bytes,
+                                          std::array<Clock::time_point, 2> &out)
+    {
+        ++_stats.packets;
+        if (_chance(_impairment.loss) || _queueFull(now, bytes)) {
+            ++_stats.dropped;
+            return 0;
+        }
+
+        const size_t copies = _chance(_impairment.duplicate) ? 2 : 1;
+        for (size_t i = 0; i < copies; ++i) {
+            out[i] = _serialize(now, bytes) + _latency();
+            if (_chance(_impairment.reorder)) {
+                out[i] += _impairment.reorderGap;
+                ++_stats.reordered;
+            }
+        }
+        if (copies == 2)
+            ++_stats.duplicated;
+        _stats.delivered += copies;
+        _stats.bytes += copies * bytes;
+        return copies;
+    }
+
+    ImpairedLink::Clock::time_point ImpairedLink::scheduleStream(Clock::time_point now,
+                                                                 size_t bytes)
+    {
+        ++_stats.packets;
+        Clock::time_point arrival = _serialize(now, bytes) + _latency();
+        if (_chance(_impairment.loss)) {
+            const Clock::duration roundTrip = 2 * (_impairment.delay + _impairment.jitter);
+            arrival += std::max(MIN_RETRANSMIT, 2 * roundTrip);
+            ++_stats.retransmits;
+        }
+
+        _lastStream = std::max(arrival, _lastStream);
+        ++_stats.delivered;
+        _stats.bytes += bytes;
+        return _lastStream;
+    }
+
+    ImpairedLink::Stats ImpairedLink::getStats(void) const
+    {
+        return _stats;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    ImpairedLink::Clock::time_point ImpairedLink::_serialize(Clock::time_point now,
+                                                             size_t bytes)
+    {
+        if (_impairment.bandwidth == 0)
+            return now;
+
+        const auto transmit = std::chrono::nanoseconds(
+            bytes * 1'000'000'000ull / _impairment.bandwidth);
+        _linkFree = std::max(_linkFree, now) + transmit;
+        return _linkFree;
+    }
+
+    bool ImpairedLink::_queueFull(Clock::time_point now, size_t bytes) const
+    {
+        if (_impairment.bandwidth == 0 || _linkFree <= now)
+            return false;
+
+        const auto backlog = std::chrono::duration_cast<std::chrono::nanoseconds>(_linkFree - now);
+        const uint64_t queued = static_cast<uint64_t>(backlog.count()) * _impairment.bandwidth
+                              / 1'000'000'000ull;
+        return queued + bytes > _impairment.queueLimit;
+    }
+
+    ImpairedLink::Clock::duration ImpairedLink::_latency(void)
+    {
+        const auto jitter = _impairment.jitter.count();
+        if (jitter == 0)
+            return _impairment.delay;
+
+        std::uniform_int_distribution<long long> spread(-jitter, jitter);
+        const auto latency = _impairment.delay + std::chrono::microseconds(spread(_rng));
+        return std::max<Clock::duration>(latency, Clock::duration::zero());
+    }
+
+    bool ImpairedLink::_chance(double probability)
+    {
+        if (probability <= 0.0)
+            return false;
+        return std::uniform_real_distribution<double>(0.0, 1.0)(_rng) < probability;
+    }
+}
@@ -17,8 +17,13 @@ using BufferSequence = std::array<asio::const_buffer, 2>;
 
 namespace rtp::net
 {
+    Packet::Packet()
+        : header{}, body(PacketBufferPool::acquire()), _readPos(0)
+    {
+    }
+
     Packet::Packet(OpCode op)
-        : header{}, body{}, _readPos(0)
+        : header{}, body(PacketBufferPool::acquire()), _readPos(0)
     {
         header.opCode = op;
         header.magic = MAGIC_NUMBER;
@@ -28,6 +33,45 @@ namespace rtp::net
         header.reserved = 0;
     }
 
+    Packet::Packet(const Packet &other)
+        : header(other.header), body(PacketBufferPool::acquire()), _readPos(other._readPos)
+    {
+        body.assign(other.body.begin(), other.body.end());
+    }
+
+    Packet::Packet(Packet &&other) noexcept
+        : header(other.header), body(std::move(other.body)), _readPos(other._readPos)
+    {
+        other._readPos = 0;
+    }
+
+    Packet &Packet::operator=(const Packet &other)
+    {
+        if (this != &other) {
+            header = other.header;
+            body.assign(other.body.begin(), other.body.end());
+            _readPos = other._readPos;
+        }
+        return *this;
+    }
+
+    Packet &Packet::operator=(Packet &&other) noexcept
+    {
+        if (this != &other) {
+            PacketBufferPool::release(std::move(body));
+            header = other.header;
+            body = std::move(other.body);
+            _readPos = other._readPos;
+            other._readPos = 0;
+        }
+        return *this;
+    }
+
+    Packet::~Packet()
+    {
+        PacketBufferPool::release(std::move(body));
+    }
+
     void Packet::resetRead(void)
     {
         _readPos = 0;
@@ -0,0 +1,127 @@
+/**
+ * File   : PacketBufferPool.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Network/PacketBufferPool.hpp"
+#include "RType/Network/Packet.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+namespace rtp::net
+{
+    namespace
+    {
+        struct SharedFreelist {
+            std::mutex mutex;
+            std::vector<PacketBufferPool::Buffer> buffers;
+
+            SharedFreelist()
+            {
+                buffers.reserve(PacketBufferPool::SHARED_LIMIT);
+            }
+        };
+
+        SharedFreelist &shared(void)
+        {
+            static SharedFreelist instance;
+            return instance;
+        }
+
+        struct LocalFreelist {
+            std::vector<PacketBufferPool::Buffer> buffers;
+
+            LocalFreelist()
+            {
+                shared();
+                buffers.reserve(PacketBufferPool::LOCAL_LIMIT);
+            }
+
+            ~LocalFreelist()
+            {
+                auto &central = shared();
+                std::lock_guard<std::mutex> lock(central.mutex);
+                for (auto &buffer : buffers) {
+                    if (central.buffers.size() >= PacketBufferPool::SHARED_LIMIT)
+                        break;
+                    central.buffers.push_back(std::move(buffer));
+                }
+            }
+        };
+
+        LocalFreelist &local(void)
+        {
+            thread_local LocalFreelist instance;
+            return instance;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    PacketBufferPool::Buffer PacketBufferPool::acquire(void)
+    {
+        auto &cache = local().buffers;
+
+        if (cache.empty()) {
+            auto &central = shared();
+            std::lock_guard<std::mutex> lock(central.mutex);
+            const std::size_t count = std::min(TRANSFER_BATCH, central.buffers.size());
+            for (std::size_t i = 0; i < count; ++i) {
+                cache.push_back(std::move(central.buffers.back()));
+                central.buffers.pop_back();
+            }
+        }
+
+        if (cache.empty()) {
+            Buffer buffer;
+            buffer.reserve(MTU_SIZE);
+            return buffer;
+        }
+
+        Buffer buffer = std::move(cache.back());
+        cache.pop_back();
+        buffer.clear();
+        return buffer;
+    }
+
+    void PacketBufferPool::release(Buffer &&buffer) noexcept
+    {
+        const std::size_t capacity = buffer.capacity();
+        if (capacity < MTU_SIZE || capacity > MAX_BODY_SIZE) {
+            Buffer{}.swap(buffer);
+            return;
+        }
+
+        auto &cache = local().buffers;
+        if (cache.size() >= LOCAL_LIMIT) {
+            auto &central = shared();
+            std::lock_guard<std::mutex> lock(central.mutex);
+            for (std::size_t i = 0; i < TRANSFER_BATCH; ++i) {
+                if (central.buffers.size() >= SHARED_LIMIT) {
+                    cache.pop_back();
+                    continue;
+                }
+                central.buffers.push_back(std::move(cache.back()));
+                cache.pop_back();
+            }
+        }
+        cache.push_back(std::move(buffer));
+    }
+
+    std::size_t PacketBufferPool::localCount(void) noexcept
+    {
+        return local().buffers.size();
+    }
+
+    std::size_t PacketBufferPool::sharedCount(void) noexcept
+    {
+        auto &central = shared();
+        std::lock_guard<std::mutex> lock(central.mutex);
+        return central.buffers.size();
+    }
+}
@@ -0,0 +1,302 @@
+/**
+ * File   : ReliableChannel.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Network/ReliableChannel.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace rtp::net
+{
+    namespace
+    {
+        /**
+         * @brief Header::reserved flag telling that ackId/ack bits are meaningful
+         */
+        constexpr uint8_t ACK_VALID = 0x01;
+
+        /**
+         * @brief Offset of the message count byte in a datagram body
+         */
+        constexpr size_t COUNT_OFFSET = sizeof(uint32_t);
+
+        /**
+         * @brief Per-message overhead: id, opCode and size
+         */
+        constexpr size_t MESSAGE_OVERHEAD = sizeof(uint16_t) + sizeof(uint8_t) + sizeof(uint16_t);
+
+        bool sequenceGreater(uint16_t a, uint16_t b)
+        {
+            return ((a > b) && (a - b <= 32768)) || ((a < b) && (b - a > 32768));
+        }
+
+        size_t distance(uint16_t from, uint16_t to)
+        {
+            return static_cast<uint16_t>(to - from);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    ReliableChannel::ReliableChannel(void)
+    {
+        _received.fill(-1);
+    }
+
+    void ReliableChannel::send(const Packet &message)
+    {
+        if (message.body.size() > std::numeric_limits<uint16_t>::max()) {
+            throw std::length_error("Reliable message too large");
+        }
+
+        std::lock_guard<std::mutex> lock(_mutex);
+        ++_stats.messagesSent;
+        _backlog.emplace_back(message.header.opCode,
+                              std::vector<uint8_t>(message.body.begin(), message.body.end()));
+        _admitBacklog();
+    }
+
+    size_t ReliableChannel::flush(Clock::time_point now, std::vector<Packet> &out)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        const Clock::duration delay = _resendDelay();
+        const size_t before = out.size();
+
+        std::vector<uint16_t> ids;
+        Packet datagram;
+        bool open = false;
+
+        auto close = [&](void) {
+            datagram.body[COUNT_OFFSET] = static_cast<uint8_t>(ids.size());
+            SentDatagram &slot = _sent[datagram.header.sequenceId % WINDOW_SIZE];
+            slot.used = true;
+            slot.acked = false;
+            slot.sequence = datagram.header.sequenceId;
+            slot.sentAt = now;
+            slot.messageIds.assign(ids.begin(), ids.end());
+            ids.clear();
+            out.push_back(std::move(datagram));
+            ++_stats.datagramsSent;
+            _ackPending = false;
+            open = false;
+        };
+
+        for (uint16_t id = _oldestUnacked; id != _nextMessageId; ++id) {
+            OutgoingMessage &msg = _outgoing[id % WINDOW_SIZE];
+            if (!msg.used || (msg.everSent && now - msg.lastSent < delay)) {
+                continue;
+            }
+
+            const size_t size = MESSAGE_OVERHEAD + msg.body.size();
+            if (open && (datagram.body.size() + size > MTU_SIZE ||
+                         ids.size() >= MAX_MESSAGES_PER_DATAGRAM)) {
+                close();
+            }
+            if (!open) {
+                datagram = _beginDatagram();
+                open = true;
+            }
+
+            datagram << msg.id << msg.opCode << static_cast<uint16_t>(msg.body.size());
+            datagram.writeBytes(msg.body);
+            ids.push_back(msg.id);
+
+            if (msg.everSent) {
+                ++_stats.messagesResent;
+            }
+            msg.everSent = true;
+            msg.lastSent = now;
+        }
+
+        if (open) {
+            close();
+        } else if (_ackPending) {
+            datagram = _beginDatagram();
+            close();
+        }
+        return out.size() - before;
+    }
+
+    bool ReliableChannel::receive(Packet &datagram, Clock::time_point now,
+                                  std::vector<Packet> &delivered)
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        try {
+            uint32_t ackBits = 0;
+            uint8_t count = 0;
+            datagram >> ackBits >> count;
+
+            if (datagram.header.reserved & ACK_VALID) {
+                const uint16_t ack = datagram.header.ackId;
+                _onDatagramAcked(ack, now);
+                for (uint16_t i = 0; i < 32; ++i) {
+                    if (ackBits & (1u << i)) {
+                        _onDatagramAcked(static_cast<uint16_t>(ack - 1 - i), now);
+                    }
+                }
+            }
+
+            _ackPending = true;
+            if (!_recordReceived(datagram.header.sequenceId)) {
+                return true;
+            }
+            ++_stats.datagramsReceived;
+
+            for (uint8_t i = 0; i < count; ++i) {
+                uint16_t id = 0;
+                OpCode opCode = OpCode::None;
+                uint16_t size = 0;
+                datagram >> id >> opCode >> size;
+                const auto bytes = datagram.readBytes(size);
+
+                if (distance(_nextDeliverId, id) >= WINDOW_SIZE) {
+                    continue;
+                }
+                IncomingMessage &slot = _incoming[id % WINDOW_SIZE];
+                if (slot.used) {
+                    continue;
+                }
+                slot.used = true;
+                slot.id = id;
+                slot.opCode = opCode;
+                slot.body.assign(bytes.begin(), bytes.end());
+            }
+        } catch (const std::out_of_range &) {
+            return false;
+        }
+
+        for (;;) {
+            IncomingMessage &slot = _incoming[_nextDeliverId % WINDOW_SIZE];
+            if (!slot.used || slot.id != _nextDeliverId) {
+                break;
+            }
+            Packet message(slot.opCode);
+            message.writeBytes(slot.body);
+            delivered.push_back(std::move(message));
+            slot.used = false;
+            slot.body.clear();
+            ++_nextDeliverId;
+            ++_stats.messagesDelivered;
+        }
+        return true;
+    }
+
+    ReliableChannel::Clock::duration ReliableChannel::getRtt(void) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _rtt;
+    }
+
+    size_t ReliableChannel::getPendingCount(void) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        size_t pending = _backlog.size();
+        for (uint16_t id = _oldestUnacked; id != _nextMessageId; ++id) {
+            pending += _outgoing[id % WINDOW_SIZE].used;
+        }
+        return pending;
+    }
+
+    ReliableChannel::Stats ReliableChannel::getStats(void) const
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        return _stats;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    void ReliableChannel::_admitBacklog(void)
+    {
+        while (!_backlog.empty() && distance(_oldestUnacked, _nextMessageId) < WINDOW_SIZE) {
+            auto &[opCode, body] = _backlog.front();
+            OutgoingMessage &slot = _outgoing[_nextMessageId % WINDOW_SIZE];
+            slot.used = true;
+            slot.id = _nextMessageId;
+            slot.everSent = false;
+            slot.opCode = opCode;
+            slot.body = std::move(body);
+            ++_nextMessageId;
+            _backlog.pop_front();
+        }
+    }
+
+    void ReliableChannel::_onDatagramAcked(uint16_t sequence, Clock::time_point now)
+    {
+        SentDatagram &slot = _sent[sequence % WINDOW_SIZE];
+        if (!slot.used || slot.acked || slot.sequence != sequence) {
+            return;
+        }
+        slot.acked = true;
+        _rtt += (now - slot.sentAt - _rtt) / 8;
+
+        for (uint16_t id : slot.messageIds) {
+            OutgoingMessage &msg = _outgoing[id % WINDOW_SIZE];
+            if (msg.used && msg.id == id) {
+                msg.used = false;
+                msg.body.clear();
+            }
+        }
+        while (_oldestUnacked != _nextMessageId && !_outgoing[_oldestUnacked % WINDOW_SIZE].used) {
+            ++_oldestUnacked;
+        }
+        _admitBacklog();
+    }
+
+    bool ReliableChannel::_recordReceived(uint16_t sequence)
+    {
+        int32_t &slot = _received[sequence % WINDOW_SIZE];
+
+        if (!_hasRemote) {
+            _hasRemote = true;
+            _remoteSequence = sequence;
+        } else if (sequenceGreater(sequence, _remoteSequence)) {
+            const size_t gap = std::min(distance(_remoteSequence, sequence), WINDOW_SIZE);
+            for (size_t i = 1; i < gap; ++i) {
+                _received[static_cast<uint16_t>(sequence - i) % WINDOW_SIZE] = -1;
+            }
+            _remoteSequence = sequence;
+        } else if (slot == sequence || distance(sequence, _remoteSequence) >= WINDOW_SIZE) {
+            return false;
+        }
+        slot = sequence;
+        return true;
+    }
+
+    uint32_t ReliableChannel::_ackBits(void) const
+    {
+        uint32_t bits = 0;
+        for (uint16_t i = 0; i < 32; ++i) {
+            const auto sequence = static_cast<uint16_t>(_remoteSequence - 1 - i);
+            if (_received[sequence % WINDOW_SIZE] == sequence) {
+                bits |= 1u << i;
+            }
+        }
+        return bits;
+    }
+
+    ReliableChannel::Clock::duration ReliableChannel::_resendDelay(void) const
+    {
+        using namespace std::chrono_literals;
+        return std::clamp<Clock::duration>(_rtt + _rtt / 2, 20ms, 500ms);
+    }
+
+    Packet ReliableChannel::_beginDatagram(void)
+    {
+        Packet datagram(OpCode::Reliable);
+        datagram.header.sequenceId = _nextSequence++;
+        datagram.header.ackId = _remoteSequence;
+        datagram.header.reserved = _hasRemote ? ACK_VALID : 0;
+        datagram << _ackBits() << static_cast<uint8_t>(0);
+        return datagram;
+    }
+}
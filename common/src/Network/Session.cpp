@@ -8,6 +8,8 @@
 #include "RType/Network/Session.hpp"
 #include "RType/Logger.hpp"
 
+#include <algorithm>
+
 namespace rtp::net
 {
     //////////////////////////////////////////////////////////////////////////
@@ -20,7 +22,7 @@ namespace rtp::net
                      IEventPublisher &publisher)
         : _id(id),
           _socket(std::move(socket)),
-          _serverUdpSocket(serverUdpSocket),
+          _serverUdpSocket(&serverUdpSocket),
           _publisher(publisher),
           _timer(_socket.get_executor())
     {
@@ -31,6 +33,9 @@ namespace rtp::net
     }
 
     void Session::start() {
+        asio::error_code ec;
+        _socket.set_option(asio::ip::tcp::no_delay(true), ec);
+
         asio::co_spawn(_socket.get_executor(), 
             [self = shared_from_this()] { return self->reader(); }, 
             asio::detached);
@@ -49,19 +54,81 @@ namespace rtp::net
     }
 
     void Session::send(const Packet& packet, NetworkMode mode) {
+        if (mode == NetworkMode::ReliableUDP) {
+            if (_hasUdp) {
+                _reliable.send(packet);
+                return;
+            }
+            mode = NetworkMode::TCP;
+        }
+
+        if (_traffic != nullptr && (mode == NetworkMode::TCP || _hasUdp)) {
+            _traffic->record(TrafficDirection::Outbound, mode, packet.header.opCode,
+                             sizeof(Header) + packet.body.size());
+        }
+
         if (mode == NetworkMode::TCP) {
             std::lock_guard<std::mutex> lock(_writeMutex);
             _writeQueue.push_back(packet);
-            _timer.cancel();
+            const size_t depth = _writeQueue.size();
+            _writeQueueDepth.store(depth, std::memory_order_relaxed);
+            if (depth > _writeQueuePeak.load(std::memory_order_relaxed)) {
+                _writeQueuePeak.store(depth, std::memory_order_relaxed);
+            }
+            if (_flushPolicy == TcpFlushPolicy::Immediate) {
+                requestWrite();
+            }
         } 
         else if (mode == NetworkMode::UDP && _hasUdp) {
             auto pkt = std::make_shared<Packet>(packet); 
             auto buffers = pkt->getBufferSequence();
-            _serverUdpSocket.async_send_to(buffers, _udpEndpoint, 
-                [](const asio::error_code&, std::size_t){});
+            _serverUdpSocket->async_send_to(buffers, _udpEndpoint, 
+                [pkt](const asio::error_code&, std::size_t){});
         }
     }
 
+    void Session::flush() {
+        std::lock_guard<std::mutex> lock(_writeMutex);
+        if (!_writeQueue.empty()) {
+            requestWrite();
+        }
+    }
+
+    void Session::setFlushPolicy(TcpFlushPolicy policy) {
+        std::lock_guard<std::mutex> lock(_writeMutex);
+        _flushPolicy = policy;
+    }
+
+    Session::WriteStats Session::getWriteStats() const {
+        return {
+            _writeCalls.load(std::memory_order_relaxed),
+            _packetsWritten.load(std::memory_order_relaxed),
+            _bytesWritten.load(std::memory_order_relaxed)
+        };
+    }
+
+    void Session::setTrafficCounters(TrafficCounters *counters) {
+        _traffic = counters;
+    }
+
+    void Session::recordRtt(std::chrono::microseconds sample) {
+        const auto us = static_cast<uint32_t>(std::max<int64_t>(sample.count(), 1));
+        const uint32_t previous = _rttUs.load(std::memory_order_relaxed);
+        // RFC 6298 smoothing, the first sample seeds the estimate
+        const uint32_t smoothed = previous == 0
+            ? us
+            : static_cast<uint32_t>((7ull * previous + us) / 8);
+        _rttUs.store(smoothed, std::memory_order_relaxed);
+    }
+
+    Session::LinkStats Session::getLinkStats() const {
+        return {
+            _rttUs.load(std::memory_order_relaxed),
+            _writeQueueDepth.load(std::memory_order_relaxed),
+            _writeQueuePeak.load(std::memory_order_relaxed)
+        };
+    }
+
     void Session::setId(uint32_t id) {
         _id = id;
     }
@@ -79,6 +146,12 @@ namespace rtp::net
         _hasUdp = true;
     }
 
+    void Session::setUdpEndpoint(const asio::ip::udp::endpoint& endpoint,
+                                 asio::ip::udp::socket& socket) {
+        _serverUdpSocket = &socket;
+        setUdpEndpoint(endpoint);
+    }
+
     //////////////////////////////////////////////////////////////////////////////
     // Private API
     //////////////////////////////////////////////////////////////////////////////
@@ -96,6 +169,7 @@ namespace rtp::net
                 header.sessionId = Packet::from_network(header.sessionId);
                 
                 if (header.magic != MAGIC_NUMBER) break;
+                if (header.bodySize > MAX_BODY_SIZE) break;
 
                 Packet packet;
                 packet.header = header;
@@ -105,7 +179,11 @@ namespace rtp::net
                     co_await asio::async_read(_socket, asio::buffer(packet.body), asio::use_awaitable);
                 }
 
-                _publisher.publishEvent({_id, packet});
+                if (_traffic != nullptr) {
+                    _traffic->record(TrafficDirection::Inbound, NetworkMode::TCP,
+                                     header.opCode, sizeof(Header) + header.bodySize);
+                }
+                _publisher.publishEvent({_id, std::move(packet)});
             }
         } catch (std::exception&) {
             stop();
@@ -116,23 +194,61 @@ namespace rtp::net
     asio::awaitable<void> Session::writer() {
         try {
             while (!_stopped) {
-                if (_writeQueue.empty()) {
+                {
+                    std::lock_guard<std::mutex> lock(_writeMutex);
+                    if (_writeRequested) {
+                        _writeBatch.swap(_writeQueue);
+                        _writeRequested = false;
+                        _writeQueueDepth.store(0, std::memory_order_relaxed);
+                    }
+                }
+
+                if (_writeBatch.empty()) {
                     asio::error_code ec;
                     _timer.expires_at(std::chrono::steady_clock::time_point::max());
                     co_await _timer.async_wait(redirect_error(asio::use_awaitable, ec));
-                } else {
-                    Packet packet;
-                    {
-                        std::lock_guard<std::mutex> lock(_writeMutex);
-                        packet = _writeQueue.front();
-                        _writeQueue.pop_front();
+                    continue;
+                }
+
+                _writeBuffers.clear();
+                for (const auto &packet : _writeBatch) {
+                    for (const auto &buffer : packet.getBufferSequence()) {
+                        if (buffer.size() > 0) {
+                            _writeBuffers.push_back(buffer);
+                        }
                     }
-                    co_await asio::async_write(_socket, packet.getBufferSequence(), asio::use_awaitable);
                 }
+                // async_write splits gathers into 16-buffer chunks, write_some
+                // hands up to 64 buffers to a single writev
+                std::span<asio::const_buffer> pending(_writeBuffers);
+                while (!pending.empty()) {
+                    size_t bytes = co_await _socket.async_write_some(pending, asio::use_awaitable);
+                    _writeCalls.fetch_add(1, std::memory_order_relaxed);
+                    _bytesWritten.fetch_add(bytes, std::memory_order_relaxed);
+                    while (!pending.empty() && bytes >= pending.front().size()) {
+                        bytes -= pending.front().size();
+                        pending = pending.subspan(1);
+                    }
+                    if (!pending.empty()) {
+                        pending.front() += bytes;
+                    }
+                }
+                _packetsWritten.fetch_add(_writeBatch.size(), std::memory_order_relaxed);
+                _writeBatch.clear();
             }
         } catch (std::exception&) {
             stop();
         }
     }
 
+    void Session::requestWrite() {
+        if (_writeRequested) {
+            return;
+        }
+        _writeRequested = true;
+        asio::post(_socket.get_executor(), [self = shared_from_this()]() {
+            self->_timer.cancel();
+        });
+    }
+
 } // namespace rtp::net
\ No newline at end of file
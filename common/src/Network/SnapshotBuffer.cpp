@@ -0,0 +1,195 @@
+/**
+ * File   : SnapshotBuffer.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Network/SnapshotBuffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace rtp::net
+{
+    namespace
+    {
+        /**
+         * @brief Shortest window the tick rate is measured over, in seconds
+         */
+        constexpr double RATE_WINDOW = 1.0;
+
+        /**
+         * @brief Windows longer than this (pause, room change) are not measured
+         */
+        constexpr double RATE_WINDOW_MAX = 5.0;
+
+        /**
+         * @brief Drift, in seconds, past which the clock jumps instead of converging
+         */
+        constexpr double RESYNC_THRESHOLD = 0.5;
+
+        /**
+         * @brief Fraction of the drift corrected per second
+         */
+        constexpr double CORRECTION_RATE = 2.0;
+
+        float lerp(float a, float b, float t)
+        {
+            return a + (b - a) * t;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // SnapshotBuffer
+    //////////////////////////////////////////////////////////////////////////
+
+    bool SnapshotBuffer::push(const Sample &sample)
+    {
+        const auto begin = _samples.begin();
+        const auto end = begin + _count;
+        const auto it = std::lower_bound(begin, end, sample.tick,
+            [](const Sample &s, uint32_t tick) { return s.tick < tick; });
+
+        if (it != end && it->tick == sample.tick) {
+            return false;
+        }
+        if (_count == CAPACITY) {
+            if (it == begin) {
+                return false;
+            }
+            std::move(begin + 1, it, begin);
+            *(it - 1) = sample;
+            return true;
+        }
+        std::move_backward(it, end, end + 1);
+        *it = sample;
+        ++_count;
+        return true;
+    }
+
+    bool SnapshotBuffer::sample(double tick, float tickRate, Sample &out) const
+    {
+        if (_count == 0) {
+            return false;
+        }
+
+        const Sample &oldest = _samples[0];
+        const Sample &newest = _samples[_count - 1];
+
+        if (tick <= oldest.tick) {
+            out = oldest;
+        } else if (tick >= newest.tick) {
+            out = newest;
+            const float ahead = std::min(
+                static_cast<float>(tick - newest.tick) / tickRate, MAX_EXTRAPOLATION);
+            out.position = {newest.position.x + newest.velocity.x * ahead,
+                            newest.position.y + newest.velocity.y * ahead};
+        } else {
+            size_t next = 1;
+            while (_samples[next].tick < tick) {
+                ++next;
+            }
+            const Sample &a = _samples[next - 1];
+            const Sample &b = _samples[next];
+            const float t = static_cast<float>((tick - a.tick) / (b.tick - a.tick));
+            out.position = {lerp(a.position.x, b.position.x, t), lerp(a.position.y, b.position.y, t)};
+            out.velocity = {lerp(a.velocity.x, b.velocity.x, t), lerp(a.velocity.y, b.velocity.y, t)};
+            out.rotation = lerp(a.rotation, b.rotation, t);
+        }
+        out.tick = static_cast<uint32_t>(std::max(tick, 0.0));
+        return true;
+    }
+
+    void SnapshotBuffer::clear(void)
+    {
+        _count = 0;
+    }
+
+    size_t SnapshotBuffer::size(void) const
+    {
+        return _count;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // InterpolationClock
+    //////////////////////////////////////////////////////////////////////////
+
+    InterpolationClock::InterpolationClock(float delay, float tickRate)
+        : _delay(delay), _tickRate(tickRate)
+    {
+    }
+
+    void InterpolationClock::onSnapshot(uint32_t tick, Clock::time_point now)
+    {
+        if (!_synced) {
+            _synced = true;
+            _newestTick = tick;
+            _renderTick = _targetTick();
+            _anchorTick = tick;
+            _anchorTime = now;
+            return;
+        }
+        if (tick <= _newestTick) {
+            return;
+        }
+        _newestTick = tick;
+
+        const double elapsed = std::chrono::duration<double>(now - _anchorTime).count();
+        if (elapsed >= RATE_WINDOW) {
+            if (elapsed <= RATE_WINDOW_MAX) {
+                const double measured = (tick - _anchorTick) / elapsed;
+                _tickRate += static_cast<float>((std::clamp(measured, 10.0, 240.0) - _tickRate) * 0.25);
+            }
+            _anchorTick = tick;
+            _anchorTime = now;
+        }
+    }
+
+    double InterpolationClock::advance(float dt)
+    {
+        if (!_synced) {
+            return _renderTick;
+        }
+        _renderTick += dt * _tickRate;
+
+        const double drift = _targetTick() - _renderTick;
+        if (std::abs(drift) > RESYNC_THRESHOLD * _tickRate) {
+            _renderTick += drift;
+        } else {
+            _renderTick += drift * std::min(1.0, dt * CORRECTION_RATE);
+        }
+        return _renderTick;
+    }
+
+    void InterpolationClock::reset(void)
+    {
+        _synced = false;
+        _newestTick = 0;
+        _renderTick = 0.0;
+    }
+
+    bool InterpolationClock::isSynced(void) const
+    {
+        return _synced;
+    }
+
+    double InterpolationClock::getRenderTick(void) const
+    {
+        return _renderTick;
+    }
+
+    float InterpolationClock::getTickRate(void) const
+    {
+        return _tickRate;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    double InterpolationClock::_targetTick(void) const
+    {
+        return static_cast<double>(_newestTick) - _delay * _tickRate;
+    }
+}
@@ -0,0 +1,100 @@
+/**
+ * File   : TrafficStats.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Network/TrafficStats.hpp"
+
+namespace rtp::net
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    const TrafficCount &TrafficSnapshot::at(TrafficDirection direction, NetworkMode transport,
+                                            OpCode opCode) const
+    {
+        return cells[index(direction, transport, opCode)];
+    }
+
+    TrafficCount TrafficSnapshot::total(TrafficDirection direction, NetworkMode transport) const
+    {
+        TrafficCount sum;
+        const size_t first = index(direction, transport, OpCode::None);
+        for (size_t i = first; i < first + OPCODES; ++i) {
+            sum.packets += cells[i].packets;
+            sum.bytes += cells[i].bytes;
+        }
+        return sum;
+    }
+
+    size_t TrafficSnapshot::index(TrafficDirection direction, NetworkMode transport,
+                                  OpCode opCode) noexcept
+    {
+        const size_t dir = direction == TrafficDirection::Inbound ? 0 : 1;
+        const size_t mode = transport == NetworkMode::TCP ? 0 : 1;
+        return (dir * 2 + mode) * OPCODES + static_cast<uint8_t>(opCode);
+    }
+
+    void TrafficCounters::record(TrafficDirection direction, NetworkMode transport,
+                                 OpCode opCode, size_t bytes) noexcept
+    {
+        Cell &cell = _cells[TrafficSnapshot::index(direction, transport, opCode)];
+        cell.packets.fetch_add(1, std::memory_order_relaxed);
+        cell.bytes.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    TrafficSnapshot TrafficCounters::snapshot(void) const
+    {
+        TrafficSnapshot out;
+        for (size_t i = 0; i < _cells.size(); ++i) {
+            out.cells[i].packets = _cells[i].packets.load(std::memory_order_relaxed);
+            out.cells[i].bytes = _cells[i].bytes.load(std::memory_order_relaxed);
+        }
+        return out;
+    }
+
+    std::string_view toString(OpCode opCode) noexcept
+    {
+        switch (opCode) {
+            using enum OpCode;
+            case None: return "None";
+            case Hello: return "Hello";
+            case Welcome: return "Welcome";
+            case Disconnect: return "Disconnect";
+            case LoginRequest: return "LoginRequest";
+            case RegisterRequest: return "RegisterRequest";
+            case LoginResponse: return "LoginResponse";
+            case RegisterResponse: return "RegisterResponse";
+            case ListRooms: return "ListRooms";
+            case RoomList: return "RoomList";
+            case CreateRoom: return "CreateRoom";
+            case JoinRoom: return "JoinRoom";
+            case LeaveRoom: return "LeaveRoom";
+            case RoomUpdate: return "RoomUpdate";
+            case SetReady: return "SetReady";
+            case RoomChatSended: return "RoomChatSended";
+            case RoomChatReceived: return "RoomChatReceived";
+            case StartGame: return "StartGame";
+            case InputTick: return "InputTick";
+            case UpdateSelectedWeapon: return "UpdateSelectedWeapon";
+            case EntitySpawn: return "EntitySpawn";
+            case EntityDeath: return "EntityDeath";
+            case AmmoUpdate: return "AmmoUpdate";
+            case Ping: return "Ping";
+            case Pong: return "Pong";
+            case DebugModeUpdate: return "DebugModeUpdate";
+            case Kicked: return "Kicked";
+            case BeamState: return "BeamState";
+            case ScoreUpdate: return "ScoreUpdate";
+            case GameOver: return "GameOver";
+            case HealthUpdate: return "HealthUpdate";
+            case EntitySpawnBatch: return "EntitySpawnBatch";
+            case EntityDeathBatch: return "EntityDeathBatch";
+            case Reliable: return "Reliable";
+        }
+        return "Unknown";
+    }
+}
@@ -0,0 +1,119 @@
+/**
+ * File   : UdpBatch.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "RType/Network/UdpBatch.hpp"
+
+#if defined(RTYPE_HAS_UDP_MMSG)
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+namespace rtp::net
+{
+    //////////////////////////////////////////////////////////////////////////
+    // UdpBatchReceiver
+    //////////////////////////////////////////////////////////////////////////
+
+    UdpBatchReceiver::UdpBatchReceiver(void)
+    {
+        for (size_t i = 0; i < UDP_BATCH_SIZE; ++i) {
+            _iovecs[i].iov_base = _slots[i].data();
+            _iovecs[i].iov_len = _slots[i].size();
+        }
+    }
+
+    size_t UdpBatchReceiver::receive(asio::ip::udp::socket &socket, asio::error_code &ec)
+    {
+        ec.clear();
+        for (size_t i = 0; i < UDP_BATCH_SIZE; ++i) {
+            std::memset(&_messages[i], 0, sizeof(::mmsghdr));
+            _messages[i].msg_hdr.msg_iov = &_iovecs[i];
+            _messages[i].msg_hdr.msg_iovlen = 1;
+            _messages[i].msg_hdr.msg_name = _endpoints[i].data();
+            _messages[i].msg_hdr.msg_namelen =
+                static_cast<socklen_t>(_endpoints[i].capacity());
+        }
+
+        const int received = ::recvmmsg(socket.native_handle(), _messages.data(),
+                                        UDP_BATCH_SIZE, MSG_DONTWAIT, nullptr);
+        if (received < 0) {
+            ec = asio::error_code(errno, asio::error::get_system_category());
+            return 0;
+        }
+
+        for (int i = 0; i < received; ++i) {
+            _endpoints[i].resize(_messages[i].msg_hdr.msg_namelen);
+            _sizes[i] = _messages[i].msg_len;
+        }
+        return static_cast<size_t>(received);
+    }
+
+    std::span<const uint8_t> UdpBatchReceiver::data(size_t index) const
+    {
+        return {_slots[index].data(), _sizes[index]};
+    }
+
+    const asio::ip::udp::endpoint &UdpBatchReceiver::endpoint(size_t index) const
+    {
+        return _endpoints[index];
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // UdpBatchSender
+    //////////////////////////////////////////////////////////////////////////
+
+    void UdpBatchSender::push(const asio::ip::udp::endpoint &endpoint, const Packet &packet)
+    {
+        _queue.push_back({endpoint, packet});
+    }
+
+    size_t UdpBatchSender::flush(asio::ip::udp::socket &socket, asio::error_code &ec)
+    {
+        ec.clear();
+        size_t sent = 0;
+
+        while (sent < _queue.size()) {
+            const size_t count = std::min(UDP_BATCH_SIZE, _queue.size() - sent);
+
+            for (size_t i = 0; i < count; ++i) {
+                auto &datagram = _queue[sent + i];
+                const auto buffers = datagram.packet.getBufferSequence();
+
+                _iovecs[i * 2].iov_base = const_cast<void *>(buffers[0].data());
+                _iovecs[i * 2].iov_len = buffers[0].size();
+                _iovecs[i * 2 + 1].iov_base = const_cast<void *>(buffers[1].data());
+                _iovecs[i * 2 + 1].iov_len = buffers[1].size();
+
+                std::memset(&_messages[i], 0, sizeof(::mmsghdr));
+                _messages[i].msg_hdr.msg_iov = &_iovecs[i * 2];
+                _messages[i].msg_hdr.msg_iovlen = 2;
+                _messages[i].msg_hdr.msg_name = datagram.endpoint.data();
+                _messages[i].msg_hdr.msg_namelen =
+                    static_cast<socklen_t>(datagram.endpoint.size());
+            }
+
+            const int result = ::sendmmsg(socket.native_handle(), _messages.data(),
+                                          static_cast<unsigned int>(count), MSG_DONTWAIT);
+            if (result < 0) {
+                ec = asio::error_code(errno, asio::error::get_system_category());
+                break;
+            }
+            sent += static_cast<size_t>(result);
+        }
+
+        _queue.clear();
+        return sent;
+    }
+
+    size_t UdpBatchSender::pending(void) const
+    {
+        return _queue.size();
+    }
+}
+
+#endif /* RTYPE_HAS_UDP_MMSG */
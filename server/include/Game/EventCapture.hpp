@@ -0,0 +1,148 @@
+/**
+ * File   : EventCapture.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_GAME_EVENTCAPTURE_HPP_
+    #define RTYPE_GAME_EVENTCAPTURE_HPP_
+
+    #include "RType/Network/INetwork.hpp"
+
+    #include <array>
+    #include <cstdint>
+    #include <fstream>
+    #include <string>
+
+/**
+ * @namespace rtp::server
+ * @brief R-Type server-side game management
+ */
+namespace rtp::server
+{
+    /**
+     * @brief File signature, "RTPC" read as little-endian
+     */
+    constexpr uint32_t CAPTURE_MAGIC = 0x43505452;
+
+    /**
+     * @brief Format version, bumped on incompatible changes
+     */
+    constexpr uint16_t CAPTURE_VERSION = 2;
+
+    /**
+     * @struct CaptureInfo
+     * @brief Server state a replay needs to take the same decisions
+     */
+    struct CaptureInfo {
+        uint32_t randSeed = 1;          /**< Seed of the room generators, see GameManager::setRandomSeed() */
+        uint32_t snapshotInterval = 2;  /**< Ticks between entity snapshots */
+        uint32_t tickRate = 60;         /**< Server ticks per second */
+        std::string accounts;           /**< Accounts file contents when the capture started */
+    };
+
+    /**
+     * @struct CapturedEvent
+     * @brief One inbound event and the tick that drained it
+     */
+    struct CapturedEvent {
+        uint32_t tick = 0;              /**< GameManager server tick before the tick ran */
+        net::NetworkEvent event{};      /**< Session and packet; only opCode and body are kept */
+    };
+
+    /**
+     * @class EventRecorder
+     * @brief Appends every inbound NetworkEvent to a capture file
+     *
+     * The file starts with the magic, the version and the CaptureInfo
+     * (little-endian u32 fields, accounts length-prefixed). Each event is
+     * then stored as LEB128 varints: tick delta, session ID, body size,
+     * with the OpCode byte before the body size and the raw body after.
+     * An InputTick costs its body plus four bytes. Header fields other
+     * than the OpCode are not used by the game and are dropped.
+     *
+     * The recorder runs on the game thread. Writes go through a 64 KiB
+     * buffer that is flushed at least once a second of ticks.
+     *
+     * @note The accounts file and login packets hold plaintext passwords,
+     *       treat captures as sensitive.
+     */
+    class EventRecorder final {
+        public:
+            static constexpr uint32_t FLUSH_TICKS = 60;     /**< Ticks between forced flushes */
+
+            /**
+             * @brief Create the capture file and write its header
+             * @param path File to create, truncated if it exists
+             * @param info Seed, snapshot interval and accounts
+             * @throw std::runtime_error if the file cannot be written
+             */
+            EventRecorder(const std::string &path, const CaptureInfo &info);
+
+            /**
+             * @brief Flush the remaining events
+             */
+            ~EventRecorder();
+
+            /**
+             * @brief Append an event
+             * @param tick Server tick draining the event, never decreasing
+             * @param event Event as polled from the network
+             */
+            void record(uint32_t tick, const net::NetworkEvent &event);
+
+            /**
+             * @brief Write buffered events to the file
+             */
+            void flush(void);
+
+            /**
+             * @brief Events recorded so far
+             * @return Event count
+             */
+            uint64_t getEventCount(void) const;
+
+        private:
+            std::array<char, 64 * 1024> _buffer{};  /**< Stream buffer */
+            std::ofstream _file;                    /**< Capture file */
+            uint32_t _lastTick = 0;                 /**< Tick of the previous event, for deltas */
+            uint32_t _lastFlushTick = 0;            /**< Tick of the previous flush */
+            uint64_t _events = 0;                   /**< Events recorded */
+    };
+
+    /**
+     * @class CaptureReader
+     * @brief Reads back a file written by EventRecorder
+     */
+    class CaptureReader final {
+        public:
+            /**
+             * @brief Open a capture and read its header
+             * @param path Capture file
+             * @throw std::runtime_error if the file is missing or not a capture
+             */
+            explicit CaptureReader(const std::string &path);
+
+            /**
+             * @brief Seed, snapshot interval and accounts of the recording server
+             * @return Capture header
+             */
+            const CaptureInfo &getInfo(void) const;
+
+            /**
+             * @brief Read the next event
+             * @param out Filled with the event
+             * @return false at the end of the file
+             * @throw std::runtime_error if the file is truncated inside an event
+             */
+            bool next(CapturedEvent &out);
+
+        private:
+            std::ifstream _file;        /**< Capture file */
+            CaptureInfo _info;          /**< Header */
+            uint32_t _tick = 0;         /**< Tick of the previous event */
+    };
+}
+
+#endif /* !RTYPE_GAME_EVENTCAPTURE_HPP_ */
@@ -20,8 +20,13 @@
     #include "RType/Logger.hpp"
     #include "Game/Room.hpp"
     #include "Game/Player.hpp"
+    #include "Game/EventCapture.hpp"
+    #include "Game/TickScheduler.hpp"
+    #include "Game/TickProfiler.hpp"
+    #include "Game/RoomSimulation.hpp"
     #include "ServerNetwork/ServerNetwork.hpp"
     #include "RType/ECS/Registry.hpp"
+    #include "RType/Thread/ThreadPool.hpp"
 
     /* Systems */
     #include "Systems/NetworkSyncSystem.hpp"
@@ -84,10 +89,105 @@ namespace rtp::server
 
             /**
              * @brief Main game loop
-             * @note Processes network events, updates game state, and manages rooms
+             * @note Runs tick() at the tick rate on absolute deadlines,
+             *       catching up when late (see TickScheduler)
              */
             void gameLoop(void);
 
+            /**
+             * @brief Run one server tick without waiting
+             * @note Drains and dispatches network events, updates the
+             *       systems, then flushes snapshots and queued packets.
+             *       gameLoop() calls it at the tick rate; rtype_replay as
+             *       fast as it can.
+             */
+            void tick(void);
+
+            /**
+             * @brief Set the simulation rate
+             * @param ticksPerSecond Ticks per second, also fixes dt to its inverse
+             * @note Clients predict their ship at 60 Hz, other rates desync them
+             */
+            void setTickRate(uint32_t ticksPerSecond);
+
+            /**
+             * @brief Get the simulation rate
+             * @return Ticks per second
+             */
+            uint32_t getTickRate(void) const;
+
+            /**
+             * @brief Run rooms on worker threads
+             * @param threads Worker count, 0 to run every room on the game thread
+             * @note Rooms are simulated concurrently and joined before
+             *       snapshots and network flushes. Each room draws from
+             *       its own generator, see setRandomSeed().
+             */
+            void setSimulationThreads(size_t threads);
+
+            /**
+             * @brief Set how often gameLoop() logs its tick statistics
+             * @param seconds Seconds of game time between summaries, 0 for none
+             */
+            void setStatsInterval(uint32_t seconds);
+
+            /**
+             * @brief Tick pacing counters and duration percentiles
+             * @return Scheduler statistics
+             * @note Game thread only
+             */
+            TickStats getTickStats(void) const;
+
+            /**
+             * @brief Rooms simulated by the last tick
+             * @return Number of running matches
+             */
+            size_t getSimulatedRoomCount(void) const;
+
+            /**
+             * @brief Time every system and network step of the tick
+             * @param enabled True to record per-system histograms and a trace
+             * @note The tick summary then lists the slowest zones, and the
+             *       /profile chat command exports the trace
+             */
+            void setProfiling(bool enabled);
+
+            /**
+             * @brief Per-system timings recorded while profiling
+             * @return Tick profiler
+             */
+            TickProfiler &getProfiler(void);
+
+            /**
+             * @brief Get the number of ticks run so far
+             * @return Server tick, also the arrival tick of the events the next tick drains
+             */
+            uint32_t getServerTick(void) const;
+
+            /**
+             * @brief Record every inbound event before it is dispatched
+             * @param recorder Capture to append to, nullptr to stop recording
+             */
+            void setEventRecorder(EventRecorder *recorder);
+
+            /**
+             * @brief Choose the accounts file used for login and registration
+             * @param path Accounts file
+             */
+            void setAccountsPath(const std::string &path);
+
+            /**
+             * @brief Seed the random draws of the rooms
+             * @param seed Capture seed, replays pass the same value
+             */
+            void setRandomSeed(uint32_t seed);
+
+            /**
+             * @brief Set how often rooms send entity snapshots
+             * @param ticks Send one snapshot every this many ticks
+             */
+            void setSnapshotInterval(uint32_t ticks);
+
             /**
              * @brief Start a game in the specified room
              * @param room Reference to the Room where the game will start
@@ -101,10 +201,21 @@ namespace rtp::server
             
             /**
              * @brief Process incoming network events with OpCode handling
-             * @note Handles player connections, disconnections, and packet processing
+             * @note Drains the network queue in batches of EVENT_BATCH_SIZE
              */
             void processNetworkEvents(void);
 
+            /**
+             * @brief Log the scheduler counters and tick percentiles
+             */
+            void logTickStats(void) const;
+
+            /**
+             * @brief Dispatch a single network event to its OpCode handler
+             * @param event Event drained from the network queue
+             */
+            void dispatchNetworkEvent(net::NetworkEvent &event);
+
             /**
              * @brief Handle a new player connection
              * @param sessionId Unique identifier of the connecting player
@@ -190,32 +301,34 @@ namespace rtp::server
             void sendChatToSession(uint32_t sessionId, const std::string& message);
             void sendSystemMessageToRoom(uint32_t roomId, const std::string& message);
 
-            void sendEntitySpawnToSessions(const ecs::Entity& entity,
+            void sendEntitySpawnToSessions(ecs::Registry& registry,
+                                           const ecs::Entity& entity,
                                            const std::vector<uint32_t>& sessions);
             void sendRoomEntitySpawnsToSession(uint32_t roomId, uint32_t sessionId);
 
         private:
             ServerNetwork &_networkManager;                            /**< Reference to the ServerNetwork instance */
 
-            ecs::Registry _registry;                              /**< ECS Registry for managing entities and components */
+            ecs::Registry _registry;                              /**< Registry of the session-level systems, game entities live in each RoomSimulation */
+            TickProfiler _profiler;                                    /**< Per-system timings, disabled unless profiling */
 
             std::unique_ptr<NetworkSyncSystem> _networkSyncSystem; /**< Server network system for handling network-related ECS operations */
-            std::unique_ptr<MovementSystem> _movementSystem;           /**< Movement system for updating entity positions */
             std::unique_ptr<AuthSystem> _authSystem;                   /**< Authentication system for handling player logins */
             std::unique_ptr<RoomSystem> _roomSystem;                   /**< Room system for handling room management */
             std::unique_ptr<PlayerSystem> _playerSystem;               /**< Player system for handling player-related operations */
-            std::unique_ptr<EntitySystem> _entitySystem;               /**< Entity system for handling entity-related operations */
-            std::unique_ptr<PlayerMouvementSystem> _playerMouvementSystem; /**< Player movement system for handling player-specific movement logic */
-            std::unique_ptr<PlayerShootSystem> _playerShootSystem;      /**< Player shooting system for handling bullets */
-            std::unique_ptr<EnemyAISystem> _enemyAISystem;              /**< Enemy AI system for movement patterns */
-            std::unique_ptr<LevelSystem> _levelSystem;                  /**< Level system for timed spawns */
-            std::unique_ptr<HomingSystem> _homingSystem;                /**< Homing system for tracker bullets */
-            std::unique_ptr<BoomerangSystem> _boomerangSystem;          /**< Boomerang system for boomerang projectiles */
-            std::unique_ptr<CollisionSystem> _collisionSystem;          /**< Collision system for pickups/obstacles */
-            std::unique_ptr<EnemyShootSystem> _enemyShootSystem;        /**< Enemy shooting system */
-            std::unique_ptr<BulletCleanupSystem> _bulletCleanupSystem;  /**< Bullet cleanup system */
+
+            std::unique_ptr<thread::ThreadPool> _simulationPool;       /**< Workers running rooms in parallel, null to run them on the game thread */
+
+            static constexpr uint32_t DEFAULT_TICK_RATE = 60;          /**< Ticks per second unless configured */
+            static constexpr size_t EVENT_BATCH_SIZE = 256;            /**< Events drained per pollEvents call */
+            static constexpr size_t SLOWEST_ZONES_LOGGED = 5;          /**< Zones listed by the tick summary */
+            std::vector<net::NetworkEvent> _eventBatch;                /**< Reused slots for drained events */
 
             uint32_t _serverTick = 0;                                  /**< Current server tick for synchronization */
+            uint32_t _tickRate = DEFAULT_TICK_RATE;                    /**< Ticks per second */
+            uint32_t _statsInterval = 0;                               /**< Seconds between tick summaries, 0 for none */
+            TickScheduler _scheduler{DEFAULT_TICK_RATE};               /**< Fixed-timestep pacing of gameLoop() */
+            EventRecorder *_recorder = nullptr;                        /**< Capture of inbound events, optional */
             mutable std::mutex _mutex;                                 /**< Mutex for thread-safe operations */
             bool _gamePaused = false;                                  /**< Global game pause flag */
             float _gameSpeed = 1.0f;                                   /**< Global game speed multiplier */
@@ -0,0 +1,87 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** LevelCache
+*/
+
+#pragma once
+
+#include "Game/LevelData.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace rtp::server {
+
+/**
+ * @class LevelCache
+ * @brief Levels parsed once and shared by every room
+ *
+ * A level is loaded the first time it is needed, or ahead of time on a
+ * background thread by preload(). The parsed LevelData is never modified
+ * afterwards, so rooms on different simulation threads read the same
+ * instance without locking. A level that fails to load is cached as
+ * missing and is not retried.
+ */
+class LevelCache {
+    public:
+        using LevelPtr = std::shared_ptr<const LevelData>;
+
+        /**
+         * @brief Register the file of a level
+         * @param levelId ID rooms ask for
+         * @param path Level JSON, its compiled .lvl is preferred when up to date
+         * @note Registering an ID again drops its cached level
+         */
+        void registerLevel(uint32_t levelId, const std::string& path);
+
+        /**
+         * @brief Start loading every registered level on background threads
+         * @note Levels already loaded or loading are left alone
+         */
+        void preload(void);
+
+        /**
+         * @brief Parsed level
+         * @param levelId Registered level ID
+         * @return The level, nullptr if it is unknown or failed to load
+         * @note Waits for a background load, or loads on the calling
+         *       thread when preload() did not run
+         */
+        LevelPtr get(uint32_t levelId);
+
+        /**
+         * @brief Number of registered levels
+         * @return Levels registered with registerLevel()
+         */
+        size_t size(void) const;
+
+    private:
+        /**
+         * @struct Entry
+         * @brief Level file and its parse, started once
+         */
+        struct Entry {
+            std::string path;                       /**< Level JSON */
+            std::shared_future<LevelPtr> level;     /**< Invalid until the load is started */
+        };
+
+        /**
+         * @brief Parse a level file
+         * @param levelId Level ID, for the log
+         * @param path Level JSON
+         * @return The level, nullptr on failure
+         */
+        static LevelPtr load(uint32_t levelId, const std::string& path);
+
+        mutable std::mutex _mutex;                      /**< Guards _levels */
+        std::unordered_map<uint32_t, Entry> _levels;    /**< Levels by ID */
+};
+
+}  // namespace rtp::server
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <optional>
 #include <string>
 #include <vector>
@@ -72,6 +73,52 @@ struct LevelData {
     std::optional<Boss3Data> boss3Data;
 };
 
+/**
+ * @brief Signature of a compiled level, "RTLV" read as little-endian
+ */
+constexpr uint32_t LEVEL_BINARY_MAGIC = 0x564C5452;
+
+/**
+ * @brief Compiled level format version, bumped on incompatible changes
+ */
+constexpr uint16_t LEVEL_BINARY_VERSION = 1;
+
 std::optional<LevelData> loadLevelFromFile(const std::string& path, std::string& error);
 
+/**
+ * @brief Path of the compiled form of a level file
+ * @param jsonPath Level JSON, e.g. config/levels/level_01.json
+ * @return Same path with a .lvl extension
+ */
+std::string compiledLevelPath(const std::string& jsonPath);
+
+/**
+ * @brief Write a parsed level, tileset obstacles included, in the binary format
+ * @param level Level to write
+ * @param path File to create, truncated if it exists
+ * @param error Filled when false is returned
+ * @return True if the whole file was written
+ * @note Little-endian fixed-size records, strings are length-prefixed.
+ *       Produced offline by rtype_levelc.
+ */
+bool saveLevelBinary(const LevelData& level, const std::string& path, std::string& error);
+
+/**
+ * @brief Read a compiled level, memory-mapped where the platform allows it
+ * @param path File written by saveLevelBinary()
+ * @param error Filled when std::nullopt is returned
+ * @return The level, std::nullopt on a missing, truncated or foreign file
+ */
+std::optional<LevelData> loadLevelBinary(const std::string& path, std::string& error);
+
+/**
+ * @brief Load a level, from its compiled form when it is up to date
+ * @param path Level JSON
+ * @param error Filled when std::nullopt is returned
+ * @return The level
+ * @note The compiled file is used when it is at least as recent as both
+ *       the JSON and the tileset it was built with.
+ */
+std::optional<LevelData> loadLevel(const std::string& path, std::string& error);
+
 }  // namespace rtp::server
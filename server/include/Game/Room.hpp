@@ -16,6 +16,7 @@
     #include <memory>
     #include <list>
     #include <algorithm>
+    #include <unordered_map>
     #include <unordered_set>
     #include "RType/Network/Packet.hpp"
     #include "Systems/NetworkSyncSystem.hpp"
@@ -27,6 +28,8 @@
  */
 namespace rtp::server
 {
+    class RoomSimulation;
+
     /**
      * @class Room
      * @brief Represents a game room in the server.
@@ -67,11 +70,12 @@ namespace rtp::server
         public:
             /**
              * @brief Constructor for Room
+             * @param simulation Entities and systems owned by the room
              * @param id Unique identifier for the room
              * @param name Name of the room
              * @param maxPlayers Maximum number of players allowed in the room
              */
-            Room(ecs::Registry& registry, NetworkSyncSystem& network, uint32_t id, const std::string &name,
+            Room(std::unique_ptr<RoomSimulation> simulation, uint32_t id, const std::string &name,
                  uint32_t maxPlayers, float difficulty, float speed, RoomType type,
                  uint32_t creatorSessionId = 0, uint32_t levelId = 1, uint32_t seed = 0,
                  uint32_t durationMinutes = 0);
@@ -107,6 +111,21 @@ namespace rtp::server
              */
             const std::list<PlayerPtr> getPlayers(void) const;
 
+            /**
+             * @brief Find a player of the room by session
+             * @param sessionId Session of the player
+             * @return The player, nullptr if it is not in the room
+             */
+            PlayerPtr getPlayer(uint32_t sessionId) const;
+
+            /**
+             * @brief Find the player controlling an entity of the room
+             * @param entityId Network ID of the entity, as stored by Player::setEntityId
+             * @return The player, nullptr if no player of the room controls it
+             * @note Goes through the session bound to the entity, no scan
+             */
+            PlayerPtr getPlayerByEntity(uint32_t entityId) const;
+
             /**
              * @brief Get the unique identifier of the room
              * @return Current room ID
@@ -209,27 +228,65 @@ namespace rtp::server
              * @brief Update the room state
              * @param dt Time elapsed since last update in seconds
              */
-            void update(uint32_t serverTick, float dt);
+            void update(float dt);
+
+            /**
+             * @brief Entities and gameplay systems of the room
+             * @return Room simulation, alive as long as the room
+             */
+            RoomSimulation &getSimulation(void);
+
+            /**
+             * @brief Whether the room has a world to simulate this tick
+             * @return true once the game started, lobbies and waiting rooms have no entities
+             */
+            bool isSimulated(void) const;
 
             /**
              * @brief Broadcast the current room state to all connected players
-             * @param serverTick Current server tick count
+             * @param serverTick Server tick the state was simulated at
+             * @note Clients interpolate between snapshots by this tick, so it
+             *       must be called after the tick's systems ran. Each session's
+             *       copy also acks the last input applied to its ship.
              */
             void broadcastRoomState(uint32_t serverTick);
 
+            /**
+             * @brief Queue an entity spawn for the end-of-tick EntitySpawnBatch
+             * @param payload Spawn notification sent to every player of the room
+             */
+            void queueEntitySpawn(const net::EntitySpawnPayload &payload);
+
+            /**
+             * @brief Queue an entity death for the end-of-tick EntityDeathBatch
+             * @param payload Death notification sent to every player of the room
+             */
+            void queueEntityDeath(const net::EntityDeathPayload &payload);
+
+            /**
+             * @brief Send the spawns and deaths queued during the tick
+             * @note Spawns go out before deaths, ENTITY_BATCH_SIZE entities per packet
+             */
+            void flushEntityEvents(void);
+
             void banUser(const std::string &username);
             bool isBanned(const std::string &username) const;
 
         private:
             void broadcastSystemMessage(const std::string &message);
-            NetworkSyncSystem _network;       /**< Reference to the server network manager */
-            ecs::Registry& _registry;    /**< Reference to the entity registry */
+            std::unique_ptr<RoomSimulation>
+                _simulation;                  /**< Entities and gameplay systems of the room */
+            NetworkSyncSystem& _network;      /**< Network sync of _simulation */
+            ecs::Registry& _registry;         /**< Registry of _simulation */
 
             uint32_t _id;                     /**< Unique room identifier */
             std::string _name;                /**< Name of the room */
             uint32_t _maxPlayers;             /**< Maximum number of players allowed */
             std::list<std::pair<PlayerPtr, PlayerType>>
                 _players;                     /**< List of player ptr's in the room */
+            std::unordered_map<uint32_t,
+                std::list<std::pair<PlayerPtr, PlayerType>>::iterator>
+                _playersBySession;            /**< Entry of each session in _players */
             State _state;                     /**< Current state of the room */
             RoomType _type;                   /**< Type of the room */
             uint32_t _creatorSessionId;       /**< Session ID of the room creator (Administrator) */
@@ -249,6 +306,14 @@ namespace rtp::server
             mutable std::mutex _mutex;        /**< Mutex to protect access to room state */
             std::unordered_set<std::string> _bannedUsers; /**< Banned usernames */
             float _scoreTick{0.0f};          /**< Score tick accumulator */
+            std::vector<net::EntitySpawnPayload>
+                _pendingSpawns;               /**< Spawns queued since the last flush */
+            std::vector<net::EntityDeathPayload>
+                _pendingDeaths;               /**< Deaths queued since the last flush */
+            std::vector<net::EntitySpawnPayload>
+                _flushSpawns;                 /**< Spawns being sent, swapped with _pendingSpawns */
+            std::vector<net::EntityDeathPayload>
+                _flushDeaths;                 /**< Deaths being sent, swapped with _pendingDeaths */
     };
 } // namespace rtp::server
 
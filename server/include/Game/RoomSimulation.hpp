@@ -0,0 +1,139 @@
+/**
+ * File   : RoomSimulation.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_GAME_ROOMSIMULATION_HPP_
+    #define RTYPE_GAME_ROOMSIMULATION_HPP_
+
+    #include "RType/ECS/Registry.hpp"
+    #include "ServerNetwork/ServerNetwork.hpp"
+    #include "Game/TickProfiler.hpp"
+
+    /* Systems */
+    #include "Systems/EntityIndex.hpp"
+    #include "Systems/ProjectilePool.hpp"
+    #include "Systems/NetworkSyncSystem.hpp"
+    #include "Systems/EntitySystem.hpp"
+    #include "Systems/MovementSystem.hpp"
+    #include "Systems/PlayerMouvementSystem.hpp"
+    #include "Systems/PlayerShootSystem.hpp"
+    #include "Systems/EnemyAISystem.hpp"
+    #include "Systems/LevelSystem.hpp"
+    #include "Systems/CollisionSystem.hpp"
+    #include "Systems/EnemyShootSystem.hpp"
+    #include "Systems/BulletCleanupSystem.hpp"
+    #include "Systems/HomingSystem.hpp"
+    #include "Systems/BoomerangSystem.hpp"
+
+    #include <random>
+
+/**
+ * @namespace rtp::server
+ * @brief R-Type server-side game management
+ */
+namespace rtp::server
+{
+    class RoomSystem;
+
+    /**
+     * @class RoomSimulation
+     * @brief Entities and gameplay systems of a single room
+     *
+     * Every room owns its registry and its own instance of each gameplay
+     * system, so two rooms never touch the same ECS storage and can be
+     * updated on different threads. What rooms still share (RoomSystem
+     * lookups, ServerNetwork sends, the logger) is guarded by mutexes.
+     *
+     * Entity indices and network IDs are only unique within the room,
+     * which is all clients need since they only see their own room.
+     *
+     * Drop rolls and spawn positions come from the room's own generator,
+     * never from std::rand: rooms on different threads neither race on
+     * it nor change each other's draws, so a capture replays the same.
+     */
+    class RoomSimulation final {
+        public:
+            /**
+             * @brief Create an empty world for a room
+             * @param network Server network, for packets sent by the systems
+             * @param roomSystem Room lookups used to queue spawns and deaths
+             * @param seed Seed of the room generator
+             */
+            RoomSimulation(ServerNetwork &network, RoomSystem &roomSystem, uint32_t seed);
+
+            /**
+             * @brief Run the gameplay systems for one tick
+             * @param dt Scaled tick duration in seconds
+             * @param profiler Times each system when enabled, may be null
+             * @param roomId Room the systems are profiled under
+             * @note Safe to call concurrently for different rooms
+             */
+            void update(float dt, TickProfiler *profiler, uint32_t roomId);
+
+            /**
+             * @brief Restart the room generator
+             * @param seed New seed
+             * @note Game thread, while the room is not simulated
+             */
+            void reseed(uint32_t seed);
+
+            /**
+             * @brief Entities of the room
+             * @return Room registry
+             */
+            ecs::Registry &getRegistry(void);
+
+            /**
+             * @brief Session to entity bindings and inputs of the room
+             * @return Room network sync system
+             */
+            NetworkSyncSystem &getNetworkSync(void);
+
+            /**
+             * @brief Entities of the room by category
+             * @return Room entity index, untrack() what is killed outside the systems
+             */
+            EntityIndex &getEntityIndex(void);
+
+            /**
+             * @brief Entity factory bound to the room registry
+             * @return Room entity system
+             */
+            EntitySystem &getEntitySystem(void);
+
+            /**
+             * @brief Level script of the room
+             * @return Room level system
+             */
+            LevelSystem &getLevelSystem(void);
+
+            /**
+             * @brief Collisions of the room, holds the /debug invincibility flag
+             * @return Room collision system
+             */
+            CollisionSystem &getCollisionSystem(void);
+
+        private:
+            ecs::Registry _registry;                        /**< Entities of this room only */
+            std::mt19937 _rng;                              /**< Random draws of this room only */
+            EntityIndex _entityIndex;                       /**< _registry grouped by category */
+            ProjectilePool _projectilePool;                 /**< Dead bullets of _registry kept for reuse */
+            NetworkSyncSystem _networkSync;                 /**< Session bindings into _registry */
+            EntitySystem _entitySystem;                     /**< Entity factory */
+            MovementSystem _movementSystem;                 /**< Velocity integration */
+            PlayerMouvementSystem _playerMouvementSystem;   /**< Player inputs to velocity */
+            PlayerShootSystem _playerShootSystem;           /**< Player weapons */
+            EnemyAISystem _enemyAISystem;                   /**< Enemy movement patterns */
+            LevelSystem _levelSystem;                       /**< Timed spawns */
+            CollisionSystem _collisionSystem;               /**< Hits and pickups */
+            EnemyShootSystem _enemyShootSystem;             /**< Enemy weapons */
+            HomingSystem _homingSystem;                     /**< Tracker bullets */
+            BoomerangSystem _boomerangSystem;               /**< Boomerang projectiles */
+            BulletCleanupSystem _bulletCleanupSystem;       /**< Off-screen bullets */
+    };
+}
+
+#endif /* !RTYPE_GAME_ROOMSIMULATION_HPP_ */
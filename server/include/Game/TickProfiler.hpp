@@ -0,0 +1,196 @@
+/**
+ * File   : TickProfiler.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_GAME_TICKPROFILER_HPP_
+    #define RTYPE_GAME_TICKPROFILER_HPP_
+
+    #include <array>
+    #include <atomic>
+    #include <chrono>
+    #include <cstddef>
+    #include <cstdint>
+    #include <map>
+    #include <mutex>
+    #include <string>
+    #include <string_view>
+    #include <thread>
+    #include <utility>
+    #include <vector>
+
+/**
+ * @namespace rtp::server
+ * @brief R-Type server-side game management
+ */
+namespace rtp::server
+{
+    /**
+     * @struct ZoneStats
+     * @brief Durations of one profiled zone, in one room or server-wide
+     */
+    struct ZoneStats {
+        std::string name;               /**< Zone name, usually a system */
+        uint32_t roomId = 0;            /**< Room the zone ran for, 0 for server-wide zones */
+        uint64_t calls = 0;             /**< Times the zone ran since it was first seen */
+        uint64_t totalUs = 0;           /**< Time spent in the zone since it was first seen */
+        uint32_t p50Us = 0;             /**< Median duration over the window */
+        uint32_t p90Us = 0;             /**< 90th percentile duration */
+        uint32_t p99Us = 0;             /**< 99th percentile duration */
+        uint32_t maxUs = 0;             /**< Longest run in the window */
+    };
+
+    /**
+     * @class TickProfiler
+     * @brief Per-zone tick timings and a trace of the recent ones
+     *
+     * Zones are timed by ProfileZone. Each (zone, room) pair keeps a
+     * rolling window of its last durations for percentiles, and every
+     * run is appended to a bounded trace that exportTrace() writes in
+     * the Chrome trace-event format (chrome://tracing, Perfetto).
+     *
+     * Disabled by default: a disabled zone costs one relaxed atomic
+     * load. Recording takes a mutex, rooms simulated on workers may
+     * record at the same time.
+     */
+    class TickProfiler final {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            static constexpr uint32_t NO_ROOM = 0;                  /**< Room ID of server-wide zones */
+            static constexpr size_t HISTOGRAM_SAMPLES = 256;        /**< Durations kept per zone */
+            static constexpr size_t MAX_TRACE_EVENTS = 1 << 18;     /**< Most recent runs kept for export */
+
+            TickProfiler(void);
+
+            /**
+             * @brief Start or stop recording
+             * @param enabled True to time zones
+             * @note Histograms and trace are kept when recording stops
+             */
+            void setEnabled(bool enabled);
+
+            /**
+             * @brief Whether zones are timed
+             * @return True when recording
+             */
+            bool isEnabled(void) const;
+
+            /**
+             * @brief Account for one run of a zone
+             * @param zone Zone name, must outlive the profiler (string literal)
+             * @param roomId Room the zone ran for, NO_ROOM for server-wide work
+             * @param start Time the zone was entered
+             * @param end Time the zone was left
+             */
+            void record(const char *zone, uint32_t roomId,
+                        Clock::time_point start, Clock::time_point end);
+
+            /**
+             * @brief Forget the histograms of a room that was removed
+             * @param roomId Room to drop, its trace events are kept
+             */
+            void dropRoom(uint32_t roomId);
+
+            /**
+             * @brief Clear histograms and trace
+             */
+            void reset(void);
+
+            /**
+             * @brief Durations of every zone seen, by name then room
+             * @return One entry per (zone, room)
+             */
+            std::vector<ZoneStats> getStats(void) const;
+
+            /**
+             * @brief Write the recorded trace as Chrome trace-event JSON
+             * @param path Output file
+             * @return Number of events written
+             * @throw std::runtime_error If the file cannot be written
+             */
+            size_t exportTrace(const std::string &path) const;
+
+        private:
+            /**
+             * @struct Histogram
+             * @brief Rolling window of the durations of one (zone, room)
+             */
+            struct Histogram {
+                std::array<uint32_t, HISTOGRAM_SAMPLES> samplesUs{}; /**< Ring of recent durations */
+                size_t count = 0;                   /**< Valid entries in samplesUs */
+                size_t next = 0;                    /**< Next slot to overwrite */
+                uint64_t calls = 0;                 /**< Runs recorded */
+                uint64_t totalUs = 0;               /**< Sum of the durations recorded */
+            };
+
+            /**
+             * @struct TraceEvent
+             * @brief One run of a zone, as exported
+             */
+            struct TraceEvent {
+                const char *zone;                   /**< Zone name */
+                uint32_t roomId;                    /**< Room, NO_ROOM for server-wide zones */
+                uint32_t thread;                    /**< Index of the thread that ran it */
+                int64_t startUs;                    /**< Start, relative to the profiler creation */
+                uint32_t durationUs;                /**< Duration */
+            };
+
+            uint32_t threadIndex(void);
+
+            std::atomic<bool> _enabled{false};      /**< Zones are timed */
+            Clock::time_point _origin;              /**< Time origin of the trace */
+            mutable std::mutex _mutex;              /**< Guards everything below */
+            std::map<std::pair<std::string_view, uint32_t>,
+                Histogram> _zones;                  /**< Histograms by (zone, room) */
+            std::vector<TraceEvent> _trace;         /**< Ring of recent runs */
+            size_t _traceNext = 0;                  /**< Next trace slot to overwrite */
+            std::vector<std::thread::id> _threads;  /**< Threads seen, in order of first record */
+    };
+
+    /**
+     * @class ProfileZone
+     * @brief Times its own scope into a TickProfiler
+     *
+     * Does nothing when the profiler is null or disabled on entry.
+     */
+    class ProfileZone final {
+        public:
+            /**
+             * @brief Enter the zone
+             * @param profiler Profiler to record into, may be null
+             * @param zone Zone name, must outlive the profiler (string literal)
+             * @param roomId Room the zone runs for, NO_ROOM for server-wide work
+             */
+            ProfileZone(TickProfiler *profiler, const char *zone,
+                        uint32_t roomId = TickProfiler::NO_ROOM)
+                : _profiler(profiler != nullptr && profiler->isEnabled() ? profiler : nullptr)
+                , _zone(zone)
+                , _roomId(roomId)
+                , _start(_profiler != nullptr ? TickProfiler::Clock::now() : TickProfiler::Clock::time_point{})
+            {
+            }
+
+            /**
+             * @brief Leave the zone and record its duration
+             */
+            ~ProfileZone()
+            {
+                if (_profiler != nullptr)
+                    _profiler->record(_zone, _roomId, _start, TickProfiler::Clock::now());
+            }
+
+            ProfileZone(const ProfileZone &) = delete;
+            ProfileZone &operator=(const ProfileZone &) = delete;
+
+        private:
+            TickProfiler *_profiler;                /**< Null when not recording */
+            const char *_zone;                      /**< Zone name */
+            uint32_t _roomId;                       /**< Room the zone runs for */
+            TickProfiler::Clock::time_point _start; /**< Time the zone was entered */
+    };
+}
+
+#endif /* !RTYPE_GAME_TICKPROFILER_HPP_ */
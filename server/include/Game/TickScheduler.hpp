@@ -0,0 +1,129 @@
+/**
+ * File   : TickScheduler.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_GAME_TICKSCHEDULER_HPP_
+    #define RTYPE_GAME_TICKSCHEDULER_HPP_
+
+    #include <array>
+    #include <chrono>
+    #include <cstddef>
+    #include <cstdint>
+
+/**
+ * @namespace rtp::server
+ * @brief R-Type server-side game management
+ */
+namespace rtp::server
+{
+    /**
+     * @struct TickStats
+     * @brief Scheduler counters and recent tick durations
+     */
+    struct TickStats {
+        uint32_t tickRate = 0;          /**< Ticks per second */
+        uint64_t ticks = 0;             /**< Ticks run */
+        uint64_t overruns = 0;          /**< Ticks that took longer than a period */
+        uint64_t lateTicks = 0;         /**< Ticks started past their deadline */
+        uint64_t skippedTicks = 0;      /**< Ticks dropped by the catch-up cap */
+        uint32_t p50Us = 0;             /**< Median tick duration over the window */
+        uint32_t p90Us = 0;             /**< 90th percentile tick duration */
+        uint32_t p99Us = 0;             /**< 99th percentile tick duration */
+        uint32_t maxUs = 0;             /**< Longest tick in the window */
+    };
+
+    /**
+     * @class TickScheduler
+     * @brief Fixed-timestep pacing for the game loop
+     *
+     * Deadlines are absolute: tick N is due at start + N * period, so
+     * the time spent in a tick does not push the following ones back.
+     * waitForDeadline() sleeps until shortly before the deadline and
+     * spins the rest of the way, since sleep_until wakes up late by up
+     * to a scheduler quantum.
+     *
+     * When the loop falls behind, collectDueTicks() returns every tick
+     * that is due so the simulation catches up, at most
+     * MAX_CATCH_UP_TICKS at once. Beyond that the backlog is dropped and
+     * deadlines restart from now, which slows the game down instead of
+     * making it run in bursts.
+     */
+    class TickScheduler final {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            static constexpr uint32_t MAX_CATCH_UP_TICKS = 4;      /**< Ticks run back to back when late */
+            static constexpr std::chrono::microseconds SPIN_MARGIN{1000}; /**< Time spun instead of slept */
+            static constexpr size_t DURATION_SAMPLES = 1024;       /**< Tick durations kept for percentiles */
+
+            /**
+             * @brief Create a scheduler whose first tick is due one period after start
+             * @param tickRate Ticks per second, clamped to at least 1
+             * @param start Reference time for every deadline
+             */
+            explicit TickScheduler(uint32_t tickRate, Clock::time_point start = Clock::now());
+
+            /**
+             * @brief Ticks per second
+             * @return Tick rate
+             */
+            uint32_t getTickRate(void) const;
+
+            /**
+             * @brief Time between two ticks
+             * @return Tick period
+             */
+            Clock::duration getPeriod(void) const;
+
+            /**
+             * @brief Deadline of the next tick
+             * @return Absolute time the next tick is due
+             */
+            Clock::time_point getDeadline(void) const;
+
+            /**
+             * @brief Block until the next tick is due
+             * @note Returns at once if the deadline already passed
+             */
+            void waitForDeadline(void) const;
+
+            /**
+             * @brief Count the ticks due at a given time and move the deadline past them
+             * @param now Current time
+             * @return Ticks to run now, 0 before the deadline
+             */
+            uint32_t collectDueTicks(Clock::time_point now);
+
+            /**
+             * @brief Account for the duration of a tick
+             * @param duration Time the tick took
+             */
+            void recordTick(Clock::duration duration);
+
+            /**
+             * @brief Counters and duration percentiles
+             * @return Snapshot of the statistics
+             */
+            TickStats getStats(void) const;
+
+        private:
+            uint32_t _tickRate;                         /**< Ticks per second */
+            Clock::duration _period;                    /**< Time between ticks */
+            Clock::duration _lateTolerance;             /**< Delay after which a tick counts as late */
+            Clock::time_point _deadline;                /**< Next tick deadline */
+
+            uint64_t _ticks = 0;                        /**< Ticks recorded */
+            uint64_t _overruns = 0;                     /**< Ticks longer than a period */
+            uint64_t _lateTicks = 0;                    /**< Ticks started late */
+            uint64_t _skippedTicks = 0;                 /**< Ticks dropped by the cap */
+
+            std::array<uint32_t, DURATION_SAMPLES> _durationsUs{}; /**< Ring of recent tick durations */
+            size_t _durationCount = 0;                  /**< Valid entries in _durationsUs */
+            size_t _durationNext = 0;                   /**< Next slot to overwrite */
+    };
+}
+
+#endif /* !RTYPE_GAME_TICKSCHEDULER_HPP_ */
@@ -12,15 +12,22 @@
     #include "RType/Network/Session.hpp"
     #include "RType/Network/Packet.hpp"
     #include "RType/Network/IEventPublisher.hpp"
+    #include "RType/Network/TrafficStats.hpp"
+    #include "RType/Network/UdpBatch.hpp"
+    #include "RType/Thread/MpscRing.hpp"
     #include "RType/Logger.hpp"
 
     #include <asio.hpp>
+    #include <atomic>
+    #include <chrono>
+    #include <deque>
     #include <memory>
     #include <unordered_map>
     #include <thread>
     #include <mutex>
-    #include <queue>
     #include <optional>
+    #include <span>
+    #include <vector>
 
 /**
  * @namespace rtp::server
@@ -28,6 +35,27 @@
  */
 namespace rtp::server {
 
+    /**
+     * @struct NetworkStats
+     * @brief Aggregated network counters, see ServerNetwork::getNetworkStats
+     */
+    struct NetworkStats {
+        /**
+         * @brief Link counters of one connected session
+         */
+        struct SessionEntry {
+            uint32_t sessionId = 0;                 /**< Session ID */
+            net::Session::LinkStats link;           /**< RTT and TCP queue depth */
+        };
+
+        net::TrafficSnapshot traffic;               /**< Packets and bytes per OpCode, direction and transport */
+        net::Session::WriteStats tcpWrites;         /**< TCP writer counters of the connected sessions */
+        uint64_t udpSizeMismatch = 0;               /**< Datagrams whose size disagrees with their header */
+        uint64_t udpUnbound = 0;                    /**< Datagrams from an endpoint without UDP Hello */
+        uint64_t droppedEvents = 0;                 /**< Inputs lost to a full game thread queue */
+        std::vector<SessionEntry> sessions;         /**< Every connected session */
+    };
+
     /**
      * @class ServerNetwork
      * @brief Implementation ASIO du serveur réseau (TCP + UDP)
@@ -37,8 +65,10 @@ namespace rtp::server {
             /**
              * @brief Constructor for ServerNetwork
              * @param port Port number to start the server on
+             * @param ioThreads Number of I/O shards, each with its own thread and
+             *                  SO_REUSEPORT UDP socket (clamped to 1 off Linux)
              */
-            ServerNetwork(uint16_t port);
+            ServerNetwork(uint16_t port, size_t ioThreads = 1);
 
             /**
              * @brief Destructor for ServerNetwork
@@ -72,19 +102,111 @@ namespace rtp::server {
              */
             void broadcastPacket(const net::Packet &packet, net::NetworkMode mode);
 
+            /**
+             * @brief Send every UDP packet queued since the last flush
+             * @note Called once per server tick. Reliable channels emit
+             *       their new messages, resends and acks first. On Linux
+             *       the packets are sent with sendmmsg; elsewhere UDP sends
+             *       are immediate.
+             */
+            void flushUdp(void);
+
+            /**
+             * @brief Hand every session's queued TCP packets to its writer
+             * @note Called once per server tick. Each session then writes its
+             *       whole backlog with one scatter-gather async_write.
+             */
+            void flushTcp(void);
+
+            /**
+             * @brief Choose when queued TCP packets are written
+             * @param policy Applied to current and future sessions
+             */
+            void setTcpFlushPolicy(net::TcpFlushPolicy policy);
+
+            /**
+             * @brief Sum the TCP writer counters of every connected session
+             * @return Aggregated write statistics
+             */
+            net::Session::WriteStats getTcpWriteStats(void);
+
+            /**
+             * @brief Copy every network counter
+             * @return Traffic per OpCode, drops and per-session link statistics
+             * @note Counters are cumulative since start; callers diff two snapshots for rates
+             */
+            NetworkStats getNetworkStats(void);
+
+            /**
+             * @brief Log a traffic summary periodically
+             * @param interval Seconds between summaries, 0 to disable
+             * @note Summaries are written from the acceptor thread and show
+             *       rates since the previous one
+             */
+            void setStatsInterval(std::chrono::seconds interval);
+
+            /**
+             * @brief Get the number of I/O shards actually running
+             * @return Shard count
+             */
+            size_t getShardCount(void) const;
+
             /**
              * @brief Poll for a network event
              * @return Optional NetworkEvent if available
              */
             std::optional<net::NetworkEvent> pollEvent(void) override;
 
+            /**
+             * @brief Drain up to out.size() network events in one call
+             * @param out Slots the events are moved into, oldest first
+             * @return Number of events written to out
+             * @note Must only be called from the game thread. Events that
+             *       overflowed the ring come after the ones still in it.
+             */
+            size_t pollEvents(std::span<net::NetworkEvent> out) override;
+
             /**
              * @brief Publish a network event to be processed
              * @param event NetworkEvent to publish
+             * @note Lock-free, called from every I/O shard. When the game
+             *       thread has fallen too far behind, an InputTick is
+             *       dropped: the next one repeats its history. Any other
+             *       event (Disconnect, reliable messages already acked)
+             *       goes to a locked overflow queue instead.
              */
             void publishEvent(net::NetworkEvent event) override;
 
+            static constexpr auto RTT_PROBE_INTERVAL = std::chrono::seconds(1); /**< Period of the server Ping */
+
         private:
+            /**
+             * @struct UdpShard
+             * @brief One I/O thread with its own context and UDP socket
+             *
+             * All shards bind the same port with SO_REUSEPORT, so the kernel
+             * spreads client flows across them. A session is pinned to the
+             * shard that received its UDP Hello, and its TCP socket lives on
+             * the shard it was assigned at accept time.
+             */
+            struct UdpShard {
+                size_t index;                                  /**< Position in _shards */
+                asio::io_context ioContext;                    /**< Context driven by this shard's thread */
+                asio::ip::udp::socket socket;                  /**< Shard UDP socket bound with SO_REUSEPORT */
+                std::thread thread;                            /**< Thread running ioContext */
+#if defined(RTYPE_HAS_UDP_MMSG)
+                net::UdpBatchReceiver receiver;                /**< recvmmsg slots for incoming datagrams */
+                net::UdpBatchSender sender;                    /**< UDP packets queued until the next flushUdp */
+                std::mutex senderMutex;                        /**< Mutex for protecting the UDP send queue */
+#else
+                std::array<char, 4096> buffer;                 /**< Buffer for receiving UDP packets */
+                asio::ip::udp::endpoint remoteEndpoint;        /**< Remote endpoint for the last received UDP packet */
+#endif
+                std::vector<net::Packet> reliableDelivered;    /**< Messages released by reliable channels */
+
+                UdpShard(size_t idx, uint16_t port, bool reusePort);
+            };
+
             /**
              * @brief Accept incoming TCP connections
              * @note Initiates an asynchronous accept operation
@@ -92,23 +214,80 @@ namespace rtp::server {
             void acceptConnection();
 
             /**
-             * @brief Receive incoming UDP packets
+             * @brief Receive incoming UDP packets on a shard
+             * @param shard Shard whose socket to read
              * @note Initiates an asynchronous receive operation
              */
-            void receiveUdpPacket();
+            void receiveUdpPacket(UdpShard &shard);
+
+            /**
+             * @brief Send a packet through a session, queuing UDP for the batched flush
+             * @param session Session to send the packet to
+             * @param packet Packet to send
+             * @param mode Network mode (TCP or UDP)
+             */
+            void sendToSession(net::Session &session, const net::Packet &packet,
+                               net::NetworkMode mode);
+
+            /**
+             * @brief Validate and dispatch one received UDP datagram
+             * @param shard Shard the datagram arrived on
+             * @param data Raw datagram bytes (header + body)
+             * @param from Endpoint the datagram was received from
+             */
+            void handleUdpDatagram(UdpShard &shard, std::span<const uint8_t> data,
+                                   const asio::ip::udp::endpoint &from);
+
+            /**
+             * @brief Get the shard a session is pinned to
+             * @param sessionId Session to look up, _sessionsMutex must be held
+             * @return Pinned shard, or shard 0 if the session is unknown
+             */
+            UdpShard &shardOf(uint32_t sessionId);
+
+            /**
+             * @brief Arm the one-second timer driving RTT probes and stats summaries
+             */
+            void scheduleStatsTimer(void);
+
+            /**
+             * @brief Ping every session bound over UDP, bypassing the tick batch
+             * @note The payload carries the server's steady clock in
+             *       microseconds; clients echo it back in a Pong
+             */
+            void sendRttProbes(void);
+
+            /**
+             * @brief Turn a Pong to an RTT probe into a session RTT sample
+             * @param sessionId Session the Pong came from
+             * @param packet Pong packet
+             */
+            void handlePong(uint32_t sessionId, net::Packet &packet);
+
+            /**
+             * @brief Log rates since the previous summary, top OpCodes and session links
+             */
+            void logNetworkStats(void);
 
         private:
+            std::vector<std::unique_ptr<UdpShard>> _shards;    /**< I/O shards, each owning a UDP socket, outlive the
+                                                                    acceptor whose pending accept holds a shard socket */
             asio::io_context _ioContext;                       /**< ASIO I/O context for managing asynchronous operations */
             asio::ip::tcp::acceptor _acceptor;                 /**< TCP acceptor for incoming connections */
-            asio::ip::udp::socket _udpSocket;                  /**< UDP socket for receiving and sending datagrams */
-            std::thread _ioThread;                             /**< Thread running the ASIO I/O context */
+            std::thread _ioThread;                             /**< Thread running the acceptor context */
+            std::atomic<size_t> _nextShard{0};                 /**< Round-robin cursor for TCP sockets */
 
             std::unordered_map<uint32_t, 
                 std::shared_ptr<net::Session>> _sessions; /**< Map of active sessions indexed by session ID */
+            std::unordered_map<uint32_t, size_t> _sessionShard; /**< Shard each session is pinned to */
             std::mutex _sessionsMutex;                         /**< Mutex for protecting access to the sessions map */
             
-            std::queue<net::NetworkEvent> _eventQueue;    /**< Queue of network events to be processed */
-            std::mutex _eventQueueMutex;                       /**< Mutex for protecting access to the event queue */
+            thread::MpscRing<net::NetworkEvent> _eventQueue{
+                net::EVENT_QUEUE_CAPACITY};                    /**< I/O threads to game thread event queue */
+            std::atomic<uint64_t> _droppedEvents{0};           /**< Inputs lost to a full queue */
+            std::deque<net::NetworkEvent> _overflowEvents;     /**< Events that must not be lost, published while the ring was full */
+            std::mutex _overflowMutex;                         /**< Guards _overflowEvents */
+            std::atomic<bool> _overflowing{false};             /**< _overflowEvents is not empty, later events queue behind it */
             
             uint32_t _nextSessionId;                           /**< Next session ID to assign to a new connection */
 
@@ -116,8 +295,17 @@ namespace rtp::server {
                 uint32_t> _udpEndpointToSessionId;             /**< Map of UDP endpoints to session IDs */
             std::mutex _udpMapMutex;                           /**< Mutex for protecting access to the UDP endpoint map */
 
-            std::array<char, 4096> _udpBuffer;                 /**< Buffer for receiving UDP packets */
-            asio::ip::udp::endpoint _udpRemoteEndpoint;        /**< Remote endpoint for the last received UDP packet */
+            std::vector<net::Packet> _reliableOut;             /**< Datagrams produced by reliable channels on flush */
+            net::TcpFlushPolicy _tcpFlushPolicy =
+                net::TcpFlushPolicy::EndOfTick;                /**< Flush policy given to new sessions */
+
+            net::TrafficCounters _traffic;                     /**< Packets and bytes per OpCode, shared with sessions */
+            std::atomic<uint64_t> _udpSizeMismatch{0};         /**< Datagrams whose size disagrees with their header */
+            std::atomic<uint64_t> _udpUnbound{0};              /**< Datagrams from an endpoint without UDP Hello */
+            asio::steady_timer _statsTimer{_ioContext};        /**< Ticks every second on the acceptor thread */
+            std::atomic<uint32_t> _statsInterval{0};           /**< Seconds between summaries, 0 for none */
+            uint32_t _statsElapsed = 0;                        /**< Seconds since the last summary */
+            net::TrafficSnapshot _lastTraffic;                 /**< Counters at the last summary */
     };
 } 
 
@@ -0,0 +1,129 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** AabbBatch
+*/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rtp::server {
+
+/**
+ * @struct Aabb
+ * @brief Axis-aligned box by its edges
+ */
+struct Aabb {
+    float minX = 0.0f;  /**< Left edge */
+    float minY = 0.0f;  /**< Top edge */
+    float maxX = 0.0f;  /**< Right edge */
+    float maxY = 0.0f;  /**< Bottom edge */
+
+    /**
+     * @brief Box of a Transform position and BoundingBox size
+     * @param x Left edge
+     * @param y Top edge
+     * @param width Box width
+     * @param height Box height
+     * @return Box from (x, y) to (x + width, y + height)
+     */
+    static Aabb fromSize(float x, float y, float width, float height)
+    {
+        return Aabb{x, y, x + width, y + height};
+    }
+};
+
+/**
+ * @enum SimdLevel
+ * @brief Instruction set used by the overlap kernel
+ */
+enum class SimdLevel {
+    Scalar,     /**< Portable loop */
+    SSE2,       /**< 4 boxes per instruction */
+    AVX2        /**< 8 boxes per instruction */
+};
+
+/**
+ * @class AabbBatch
+ * @brief Boxes stored as one array per edge for the overlap kernel
+ */
+class AabbBatch {
+    public:
+        /**
+         * @brief Remove every box, keeping the buffers
+         */
+        void clear(void);
+
+        /**
+         * @brief Append a box
+         * @param box Box to append, its index is the previous size()
+         */
+        void push(const Aabb &box);
+
+        /**
+         * @brief Box at an index
+         * @param i Index, below size()
+         * @return Box i
+         */
+        Aabb get(size_t i) const;
+
+        /**
+         * @brief Number of boxes
+         * @return Boxes appended since clear()
+         */
+        size_t size(void) const;
+
+        /**
+         * @brief Flag the boxes that overlap a query box
+         * @param query Box tested against every box of the batch
+         * @param mask Resized to size() bits, bit i is set when box i overlaps
+         * @note Overlap is strict, like CollisionSystem::overlaps: boxes
+         *       that only share an edge do not overlap. Uses the best
+         *       instruction set of the CPU, see detectSimdLevel().
+         */
+        void overlapMask(const Aabb &query, std::vector<uint64_t> &mask) const;
+
+        /**
+         * @brief overlapMask() with a given instruction set
+         * @param query Box tested against every box of the batch
+         * @param mask Resized to size() bits, bit i is set when box i overlaps
+         * @param level Kernel to run, lowered to what the CPU supports
+         */
+        void overlapMask(const Aabb &query, std::vector<uint64_t> &mask, SimdLevel level) const;
+
+        /**
+         * @brief Whether bit i of a mask is set
+         * @param mask Mask filled by overlapMask()
+         * @param i Box index
+         * @return True when box i overlaps
+         */
+        static bool isSet(const std::vector<uint64_t> &mask, size_t i)
+        {
+            return (mask[i / 64] >> (i % 64)) & 1u;
+        }
+
+    private:
+        std::vector<float> _minX;   /**< Left edges */
+        std::vector<float> _minY;   /**< Top edges */
+        std::vector<float> _maxX;   /**< Right edges */
+        std::vector<float> _maxY;   /**< Bottom edges */
+};
+
+/**
+ * @brief Best overlap kernel the CPU runs, detected once
+ * @return Instruction set used by AabbBatch::overlapMask
+ */
+SimdLevel detectSimdLevel(void);
+
+/**
+ * @brief Printable name of an instruction set
+ * @param level Instruction set
+ * @return "scalar", "sse2" or "avx2"
+ */
+const char *toString(SimdLevel level);
+
+}  // namespace rtp::server
@@ -74,9 +74,22 @@ namespace rtp::server {
              */
             void sendRegisterResponse(uint32_t sessionId, bool success, const std::string& username);
 
+            /**
+             * @brief Choose the accounts file, one "username:password" per line
+             * @param path Accounts file, logins.txt in the working directory by default
+             */
+            void setAccountsPath(std::string path);
+
+            /**
+             * @brief Get the accounts file
+             * @return Accounts file path
+             */
+            const std::string &getAccountsPath(void) const;
+
         private:
             ServerNetwork& _network;          /**< Reference to the server network manager */
             ecs::Registry& _registry;    /**< Reference to the entity registry */
+            std::string _accountsPath = "logins.txt"; /**< Accounts file */
     };
 }
 
@@ -7,6 +7,7 @@
 
 #include "RType/ECS/ISystem.hpp"
 #include "RType/ECS/Registry.hpp"
+#include "Systems/EntityIndex.hpp"
 
 #include "RType/ECS/Components/Transform.hpp"
 #include "RType/ECS/Components/Velocity.hpp"
@@ -17,11 +18,12 @@ namespace rtp::server {
 
 class BoomerangSystem : public ecs::ISystem {
   public:
-    explicit BoomerangSystem(ecs::Registry &registry);
+    BoomerangSystem(ecs::Registry &registry, EntityIndex &entityIndex);
     void update(float dt) override;
 
   private:
     ecs::Registry &_registry;
+    EntityIndex &_entityIndex;
 };
 
 } // namespace rtp::server
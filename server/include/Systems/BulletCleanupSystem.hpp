@@ -18,6 +18,10 @@
 
     #include "Systems/RoomSystem.hpp"
     #include "Systems/NetworkSyncSystem.hpp"
+    #include "Systems/ProjectilePool.hpp"
+    #include "Systems/AabbBatch.hpp"
+
+    #include <vector>
 
 namespace rtp::server {
     /**
@@ -29,10 +33,12 @@ namespace rtp::server {
             /**
              * @brief Constructor for BulletCleanupSystem
              * @param registry Reference to the ECS registry
+             * @param projectilePool Where despawned bullets are parked
              * @param roomSystem Reference to the RoomSystem
              * @param networkSync Reference to the NetworkSyncSystem
              */
             BulletCleanupSystem(ecs::Registry& registry,
+                                ProjectilePool& projectilePool,
                                 RoomSystem& roomSystem,
                                 NetworkSyncSystem& networkSync);
 
@@ -52,11 +58,16 @@ namespace rtp::server {
 
         private:
             ecs::Registry& _registry;      /**< Reference to the ECS registry */
+            ProjectilePool& _projectilePool;    /**< Where despawned bullets are parked */
             RoomSystem& _roomSystem;            /**< Reference to the RoomSystem */
             NetworkSyncSystem& _networkSync;    /**< Reference to the NetworkSyncSystem */
 
             float _minX = -200.0f;              /**< Left boundary for bullet despawn */
             float _maxX = 1800.0f;              /**< Right boundary for bullet despawn */
+
+            std::vector<ecs::Entity> _tracked;  /**< Entities checked this tick */
+            AabbBatch _positions;               /**< Their positions, indexed like _tracked */
+            std::vector<uint64_t> _inside;      /**< Bit set when the entity is inside the bounds */
     };
 }
 
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <random>
 #include <unordered_set>
 
 #include "RType/ECS/ISystem.hpp"
@@ -28,6 +29,10 @@
 
 #include "Systems/RoomSystem.hpp"
 #include "Systems/NetworkSyncSystem.hpp"
+#include "Systems/EntityIndex.hpp"
+#include "Systems/ProjectilePool.hpp"
+#include "Systems/SpatialHash.hpp"
+#include "Systems/AabbBatch.hpp"
 
 namespace rtp::server {
 
@@ -36,12 +41,18 @@ class CollisionSystem : public ecs::ISystem {
         /**
          * @brief Constructor for CollisionSystem
          * @param registry Reference to the ECS registry
+         * @param entityIndex Entities of the registry by category, dropped power-ups are tracked in it
+         * @param projectilePool Where destroyed bullets are parked
          * @param roomSystem Reference to the RoomSystem
          * @param networkSync Reference to the NetworkSyncSystem
+         * @param rng Generator of the room, for power-up drops
          */
         CollisionSystem(ecs::Registry& registry,
+                        EntityIndex& entityIndex,
+                        ProjectilePool& projectilePool,
                         RoomSystem& roomSystem,
-                        NetworkSyncSystem& networkSync);
+                        NetworkSyncSystem& networkSync,
+                        std::mt19937& rng);
 
         /**
          * @brief Update system logic for one frame
@@ -50,7 +61,7 @@ class CollisionSystem : public ecs::ISystem {
         void update(float dt) override;
 
         /**
-         * @brief Set invincibility mode for all players
+         * @brief Set invincibility mode for the players of this room
          * @param enabled Whether invincibility is enabled
          */
         void setInvincible(bool enabled) { _invincibleMode = enabled; }
@@ -92,9 +103,24 @@ class CollisionSystem : public ecs::ISystem {
     
     private:
         ecs::Registry& _registry;      /**< Reference to the ECS registry */
+        EntityIndex& _entityIndex;          /**< Entities of _registry by category */
+        ProjectilePool& _projectilePool;    /**< Where destroyed bullets are parked */
         RoomSystem& _roomSystem;            /**< Reference to the RoomSystem */
         NetworkSyncSystem& _networkSync;    /**< Reference to the NetworkSyncSystem */
+        std::mt19937& _rng;                 /**< Generator of the room */
         bool _invincibleMode = false;       /**< Debug: players are invincible */
+        SpatialHash _playerGrid;            /**< Players, rebuilt every tick */
+        SpatialHash _enemyGrid;             /**< Enemies, rebuilt every tick */
+        SpatialHash _obstacleGrid;          /**< Obstacles, rebuilt every tick */
+        SpatialHash _powerupGrid;           /**< Power-ups, rebuilt every tick */
+        AabbBatch _playerBoxes;             /**< Player boxes, indexed like the player grid */
+        AabbBatch _enemyBoxes;              /**< Enemy boxes, indexed like the enemy grid */
+        AabbBatch _obstacleBoxes;           /**< Obstacle boxes, indexed like the obstacle grid */
+        AabbBatch _powerupBoxes;            /**< Power-up boxes, indexed like the power-up grid */
+        AabbBatch _narrow;                  /**< Boxes of the current grid candidates */
+        std::vector<uint32_t> _candidates;  /**< Reused grid query result */
+        std::vector<uint64_t> _hits;        /**< Overlap bits of the candidates */
+        std::vector<uint32_t> _overlapping; /**< Candidates that overlap */
 };
 
 }  // namespace rtp::server
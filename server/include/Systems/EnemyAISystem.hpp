@@ -15,7 +15,9 @@
     #include "RType/ECS/Components/Velocity.hpp"
     #include "RType/ECS/Components/EntityType.hpp"
     #include "RType/ECS/Components/MouvementPattern.hpp"
-    #include "RType/ECS/Components/RoomId.hpp"
+    #include "Systems/EntityIndex.hpp"
+
+    #include <unordered_map>
 
 /**
  * @namespace rtp::server
@@ -31,8 +33,9 @@ namespace rtp::server {
             /**
              * @brief Constructor for EnemyAISystem
              * @param registry Reference to the entity registry
+             * @param entityIndex Entities of the registry by category
              */
-            EnemyAISystem(ecs::Registry& registry);
+            EnemyAISystem(ecs::Registry& registry, const EntityIndex& entityIndex);
 
             /**
              * @brief Update enemy AI system logic for one frame
@@ -41,7 +44,12 @@ namespace rtp::server {
             void update(float dt) override;
         private:
             ecs::Registry& _registry;   /**< Reference to the entity registry */
+            const EntityIndex& _entityIndex; /**< Players and enemies of _registry */
             float _time{0.0f};               /**< Elapsed time for AI calculations */
+            std::unordered_map<ecs::Entity, ecs::Entity>
+                _shieldBoss;                 /**< Boss each shield follows */
+            std::unordered_map<ecs::Entity, Vec2f>
+                _shieldOffsets;              /**< Shield position relative to its boss */
     };
 }
 #endif /* !RTYPE_ENEMY_AI_SYSTEM_HPP_ */
@@ -22,6 +22,7 @@
 
     #include "Systems/RoomSystem.hpp"
     #include "Systems/NetworkSyncSystem.hpp"
+    #include "Systems/ProjectilePool.hpp"
 
 namespace rtp::server {
     /**
@@ -33,10 +34,12 @@ namespace rtp::server {
             /**
              * @brief Constructor for EnemyShootSystem
              * @param registry Reference to the entity registry
+             * @param projectilePool Recycled bullets of the registry
              * @param roomSystem Reference to the RoomSystem
              * @param networkSync Reference to the NetworkSyncSystem
              */
             EnemyShootSystem(ecs::Registry& registry,
+                             ProjectilePool& projectilePool,
                              RoomSystem& roomSystem,
                              NetworkSyncSystem& networkSync);
 
@@ -61,6 +64,7 @@ namespace rtp::server {
 
         private:
             ecs::Registry& _registry;      /**< Reference to the entity registry */
+            ProjectilePool& _projectilePool;    /**< Bullets reused instead of spawned */
             RoomSystem& _roomSystem;            /**< Reference to the RoomSystem */
             NetworkSyncSystem& _networkSync;    /**< Reference to the NetworkSyncSystem */
 
@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** EntityIndex
+*/
+
+#pragma once
+
+#include "RType/ECS/Registry.hpp"
+#include "RType/Network/Packet.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rtp::server {
+
+/**
+ * @enum EntityCategory
+ * @brief Gameplay family of an entity type, one bucket per family
+ */
+enum class EntityCategory : uint8_t {
+    Player,         /**< Player ships */
+    Enemy,          /**< Enemies, bosses and boss shields */
+    Obstacle,       /**< Destructible and solid obstacles */
+    PlayerBullet,   /**< Normal and charged player shots */
+    EnemyBullet,    /**< Enemy and boss projectiles */
+    Powerup,        /**< Pickups */
+    Other,          /**< Anything else */
+    Count
+};
+
+/**
+ * @brief Family of an entity type
+ * @param type Network entity type
+ * @return Bucket the type is indexed under
+ */
+EntityCategory categoryOf(net::EntityType type);
+
+/**
+ * @class EntityIndex
+ * @brief Entities of a room registry grouped by category
+ *
+ * Systems that only care about players or enemies read their bucket
+ * instead of walking every entity and testing its type.
+ *
+ * The sites that give an entity its EntityType call track(), the ones
+ * that kill it call untrack(). Both only queue the change, so they never
+ * move an entry under a system that is iterating a bucket. They run on
+ * whichever thread owns the room at the time: the game thread while
+ * GameManager handles events between ticks, or the one worker simulating
+ * the room, so the index needs no lock. RoomSimulation calls flush()
+ * before the systems that read the index, right after the ones that
+ * spawn what those systems look for. An entity killed since the last flush stays
+ * listed: readers test its components with has(), which also rejects a
+ * recycled index since it compares generations.
+ */
+class EntityIndex {
+    public:
+        /**
+         * @brief Create an empty index over a registry
+         * @param registry Room registry, must outlive the index
+         */
+        explicit EntityIndex(ecs::Registry &registry);
+
+        /**
+         * @brief List an entity at the next flush()
+         * @param entity Entity that was just given its EntityType
+         * @param type Type it was given
+         */
+        void track(ecs::Entity entity, net::EntityType type);
+
+        /**
+         * @brief Drop an entity at the next flush()
+         * @param entity Entity about to be killed or recycled
+         */
+        void untrack(ecs::Entity entity);
+
+        /**
+         * @brief Apply the changes queued since the last flush()
+         * @note Costs one step per queued change, not per entity
+         */
+        void flush(void);
+
+        /**
+         * @brief Rebuild the buckets from the registry
+         * @note Full scan, drops the queued changes. For an index created
+         * over a registry that already holds entities.
+         */
+        void refresh(void);
+
+        /**
+         * @brief Entities of a category at the last flush()
+         * @param category Bucket to read
+         * @return Entities of the category, in no particular order
+         */
+        const std::vector<ecs::Entity> &get(EntityCategory category) const;
+
+        /**
+         * @brief Number of indexed entities
+         * @return Entities listed at the last flush()
+         */
+        size_t size(void) const;
+
+    private:
+        /**
+         * @struct Change
+         * @brief Queued track() or untrack()
+         */
+        struct Change {
+            ecs::Entity entity;         /**< Entity to list or drop */
+            EntityCategory category;    /**< Bucket to list it in, Count to drop it */
+        };
+
+        /**
+         * @struct Slot
+         * @brief Where an entity index is listed
+         */
+        struct Slot {
+            EntityCategory category = EntityCategory::Count;   /**< Count when not listed */
+            uint32_t position = 0;                              /**< Offset in the bucket */
+        };
+
+        void insert(ecs::Entity entity, EntityCategory category);
+        void erase(ecs::Entity entity);
+
+        ecs::Registry &_registry;   /**< Room registry */
+        std::array<std::vector<ecs::Entity>,
+                   static_cast<size_t>(EntityCategory::Count)>
+            _buckets;               /**< One entity list per category */
+        std::vector<Slot> _slots;   /**< Bucket position of each listed entity index */
+        std::vector<Change> _pending;   /**< Changes since the last flush() */
+};
+
+}  // namespace rtp::server
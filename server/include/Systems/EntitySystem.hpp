@@ -14,6 +14,7 @@
     #include "ServerNetwork/ServerNetwork.hpp"
     #include "RType/Network/Packet.hpp"
     #include "Systems/NetworkSyncSystem.hpp"
+    #include "Systems/EntityIndex.hpp"
 
     #include "RType/ECS/Components/InputComponent.hpp"
     #include "RType/ECS/Components/Transform.hpp"
@@ -46,8 +47,9 @@ namespace rtp::server {
             /**
              * @brief Constructor for EntitySystem
              * @param registry Reference to the entity registry
+             * @param entityIndex Index the created entities are tracked in
              */
-            EntitySystem(ecs::Registry& registry, ServerNetwork& network, NetworkSyncSystem& networkSync);
+            EntitySystem(ecs::Registry& registry, EntityIndex& entityIndex, ServerNetwork& network, NetworkSyncSystem& networkSync);
 
             /**
              * @brief Update movement system logic for one frame
@@ -139,6 +141,7 @@ namespace rtp::server {
 
         protected:
             ecs::Registry& _registry;   /**< Reference to the entity registry */
+            EntityIndex& _entityIndex;  /**< Buckets of _registry */
             ServerNetwork& _network;         /**< Reference to the server network manager */
             NetworkSyncSystem& _networkSync; /**< Reference to the network sync system */
     };
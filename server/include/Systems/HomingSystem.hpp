@@ -11,19 +11,27 @@
 #include "RType/ECS/Components/Transform.hpp"
 #include "RType/ECS/Components/Velocity.hpp"
 #include "RType/ECS/Components/EntityType.hpp"
-#include "RType/ECS/Components/RoomId.hpp"
 #include "RType/ECS/Components/Health.hpp"
 #include "RType/ECS/Components/Homing.hpp"
 
+#include "Systems/EntityIndex.hpp"
+#include "Systems/SpatialHash.hpp"
+
+#include <vector>
+
 namespace rtp::server {
 
 class HomingSystem : public ecs::ISystem {
   public:
-    explicit HomingSystem(ecs::Registry &registry);
+    HomingSystem(ecs::Registry &registry, const EntityIndex &entityIndex);
     void update(float dt) override;
 
   private:
     ecs::Registry &_registry;
+    const EntityIndex &_entityIndex;
+    std::vector<rtp::Vec2f> _targets; // positions of the enemies missiles can lock on, reused
+    SpatialHash _targetGrid;          // _targets as points, rebuilt every tick
+    std::vector<uint32_t> _nearest;   // result of the nearest target query
 };
 
 } // namespace rtp::server
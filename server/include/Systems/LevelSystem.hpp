@@ -7,11 +7,12 @@
 
 #pragma once
 
-#include <string>
+#include <random>
 #include <unordered_map>
-#include <optional>
 
+#include "Game/LevelCache.hpp"
 #include "Game/LevelData.hpp"
+#include "Systems/EntityIndex.hpp"
 #include "Systems/EntitySystem.hpp"
 #include "Systems/RoomSystem.hpp"
 #include "Systems/NetworkSyncSystem.hpp"
@@ -23,21 +24,20 @@ class LevelSystem {
         /**
          * @brief Constructor for LevelSystem
          * @param registry Reference to the ECS registry
+         * @param entityIndex Entities of the registry by category
+         * @param levelCache Parsed levels shared with the other rooms
          * @param entitySystem Reference to the EntitySystem
          * @param roomSystem Reference to the RoomSystem
          * @param networkSync Reference to the NetworkSyncSystem
+         * @param rng Generator of the room, for boss 3 spawn positions
          */
         LevelSystem(ecs::Registry& registry,
+                    const EntityIndex& entityIndex,
+                    LevelCache& levelCache,
                     EntitySystem& entitySystem,
                     RoomSystem& roomSystem,
-                    NetworkSyncSystem& networkSync);
-
-        /**
-         * @brief Register a level file path with a level ID
-         * @param levelId ID of the level
-         * @param path File path to the level data
-         */
-        void registerLevelPath(uint32_t levelId, const std::string& path);
+                    NetworkSyncSystem& networkSync,
+                    std::mt19937& rng);
 
         /**
          * @brief Start a level for a specific room
@@ -70,7 +70,7 @@ class LevelSystem {
          *  @brief Struct to hold active level data for a room
          */
         struct ActiveLevel {
-            LevelData data;
+            LevelCache::LevelPtr data;      /**< Shared, never modified */
             float elapsed{0.0f};
             size_t nextSpawn{0};
             size_t nextPowerup{0};
@@ -93,21 +93,29 @@ class LevelSystem {
         void spawnEntityForRoom(uint32_t roomId, const ecs::Entity& entity);
 
         /**
-         * @brief Load level data from a file
-         * @param levelId ID of the level to load
-         * @return Optional LevelData if loading was successful, std::nullopt otherwise
+         * @brief Whether an indexed entity of a type still has health
+         * @param category Bucket to search
+         * @param type Entity type to look for in the bucket
+         * @return True if one of them has more than 0 health
          */
-        std::optional<LevelData> loadLevel(uint32_t levelId) const;
+        bool anyAlive(EntityCategory category, net::EntityType type) const;
+
+        /**
+         * @brief Rightmost player position
+         * @return Largest player X, 0 when no player is further right
+         */
+        float frontPlayerX(void) const;
     
     private:
         ecs::Registry& _registry;      /**< Reference to the entity registry */
+        const EntityIndex& _entityIndex;    /**< Entities of _registry by category */
+        LevelCache& _levelCache;            /**< Parsed levels, owned by the RoomSystem */
         EntitySystem& _entitySystem;        /**< Reference to the EntitySystem */
         RoomSystem& _roomSystem;            /**< Reference to the RoomSystem */
         NetworkSyncSystem& _networkSync;    /**< Reference to the NetworkSyncSystem */
+        std::mt19937& _rng;                 /**< Generator of the room */
         std::unordered_map<uint32_t,
             ActiveLevel> _activeLevels;     /**< Active levels mapped by room ID */
-        std::unordered_map<uint32_t,
-            std::string> _levelPaths;       /**< Level file paths mapped by level ID */
 };
 
 }  // namespace rtp::server
@@ -19,6 +19,8 @@
     #include "RType/ECS/Components/RoomId.hpp"
     #include "RType/Network/Packet.hpp"
 
+    #include <optional>
+    #include <span>
     #include <vector>
     #include <unordered_map>
 
@@ -52,17 +54,50 @@ namespace rtp::server {
              * @brief Bind a network session to an entity
              * @param sessionId ID of the network session
              * @param entity The entity to bind (includes both index and generation)
+             * @note A session controls one entity and an entity one session,
+             *       older bindings of either side are dropped
              */
             void bindSessionToEntity(uint32_t sessionId, ecs::Entity entity);
             void unbindSession(uint32_t sessionId);
 
+            /**
+             * @brief Entity controlled by a session
+             * @param sessionId ID of the network session
+             * @return Bound entity, NullEntity if the session controls none
+             */
+            ecs::Entity getEntityOfSession(uint32_t sessionId) const;
+
+            /**
+             * @brief Session controlling an entity
+             * @param entityId Network ID, as stored in Player and NetworkId
+             * @return Bound session, std::nullopt if no session controls it
+             */
+            std::optional<uint32_t> getSessionOfEntity(uint32_t entityId) const;
+
+            /**
+             * @brief Entity carrying a network ID
+             * @param netId Network ID, as built by NetworkId::of()
+             * @return Entity whose NetworkId is netId, NullEntity if none
+             */
+            ecs::Entity findEntityByNetId(uint32_t netId) const;
+
             /**
              * @brief Handle input received from a client
              * @param sessionId ID of the network session
              * @param packet Packet containing the input data
+             * @note The packet holds the client's last few inputs, oldest
+             *       first. Sequences not seen yet are queued and applied one
+             *       per tick by PlayerMouvementSystem, repeats are dropped.
              */
             void handleInput(uint32_t sessionId, const net::Packet& packet);
 
+            /**
+             * @brief Ship and last applied input of a session, for its snapshots
+             * @param sessionId ID of the network session
+             * @return Ack with netId 0 if the session controls no ship
+             */
+            net::InputAckPayload getInputAck(uint32_t sessionId) const;
+
             /**
              * @brief Handle disconnection of a client
              * @param sessionId ID of the disconnected session
@@ -78,7 +113,7 @@ namespace rtp::server {
 
             /**
              * @brief Send a packet to the entity associated with the given ID
-             * @param entityId ID of the target entity
+             * @param entityId Network ID of the target entity
              * @param packet Packet to send
              * @param mode Network mode (TCP or UDP)
              */
@@ -99,12 +134,42 @@ namespace rtp::server {
              * @param mode Network mode (TCP or UDP)
              */
             void sendPacketToSessions(const std::vector<uint32_t>& sessions, const net::Packet& packet, net::NetworkMode mode);
+
+            /**
+             * @brief Send spawns as EntitySpawnBatch packets of up to ENTITY_BATCH_SIZE entities
+             * @param sessions List of session IDs
+             * @param spawns Spawn notifications, in order
+             */
+            void sendEntitySpawnBatches(const std::vector<uint32_t>& sessions,
+                                        std::span<const net::EntitySpawnPayload> spawns);
+
+            /**
+             * @brief Send deaths as EntityDeathBatch packets of up to ENTITY_BATCH_SIZE entities
+             * @param sessions List of session IDs
+             * @param deaths Death notifications, in order
+             */
+            void sendEntityDeathBatches(const std::vector<uint32_t>& sessions,
+                                        std::span<const net::EntityDeathPayload> deaths);
             
+        private:
+            /**
+             * @brief Split payloads into packets of ENTITY_BATCH_SIZE and send them reliably
+             * @param sessions List of session IDs
+             * @param opCode Batch opcode
+             * @param payloads Payloads serialized as a counted vector
+             */
+            template <typename Payload>
+            void sendBatches(const std::vector<uint32_t>& sessions, net::OpCode opCode,
+                             std::span<const Payload> payloads);
+
         private:
             ServerNetwork& _network;           /**< Reference to the server network manager */
             ecs::Registry& _registry;     /**< Reference to the entity registry */
             std::unordered_map<uint32_t,
                 ecs::Entity> _sessionToEntity;    /**< Map of session IDs to entities (with generation) */
+            std::unordered_map<uint32_t,
+                uint32_t> _entityToSession;       /**< Reverse of _sessionToEntity, by network ID */
+            std::vector<net::InputPayload> _inputBatch; /**< Reused storage for InputTick histories */
     };
 }
 
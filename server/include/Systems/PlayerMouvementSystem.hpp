@@ -40,6 +40,16 @@ namespace rtp::server {
              */
             void update(float dt) override;
 
+        private:
+            /**
+             * @brief Take the player's next queued input
+             * @param input Input component of the player
+             * @note Each client input covers one tick; with none queued the
+             *       last mask is kept. update() calls it InputQueue::due()
+             *       times per tick.
+             */
+            void consumeInput(ecs::components::server::InputComponent &input);
+
         private:
             ecs::Registry& _registry;   /**< Reference to the entity registry */
     };
@@ -25,8 +25,14 @@
 
     #include "Systems/RoomSystem.hpp"
     #include "Systems/NetworkSyncSystem.hpp"
+    #include "Systems/EntityIndex.hpp"
+    #include "Systems/ProjectilePool.hpp"
+    #include "Systems/AabbBatch.hpp"
 
+    #include <array>
+    #include <random>
     #include <unordered_map>
+    #include <vector>
 
 /**
  * @namespace rtp::server
@@ -42,12 +48,18 @@ namespace rtp::server {
             /**
              * @brief Constructor for PlayerShootSystem
              * @param registry Reference to the entity registry
+             * @param entityIndex Index the beam kills and dropped power-ups go through
+             * @param projectilePool Recycled bullets of the registry
              * @param roomSystem Reference to the RoomSystem
              * @param networkSync Reference to the NetworkSyncSystem
+             * @param rng Generator of the room, for beam drops and debug power-ups
              */
             PlayerShootSystem(ecs::Registry& registry,
+                              EntityIndex& entityIndex,
+                              ProjectilePool& projectilePool,
                               RoomSystem& roomSystem,
-                              NetworkSyncSystem& networkSync);
+                              NetworkSyncSystem& networkSync,
+                              std::mt19937& rng);
 
             /**
              * @brief Update player shoot system logic for one frame
@@ -97,8 +109,11 @@ namespace rtp::server {
 
         private:
             ecs::Registry& _registry;      /**< Reference to the entity registry */
+            EntityIndex& _entityIndex;          /**< Buckets of _registry */
+            ProjectilePool& _projectilePool;    /**< Bullets reused instead of spawned */
             RoomSystem& _roomSystem;            /**< Reference to the RoomSystem */
             NetworkSyncSystem& _networkSync;    /**< Reference to the NetworkSyncSystem */
+            std::mt19937& _rng;                 /**< Generator of the room */
 
             float _bulletSpeed = 500.0f;        /**< Speed of the spawned bullets */
             float _chargedBulletSpeed = 280.0f; /**< Speed of the charged bullets */
@@ -106,6 +121,10 @@ namespace rtp::server {
 
             // Beam tick timers per-owner (accumulator for periodic damage ticks)
             std::unordered_map<uint32_t, float> _beamTickTimers;
+
+            std::vector<ecs::Entity> _beamTargets;              /**< Entities a beam tick may hit */
+            AabbBatch _beamBoxes;                               /**< Their hit segments, indexed like _beamTargets */
+            std::array<std::vector<uint64_t>, 2> _beamHits;     /**< Targets hit by each beam line */
     };
 }
 
@@ -0,0 +1,127 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** ProjectilePool
+*/
+
+#pragma once
+
+#include "RType/ECS/Registry.hpp"
+#include "RType/ECS/Components/BoundingBox.hpp"
+#include "RType/ECS/Components/Boomerang.hpp"
+#include "RType/ECS/Components/Damage.hpp"
+#include "RType/ECS/Components/EntityType.hpp"
+#include "RType/ECS/Components/Homing.hpp"
+#include "RType/ECS/Components/NetworkId.hpp"
+#include "RType/ECS/Components/RoomId.hpp"
+#include "RType/ECS/Components/Transform.hpp"
+#include "RType/ECS/Components/Velocity.hpp"
+#include "RType/Error.hpp"
+#include "RType/Math/Vec2.hpp"
+#include "RType/Network/Packet.hpp"
+#include "Systems/EntityIndex.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <expected>
+
+namespace rtp::server {
+
+/**
+ * @struct ProjectileSpec
+ * @brief Core components of a projectile, written by ProjectilePool::acquire()
+ */
+struct ProjectileSpec {
+    net::EntityType type;                   /**< Bullet, ChargedBullet, EnemyBullet or Boss2Bullet */
+    Vec2f position;                         /**< Spawn position */
+    ecs::components::Velocity velocity;     /**< Initial velocity */
+    float width;                            /**< Hitbox width */
+    float height;                           /**< Hitbox height */
+    int damage;                             /**< Damage dealt on hit */
+    ecs::Entity owner;                      /**< Shooter, NullEntity for enemies */
+    uint32_t roomId;                        /**< Room of the shooter */
+};
+
+/**
+ * @class ProjectilePool
+ * @brief Dead projectiles of a room registry kept for reuse
+ *
+ * Bullets are spawned and destroyed every few ticks. Killing one erases
+ * it from every component array and spawning the next one adds them all
+ * back. release() instead strips the components that make a projectile
+ * visible to the systems (EntityType, NetworkId, Velocity, Homing,
+ * Boomerang) and parks the entity with its Transform, BoundingBox,
+ * Damage and RoomId. acquire() overwrites those in place and adds the
+ * stripped ones back.
+ *
+ * release() renews the entity, so handles held by systems die exactly
+ * as after a kill. The network ID includes the generation, a reused
+ * projectile never shows up on clients under the ID of the one it
+ * replaces.
+ *
+ * The pool holds the component arrays it writes: acquire() and
+ * release() work on them directly, without a type lookup per component,
+ * and renewing only rebinds the four parked arrays.
+ *
+ * acquire() and release() track and untrack the projectile in the room
+ * EntityIndex, so a parked entity never shows up in a bucket.
+ */
+class ProjectilePool {
+    public:
+        static constexpr size_t MAX_PARKED = 512;  /**< Released projectiles past this are killed */
+
+        /**
+         * @brief Create an empty pool over a registry
+         * @param registry Room registry, must outlive the pool
+         * @param entityIndex Index of the registry, must outlive the pool
+         * @throw rtp::Error If a projectile component is not subscribed yet
+         */
+        ProjectilePool(ecs::Registry &registry, EntityIndex &entityIndex);
+
+        /**
+         * @brief Reuse a parked projectile, or spawn one
+         * @param spec Components of the projectile
+         * @return The projectile entity, with NetworkId::of() as network ID
+         * @note Homing and Boomerang are left to the caller
+         */
+        std::expected<ecs::Entity, rtp::Error> acquire(const ProjectileSpec &spec);
+
+        /**
+         * @brief Park a projectile for reuse, kill anything else
+         * @param entity Entity to remove from the game
+         * @note The caller queues the death payload before releasing
+         */
+        void release(ecs::Entity entity);
+
+        /**
+         * @brief Number of parked projectiles
+         * @return Entities acquire() can reuse
+         */
+        size_t parked(void) const;
+
+        /**
+         * @brief Whether an entity type is pooled
+         * @param type Network entity type
+         * @return True for player and enemy bullets
+         */
+        static bool isPooled(net::EntityType type);
+
+    private:
+        ecs::Registry &_registry;           /**< Room registry */
+        EntityIndex &_entityIndex;          /**< Buckets of _registry */
+        std::deque<ecs::Entity> _parked;    /**< Released projectiles, oldest first */
+
+        ecs::SparseArray<ecs::components::Transform> &_transforms;      /**< Kept while parked */
+        ecs::SparseArray<ecs::components::BoundingBox> &_boxes;         /**< Kept while parked */
+        ecs::SparseArray<ecs::components::Damage> &_damages;            /**< Kept while parked */
+        ecs::SparseArray<ecs::components::RoomId> &_rooms;              /**< Kept while parked */
+        ecs::SparseArray<ecs::components::Velocity> &_velocities;       /**< Stripped on release */
+        ecs::SparseArray<ecs::components::NetworkId> &_netIds;          /**< Stripped on release */
+        ecs::SparseArray<ecs::components::EntityType> &_types;          /**< Stripped on release */
+        ecs::SparseArray<ecs::components::Homing> &_homings;            /**< Stripped on release */
+        ecs::SparseArray<ecs::components::Boomerang> &_boomerangs;      /**< Stripped on release */
+};
+
+}  // namespace rtp::server
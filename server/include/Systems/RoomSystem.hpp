@@ -17,9 +17,15 @@
     #include "RType/Network/Packet.hpp"
     #include "Systems/NetworkSyncSystem.hpp"
     #include "Game/Room.hpp"
+    #include "Game/LevelCache.hpp"
+    #include "RType/Thread/ThreadPool.hpp"
+    #include "Game/TickProfiler.hpp"
     
+    #include <future>
     #include <memory>
     #include <map>
+    #include <shared_mutex>
+    #include <vector>
 
 /**
  * @namespace rtp::server
@@ -48,17 +54,73 @@ namespace rtp::server {
             /** 
              * @brief Constructor for RoomSystem
              * @param network Reference to the server network manager
-             * @param registry Reference to the entity registry
+             * @note Each room gets its own RoomSimulation, see createRoom()
              */
-            RoomSystem(ServerNetwork& network, ecs::Registry& registry, NetworkSyncSystem& networkSync);
+            explicit RoomSystem(ServerNetwork& network);
+
+            /**
+             * @brief Destructor, destroys the rooms and their simulations
+             */
+            ~RoomSystem() override;
 
             /**
              * @brief Update system logic for one frame
              * @param dt Time elapsed since last update in seconds
-             * @note Currently not used
+             * @note Launches ready rooms and ticks every room's score
              */
             void update(float dt) override;
 
+            /**
+             * @brief Run the gameplay systems of every started room
+             * @param dt Scaled tick duration in seconds
+             * @param pool Workers to spread rooms over, nullptr to run them on the calling thread
+             * @note Returns once every room is done: snapshots and flushes
+             *       that follow never see a room mid-tick.
+             * @throw Rethrows the first exception raised by a room, after all rooms finished
+             */
+            void simulate(float dt, thread::ThreadPool *pool);
+
+            /**
+             * @brief Rooms run by the last simulate() call
+             * @return Number of matches simulated on the last tick
+             */
+            size_t getSimulatedRoomCount(void) const;
+
+            /**
+             * @brief Send every room's spawns and deaths queued during the tick
+             * @note Called once per tick, after all gameplay systems
+             */
+            void flushEntityEvents(void);
+
+            /**
+             * @brief Send every in-game room's entity snapshot, stamped with the tick
+             * @param serverTick Tick just simulated
+             * @note Only every snapshot interval-th tick is sent, clients
+             *       interpolate the ticks in between
+             */
+            void broadcastSnapshots(uint32_t serverTick);
+
+            /**
+             * @brief Set how often entity snapshots are sent
+             * @param ticks Send one snapshot every this many ticks, at least 1
+             */
+            void setSnapshotInterval(uint32_t ticks);
+
+            /**
+             * @brief Seed the random draws of every room
+             * @param seed Capture seed, each room mixes in its own ID
+             * @note Rooms draw from their own generator, so a room replays
+             *       the same drops and spawns whatever thread it runs on
+             */
+            void setRandomSeed(uint32_t seed);
+
+            /**
+             * @brief Time the systems of every room
+             * @param profiler Profiler simulate() records into, nullptr for none
+             * @note Histograms of a room are dropped when the room is removed
+             */
+            void setProfiler(TickProfiler *profiler);
+
             /**
              * @brief Create a new room based on client request
              * @param sessionId ID of the network session
@@ -127,19 +189,38 @@ namespace rtp::server {
              * @return Shared pointer to the Room instance, or nullptr if not found
              */
             std::shared_ptr<Room> getRoom(uint32_t roomId);
+
+            /**
+             * @brief Get the room a session is in
+             * @param sessionId ID of the network session
+             * @return Shared pointer to the Room instance, or nullptr if the session is in no room
+             */
+            std::shared_ptr<Room> getRoomOfSession(uint32_t sessionId);
+
+            /**
+             * @brief Levels shared by the simulations of every room
+             * @return Level cache, levels 1 to 4 are registered
+             */
+            LevelCache& getLevelCache(void);
         
         private:
             void despawnPlayerEntity(const PlayerPtr& player,
                                      const std::shared_ptr<Room>& room);
+            uint32_t roomSeed(uint32_t roomId) const;
             ServerNetwork& _network;                          /**< Reference to the server network manager */
-            NetworkSyncSystem& _networkSync;                  /**< Reference to the network sync system */
-            ecs::Registry& _registry;                    /**< Reference to the entity registry */
+            LevelCache _levelCache;                           /**< Parsed levels, outlives the rooms */
             std::map<uint32_t,
                 std::shared_ptr<Room>> _rooms{};              /**< Map of room ID to Room instances */
             std::map<uint32_t, uint32_t> _playerRoomMap;      /**< Map of player session ID to room ID */
             uint32_t _nextRoomId = 1;                         /**< Next available room ID */
             uint32_t _lobbyId = 0;                            /**< ID of the main lobby room */  
-            mutable std::mutex _mutex;                        /**< Mutex for thread-safe operations */
+            uint32_t _snapshotInterval = 2;                   /**< Ticks between two entity snapshots */
+            uint32_t _randomSeed = 1;                         /**< Mixed with the room ID to seed each room */
+            mutable std::shared_mutex _mutex;                 /**< Exclusive for changes, shared for lookups from room threads */
+            std::vector<std::shared_ptr<Room>> _simulated;   /**< Rooms run by the current simulate() call */
+            std::vector<std::future<void>> _pending;          /**< Room tasks simulate() waits for */
+            size_t _simulatedCount = 0;                       /**< Rooms run by the last simulate() call */
+            TickProfiler *_profiler = nullptr;                /**< Per-room system timings, not owned */
             RoomStartedCb _onRoomStarted;                     /**< Callback for when a room starts */
 
     };
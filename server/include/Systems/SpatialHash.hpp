@@ -0,0 +1,150 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** SpatialHash
+*/
+
+#pragma once
+
+#include "Systems/AabbBatch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace rtp::server {
+
+/**
+ * @class SpatialHash
+ * @brief Uniform grid broadphase over axis-aligned boxes
+ *
+ * Items are the indices of the caller's own array. A box is stored in
+ * every cell it covers, cells are hashed into a flat bucket table
+ * rebuilt from scratch by build(): insert() the boxes of the tick, then
+ * build(), then query(). The buffers are kept between ticks so a
+ * rebuild does not allocate once the room reached its peak size.
+ *
+ * Two cells may share a bucket, so query() returns candidates: callers
+ * still run their exact overlap test on each. nearest() and
+ * queryRadius() measure the staged boxes themselves and are exact.
+ */
+class SpatialHash {
+    public:
+        static constexpr float DEFAULT_CELL_SIZE = 64.0f;  /**< About the size of an enemy sprite */
+
+        /**
+         * @brief Create an empty grid
+         * @param cellSize Side of a cell in world units
+         */
+        explicit SpatialHash(float cellSize = DEFAULT_CELL_SIZE);
+
+        /**
+         * @brief Remove every item, keeping the buffers
+         */
+        void clear(void);
+
+        /**
+         * @brief Stage a box for the next build()
+         * @param item Index of the box in the caller's array
+         * @param x Left edge
+         * @param y Top edge
+         * @param width Box width
+         * @param height Box height
+         * @note Insert items in increasing order, query() relies on it
+         */
+        void insert(uint32_t item, float x, float y, float width, float height);
+
+        /**
+         * @brief Bucket the staged boxes, must run before query()
+         */
+        void build(void);
+
+        /**
+         * @brief Items whose cells intersect the cells of a box
+         * @param x Left edge
+         * @param y Top edge
+         * @param width Box width
+         * @param height Box height
+         * @param out Cleared, then filled with candidates in increasing item order, without duplicates
+         * @note Increasing order keeps "first hit wins" loops identical to a linear scan
+         */
+        void query(float x, float y, float width, float height,
+                   std::vector<uint32_t> &out) const;
+
+        /**
+         * @brief Items whose box is within a distance of a point
+         * @param x Point X
+         * @param y Point Y
+         * @param radius Largest distance from the point to a box
+         * @param out Cleared, then filled in increasing item order, without duplicates
+         * @note A point inside a box is at distance 0 from it
+         */
+        void queryRadius(float x, float y, float radius,
+                         std::vector<uint32_t> &out) const;
+
+        /**
+         * @brief The k items whose box is closest to a point
+         * @param x Point X
+         * @param y Point Y
+         * @param radius Boxes further than this are ignored
+         * @param k Most items returned
+         * @param out Cleared, then filled nearest first, ties in increasing item order
+         * @note Visits rings of cells around the point and stops as soon
+         *       as no unvisited cell can hold a closer box, so a dense
+         *       grid answers from the few cells next to the point.
+         */
+        void nearest(float x, float y, float radius, size_t k,
+                     std::vector<uint32_t> &out);
+
+        /**
+         * @brief Number of staged items
+         * @return Items inserted since clear()
+         */
+        size_t size(void) const;
+
+    private:
+        /**
+         * @struct Span
+         * @brief Cells covered by a box
+         */
+        struct Span {
+            uint32_t item;      /**< Caller's index */
+            Aabb box;           /**< Staged box */
+            int32_t minX;       /**< First cell column */
+            int32_t minY;       /**< First cell row */
+            int32_t maxX;       /**< Last cell column */
+            int32_t maxY;       /**< Last cell row */
+        };
+
+        /**
+         * @struct Neighbour
+         * @brief Box kept by nearest(), ordered by distance then item
+         */
+        struct Neighbour {
+            float distance2;    /**< Squared distance to the query point */
+            uint32_t item;      /**< Caller's index */
+
+            bool operator<(const Neighbour &other) const
+            {
+                return distance2 < other.distance2
+                    || (distance2 == other.distance2 && item < other.item);
+            }
+        };
+
+        Span span(uint32_t item, float x, float y, float width, float height) const;
+        size_t bucketOf(int32_t cellX, int32_t cellY) const;
+        void keepNearest(const Span &s, float x, float y, float radius2, size_t k);
+
+        float _cellSize;                        /**< Cell side */
+        float _inverseCellSize;                 /**< 1 / cell side */
+        std::vector<Span> _spans;               /**< Staged boxes */
+        std::vector<Span> _oversized;           /**< Boxes too large for the grid, returned by every query */
+        std::vector<uint32_t> _bucketStart;     /**< Offset of each bucket in _entries, plus the end */
+        std::vector<uint32_t> _entries;         /**< Indices into _spans, grouped by bucket */
+        std::vector<uint32_t> _cursor;          /**< Fill position of each bucket during build() */
+        size_t _bucketMask = 0;                 /**< Bucket count - 1, a power of two */
+        std::vector<Neighbour> _best;           /**< Nearest boxes found so far by nearest() */
+};
+
+}  // namespace rtp::server
@@ -0,0 +1,168 @@
+/**
+ * File   : EventCapture.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "Game/EventCapture.hpp"
+
+#include <stdexcept>
+
+namespace rtp::server
+{
+    namespace
+    {
+        void writeVarint(std::ofstream &out, uint64_t value)
+        {
+            char bytes[10];
+            size_t size = 0;
+            do {
+                uint8_t byte = value & 0x7F;
+                value >>= 7;
+                if (value != 0)
+                    byte |= 0x80;
+                bytes[size++] = static_cast<char>(byte);
+            } while (value != 0);
+            out.write(bytes, static_cast<std::streamsize>(size));
+        }
+
+        bool readVarint(std::ifstream &in, uint64_t &value)
+        {
+            value = 0;
+            for (unsigned shift = 0; shift < 64; shift += 7) {
+                const int byte = in.get();
+                if (byte == std::char_traits<char>::eof())
+                    return false;
+                value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0)
+                    return true;
+            }
+            return false;
+        }
+
+        void writeU32(std::ofstream &out, uint32_t value)
+        {
+            const char bytes[4] = {
+                static_cast<char>(value), static_cast<char>(value >> 8),
+                static_cast<char>(value >> 16), static_cast<char>(value >> 24)};
+            out.write(bytes, sizeof(bytes));
+        }
+
+        uint32_t readU32(std::ifstream &in)
+        {
+            unsigned char bytes[4] = {};
+            in.read(reinterpret_cast<char *>(bytes), sizeof(bytes));
+            return static_cast<uint32_t>(bytes[0]) | static_cast<uint32_t>(bytes[1]) << 8
+                 | static_cast<uint32_t>(bytes[2]) << 16 | static_cast<uint32_t>(bytes[3]) << 24;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    EventRecorder::EventRecorder(const std::string &path, const CaptureInfo &info)
+    {
+        _file.rdbuf()->pubsetbuf(_buffer.data(), static_cast<std::streamsize>(_buffer.size()));
+        _file.open(path, std::ios::binary | std::ios::trunc);
+        if (!_file)
+            throw std::runtime_error("Cannot create capture file " + path);
+
+        writeU32(_file, CAPTURE_MAGIC);
+        writeU32(_file, CAPTURE_VERSION);
+        writeU32(_file, info.randSeed);
+        writeU32(_file, info.snapshotInterval);
+        writeU32(_file, info.tickRate);
+        writeU32(_file, static_cast<uint32_t>(info.accounts.size()));
+        _file.write(info.accounts.data(), static_cast<std::streamsize>(info.accounts.size()));
+        _file.flush();
+        if (!_file)
+            throw std::runtime_error("Cannot write capture file " + path);
+    }
+
+    EventRecorder::~EventRecorder()
+    {
+        flush();
+    }
+
+    void EventRecorder::record(uint32_t tick, const net::NetworkEvent &event)
+    {
+        writeVarint(_file, tick - _lastTick);
+        writeVarint(_file, event.sessionId);
+        _file.put(static_cast<char>(event.packet.header.opCode));
+        writeVarint(_file, event.packet.body.size());
+        _file.write(reinterpret_cast<const char *>(event.packet.body.data()),
+                    static_cast<std::streamsize>(event.packet.body.size()));
+        _lastTick = tick;
+        ++_events;
+
+        if (tick - _lastFlushTick >= FLUSH_TICKS) {
+            flush();
+            _lastFlushTick = tick;
+        }
+    }
+
+    void EventRecorder::flush(void)
+    {
+        _file.flush();
+    }
+
+    uint64_t EventRecorder::getEventCount(void) const
+    {
+        return _events;
+    }
+
+    CaptureReader::CaptureReader(const std::string &path)
+        : _file(path, std::ios::binary)
+    {
+        if (!_file)
+            throw std::runtime_error("Cannot open capture file " + path);
+        if (readU32(_file) != CAPTURE_MAGIC)
+            throw std::runtime_error(path + " is not a capture file");
+        if (const uint32_t version = readU32(_file); version != CAPTURE_VERSION)
+            throw std::runtime_error(path + " has unsupported capture version " + std::to_string(version));
+
+        _info.randSeed = readU32(_file);
+        _info.snapshotInterval = readU32(_file);
+        _info.tickRate = readU32(_file);
+        _info.accounts.resize(readU32(_file));
+        _file.read(_info.accounts.data(), static_cast<std::streamsize>(_info.accounts.size()));
+        if (!_file)
+            throw std::runtime_error(path + " has a truncated header");
+    }
+
+    const CaptureInfo &CaptureReader::getInfo(void) const
+    {
+        return _info;
+    }
+
+    bool CaptureReader::next(CapturedEvent &out)
+    {
+        uint64_t tickDelta = 0;
+        if (!readVarint(_file, tickDelta))
+            return false;
+
+        uint64_t sessionId = 0;
+        uint64_t bodySize = 0;
+        if (!readVarint(_file, sessionId))
+            throw std::runtime_error("Truncated capture event");
+        const int opCode = _file.get();
+        if (opCode == std::char_traits<char>::eof() || !readVarint(_file, bodySize)
+            || bodySize > net::MAX_BODY_SIZE)
+            throw std::runtime_error("Truncated capture event");
+
+        _tick += static_cast<uint32_t>(tickDelta);
+        out.tick = _tick;
+        out.event.sessionId = static_cast<uint32_t>(sessionId);
+        out.event.packet = net::Packet(static_cast<net::OpCode>(opCode));
+        out.event.packet.header.sessionId = out.event.sessionId;
+        out.event.packet.header.bodySize = static_cast<uint32_t>(bodySize);
+        out.event.packet.body.resize(bodySize);
+        _file.read(reinterpret_cast<char *>(out.event.packet.body.data()),
+                   static_cast<std::streamsize>(bodySize));
+        if (!_file)
+            throw std::runtime_error("Truncated capture event");
+        return true;
+    }
+}
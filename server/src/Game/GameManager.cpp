@@ -8,9 +8,13 @@
 #include "Game/GameManager.hpp"
 #include "RType/ECS/Components/Health.hpp"
 #include "RType/ECS/Components/RoomId.hpp"
+#include "RType/Config/WeaponConfig.hpp"
 
+#include <algorithm>
 #include <cctype>
 #include <cstring>
+#include <format>
+#include <functional>
 #include <unordered_map>
 
 namespace rtp::server
@@ -20,47 +24,18 @@ namespace rtp::server
     //////////////////////////////////////////////////////////////////////////
 
     GameManager::GameManager(ServerNetwork &networkManager)
-        : _networkManager(networkManager)
+        : _networkManager(networkManager), _eventBatch(EVENT_BATCH_SIZE)
     {        
-        _registry.subscribe<ecs::components::Transform>();
-        _registry.subscribe<ecs::components::Velocity>();
-        _registry.subscribe<ecs::components::NetworkId>();
-        _registry.subscribe<ecs::components::server::InputComponent>();
-        _registry.subscribe<ecs::components::EntityType>();
-        _registry.subscribe<ecs::components::RoomId>();
-        _registry.subscribe<ecs::components::SimpleWeapon>();
-        _registry.subscribe<ecs::components::Ammo>();
-        _registry.subscribe<ecs::components::MouvementPattern>();
-        _registry.subscribe<ecs::components::Health>();
-        _registry.subscribe<ecs::components::BoundingBox>();
-        _registry.subscribe<ecs::components::Damage>();
-        _registry.subscribe<ecs::components::Powerup>();
-        _registry.subscribe<ecs::components::MovementSpeed>();
-        _registry.subscribe<ecs::components::Shield>();
-        _registry.subscribe<ecs::components::DoubleFire>();
-        _registry.subscribe<ecs::components::Homing>();
-        _registry.subscribe<ecs::components::Boomerang>();
-
         _networkSyncSystem = std::make_unique<NetworkSyncSystem>(_networkManager, _registry);
-        _movementSystem = std::make_unique<MovementSystem>(_registry);
         _authSystem = std::make_unique<AuthSystem>(_networkManager, _registry);
-        _roomSystem =  std::make_unique<RoomSystem>(_networkManager, _registry, *_networkSyncSystem);
+        _roomSystem =  std::make_unique<RoomSystem>(_networkManager);
+        _roomSystem->setProfiler(&_profiler);
         _playerSystem = std::make_unique<PlayerSystem>(_networkManager, _registry);
-        _entitySystem = std::make_unique<EntitySystem>(_registry, _networkManager, *_networkSyncSystem);
-        _playerMouvementSystem = std::make_unique<PlayerMouvementSystem>(_registry);
-        _playerShootSystem = std::make_unique<PlayerShootSystem>(_registry, *_roomSystem, *_networkSyncSystem);
-        _enemyAISystem = std::make_unique<EnemyAISystem>(_registry);
-        _levelSystem = std::make_unique<LevelSystem>(_registry, *_entitySystem, *_roomSystem, *_networkSyncSystem);
-        _collisionSystem = std::make_unique<CollisionSystem>(_registry, *_roomSystem, *_networkSyncSystem);
-        _enemyShootSystem = std::make_unique<EnemyShootSystem>(_registry, *_roomSystem, *_networkSyncSystem);
-        _homingSystem = std::make_unique<HomingSystem>(_registry);
-        _boomerangSystem = std::make_unique<BoomerangSystem>(_registry);
-        _bulletCleanupSystem = std::make_unique<BulletCleanupSystem>(_registry, *_roomSystem, *_networkSyncSystem);
-
-        _levelSystem->registerLevelPath(1, "config/levels/level_01.json");
-        _levelSystem->registerLevelPath(2, "config/levels/level_02.json");
-        _levelSystem->registerLevelPath(3, "config/levels/level_03.json");
-        _levelSystem->registerLevelPath(4, "config/levels/level_04.json");
+
+        // Load the weapon table now: room threads only ever read it
+        config::hasWeaponConfigs();
+        // Parse the levels in the background, a room starting earlier waits for its own
+        _roomSystem->getLevelCache().preload();
 
         _roomSystem->setOnRoomStarted(
             [this](uint32_t roomId) {
@@ -70,7 +45,8 @@ namespace rtp::server
                     return;
                 }
 
-                _levelSystem->startLevelForRoom(roomId, room->getLevelId());
+                RoomSimulation &simulation = room->getSimulation();
+                simulation.getLevelSystem().startLevelForRoom(roomId, room->getLevelId());
 
                 const auto players = room->getPlayers();
                 std::vector<uint32_t> sessions;
@@ -79,7 +55,7 @@ namespace rtp::server
                     sessions.push_back(player->getId());
                 }
 
-                const LevelData* level = _levelSystem->getLevelData(roomId);
+                const LevelData* level = simulation.getLevelSystem().getLevelData(roomId);
                 const Vec2f spawnPos = level
                     ? level->playerStart
                     : Vec2f{100.f, 100.f};
@@ -90,15 +66,14 @@ namespace rtp::server
                     net::ScoreUpdatePayload scorePayload{0};
                     scorePacket << scorePayload;
                     _networkSyncSystem->sendPacketToSession(
-                        player->getId(), scorePacket, net::NetworkMode::TCP);
-                    auto entity = _entitySystem->createPlayerEntity(player, spawnPos);
-                    uint32_t entityId = static_cast<uint32_t>(entity.index());
-                    player->setEntityId(entityId);
+                        player->getId(), scorePacket, net::NetworkMode::ReliableUDP);
+                    auto entity = simulation.getEntitySystem().createPlayerEntity(player, spawnPos);
+                    player->setEntityId(ecs::components::NetworkId::of(entity));
                     log::info("Spawned Entity {} for Player {}", entity.index(), player->getId());
-                    _networkSyncSystem->bindSessionToEntity(player->getId(), entity);
-                    sendEntitySpawnToSessions(entity, sessions);
+                    simulation.getNetworkSync().bindSessionToEntity(player->getId(), entity);
+                    sendEntitySpawnToSessions(simulation.getRegistry(), entity, sessions);
 
-                    if (auto healthRes = _registry.get<ecs::components::Health>()) {
+                    if (auto healthRes = simulation.getRegistry().get<ecs::components::Health>()) {
                         auto &healths = healthRes->get();
                         if (healths.has(entity)) {
                             net::Packet healthPacket(net::OpCode::HealthUpdate);
@@ -108,7 +83,7 @@ namespace rtp::server
                             };
                             healthPacket << hp;
                             _networkSyncSystem->sendPacketToSession(
-                                player->getId(), healthPacket, net::NetworkMode::TCP);
+                                player->getId(), healthPacket, net::NetworkMode::ReliableUDP);
                         }
                     }
                 }
@@ -126,30 +101,136 @@ namespace rtp::server
 
     void GameManager::gameLoop(void)
     {
-        const float dt = 1.0f / 60.0f;
+        using Clock = TickScheduler::Clock;
+
+        _scheduler = TickScheduler(_tickRate);
+        const uint64_t reportTicks = static_cast<uint64_t>(_statsInterval) * _tickRate;
+        uint64_t nextReport = _serverTick + reportTicks;
 
         while (true) {
-            auto start = std::chrono::high_resolution_clock::now();
+            _scheduler.waitForDeadline();
+            const uint32_t due = _scheduler.collectDueTicks(Clock::now());
+            for (uint32_t i = 0; i < due; ++i) {
+                const auto start = Clock::now();
+                tick();
+                _scheduler.recordTick(Clock::now() - start);
+            }
+            if (reportTicks > 0 && _serverTick >= nextReport) {
+                logTickStats();
+                nextReport += reportTicks;
+            }
+        }
+    }
+
+    void GameManager::tick(void)
+    {
+        const float dt = 1.0f / static_cast<float>(_tickRate);
+        ProfileZone tickZone(&_profiler, "tick");
 
+        {
+            ProfileZone zone(&_profiler, "processNetworkEvents");
             processNetworkEvents();
+        }
 
-            _serverTick++;
-            if (!_gamePaused) {
-                const float scaledDt = dt * _gameSpeed;
+        _serverTick++;
+        if (!_gamePaused) {
+            const float scaledDt = dt * _gameSpeed;
+            {
+                ProfileZone zone(&_profiler, "RoomSystem");
                 _roomSystem->update(scaledDt);
-                _levelSystem->update(scaledDt);
-                _enemyAISystem->update(scaledDt);
-                _playerMouvementSystem->update(scaledDt);
-                _playerShootSystem->update(scaledDt);
-                _enemyShootSystem->update(scaledDt);
-                _homingSystem->update(scaledDt);
-                _boomerangSystem->update(scaledDt);
-                _movementSystem->update(scaledDt);
-                _collisionSystem->update(scaledDt);
-                _bulletCleanupSystem->update(scaledDt);
             }
-            std::this_thread::sleep_for(std::chrono::milliseconds(16));
+            ProfileZone zone(&_profiler, "simulate");
+            _roomSystem->simulate(scaledDt, _simulationPool.get());
+        }
+        {
+            ProfileZone zone(&_profiler, "flushEntityEvents");
+            _roomSystem->flushEntityEvents();
+        }
+        {
+            ProfileZone zone(&_profiler, "broadcastSnapshots");
+            _roomSystem->broadcastSnapshots(_serverTick);
         }
+        ProfileZone zone(&_profiler, "flushNetwork");
+        _networkManager.flushUdp();
+        _networkManager.flushTcp();
+    }
+
+    uint32_t GameManager::getServerTick(void) const
+    {
+        return _serverTick;
+    }
+
+    void GameManager::setTickRate(uint32_t ticksPerSecond)
+    {
+        _tickRate = std::max<uint32_t>(ticksPerSecond, 1);
+        _scheduler = TickScheduler(_tickRate);
+    }
+
+    uint32_t GameManager::getTickRate(void) const
+    {
+        return _tickRate;
+    }
+
+    void GameManager::setSimulationThreads(size_t threads)
+    {
+        _simulationPool.reset();
+        if (threads == 0)
+            return;
+
+        auto pool = thread::ThreadPool::create(threads);
+        if (!pool) {
+            log::warning("Cannot start {} simulation threads, rooms run on the game thread: {}",
+                         threads, pool.error().message());
+            return;
+        }
+        _simulationPool = std::move(*pool);
+        log::info("Rooms are simulated on {} worker threads", threads);
+    }
+
+    void GameManager::setStatsInterval(uint32_t seconds)
+    {
+        _statsInterval = seconds;
+    }
+
+    TickStats GameManager::getTickStats(void) const
+    {
+        return _scheduler.getStats();
+    }
+
+    size_t GameManager::getSimulatedRoomCount(void) const
+    {
+        return _roomSystem->getSimulatedRoomCount();
+    }
+
+    void GameManager::setProfiling(bool enabled)
+    {
+        _profiler.setEnabled(enabled);
+        log::info("Tick profiling {}", enabled ? "enabled" : "disabled");
+    }
+
+    TickProfiler &GameManager::getProfiler(void)
+    {
+        return _profiler;
+    }
+
+    void GameManager::setEventRecorder(EventRecorder *recorder)
+    {
+        _recorder = recorder;
+    }
+
+    void GameManager::setAccountsPath(const std::string &path)
+    {
+        _authSystem->setAccountsPath(path);
+    }
+
+    void GameManager::setRandomSeed(uint32_t seed)
+    {
+        _roomSystem->setRandomSeed(seed);
+    }
+
+    void GameManager::setSnapshotInterval(uint32_t ticks)
+    {
+        _roomSystem->setSnapshotInterval(ticks);
     }
 
     void startGame(Room &room)
@@ -162,62 +243,99 @@ namespace rtp::server
     // Private Methods
     //////////////////////////////////////////////////////////////////////////
 
+    void GameManager::logTickStats(void) const
+    {
+        const TickStats stats = _scheduler.getStats();
+        log::info("Ticks: {} at {} Hz, {} overruns, {} late, {} skipped, "
+                  "duration p50 {} us p90 {} us p99 {} us max {} us, {} matches on {}",
+                  stats.ticks, stats.tickRate, stats.overruns, stats.lateTicks,
+                  stats.skippedTicks, stats.p50Us, stats.p90Us, stats.p99Us, stats.maxUs,
+                  _roomSystem->getSimulatedRoomCount(),
+                  _simulationPool ? "worker threads" : "the game thread");
+        if (!_profiler.isEnabled())
+            return;
+
+        std::vector<ZoneStats> zones = _profiler.getStats();
+        std::ranges::sort(zones, std::greater{}, &ZoneStats::p99Us);
+        std::string slowest;
+        for (size_t i = 0; i < std::min<size_t>(zones.size(), SLOWEST_ZONES_LOGGED); ++i) {
+            const ZoneStats &zone = zones[i];
+            slowest += std::format("{}{}{} p99 {} us max {} us",
+                                   i == 0 ? "" : ", ", zone.name,
+                                   zone.roomId == TickProfiler::NO_ROOM ? "" : std::format(" (room {})", zone.roomId),
+                                   zone.p99Us, zone.maxUs);
+        }
+        log::info("Slowest zones: {}", slowest);
+    }
+
     void GameManager::processNetworkEvents(void)
     {
-        while (auto optionalEvent = _networkManager.pollEvent()) {
-            auto& event = optionalEvent.value();
-            switch (event.packet.header.opCode) {
-                using namespace net;
-                using enum OpCode;
-                case None:
-                    break;
-                case Hello:
-                    handlePlayerConnect(event.sessionId);
-                    break;
-                case Disconnect:
-                    handlePlayerDisconnect(event.sessionId);
-                    break;
-                case LoginRequest:
-                    handlePlayerLoginAuth(event.sessionId, event.packet);
-                    break;
-                case RegisterRequest:
-                    handlePlayerRegisterAuth(event.sessionId, event.packet);
-                    break;
-                case InputTick:
-                    _networkSyncSystem->handleInput(event.sessionId, event.packet);
-                    break;
-                case ListRooms:
-                    handleListRooms(event.sessionId);
-                    break;
-                case CreateRoom:
-                    handleCreateRoom(event.sessionId, event.packet);
-                    break;
-                case JoinRoom:
-                    handleJoinRoom(event.sessionId, event.packet);
-                    break;
-                case LeaveRoom:
-                    handleLeaveRoom(event.sessionId, event.packet);
-                    break;
-                case SetReady:
-                    handleSetReady(event.sessionId, event.packet);
-                    break;
-                case UpdateSelectedWeapon: {
-                    handleUpdateSelectedWeapon(event.sessionId, event.packet);
-                    break;
+        size_t count = 0;
+        while ((count = _networkManager.pollEvents(_eventBatch)) > 0) {
+            for (size_t i = 0; i < count; ++i) {
+                if (_recorder != nullptr) {
+                    _recorder->record(_serverTick, _eventBatch[i]);
                 }
-                case RoomChatSended:
-                    handleRoomChatSended(event.sessionId, event.packet);
-                    break;
-                case Ping:
-                    handlePing(event.sessionId, event.packet);
-                    break;
-                default:
-                    handlePacket(event.sessionId, event.packet);
-                    break;
+                dispatchNetworkEvent(_eventBatch[i]);
             }
         }
     }
 
+    void GameManager::dispatchNetworkEvent(net::NetworkEvent &event)
+    {
+        switch (event.packet.header.opCode) {
+            using namespace net;
+            using enum OpCode;
+            case None:
+                break;
+            case Hello:
+                handlePlayerConnect(event.sessionId);
+                break;
+            case Disconnect:
+                handlePlayerDisconnect(event.sessionId);
+                break;
+            case LoginRequest:
+                handlePlayerLoginAuth(event.sessionId, event.packet);
+                break;
+            case RegisterRequest:
+                handlePlayerRegisterAuth(event.sessionId, event.packet);
+                break;
+            case InputTick:
+                if (auto room = _roomSystem->getRoomOfSession(event.sessionId)) {
+                    room->getSimulation().getNetworkSync().handleInput(event.sessionId, event.packet);
+                }
+                break;
+            case ListRooms:
+                handleListRooms(event.sessionId);
+                break;
+            case CreateRoom:
+                handleCreateRoom(event.sessionId, event.packet);
+                break;
+            case JoinRoom:
+                handleJoinRoom(event.sessionId, event.packet);
+                break;
+            case LeaveRoom:
+                handleLeaveRoom(event.sessionId, event.packet);
+                break;
+            case SetReady:
+                handleSetReady(event.sessionId, event.packet);
+                break;
+            case UpdateSelectedWeapon: {
+                handleUpdateSelectedWeapon(event.sessionId, event.packet);
+                break;
+            }
+            case RoomChatSended:
+                handleRoomChatSended(event.sessionId, event.packet);
+                break;
+            case Ping:
+                handlePing(event.sessionId, event.packet);
+                break;
+            default:
+                handlePacket(event.sessionId, event.packet);
+                break;
+        }
+    }
+
     void GameManager::handlePlayerConnect(uint32_t sessionId)
     {
         log::info("Client with Session ID {} connected, not logged yet", sessionId);
@@ -230,57 +348,11 @@ namespace rtp::server
         {
             std::lock_guard lock(_mutex);
             entityId = _playerSystem->removePlayer(sessionId);
+            // Despawns the player's entity from its room and queues the death
             _roomSystem->disconnectPlayer(sessionId);
-            _networkSyncSystem->handleDisconnect(sessionId);
         }
 
         if (entityId != 0) {
-            // Find the entity by scanning NetworkId sparse array for matching id
-            auto netsRes = _registry.get<ecs::components::NetworkId>();
-            ecs::Entity entity = ecs::NullEntity;
-            if (netsRes) {
-                auto &nets = netsRes->get();
-                for (auto e : nets.entities()) {
-                    if (nets[e].id == entityId) {
-                        entity = e;
-                        break;
-                    }
-                }
-            }
-
-            if (!entity.isNull()) {
-                auto transformsRes = _registry.get<ecs::components::Transform>();
-                auto typesRes = _registry.get<ecs::components::EntityType>();
-                auto roomsRes = _registry.get<ecs::components::RoomId>();
-
-                if (transformsRes && typesRes && netsRes && roomsRes) {
-                    auto &transforms = transformsRes->get();
-                    auto &types = typesRes->get();
-                    auto &nets = netsRes->get();
-                    auto &rooms = roomsRes->get();
-                    if (transforms.has(entity) && types.has(entity) && nets.has(entity) && rooms.has(entity)) {
-                        auto room = _roomSystem->getRoom(rooms[entity].id);
-                        if (room) {
-                            const auto players = room->getPlayers();
-                            if (!players.empty()) {
-                                net::Packet packet(net::OpCode::EntityDeath);
-                                net::EntityDeathPayload payload{};
-                                payload.netId = nets[entity].id;
-                                payload.type = static_cast<uint8_t>(types[entity].type);
-                                payload.position = transforms[entity].position;
-                                packet << payload;
-
-                                for (const auto& player : players) {
-                                    _networkSyncSystem->sendPacketToSession(player->getId(), packet, net::NetworkMode::TCP);
-                                }
-                            }
-                        }
-                    }
-                }
-
-                _registry.kill(entity);
-            }
-
             net::Packet disconnectPlayer(net::OpCode::Disconnect);
             disconnectPlayer << entityId;
             _networkManager.broadcastPacket(disconnectPlayer, net::NetworkMode::UDP);
@@ -460,10 +532,15 @@ namespace rtp::server
         log::info("Player {} updated weapon to {}", sessionId, static_cast<int>(kind));
 
         uint32_t entityId = player->getEntityId();
-        if (entityId != 0) {
-            ecs::Entity e(entityId, 0);
-            _entitySystem->applyWeaponToEntity(e, static_cast<rtp::ecs::components::WeaponKind>(kind));
-        }
+        auto room = _roomSystem->getRoom(player->getRoomId());
+        if (entityId == 0 || !room)
+            return;
+
+        // Player only stores the network ID, the lookup adds the generation
+        const ecs::Entity entity = room->getSimulation().getNetworkSync().findEntityByNetId(entityId);
+        if (!entity.isNull())
+            room->getSimulation().getEntitySystem().applyWeaponToEntity(
+                entity, static_cast<rtp::ecs::components::WeaponKind>(kind));
     }
 
     void GameManager::handleRoomChatSended(uint32_t sessionId, const net::Packet &packet)
@@ -557,7 +634,8 @@ namespace rtp::server
 
         if (cmd == "/help") {
             sendChatToSession(player->getId(), "Commands: /help, /kick <name>, /ban <name>, /mute <name>,");
-            sendChatToSession(player->getId(), "/stop, /run, /speed <float>, /debug <true|false>");
+            sendChatToSession(player->getId(), "/stop, /run, /speed <float>, /debug <true|false>,");
+            sendChatToSession(player->getId(), "/profile <on|off|dump>");
             sendChatToSession(player->getId(), "/debug enables invincibility + hitbox display");
             sendChatToSession(player->getId(), "Examples: /speed 0.5 | /debug true | /kick player1");
             return true;
@@ -597,20 +675,41 @@ namespace rtp::server
             }
             const bool enabled = (v == "true");
             
-            // Enable invincibility mode in CollisionSystem
-            _collisionSystem->setInvincible(enabled);
+            // Enable invincibility mode in the room's CollisionSystem
+            room->getSimulation().getCollisionSystem().setInvincible(enabled);
             
             net::Packet packet(net::OpCode::DebugModeUpdate);
             net::DebugModePayload payload{ static_cast<uint8_t>(enabled ? 1 : 0) };
             packet << payload;
             const auto players = room->getPlayers();
             for (const auto& p : players) {
-                _networkManager.sendPacket(p->getId(), packet, net::NetworkMode::TCP);
+                _networkManager.sendPacket(p->getId(), packet, net::NetworkMode::ReliableUDP);
             }
             sendSystemMessageToRoom(roomId, std::string("Debug mode ") + (enabled ? "enabled (invincibility ON)" : "disabled (invincibility OFF)"));
             return true;
         }
 
+        if (cmd == "/profile") {
+            const std::string v = toLower(arg);
+            if (v == "on" || v == "off") {
+                setProfiling(v == "on");
+                sendChatToSession(player->getId(), std::string("Profiling ") + (v == "on" ? "enabled" : "disabled"));
+            } else if (v == "dump") {
+                const std::string path = std::format("profile_{}.json", _serverTick);
+                try {
+                    const size_t events = _profiler.exportTrace(path);
+                    log::info("Wrote {} trace events to {}", events, path);
+                    sendChatToSession(player->getId(), "Trace written to " + path);
+                } catch (const std::exception &e) {
+                    log::error("{}", e.what());
+                    sendChatToSession(player->getId(), "Cannot write the trace");
+                }
+            } else {
+                sendChatToSession(player->getId(), "Usage: /profile <on|off|dump>");
+            }
+            return true;
+        }
+
         if (cmd == "/kick" || cmd == "/mute" || cmd == "/ban") {
             if (arg.empty()) {
                 sendChatToSession(player->getId(), std::string("Usage: ") + cmd + " <name>");
@@ -689,16 +788,17 @@ namespace rtp::server
         }
     }
 
-    void GameManager::sendEntitySpawnToSessions(const ecs::Entity& entity,
+    void GameManager::sendEntitySpawnToSessions(ecs::Registry& registry,
+                                                const ecs::Entity& entity,
                                                 const std::vector<uint32_t>& sessions)
     {
         if (sessions.empty())
             return;
 
-        auto transformRes = _registry.get<ecs::components::Transform>();
-        auto typeRes = _registry.get<ecs::components::EntityType>();
-        auto netRes = _registry.get<ecs::components::NetworkId>();
-        auto boxRes = _registry.get<ecs::components::BoundingBox>();
+        auto transformRes = registry.get<ecs::components::Transform>();
+        auto typeRes = registry.get<ecs::components::EntityType>();
+        auto netRes = registry.get<ecs::components::NetworkId>();
+        auto boxRes = registry.get<ecs::components::BoundingBox>();
         if (!transformRes || !typeRes || !netRes) {
             log::error("Missing component array for EntitySpawn");
             return;
@@ -724,7 +824,7 @@ namespace rtp::server
             sizeY = box.height;
         }
         uint8_t weaponKind = 0;
-        if (auto weaponRes = _registry.get<ecs::components::SimpleWeapon>()) {
+        if (auto weaponRes = registry.get<ecs::components::SimpleWeapon>()) {
             auto &weapons = weaponRes->get();
             if (weapons.has(entity)) {
                 weaponKind = static_cast<uint8_t>(weapons[entity].kind);
@@ -742,22 +842,27 @@ namespace rtp::server
             weaponKind
         };
         packet << payload;
-        _networkSyncSystem->sendPacketToSessions(sessions, packet, net::NetworkMode::TCP);
+        _networkSyncSystem->sendPacketToSessions(sessions, packet, net::NetworkMode::ReliableUDP);
     }
 
     void GameManager::sendRoomEntitySpawnsToSession(uint32_t roomId, uint32_t sessionId)
     {
-        auto view = _registry.zipView<
+        auto roomPtr = _roomSystem->getRoom(roomId);
+        if (!roomPtr)
+            return;
+        ecs::Registry &registry = roomPtr->getSimulation().getRegistry();
+
+        auto view = registry.zipView<
             ecs::components::Transform,
             ecs::components::NetworkId,
             ecs::components::EntityType,
             ecs::components::RoomId
         >();
-        auto boxRes = _registry.get<ecs::components::BoundingBox>();
+        auto boxRes = registry.get<ecs::components::BoundingBox>();
         auto *boxes = boxRes ? &boxRes->get() : nullptr;
         std::unordered_map<uint32_t, ecs::Entity> netToEntity;
         if (boxes) {
-            auto netRes = _registry.get<ecs::components::NetworkId>();
+            auto netRes = registry.get<ecs::components::NetworkId>();
             if (netRes) {
                 auto &nets = netRes->get();
                 for (auto e : nets.entities()) {
@@ -766,6 +871,7 @@ namespace rtp::server
             }
         }
 
+        std::vector<net::EntitySpawnPayload> spawns;
         for (auto&& [tf, net, type, room] : view) {
             if (room.id != roomId)
                 continue;
@@ -782,7 +888,7 @@ namespace rtp::server
             }
 
             uint8_t weaponKind = 0;
-            if (auto weaponRes = _registry.get<ecs::components::SimpleWeapon>()) {
+            if (auto weaponRes = registry.get<ecs::components::SimpleWeapon>()) {
                 auto &weapons = weaponRes->get();
                 auto it2 = netToEntity.find(net.id);
                 if (it2 != netToEntity.end() && weapons.has(it2->second)) {
@@ -790,8 +896,7 @@ namespace rtp::server
                 }
             }
 
-            net::Packet packet(net::OpCode::EntitySpawn);
-            net::EntitySpawnPayload payload = {
+            spawns.push_back({
                 net.id,
                 static_cast<uint8_t>(type.type),
                 tf.position.x,
@@ -799,9 +904,8 @@ namespace rtp::server
                 sizeX,
                 sizeY,
                 weaponKind
-            };
-            packet << payload;
-            _networkSyncSystem->sendPacketToSession(sessionId, packet, net::NetworkMode::TCP);
+            });
         }
+        _networkSyncSystem->sendEntitySpawnBatches({sessionId}, spawns);
     }
 }
@@ -0,0 +1,415 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** LevelBinary
+*/
+
+#include "Game/LevelData.hpp"
+#include "RType/Logger.hpp"
+
+#include <bit>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WIN32
+    #include <iterator>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace {
+
+    /**
+     * @brief Appends little-endian fields to a byte buffer
+     */
+    class Writer {
+        public:
+            void u8(uint8_t value)
+            {
+                _bytes.push_back(static_cast<char>(value));
+            }
+
+            void u16(uint16_t value)
+            {
+                u8(static_cast<uint8_t>(value));
+                u8(static_cast<uint8_t>(value >> 8));
+            }
+
+            void u32(uint32_t value)
+            {
+                u16(static_cast<uint16_t>(value));
+                u16(static_cast<uint16_t>(value >> 16));
+            }
+
+            void i32(int32_t value)
+            {
+                u32(static_cast<uint32_t>(value));
+            }
+
+            void f32(float value)
+            {
+                u32(std::bit_cast<uint32_t>(value));
+            }
+
+            void vec2(const rtp::Vec2f& value)
+            {
+                f32(value.x);
+                f32(value.y);
+            }
+
+            void str(const std::string& value)
+            {
+                u32(static_cast<uint32_t>(value.size()));
+                _bytes.append(value);
+            }
+
+            const std::string& bytes(void) const
+            {
+                return _bytes;
+            }
+
+        private:
+            std::string _bytes;
+    };
+
+    /**
+     * @brief Reads little-endian fields, fails once past the end
+     */
+    class Reader {
+        public:
+            Reader(const unsigned char* data, size_t size)
+                : _data(data), _size(size)
+            {
+            }
+
+            uint8_t u8(void)
+            {
+                if (!need(1)) {
+                    return 0;
+                }
+                return _data[_pos++];
+            }
+
+            uint16_t u16(void)
+            {
+                const uint16_t lo = u8();
+                return static_cast<uint16_t>(lo | (u8() << 8));
+            }
+
+            uint32_t u32(void)
+            {
+                const uint32_t lo = u16();
+                return lo | (static_cast<uint32_t>(u16()) << 16);
+            }
+
+            int32_t i32(void)
+            {
+                return static_cast<int32_t>(u32());
+            }
+
+            float f32(void)
+            {
+                return std::bit_cast<float>(u32());
+            }
+
+            rtp::Vec2f vec2(void)
+            {
+                const float x = f32();
+                return {x, f32()};
+            }
+
+            std::string str(void)
+            {
+                const uint32_t length = u32();
+                if (!need(length)) {
+                    return {};
+                }
+                std::string out(reinterpret_cast<const char*>(_data + _pos), length);
+                _pos += length;
+                return out;
+            }
+
+            /**
+             * @brief Element count that the remaining bytes can hold
+             * @param recordSize Smallest size of one element
+             */
+            uint32_t count(size_t recordSize)
+            {
+                const uint32_t n = u32();
+                if (!need(static_cast<size_t>(n) * recordSize)) {
+                    return 0;
+                }
+                return n;
+            }
+
+            bool ok(void) const
+            {
+                return _ok;
+            }
+
+        private:
+            bool need(size_t bytes)
+            {
+                if (!_ok || _size - _pos < bytes) {
+                    _ok = false;
+                    return false;
+                }
+                return true;
+            }
+
+            const unsigned char* _data;
+            size_t _size;
+            size_t _pos{0};
+            bool _ok{true};
+    };
+
+    /**
+     * @brief Read-only view of a whole file, mapped on POSIX systems
+     */
+    class MappedFile {
+        public:
+            explicit MappedFile(const std::string& path)
+            {
+#ifdef _WIN32
+                std::ifstream in(path, std::ios::binary);
+                if (!in) {
+                    return;
+                }
+                _buffer.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+                _data = reinterpret_cast<const unsigned char*>(_buffer.data());
+                _size = _buffer.size();
+                _open = true;
+#else
+                const int fd = ::open(path.c_str(), O_RDONLY);
+                if (fd < 0) {
+                    return;
+                }
+                struct stat info{};
+                if (::fstat(fd, &info) == 0 && info.st_size > 0) {
+                    void* map = ::mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+                    if (map != MAP_FAILED) {
+                        _data = static_cast<const unsigned char*>(map);
+                        _size = static_cast<size_t>(info.st_size);
+                        _open = true;
+                    }
+                } else if (info.st_size == 0) {
+                    _open = true;
+                }
+                ::close(fd);
+#endif
+            }
+
+            ~MappedFile()
+            {
+#ifndef _WIN32
+                if (_size > 0) {
+                    ::munmap(const_cast<unsigned char*>(_data), _size);
+                }
+#endif
+            }
+
+            MappedFile(const MappedFile&) = delete;
+            MappedFile& operator=(const MappedFile&) = delete;
+
+            bool isOpen(void) const { return _open; }
+            const unsigned char* data(void) const { return _data; }
+            size_t size(void) const { return _size; }
+
+        private:
+            const unsigned char* _data{nullptr};
+            size_t _size{0};
+            bool _open{false};
+#ifdef _WIN32
+            std::string _buffer;
+#endif
+    };
+
+    // Smallest encoded size of each record, used to reject absurd counts
+    constexpr size_t SPAWN_RECORD = 4 + 1 + 1 + 8 + 12;
+    constexpr size_t POWERUP_RECORD = 4 + 1 + 8 + 8;
+    constexpr size_t OBSTACLE_RECORD = 4 + 8 + 8 + 4 + 1;
+    constexpr size_t PHASE_RECORD = 12 + 4 + 12;
+
+    // A missing source cannot make the compiled file stale
+    bool editedAfter(const std::string& source, std::filesystem::file_time_type time)
+    {
+        std::error_code ec;
+        const auto sourceTime = std::filesystem::last_write_time(source, ec);
+        return !ec && sourceTime > time;
+    }
+
+} // end anonymous namespace
+
+namespace rtp::server {
+
+std::string compiledLevelPath(const std::string& jsonPath)
+{
+    return std::filesystem::path(jsonPath).replace_extension(".lvl").string();
+}
+
+bool saveLevelBinary(const LevelData& level, const std::string& path, std::string& error)
+{
+    Writer out;
+    out.u32(LEVEL_BINARY_MAGIC);
+    out.u16(LEVEL_BINARY_VERSION);
+    out.u16(0);
+    out.u32(level.id);
+    out.str(level.name);
+    out.vec2(level.playerStart);
+    out.f32(level.widthPixels);
+    out.str(level.tilesetPath);
+
+    out.u32(static_cast<uint32_t>(level.spawns.size()));
+    for (const auto& spawn : level.spawns) {
+        out.f32(spawn.atTime);
+        out.u8(static_cast<uint8_t>(spawn.type));
+        out.u8(static_cast<uint8_t>(spawn.pattern));
+        out.vec2(spawn.startPosition);
+        out.f32(spawn.speed);
+        out.f32(spawn.amplitude);
+        out.f32(spawn.frequency);
+    }
+
+    out.u32(static_cast<uint32_t>(level.powerups.size()));
+    for (const auto& powerup : level.powerups) {
+        out.f32(powerup.atTime);
+        out.u8(static_cast<uint8_t>(powerup.type));
+        out.vec2(powerup.position);
+        out.f32(powerup.value);
+        out.f32(powerup.duration);
+    }
+
+    out.u32(static_cast<uint32_t>(level.obstacles.size()));
+    for (const auto& obstacle : level.obstacles) {
+        out.f32(obstacle.atTime);
+        out.vec2(obstacle.position);
+        out.vec2(obstacle.size);
+        out.i32(obstacle.health);
+        out.u8(static_cast<uint8_t>(obstacle.type));
+    }
+
+    out.u8(level.boss3Data.has_value() ? 1 : 0);
+    if (level.boss3Data) {
+        out.u32(static_cast<uint32_t>(level.boss3Data->phases.size()));
+        for (const auto& phase : level.boss3Data->phases) {
+            out.f32(phase.duration);
+            out.i32(phase.spawnCount);
+            out.f32(phase.spawnInterval);
+            out.str(phase.enemyType);
+            out.f32(phase.spawnAreaX);
+            out.f32(phase.spawnAreaYMin);
+            out.f32(phase.spawnAreaYMax);
+        }
+    }
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        error = "Cannot create compiled level: " + path;
+        return false;
+    }
+    file.write(out.bytes().data(), static_cast<std::streamsize>(out.bytes().size()));
+    if (!file) {
+        error = "Failed to write compiled level: " + path;
+        return false;
+    }
+    return true;
+}
+
+std::optional<LevelData> loadLevelBinary(const std::string& path, std::string& error)
+{
+    MappedFile file(path);
+    if (!file.isOpen()) {
+        error = "Failed to read compiled level: " + path;
+        return std::nullopt;
+    }
+
+    Reader in(file.data(), file.size());
+    if (in.u32() != LEVEL_BINARY_MAGIC || in.u16() != LEVEL_BINARY_VERSION) {
+        error = "Not a compiled level of version " + std::to_string(LEVEL_BINARY_VERSION) + ": " + path;
+        return std::nullopt;
+    }
+    in.u16();
+
+    LevelData level;
+    level.id = in.u32();
+    level.name = in.str();
+    level.playerStart = in.vec2();
+    level.widthPixels = in.f32();
+    level.tilesetPath = in.str();
+
+    level.spawns.resize(in.count(SPAWN_RECORD));
+    for (auto& spawn : level.spawns) {
+        spawn.atTime = in.f32();
+        spawn.type = static_cast<net::EntityType>(in.u8());
+        spawn.pattern = static_cast<ecs::components::Patterns>(in.u8());
+        spawn.startPosition = in.vec2();
+        spawn.speed = in.f32();
+        spawn.amplitude = in.f32();
+        spawn.frequency = in.f32();
+    }
+
+    level.powerups.resize(in.count(POWERUP_RECORD));
+    for (auto& powerup : level.powerups) {
+        powerup.atTime = in.f32();
+        powerup.type = static_cast<ecs::components::PowerupType>(in.u8());
+        powerup.position = in.vec2();
+        powerup.value = in.f32();
+        powerup.duration = in.f32();
+    }
+
+    level.obstacles.resize(in.count(OBSTACLE_RECORD));
+    for (auto& obstacle : level.obstacles) {
+        obstacle.atTime = in.f32();
+        obstacle.position = in.vec2();
+        obstacle.size = in.vec2();
+        obstacle.health = in.i32();
+        obstacle.type = static_cast<net::EntityType>(in.u8());
+    }
+
+    if (in.u8() != 0) {
+        Boss3Data boss3Data;
+        boss3Data.phases.resize(in.count(PHASE_RECORD));
+        for (auto& phase : boss3Data.phases) {
+            phase.duration = in.f32();
+            phase.spawnCount = in.i32();
+            phase.spawnInterval = in.f32();
+            phase.enemyType = in.str();
+            phase.spawnAreaX = in.f32();
+            phase.spawnAreaYMin = in.f32();
+            phase.spawnAreaYMax = in.f32();
+        }
+        level.boss3Data = std::move(boss3Data);
+    }
+
+    if (!in.ok()) {
+        error = "Truncated compiled level: " + path;
+        return std::nullopt;
+    }
+    return level;
+}
+
+std::optional<LevelData> loadLevel(const std::string& path, std::string& error)
+{
+    const std::string compiled = compiledLevelPath(path);
+    std::error_code ec;
+    const auto compiledTime = std::filesystem::last_write_time(compiled, ec);
+    if (!ec && !editedAfter(path, compiledTime)) {
+        std::string binaryError;
+        if (auto level = loadLevelBinary(compiled, binaryError)) {
+            // Tile obstacles are baked in, so an edited tileset stales it too
+            if (level->tilesetPath.empty() || !editedAfter(level->tilesetPath, compiledTime)) {
+                return level;
+            }
+            log::info("{} is older than {}, reading {}", compiled, level->tilesetPath, path);
+        } else {
+            log::warning("Ignoring {}: {}", compiled, binaryError);
+        }
+    }
+    return loadLevelFromFile(path, error);
+}
+
+}  // namespace rtp::server
@@ -0,0 +1,82 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** LevelCache
+*/
+
+#include "Game/LevelCache.hpp"
+#include "RType/Logger.hpp"
+
+#include <chrono>
+
+namespace rtp::server {
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    void LevelCache::registerLevel(uint32_t levelId, const std::string& path)
+    {
+        std::lock_guard lock(_mutex);
+        _levels[levelId] = Entry{path, {}};
+    }
+
+    void LevelCache::preload(void)
+    {
+        std::lock_guard lock(_mutex);
+        for (auto& [levelId, entry] : _levels) {
+            if (entry.level.valid()) {
+                continue;
+            }
+            entry.level = std::async(std::launch::async, &LevelCache::load, levelId, entry.path).share();
+        }
+    }
+
+    LevelCache::LevelPtr LevelCache::get(uint32_t levelId)
+    {
+        std::shared_future<LevelPtr> level;
+        {
+            std::lock_guard lock(_mutex);
+            auto it = _levels.find(levelId);
+            if (it == _levels.end()) {
+                log::warning("No level path registered for level {}", levelId);
+                return nullptr;
+            }
+            if (!it->second.level.valid()) {
+                // Run by the first get(), later callers wait for its result
+                it->second.level = std::async(std::launch::deferred, &LevelCache::load, levelId, it->second.path).share();
+            }
+            level = it->second.level;
+        }
+        return level.get();
+    }
+
+    size_t LevelCache::size(void) const
+    {
+        std::lock_guard lock(_mutex);
+        return _levels.size();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private API
+    //////////////////////////////////////////////////////////////////////////
+
+    LevelCache::LevelPtr LevelCache::load(uint32_t levelId, const std::string& path)
+    {
+        const auto start = std::chrono::steady_clock::now();
+
+        std::string error;
+        auto level = loadLevel(path, error);
+        if (!level) {
+            log::error("Failed to load level {}: {}", levelId, error);
+            return nullptr;
+        }
+
+        const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        log::info("Parsed level {} ({} spawns, {} obstacles) in {} us",
+                  levelId, level->spawns.size(), level->obstacles.size(), elapsed.count());
+        return std::make_shared<const LevelData>(std::move(level.value()));
+    }
+}
@@ -6,6 +6,7 @@
  */
 
 #include "Game/Room.hpp"
+#include "Game/RoomSimulation.hpp"
 #include "RType/Logger.hpp"
 #include "RType/ECS/Components/RoomId.hpp"
 #include "RType/ECS/Components/Velocity.hpp"
@@ -42,12 +43,13 @@ namespace rtp::server
     // Public API
     ///////////////////////////////////////////////////////////////////////////
 
-    Room::Room(Registry& registry, NetworkSyncSystem& network, uint32_t id, const std::string &name,
+    Room::Room(std::unique_ptr<RoomSimulation> simulation, uint32_t id, const std::string &name,
                uint32_t maxPlayers, float difficulty, float speed, RoomType type,
                uint32_t creatorSessionId, uint32_t levelId, uint32_t seed,
                uint32_t durationMinutes)
-        : _registry(registry)
-        , _network(network)
+        : _simulation(std::move(simulation))
+        , _network(_simulation->getNetworkSync())
+        , _registry(_simulation->getRegistry())
         , _id(id)
         , _name(name)
         , _maxPlayers(maxPlayers)
@@ -93,14 +95,12 @@ namespace rtp::server
                 log::warning("Player {} cannot join Room '{}' (ID: {}): Game already started",
                             player->getUsername(), _name, _id);
             } else {
-                auto it = std::find_if(_players.begin(), _players.end(),
-                    [sessionId](const auto &entry) { return entry.first->getId() == sessionId; });
-
-                if (it != _players.end()) {
+                if (_playersBySession.contains(sessionId)) {
                     log::warning("Player {} already in Room '{}' (ID: {})",
                                 player->getUsername(), _name, _id);
                 } else {
                     _players.emplace_back(player, type);
+                    _playersBySession[sessionId] = std::prev(_players.end());
                     log::info("Player {} joined Room '{}' (ID: {})",
                             player->getUsername(), _name, _id);
                     username = player->getUsername();
@@ -135,19 +135,12 @@ namespace rtp::server
         {
             std::lock_guard lock(_mutex);
 
-            auto before = _players.size();
-            for (const auto &entry : _players) {
-                if (entry.first->getId() == sessionId) {
-                    username = entry.first->getUsername();
-                    type = entry.second;
-                    break;
-                }
-            }
-            _players.remove_if([sessionId](const auto &entry) {
-                return entry.first->getId() == sessionId;
-            });
-
-            if (_players.size() != before) {
+            auto it = _playersBySession.find(sessionId);
+            if (it != _playersBySession.end()) {
+                username = it->second->first->getUsername();
+                type = it->second->second;
+                _players.erase(it->second);
+                _playersBySession.erase(it);
                 removed = true;
                 log::info("Player with Session ID {} removed from Room '{}' (ID: {})",
                         sessionId, _name, _id);
@@ -216,6 +209,26 @@ namespace rtp::server
         return out;
     }
 
+    PlayerPtr Room::getPlayer(uint32_t sessionId) const
+    {
+        std::lock_guard lock(_mutex);
+
+        auto it = _playersBySession.find(sessionId);
+        return it != _playersBySession.end() ? it->second->first : nullptr;
+    }
+
+    PlayerPtr Room::getPlayerByEntity(uint32_t entityId) const
+    {
+        const auto sessionId = _network.getSessionOfEntity(entityId);
+        if (!sessionId)
+            return nullptr;
+
+        PlayerPtr player = getPlayer(*sessionId);
+        if (!player || player->getEntityId() != entityId)
+            return nullptr;
+        return player;
+    }
+
     uint32_t Room::getId(void) const
     {
         return _id;
@@ -255,10 +268,9 @@ namespace rtp::server
     {
         std::lock_guard lock(_mutex);
 
-        for (const auto &entry : _players) {
-            if (entry.first->getId() == sessionId) {
-                return entry.second;
-            }
+        auto it = _playersBySession.find(sessionId);
+        if (it != _playersBySession.end()) {
+            return it->second->second;
         }
 
         log::warning("Player with Session ID {} not found in Room '{}' (ID: {})",
@@ -270,15 +282,14 @@ namespace rtp::server
     {
         std::lock_guard lock(_mutex);
 
-        for (auto &entry : _players) {
-            if (entry.first->getId() == sessionId) {
-                entry.second = type;
+        auto it = _playersBySession.find(sessionId);
+        if (it != _playersBySession.end()) {
+            it->second->second = type;
 #ifdef DEBUG
-                log::info("Player with Session ID {} set to type {} in Room '{}' (ID: {})",
-                        sessionId, toString(type), _name, _id);
+            log::info("Player with Session ID {} set to type {} in Room '{}' (ID: {})",
+                    sessionId, toString(type), _name, _id);
 #endif
-                return;
-            }
+            return;
         }
 
         log::warning("Player with Session ID {} not found in Room '{}' (ID: {})",
@@ -347,7 +358,7 @@ namespace rtp::server
         log::info("Game finished in Room '{}' (ID: {})", _name, _id);
     }
 
-    void Room::update(uint32_t serverTick, float dt)
+    void Room::update(float dt)
     {
         if (_state == State::InGame) {
             _scoreTick += dt;
@@ -369,16 +380,27 @@ namespace rtp::server
                     net::ScoreUpdatePayload payload{player->getScore()};
                     packet << payload;
                     _network.sendPacketToSession(player->getId(), packet,
-                                                 net::NetworkMode::TCP);
+                                                 net::NetworkMode::ReliableUDP);
                 }
             }
         }
-        broadcastRoomState(serverTick);
+    }
+
+    RoomSimulation &Room::getSimulation(void)
+    {
+        return *_simulation;
+    }
+
+    bool Room::isSimulated(void) const
+    {
+        std::lock_guard lock(_mutex);
+        return _type != RoomType::Lobby && _state != State::Waiting;
     }
 
     void Room::broadcastRoomState(uint32_t serverTick)
     {
         std::vector<uint32_t> sessions;
+        uint16_t playerCount = 0;
         {
             std::lock_guard lock(_mutex);
             if (_type == RoomType::Lobby)
@@ -389,6 +411,8 @@ namespace rtp::server
             sessions.reserve(_players.size());
             for (const auto& entry : _players) {
                 sessions.push_back(entry.first->getId());
+                if (entry.second == PlayerType::Player)
+                    ++playerCount;
             }
         }
 
@@ -396,20 +420,17 @@ namespace rtp::server
 
         auto transformsRes = _registry.get<ecs::components::Transform>();
         auto networkIdsRes = _registry.get<ecs::components::NetworkId>();
-        auto roomIdsRes = _registry.get<ecs::components::RoomId>();
         auto velocitiesRes = _registry.get<ecs::components::Velocity>();
         
-        if (!transformsRes || !networkIdsRes || !roomIdsRes)
+        if (!transformsRes || !networkIdsRes)
             return;
         
         auto& transforms = transformsRes->get();
         auto& networkIds = networkIdsRes->get();
-        auto& roomIds = roomIdsRes->get();
 
+        // The room registry holds nothing but this room's entities
         for (auto entity : transforms.entities()) {
-            if (!networkIds.has(entity) || !roomIds.has(entity))
-                continue;
-            if (roomIds[entity].id != _id)
+            if (!networkIds.has(entity))
                 continue;
             
             Vec2f velocity{0.0f, 0.0f};
@@ -417,7 +438,7 @@ namespace rtp::server
                 auto& velocities = velocitiesRes->get();
                 if (velocities.has(entity)) {
                     const auto& vel = velocities[entity];
-                    velocity = vel.direction * vel.speed;
+                    velocity = vel.speed > 0.0f ? vel.direction * vel.speed : vel.direction;
                 }
             }
             
@@ -434,15 +455,52 @@ namespace rtp::server
         if (snapshots.empty())
             return;
 
-        net::Packet packet(net::OpCode::RoomUpdate);
-        net::RoomSnapshotPayload header = {
+        const net::RoomSnapshotPayload header = {
+            _id,
+            playerCount,
             serverTick,
-            static_cast<uint16_t>(snapshots.size())
+            static_cast<uint16_t>(snapshots.size()),
+            1
         };
-        packet << header << snapshots;
 
         for (uint32_t sid : sessions) {
+            net::Packet packet(net::OpCode::RoomUpdate);
+            packet << header << _network.getInputAck(sid) << snapshots;
             _network.sendPacketToSession(sid, packet, net::NetworkMode::UDP);
         }
     }
+
+    void Room::queueEntitySpawn(const net::EntitySpawnPayload &payload)
+    {
+        std::lock_guard lock(_mutex);
+        _pendingSpawns.push_back(payload);
+    }
+
+    void Room::queueEntityDeath(const net::EntityDeathPayload &payload)
+    {
+        std::lock_guard lock(_mutex);
+        _pendingDeaths.push_back(payload);
+    }
+
+    void Room::flushEntityEvents(void)
+    {
+        std::vector<uint32_t> sessions;
+        {
+            std::lock_guard lock(_mutex);
+            if (_pendingSpawns.empty() && _pendingDeaths.empty())
+                return;
+            _flushSpawns.swap(_pendingSpawns);
+            _flushDeaths.swap(_pendingDeaths);
+
+            sessions.reserve(_players.size());
+            for (const auto &entry : _players) {
+                sessions.push_back(entry.first->getId());
+            }
+        }
+
+        _network.sendEntitySpawnBatches(sessions, _flushSpawns);
+        _network.sendEntityDeathBatches(sessions, _flushDeaths);
+        _flushSpawns.clear();
+        _flushDeaths.clear();
+    }
 } // namespace rtp::server
@@ -0,0 +1,144 @@
+/**
+ * File   : RoomSimulation.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "Game/RoomSimulation.hpp"
+#include "Systems/RoomSystem.hpp"
+
+#include "RType/ECS/Components/InputComponent.hpp"
+#include "RType/ECS/Components/Transform.hpp"
+#include "RType/ECS/Components/Velocity.hpp"
+#include "RType/ECS/Components/NetworkId.hpp"
+#include "RType/ECS/Components/EntityType.hpp"
+#include "RType/ECS/Components/RoomId.hpp"
+#include "RType/ECS/Components/SimpleWeapon.hpp"
+#include "RType/ECS/Components/Ammo.hpp"
+#include "RType/ECS/Components/MouvementPattern.hpp"
+#include "RType/ECS/Components/Health.hpp"
+#include "RType/ECS/Components/BoundingBox.hpp"
+#include "RType/ECS/Components/Damage.hpp"
+#include "RType/ECS/Components/Powerup.hpp"
+#include "RType/ECS/Components/MovementSpeed.hpp"
+#include "RType/ECS/Components/Shield.hpp"
+#include "RType/ECS/Components/DoubleFire.hpp"
+#include "RType/ECS/Components/Homing.hpp"
+#include "RType/ECS/Components/Boomerang.hpp"
+
+namespace rtp::server
+{
+    namespace
+    {
+        ecs::Registry &subscribeComponents(ecs::Registry &registry)
+        {
+            registry.subscribe<ecs::components::Transform>();
+            registry.subscribe<ecs::components::Velocity>();
+            registry.subscribe<ecs::components::NetworkId>();
+            registry.subscribe<ecs::components::server::InputComponent>();
+            registry.subscribe<ecs::components::EntityType>();
+            registry.subscribe<ecs::components::RoomId>();
+            registry.subscribe<ecs::components::SimpleWeapon>();
+            registry.subscribe<ecs::components::Ammo>();
+            registry.subscribe<ecs::components::MouvementPattern>();
+            registry.subscribe<ecs::components::Health>();
+            registry.subscribe<ecs::components::BoundingBox>();
+            registry.subscribe<ecs::components::Damage>();
+            registry.subscribe<ecs::components::Powerup>();
+            registry.subscribe<ecs::components::MovementSpeed>();
+            registry.subscribe<ecs::components::Shield>();
+            registry.subscribe<ecs::components::DoubleFire>();
+            registry.subscribe<ecs::components::Homing>();
+            registry.subscribe<ecs::components::Boomerang>();
+            return registry;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    RoomSimulation::RoomSimulation(ServerNetwork &network, RoomSystem &roomSystem, uint32_t seed)
+        : _rng(seed)
+        , _entityIndex(_registry)
+        , _projectilePool(subscribeComponents(_registry), _entityIndex)
+        , _networkSync(network, _registry)
+        , _entitySystem(_registry, _entityIndex, network, _networkSync)
+        , _movementSystem(_registry)
+        , _playerMouvementSystem(_registry)
+        , _playerShootSystem(_registry, _entityIndex, _projectilePool, roomSystem, _networkSync, _rng)
+        , _enemyAISystem(_registry, _entityIndex)
+        , _levelSystem(_registry, _entityIndex, roomSystem.getLevelCache(),
+                       _entitySystem, roomSystem, _networkSync, _rng)
+        , _collisionSystem(_registry, _entityIndex, _projectilePool, roomSystem, _networkSync, _rng)
+        , _enemyShootSystem(_registry, _projectilePool, roomSystem, _networkSync)
+        , _homingSystem(_registry, _entityIndex)
+        , _boomerangSystem(_registry, _entityIndex)
+        , _bulletCleanupSystem(_registry, _projectilePool, roomSystem, _networkSync)
+    {
+    }
+
+    void RoomSimulation::update(float dt, TickProfiler *profiler, uint32_t roomId)
+    {
+        const auto run = [=](const char *zone, auto &system) {
+            ProfileZone scope(profiler, zone, roomId);
+            system.update(dt);
+        };
+
+        const auto flush = [&]() {
+            ProfileZone scope(profiler, "EntityIndex", roomId);
+            _entityIndex.flush();
+        };
+
+        // Flushed after each system that spawns what the next readers look for
+        flush();
+        run("LevelSystem", _levelSystem);
+        flush();
+        run("EnemyAISystem", _enemyAISystem);
+        run("PlayerMouvementSystem", _playerMouvementSystem);
+        run("PlayerShootSystem", _playerShootSystem);
+        run("EnemyShootSystem", _enemyShootSystem);
+        run("HomingSystem", _homingSystem);
+        run("BoomerangSystem", _boomerangSystem);
+        run("MovementSystem", _movementSystem);
+        flush();
+        run("CollisionSystem", _collisionSystem);
+        run("BulletCleanupSystem", _bulletCleanupSystem);
+    }
+
+    void RoomSimulation::reseed(uint32_t seed)
+    {
+        _rng.seed(seed);
+    }
+
+    ecs::Registry &RoomSimulation::getRegistry(void)
+    {
+        return _registry;
+    }
+
+    NetworkSyncSystem &RoomSimulation::getNetworkSync(void)
+    {
+        return _networkSync;
+    }
+
+    EntityIndex &RoomSimulation::getEntityIndex(void)
+    {
+        return _entityIndex;
+    }
+
+    EntitySystem &RoomSimulation::getEntitySystem(void)
+    {
+        return _entitySystem;
+    }
+
+    LevelSystem &RoomSimulation::getLevelSystem(void)
+    {
+        return _levelSystem;
+    }
+
+    CollisionSystem &RoomSimulation::getCollisionSystem(void)
+    {
+        return _collisionSystem;
+    }
+}
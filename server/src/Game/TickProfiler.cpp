@@ -0,0 +1,169 @@
+/**
+ * File   : TickProfiler.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "Game/TickProfiler.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace rtp::server
+{
+    namespace
+    {
+        std::string escapeJson(std::string_view text)
+        {
+            std::string out;
+            out.reserve(text.size());
+            for (const char c : text) {
+                if (c == '"' || c == '\\')
+                    out += '\\';
+                out += c;
+            }
+            return out;
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    TickProfiler::TickProfiler(void)
+        : _origin(Clock::now())
+    {
+    }
+
+    void TickProfiler::setEnabled(bool enabled)
+    {
+        _enabled.store(enabled, std::memory_order_relaxed);
+    }
+
+    bool TickProfiler::isEnabled(void) const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+
+    void TickProfiler::record(const char *zone, uint32_t roomId,
+                              Clock::time_point start, Clock::time_point end)
+    {
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+
+        const auto us = duration_cast<microseconds>(end - start).count();
+        const auto durationUs = static_cast<uint32_t>(std::clamp<int64_t>(us, 0, UINT32_MAX));
+        const int64_t startUs = duration_cast<microseconds>(start - _origin).count();
+
+        std::lock_guard lock(_mutex);
+        Histogram &histogram = _zones[{zone, roomId}];
+        histogram.samplesUs[histogram.next] = durationUs;
+        histogram.next = (histogram.next + 1) % HISTOGRAM_SAMPLES;
+        histogram.count = std::min(histogram.count + 1, HISTOGRAM_SAMPLES);
+        ++histogram.calls;
+        histogram.totalUs += durationUs;
+
+        const TraceEvent event{zone, roomId, threadIndex(), startUs, durationUs};
+        if (_trace.size() < MAX_TRACE_EVENTS) {
+            _trace.push_back(event);
+        } else {
+            _trace[_traceNext] = event;
+            _traceNext = (_traceNext + 1) % MAX_TRACE_EVENTS;
+        }
+    }
+
+    void TickProfiler::dropRoom(uint32_t roomId)
+    {
+        std::lock_guard lock(_mutex);
+        std::erase_if(_zones, [roomId](const auto &entry) {
+            return entry.first.second == roomId;
+        });
+    }
+
+    void TickProfiler::reset(void)
+    {
+        std::lock_guard lock(_mutex);
+        _zones.clear();
+        _trace.clear();
+        _traceNext = 0;
+    }
+
+    std::vector<ZoneStats> TickProfiler::getStats(void) const
+    {
+        std::lock_guard lock(_mutex);
+        std::vector<ZoneStats> result;
+        result.reserve(_zones.size());
+
+        std::vector<uint32_t> sorted;
+        for (const auto &[key, histogram] : _zones) {
+            ZoneStats stats;
+            stats.name = std::string(key.first);
+            stats.roomId = key.second;
+            stats.calls = histogram.calls;
+            stats.totalUs = histogram.totalUs;
+
+            sorted.assign(histogram.samplesUs.begin(),
+                          histogram.samplesUs.begin() + static_cast<std::ptrdiff_t>(histogram.count));
+            std::ranges::sort(sorted);
+            if (!sorted.empty()) {
+                const auto at = [&sorted](size_t percent) {
+                    return sorted[(sorted.size() - 1) * percent / 100];
+                };
+                stats.p50Us = at(50);
+                stats.p90Us = at(90);
+                stats.p99Us = at(99);
+                stats.maxUs = sorted.back();
+            }
+            result.push_back(std::move(stats));
+        }
+        return result;
+    }
+
+    size_t TickProfiler::exportTrace(const std::string &path) const
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            throw std::runtime_error("Cannot write trace " + path);
+
+        std::lock_guard lock(_mutex);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        for (size_t i = 0; i < _threads.size(); ++i) {
+            out << (i == 0 ? "" : ",")
+                << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << i
+                << ",\"args\":{\"name\":\"thread " << i << "\"}}";
+        }
+
+        // Oldest first: once the ring wrapped, it starts at _traceNext
+        const size_t count = _trace.size();
+        for (size_t i = 0; i < count; ++i) {
+            const TraceEvent &event = _trace[(_traceNext + i) % count];
+            out << (_threads.empty() && i == 0 ? "" : ",")
+                << "{\"name\":\"" << escapeJson(event.zone)
+                << "\",\"cat\":\"" << (event.roomId == NO_ROOM ? "server" : "room")
+                << "\",\"ph\":\"X\",\"ts\":" << event.startUs
+                << ",\"dur\":" << event.durationUs
+                << ",\"pid\":1,\"tid\":" << event.thread
+                << ",\"args\":{\"room\":" << event.roomId << "}}";
+        }
+        out << "]}\n";
+        if (!out)
+            throw std::runtime_error("Cannot write trace " + path);
+        return count;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    uint32_t TickProfiler::threadIndex(void)
+    {
+        const auto id = std::this_thread::get_id();
+        const auto it = std::ranges::find(_threads, id);
+        if (it != _threads.end())
+            return static_cast<uint32_t>(it - _threads.begin());
+        _threads.push_back(id);
+        return static_cast<uint32_t>(_threads.size() - 1);
+    }
+}
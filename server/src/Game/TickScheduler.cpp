@@ -0,0 +1,111 @@
+/**
+ * File   : TickScheduler.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "Game/TickScheduler.hpp"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace rtp::server
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    TickScheduler::TickScheduler(uint32_t tickRate, Clock::time_point start)
+        : _tickRate(std::max<uint32_t>(tickRate, 1))
+        , _period(std::chrono::duration_cast<Clock::duration>(
+              std::chrono::duration<double>(1.0 / _tickRate)))
+        , _lateTolerance(_period / 10)
+        , _deadline(start + _period)
+    {
+    }
+
+    uint32_t TickScheduler::getTickRate(void) const
+    {
+        return _tickRate;
+    }
+
+    TickScheduler::Clock::duration TickScheduler::getPeriod(void) const
+    {
+        return _period;
+    }
+
+    TickScheduler::Clock::time_point TickScheduler::getDeadline(void) const
+    {
+        return _deadline;
+    }
+
+    void TickScheduler::waitForDeadline(void) const
+    {
+        const auto wakeUp = _deadline - SPIN_MARGIN;
+        if (Clock::now() < wakeUp)
+            std::this_thread::sleep_until(wakeUp);
+        while (Clock::now() < _deadline)
+            std::this_thread::yield();
+    }
+
+    uint32_t TickScheduler::collectDueTicks(Clock::time_point now)
+    {
+        if (now < _deadline)
+            return 0;
+
+        const auto behind = now - _deadline;
+        const uint64_t due = static_cast<uint64_t>(behind / _period) + 1;
+
+        // Tick i is due at _deadline + i * period and starts around now
+        for (uint64_t i = 0; i < std::min<uint64_t>(due, MAX_CATCH_UP_TICKS); ++i) {
+            if (behind - static_cast<Clock::rep>(i) * _period > _lateTolerance)
+                ++_lateTicks;
+        }
+
+        if (due > MAX_CATCH_UP_TICKS) {
+            _skippedTicks += due - MAX_CATCH_UP_TICKS;
+            _deadline = now + _period;
+            return MAX_CATCH_UP_TICKS;
+        }
+        _deadline += static_cast<Clock::rep>(due) * _period;
+        return static_cast<uint32_t>(due);
+    }
+
+    void TickScheduler::recordTick(Clock::duration duration)
+    {
+        ++_ticks;
+        if (duration > _period)
+            ++_overruns;
+
+        const auto us = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        _durationsUs[_durationNext] = static_cast<uint32_t>(std::clamp<int64_t>(us, 0, UINT32_MAX));
+        _durationNext = (_durationNext + 1) % DURATION_SAMPLES;
+        _durationCount = std::min(_durationCount + 1, DURATION_SAMPLES);
+    }
+
+    TickStats TickScheduler::getStats(void) const
+    {
+        TickStats stats;
+        stats.tickRate = _tickRate;
+        stats.ticks = _ticks;
+        stats.overruns = _overruns;
+        stats.lateTicks = _lateTicks;
+        stats.skippedTicks = _skippedTicks;
+        if (_durationCount == 0)
+            return stats;
+
+        std::vector<uint32_t> sorted(_durationsUs.begin(),
+                                     _durationsUs.begin() + static_cast<std::ptrdiff_t>(_durationCount));
+        std::ranges::sort(sorted);
+        const auto at = [&sorted](size_t percent) {
+            return sorted[(sorted.size() - 1) * percent / 100];
+        };
+        stats.p50Us = at(50);
+        stats.p90Us = at(90);
+        stats.p99Us = at(99);
+        stats.maxUs = sorted.back();
+        return stats;
+    }
+}
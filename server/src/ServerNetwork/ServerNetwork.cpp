@@ -8,19 +8,56 @@
 #include "ServerNetwork/ServerNetwork.hpp"
 #include "RType/Logger.hpp"
 
+#include <algorithm>
+
 namespace rtp::server {
 
+    namespace
+    {
+        constexpr size_t TOP_OPCODES = 5;   /**< OpCodes listed per direction in a summary */
+    }
+
     //////////////////////////////////////////////////////////////////////////
     // Public API
     //////////////////////////////////////////////////////////////////////////
 
-    ServerNetwork::ServerNetwork(uint16_t port)
+    ServerNetwork::UdpShard::UdpShard(size_t idx, uint16_t port, bool reusePort)
+        : index(idx),
+          ioContext(1),
+          socket(ioContext)
+    {
+        socket.open(asio::ip::udp::v4());
+#if defined(SO_REUSEPORT)
+        if (reusePort) {
+            socket.set_option(
+                asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>(true));
+        }
+#else
+        (void)reusePort;
+#endif
+        socket.bind(asio::ip::udp::endpoint(asio::ip::udp::v4(), port));
+    }
+
+    ServerNetwork::ServerNetwork(uint16_t port, size_t ioThreads)
         : _ioContext(),
           _acceptor(_ioContext, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), port)),
-          _udpSocket(_ioContext, asio::ip::udp::endpoint(asio::ip::udp::v4(), port)),
           _nextSessionId(1)
     {
-        log::info("ServerNetwork initialized on port {}", port);
+#if !defined(SO_REUSEPORT)
+        if (ioThreads > 1) {
+            log::warning("SO_REUSEPORT unavailable, running a single I/O shard");
+            ioThreads = 1;
+        }
+#endif
+        ioThreads = std::max<size_t>(ioThreads, 1);
+
+        const uint16_t udpPort = _acceptor.local_endpoint().port();
+        _shards.reserve(ioThreads);
+        for (size_t i = 0; i < ioThreads; ++i) {
+            _shards.push_back(std::make_unique<UdpShard>(i, udpPort, ioThreads > 1));
+        }
+        log::info("ServerNetwork initialized on port {} with {} I/O shard(s)",
+                  udpPort, _shards.size());
     }
 
     ServerNetwork::~ServerNetwork()
@@ -33,7 +70,7 @@ namespace rtp::server {
         log::info("Starting ServerNetwork...");
         
         acceptConnection();
-        receiveUdpPacket();
+        scheduleStatsTimer();
 
         _ioThread = std::thread([this]() {
             try {
@@ -44,6 +81,18 @@ namespace rtp::server {
                 log::error("ServerNetwork context error: {}", e.what());
             }
         });
+
+        for (auto &shard : _shards) {
+            receiveUdpPacket(*shard);
+            shard->thread = std::thread([this, &shard = *shard]() {
+                try {
+                    auto workGuard = asio::make_work_guard(shard.ioContext);
+                    shard.ioContext.run();
+                } catch (const std::exception& e) {
+                    log::error("ServerNetwork shard {} error: {}", shard.index, e.what());
+                }
+            });
+        }
     }
 
     void ServerNetwork::stop()
@@ -51,11 +100,23 @@ namespace rtp::server {
         if (!_ioContext.stopped()) {
             _ioContext.stop();
         }
+        for (auto &shard : _shards) {
+            if (!shard->ioContext.stopped()) {
+                shard->ioContext.stop();
+            }
+        }
         if (_ioThread.joinable()) {
             _ioThread.join();
         }
+        for (auto &shard : _shards) {
+            if (shard->thread.joinable()) {
+                shard->thread.join();
+            }
+        }
         _acceptor.close();
-        _udpSocket.close();
+        for (auto &shard : _shards) {
+            shard->socket.close();
+        }
         log::info("ServerNetwork stopped.");
     }
 
@@ -64,7 +125,7 @@ namespace rtp::server {
         std::lock_guard<std::mutex> lock(_sessionsMutex);
         auto it = _sessions.find(sessionId);
         if (it != _sessions.end()) {
-            it->second->send(packet, mode);
+            sendToSession(*it->second, packet, mode);
         }
     }
 
@@ -72,25 +133,151 @@ namespace rtp::server {
     {
         std::lock_guard<std::mutex> lock(_sessionsMutex);
         for (auto& [id, session] : _sessions) {
-            session->send(packet, mode);
+            sendToSession(*session, packet, mode);
+        }
+    }
+
+    void ServerNetwork::flushUdp(void)
+    {
+        {
+            const auto now = net::ReliableChannel::Clock::now();
+            std::lock_guard<std::mutex> lock(_sessionsMutex);
+            for (auto &[id, session] : _sessions) {
+                if (!session->hasUdpEndpoint()) {
+                    continue;
+                }
+                _reliableOut.clear();
+                session->getReliableChannel().flush(now, _reliableOut);
+                for (const auto &datagram : _reliableOut) {
+                    sendToSession(*session, datagram, net::NetworkMode::UDP);
+                }
+            }
+            _reliableOut.clear();
+        }
+
+#if defined(RTYPE_HAS_UDP_MMSG)
+        for (auto &shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->senderMutex);
+            if (shard->sender.pending() == 0) {
+                continue;
+            }
+            const size_t queued = shard->sender.pending();
+            asio::error_code ec;
+            const size_t sent = shard->sender.flush(shard->socket, ec);
+            if (ec) {
+                log::warning("UDP flush (shard {}): sent {}/{} datagrams, dropped the rest: {}",
+                             shard->index, sent, queued, ec.message());
+            }
+        }
+#endif
+    }
+
+    void ServerNetwork::flushTcp(void)
+    {
+        std::lock_guard<std::mutex> lock(_sessionsMutex);
+        for (auto &[id, session] : _sessions) {
+            session->flush();
+        }
+    }
+
+    void ServerNetwork::setTcpFlushPolicy(net::TcpFlushPolicy policy)
+    {
+        std::lock_guard<std::mutex> lock(_sessionsMutex);
+        _tcpFlushPolicy = policy;
+        for (auto &[id, session] : _sessions) {
+            session->setFlushPolicy(policy);
+        }
+    }
+
+    net::Session::WriteStats ServerNetwork::getTcpWriteStats(void)
+    {
+        net::Session::WriteStats total;
+        std::lock_guard<std::mutex> lock(_sessionsMutex);
+        for (auto &[id, session] : _sessions) {
+            const auto stats = session->getWriteStats();
+            total.writes += stats.writes;
+            total.packets += stats.packets;
+            total.bytes += stats.bytes;
+        }
+        return total;
+    }
+
+    NetworkStats ServerNetwork::getNetworkStats(void)
+    {
+        NetworkStats stats;
+        stats.traffic = _traffic.snapshot();
+        stats.udpSizeMismatch = _udpSizeMismatch.load(std::memory_order_relaxed);
+        stats.udpUnbound = _udpUnbound.load(std::memory_order_relaxed);
+        stats.droppedEvents = _droppedEvents.load(std::memory_order_relaxed);
+
+        std::lock_guard<std::mutex> lock(_sessionsMutex);
+        stats.sessions.reserve(_sessions.size());
+        for (auto &[id, session] : _sessions) {
+            const auto writes = session->getWriteStats();
+            stats.tcpWrites.writes += writes.writes;
+            stats.tcpWrites.packets += writes.packets;
+            stats.tcpWrites.bytes += writes.bytes;
+            stats.sessions.push_back({id, session->getLinkStats()});
         }
+        return stats;
+    }
+
+    void ServerNetwork::setStatsInterval(std::chrono::seconds interval)
+    {
+        _statsInterval.store(static_cast<uint32_t>(std::max<int64_t>(interval.count(), 0)),
+                             std::memory_order_relaxed);
+    }
+
+    size_t ServerNetwork::getShardCount(void) const
+    {
+        return _shards.size();
     }
 
     std::optional<net::NetworkEvent> ServerNetwork::pollEvent()
     {
-        std::lock_guard<std::mutex> lock(_eventQueueMutex);
-        if (_eventQueue.empty()) {
+        net::NetworkEvent event;
+        if (pollEvents(std::span(&event, 1)) == 0)
             return std::nullopt;
-        }
-        auto event = _eventQueue.front();
-        _eventQueue.pop();
         return event;
     }
 
+    size_t ServerNetwork::pollEvents(std::span<net::NetworkEvent> out)
+    {
+        size_t count = _eventQueue.popBatch(out);
+        if (count == out.size() || !_overflowing.load(std::memory_order_acquire))
+            return count;
+
+        std::lock_guard<std::mutex> lock(_overflowMutex);
+        while (count < out.size() && !_overflowEvents.empty()) {
+            out[count++] = std::move(_overflowEvents.front());
+            _overflowEvents.pop_front();
+        }
+        if (_overflowEvents.empty())
+            _overflowing.store(false, std::memory_order_release);
+        return count;
+    }
+
     void ServerNetwork::publishEvent(net::NetworkEvent event)
     {
-        std::lock_guard<std::mutex> lock(_eventQueueMutex);
-        _eventQueue.push(event);
+        const uint32_t sessionId = event.sessionId;
+        const bool droppable = event.packet.header.opCode == net::OpCode::InputTick;
+
+        // Behind the overflow, a control event would overtake the ones queued there
+        if ((droppable || !_overflowing.load(std::memory_order_acquire))
+            && _eventQueue.tryPush(std::move(event))) {
+            return;
+        }
+        if (!droppable) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowEvents.push_back(std::move(event));
+            _overflowing.store(true, std::memory_order_release);
+            return;
+        }
+        const uint64_t dropped = ++_droppedEvents;
+        if ((dropped & (dropped - 1)) == 0) {
+            log::warning("Event queue full, dropped input from session {} ({} total)",
+                         sessionId, dropped);
+        }
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -99,24 +286,28 @@ namespace rtp::server {
 
     void ServerNetwork::acceptConnection()
     {
-        auto newSocket = std::make_shared<asio::ip::tcp::socket>(_ioContext);
+        UdpShard &shard = *_shards[_nextShard++ % _shards.size()];
 
-        _acceptor.async_accept(*newSocket, [this, newSocket](const asio::error_code& error) {
+        _acceptor.async_accept(shard.ioContext,
+            [this, &shard](const asio::error_code& error, asio::ip::tcp::socket newSocket) {
             if (!error) {
                 uint32_t id = _nextSessionId++;
-                log::info("New connection accepted from {}. Session ID: {}", 
-                    newSocket->remote_endpoint().address().to_string(), id);
+                log::info("New connection accepted from {}. Session ID: {} (shard {})", 
+                    newSocket.remote_endpoint().address().to_string(), id, shard.index);
 
                 auto session = std::make_shared<net::Session>(
                     id, 
-                    std::move(*newSocket), 
-                    _udpSocket, 
+                    std::move(newSocket), 
+                    shard.socket, 
                     *this
                 );
 
                 {
                     std::lock_guard<std::mutex> lock(_sessionsMutex);
+                    session->setFlushPolicy(_tcpFlushPolicy);
+                    session->setTrafficCounters(&_traffic);
                     _sessions[id] = session;
+                    _sessionShard[id] = shard.index;
                 }
 
                 session->start();
@@ -124,6 +315,7 @@ namespace rtp::server {
                 net::Packet welcome(net::OpCode::Welcome);
                 welcome << id;
                 session->send(welcome, net::NetworkMode::TCP);
+                session->flush();
 
             } else {
                 log::error("Accept error: {}", error.message());
@@ -133,99 +325,321 @@ namespace rtp::server {
         });
     }
 
-    void ServerNetwork::receiveUdpPacket()
-{
-    _udpSocket.async_receive_from(
-        asio::buffer(_udpBuffer),
-        _udpRemoteEndpoint,
-        [this](const asio::error_code& error, std::size_t bytesTransferred)
-        {
-            if (error) {
-                if (error != asio::error::operation_aborted)
-                    log::error("UDP receive error: {}", error.message());
-                receiveUdpPacket();
-                return;
+    void ServerNetwork::sendToSession(net::Session &session, const net::Packet &packet,
+                                      net::NetworkMode mode)
+    {
+#if defined(RTYPE_HAS_UDP_MMSG)
+        if (mode == net::NetworkMode::UDP) {
+            if (session.hasUdpEndpoint()) {
+                UdpShard &shard = shardOf(session.getId());
+                _traffic.record(net::TrafficDirection::Outbound, mode, packet.header.opCode,
+                                sizeof(net::Header) + packet.body.size());
+                std::lock_guard<std::mutex> lock(shard.senderMutex);
+                shard.sender.push(session.getUdpEndpoint(), packet);
             }
+            return;
+        }
+#endif
+        session.send(packet, mode);
+    }
 
-            if (bytesTransferred < sizeof(net::Header)) {
-                receiveUdpPacket();
-                return;
-            }
+    ServerNetwork::UdpShard &ServerNetwork::shardOf(uint32_t sessionId)
+    {
+        auto it = _sessionShard.find(sessionId);
+        if (it == _sessionShard.end()) {
+            return *_shards.front();
+        }
+        return *_shards[it->second];
+    }
 
-            net::Header header;
-            std::memcpy(&header, _udpBuffer.data(), sizeof(header));
+#if defined(RTYPE_HAS_UDP_MMSG)
+    void ServerNetwork::receiveUdpPacket(UdpShard &shard)
+    {
+        shard.socket.async_wait(asio::ip::udp::socket::wait_read,
+            [this, &shard](const asio::error_code& error)
+            {
+                if (error) {
+                    if (error == asio::error::operation_aborted)
+                        return;
+                    log::error("UDP wait error: {}", error.message());
+                    receiveUdpPacket(shard);
+                    return;
+                }
 
-            header.magic      = net::Packet::from_network(header.magic);
-            header.sequenceId = net::Packet::from_network(header.sequenceId);
-            header.bodySize   = net::Packet::from_network(header.bodySize);
-            header.ackId      = net::Packet::from_network(header.ackId);
-            header.sessionId  = net::Packet::from_network(header.sessionId);
+                asio::error_code ec;
+                size_t count = 0;
+                do {
+                    count = shard.receiver.receive(shard.socket, ec);
+                    for (size_t i = 0; i < count; ++i) {
+                        handleUdpDatagram(shard, shard.receiver.data(i),
+                                          shard.receiver.endpoint(i));
+                    }
+                } while (count == net::UDP_BATCH_SIZE);
 
-            if (header.magic != net::MAGIC_NUMBER) {
-                receiveUdpPacket();
-                return;
+                if (ec && ec != asio::error::would_block && ec != asio::error::try_again) {
+                    log::error("UDP receive error: {}", ec.message());
+                }
+                receiveUdpPacket(shard);
             }
+        );
+    }
+#else
+    void ServerNetwork::receiveUdpPacket(UdpShard &shard)
+    {
+        shard.socket.async_receive_from(
+            asio::buffer(shard.buffer),
+            shard.remoteEndpoint,
+            [this, &shard](const asio::error_code& error, std::size_t bytesTransferred)
+            {
+                if (error) {
+                    if (error == asio::error::operation_aborted)
+                        return;
+                    log::error("UDP receive error: {}", error.message());
+                    receiveUdpPacket(shard);
+                    return;
+                }
 
-            if (bytesTransferred != sizeof(net::Header) + header.bodySize) {
-                log::error("Malformed UDP packet (size mismatch) bytes={} expected={}",
-                                bytesTransferred, sizeof(net::Header) + header.bodySize);
-                receiveUdpPacket();
-                return;
+                handleUdpDatagram(shard,
+                    {reinterpret_cast<const uint8_t *>(shard.buffer.data()), bytesTransferred},
+                    shard.remoteEndpoint);
+                receiveUdpPacket(shard);
             }
+        );
+    }
+#endif
+
+    void ServerNetwork::handleUdpDatagram(UdpShard &shard, std::span<const uint8_t> data,
+                                          const asio::ip::udp::endpoint &from)
+    {
+        if (data.size() < sizeof(net::Header)) {
+            return;
+        }
+
+        net::Header header;
+        std::memcpy(&header, data.data(), sizeof(header));
 
-            if (header.opCode == net::OpCode::Hello) {
-                uint32_t claimedSessionId = header.sessionId;
+        header.magic      = net::Packet::from_network(header.magic);
+        header.sequenceId = net::Packet::from_network(header.sequenceId);
+        header.bodySize   = net::Packet::from_network(header.bodySize);
+        header.ackId      = net::Packet::from_network(header.ackId);
+        header.sessionId  = net::Packet::from_network(header.sessionId);
+
+        if (header.magic != net::MAGIC_NUMBER) {
+            return;
+        }
+
+        if (data.size() != sizeof(net::Header) + header.bodySize) {
+            const uint64_t mismatches = ++_udpSizeMismatch;
+            if ((mismatches & (mismatches - 1)) == 0) {
+                log::error("Malformed UDP packet (size mismatch) bytes={} expected={} ({} total)",
+                           data.size(), sizeof(net::Header) + header.bodySize, mismatches);
+            }
+            return;
+        }
+        _traffic.record(net::TrafficDirection::Inbound, net::NetworkMode::UDP,
+                        header.opCode, data.size());
+
+        if (header.opCode == net::OpCode::Hello) {
+            uint32_t claimedSessionId = header.sessionId;
+
+            std::lock_guard<std::mutex> lock(_sessionsMutex);
+            auto it = _sessions.find(claimedSessionId);
+            if (it != _sessions.end()) {
+                it->second->setUdpEndpoint(from, shard.socket);
+                _sessionShard[claimedSessionId] = shard.index;
 
                 {
-                    std::lock_guard<std::mutex> lock(_sessionsMutex);
-                    auto it = _sessions.find(claimedSessionId);
-                    if (it != _sessions.end()) {
-                        it->second->setUdpEndpoint(_udpRemoteEndpoint);
-
-                        {
-                            std::lock_guard<std::mutex> udpLock(_udpMapMutex);
-                            _udpEndpointToSessionId[_udpRemoteEndpoint] = claimedSessionId;
-                        }
-
-                        log::info("UDP bound: session {} -> {}:{}",
-                                       claimedSessionId,
-                                       _udpRemoteEndpoint.address().to_string(),
-                                       _udpRemoteEndpoint.port());
-                    }
+                    std::lock_guard<std::mutex> udpLock(_udpMapMutex);
+                    _udpEndpointToSessionId[from] = claimedSessionId;
                 }
 
-                receiveUdpPacket();
+                log::info("UDP bound: session {} -> {}:{} (shard {})",
+                               claimedSessionId,
+                               from.address().to_string(),
+                               from.port(),
+                               shard.index);
+            }
+            return;
+        }
+
+        uint32_t realSessionId = 0;
+        {
+            std::lock_guard<std::mutex> lock(_udpMapMutex);
+            auto it = _udpEndpointToSessionId.find(from);
+            if (it == _udpEndpointToSessionId.end()) {
+                _udpUnbound.fetch_add(1, std::memory_order_relaxed);
                 return;
             }
+            realSessionId = it->second;
+        }
+
+        net::Packet packet;
+        header.sessionId = realSessionId;
+        packet.header = header;
+
+        if (header.bodySize > 0) {
+            packet.body.assign(data.begin() + sizeof(net::Header), data.end());
+        }
+
+        if (header.opCode == net::OpCode::Pong) {
+            handlePong(realSessionId, packet);
+            return;
+        }
 
-            uint32_t realSessionId = 0;
+        if (header.opCode == net::OpCode::Reliable) {
+            std::shared_ptr<net::Session> session;
             {
-                std::lock_guard<std::mutex> lock(_udpMapMutex);
-                auto it = _udpEndpointToSessionId.find(_udpRemoteEndpoint);
-                if (it == _udpEndpointToSessionId.end()) {
-                    receiveUdpPacket();
+                std::lock_guard<std::mutex> lock(_sessionsMutex);
+                auto it = _sessions.find(realSessionId);
+                if (it == _sessions.end()) {
                     return;
                 }
-                realSessionId = it->second;
+                session = it->second;
             }
+            shard.reliableDelivered.clear();
+            if (!session->getReliableChannel().receive(packet,
+                    net::ReliableChannel::Clock::now(), shard.reliableDelivered)) {
+                log::error("Malformed reliable datagram from session {}", realSessionId);
+                return;
+            }
+            for (auto &message : shard.reliableDelivered) {
+                message.header.sessionId = realSessionId;
+                publishEvent({ realSessionId, std::move(message) });
+            }
+            return;
+        }
+
+        publishEvent({ realSessionId, std::move(packet) });
+    }
 
-            net::Packet packet;
-            header.sessionId = realSessionId;
-            packet.header = header;
+    void ServerNetwork::scheduleStatsTimer(void)
+    {
+        _statsTimer.expires_after(RTT_PROBE_INTERVAL);
+        _statsTimer.async_wait([this](const asio::error_code &error) {
+            if (error) {
+                return;
+            }
+            sendRttProbes();
 
-            if (header.bodySize > 0) {
-                packet.body.resize(header.bodySize);
-                std::memcpy(packet.body.data(),
-                            _udpBuffer.data() + sizeof(net::Header),
-                            header.bodySize);
+            const uint32_t interval = _statsInterval.load(std::memory_order_relaxed);
+            if (interval > 0 && ++_statsElapsed >= interval) {
+                logNetworkStats();
+                _statsElapsed = 0;
             }
+            scheduleStatsTimer();
+        });
+    }
+
+    void ServerNetwork::sendRttProbes(void)
+    {
+        const auto now = std::chrono::steady_clock::now().time_since_epoch();
+        net::Packet probe(net::OpCode::Ping);
+        probe << net::PingPayload{static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::microseconds>(now).count())};
+
+        std::lock_guard<std::mutex> lock(_sessionsMutex);
+        for (auto &[id, session] : _sessions) {
+            if (!session->hasUdpEndpoint()) {
+                continue;
+            }
+#if defined(RTYPE_HAS_UDP_MMSG)
+            // Waiting for the tick flush would add up to a tick to the sample
+            UdpShard &shard = shardOf(id);
+            _traffic.record(net::TrafficDirection::Outbound, net::NetworkMode::UDP,
+                            probe.header.opCode, sizeof(net::Header) + probe.body.size());
+            asio::error_code ec;
+            std::lock_guard<std::mutex> sendLock(shard.senderMutex);
+            shard.socket.send_to(probe.getBufferSequence(), session->getUdpEndpoint(), 0, ec);
+#else
+            session->send(probe, net::NetworkMode::UDP);
+#endif
+        }
+    }
 
-            publishEvent({ realSessionId, packet });
+    void ServerNetwork::handlePong(uint32_t sessionId, net::Packet &packet)
+    {
+        net::PingPayload payload{};
+        try {
+            packet >> payload;
+        } catch (const std::exception &) {
+            return;
+        }
+        const auto now = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now().time_since_epoch());
+        const auto sent = std::chrono::microseconds(payload.clientTimeMs);
+        if (sent > now) {
+            return;
+        }
 
-            receiveUdpPacket();
+        std::lock_guard<std::mutex> lock(_sessionsMutex);
+        auto it = _sessions.find(sessionId);
+        if (it != _sessions.end()) {
+            it->second->recordRtt(now - sent);
         }
-    );
-}
+    }
+
+    void ServerNetwork::logNetworkStats(void)
+    {
+        using net::NetworkMode;
+        using net::TrafficDirection;
+
+        const NetworkStats stats = getNetworkStats();
+        const double seconds = static_cast<double>(std::max<uint32_t>(_statsElapsed, 1));
 
+        net::TrafficSnapshot delta;
+        for (size_t i = 0; i < delta.cells.size(); ++i) {
+            delta.cells[i].packets = stats.traffic.cells[i].packets - _lastTraffic.cells[i].packets;
+            delta.cells[i].bytes = stats.traffic.cells[i].bytes - _lastTraffic.cells[i].bytes;
+        }
+        _lastTraffic = stats.traffic;
+
+        for (const auto direction : {TrafficDirection::Inbound, TrafficDirection::Outbound}) {
+            const auto tcp = delta.total(direction, NetworkMode::TCP);
+            const auto udp = delta.total(direction, NetworkMode::UDP);
+            log::info("Network {}: tcp {:.0f} pkt/s {:.1f} KB/s, udp {:.0f} pkt/s {:.1f} KB/s",
+                      direction == TrafficDirection::Inbound ? "in " : "out",
+                      tcp.packets / seconds, tcp.bytes / seconds / 1024.0,
+                      udp.packets / seconds, udp.bytes / seconds / 1024.0);
+
+            const size_t first = net::TrafficSnapshot::index(direction, NetworkMode::TCP, net::OpCode::None);
+            std::vector<size_t> top;
+            for (size_t i = first; i < first + 2 * net::TrafficSnapshot::OPCODES; ++i) {
+                if (delta.cells[i].bytes > 0) {
+                    top.push_back(i);
+                }
+            }
+            const size_t shown = std::min<size_t>(top.size(), TOP_OPCODES);
+            std::partial_sort(top.begin(), top.begin() + shown, top.end(), [&delta](size_t a, size_t b) {
+                return delta.cells[a].bytes > delta.cells[b].bytes;
+            });
+            for (const size_t i : std::span(top).first(shown)) {
+                const auto opCode = static_cast<net::OpCode>(i % net::TrafficSnapshot::OPCODES);
+                const bool tcp = (i / net::TrafficSnapshot::OPCODES) % 2 == 0;
+                log::info("Network {}:   {:<16} {} {:.0f} pkt/s {:.1f} KB/s",
+                          direction == TrafficDirection::Inbound ? "in " : "out",
+                          net::toString(opCode), tcp ? "tcp" : "udp",
+                          delta.cells[i].packets / seconds, delta.cells[i].bytes / seconds / 1024.0);
+            }
+        }
+
+        std::vector<uint32_t> rtts;
+        size_t queueDepth = 0;
+        size_t queuePeak = 0;
+        for (const auto &entry : stats.sessions) {
+            if (entry.link.rttUs > 0) {
+                rtts.push_back(entry.link.rttUs);
+            }
+            queueDepth = std::max(queueDepth, entry.link.writeQueueDepth);
+            queuePeak = std::max(queuePeak, entry.link.writeQueuePeak);
+        }
+        std::ranges::sort(rtts);
+        log::info("Network sessions: {} (rtt p50 {:.1f} ms, max {:.1f} ms), tcp queue max {} peak {}; "
+                  "drops: udp size {} unbound {}, events {}",
+                  stats.sessions.size(),
+                  rtts.empty() ? 0.0 : rtts[rtts.size() / 2] / 1000.0,
+                  rtts.empty() ? 0.0 : rtts.back() / 1000.0,
+                  queueDepth, queuePeak,
+                  stats.udpSizeMismatch, stats.udpUnbound, stats.droppedEvents);
+    }
 
 } // namespace rtp::server
\ No newline at end of file
@@ -0,0 +1,178 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** AabbBatch
+*/
+
+#include "Systems/AabbBatch.hpp"
+
+#if defined(__SSE2__) || defined(_M_X64)
+    #define RTYPE_AABB_SSE2 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER) && !defined(__clang__)
+        #include <intrin.h>
+        #define RTYPE_AABB_AVX2_TARGET
+    #else
+        #define RTYPE_AABB_AVX2_TARGET __attribute__((target("avx2")))
+    #endif
+#endif
+
+namespace rtp::server
+{
+    namespace {
+        /**
+         * @brief Overlap bits of boxes [begin, count), written into zeroed words
+         */
+        void scalarKernel(const Aabb &q, const float *minX, const float *minY,
+                          const float *maxX, const float *maxY,
+                          size_t begin, size_t count, uint64_t *words)
+        {
+            for (size_t i = begin; i < count; ++i) {
+                const bool hit = q.minX < maxX[i] && q.maxX > minX[i]
+                              && q.minY < maxY[i] && q.maxY > minY[i];
+                words[i / 64] |= static_cast<uint64_t>(hit) << (i % 64);
+            }
+        }
+
+#if defined(RTYPE_AABB_SSE2)
+        void sse2Kernel(const Aabb &q, const float *minX, const float *minY,
+                        const float *maxX, const float *maxY,
+                        size_t count, uint64_t *words)
+        {
+            const __m128 qMinX = _mm_set1_ps(q.minX);
+            const __m128 qMinY = _mm_set1_ps(q.minY);
+            const __m128 qMaxX = _mm_set1_ps(q.maxX);
+            const __m128 qMaxY = _mm_set1_ps(q.maxY);
+
+            size_t i = 0;
+            for (; i + 4 <= count; i += 4) {
+                __m128 hit = _mm_cmplt_ps(qMinX, _mm_loadu_ps(maxX + i));
+                hit = _mm_and_ps(hit, _mm_cmpgt_ps(qMaxX, _mm_loadu_ps(minX + i)));
+                hit = _mm_and_ps(hit, _mm_cmplt_ps(qMinY, _mm_loadu_ps(maxY + i)));
+                hit = _mm_and_ps(hit, _mm_cmpgt_ps(qMaxY, _mm_loadu_ps(minY + i)));
+                // 4 divides 64, a group never straddles two words
+                words[i / 64] |= static_cast<uint64_t>(_mm_movemask_ps(hit)) << (i % 64);
+            }
+            scalarKernel(q, minX, minY, maxX, maxY, i, count, words);
+        }
+
+        RTYPE_AABB_AVX2_TARGET
+        void avx2Kernel(const Aabb &q, const float *minX, const float *minY,
+                        const float *maxX, const float *maxY,
+                        size_t count, uint64_t *words)
+        {
+            const __m256 qMinX = _mm256_set1_ps(q.minX);
+            const __m256 qMinY = _mm256_set1_ps(q.minY);
+            const __m256 qMaxX = _mm256_set1_ps(q.maxX);
+            const __m256 qMaxY = _mm256_set1_ps(q.maxY);
+
+            size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                __m256 hit = _mm256_cmp_ps(qMinX, _mm256_loadu_ps(maxX + i), _CMP_LT_OQ);
+                hit = _mm256_and_ps(hit, _mm256_cmp_ps(qMaxX, _mm256_loadu_ps(minX + i), _CMP_GT_OQ));
+                hit = _mm256_and_ps(hit, _mm256_cmp_ps(qMinY, _mm256_loadu_ps(maxY + i), _CMP_LT_OQ));
+                hit = _mm256_and_ps(hit, _mm256_cmp_ps(qMaxY, _mm256_loadu_ps(minY + i), _CMP_GT_OQ));
+                words[i / 64] |= static_cast<uint64_t>(_mm256_movemask_ps(hit)) << (i % 64);
+            }
+            scalarKernel(q, minX, minY, maxX, maxY, i, count, words);
+        }
+
+        bool cpuHasAvx2(void)
+        {
+    #if defined(_MSC_VER) && !defined(__clang__)
+            int info[4] = {};
+            __cpuid(info, 0);
+            if (info[0] < 7)
+                return false;
+            __cpuid(info, 1);
+            const bool osSavesYmm = (info[2] & (1 << 27)) != 0
+                                 && (_xgetbv(0) & 0x6) == 0x6;
+            __cpuidex(info, 7, 0);
+            return osSavesYmm && (info[1] & (1 << 5)) != 0;
+    #else
+            return __builtin_cpu_supports("avx2");
+    #endif
+        }
+#endif
+    } // namespace
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    void AabbBatch::clear(void)
+    {
+        _minX.clear();
+        _minY.clear();
+        _maxX.clear();
+        _maxY.clear();
+    }
+
+    void AabbBatch::push(const Aabb &box)
+    {
+        _minX.push_back(box.minX);
+        _minY.push_back(box.minY);
+        _maxX.push_back(box.maxX);
+        _maxY.push_back(box.maxY);
+    }
+
+    Aabb AabbBatch::get(size_t i) const
+    {
+        return Aabb{_minX[i], _minY[i], _maxX[i], _maxY[i]};
+    }
+
+    size_t AabbBatch::size(void) const
+    {
+        return _minX.size();
+    }
+
+    void AabbBatch::overlapMask(const Aabb &query, std::vector<uint64_t> &mask) const
+    {
+        static const SimdLevel level = detectSimdLevel();
+        overlapMask(query, mask, level);
+    }
+
+    void AabbBatch::overlapMask(const Aabb &query, std::vector<uint64_t> &mask, SimdLevel level) const
+    {
+        const size_t count = size();
+        mask.assign((count + 63) / 64, 0);
+        if (count == 0)
+            return;
+
+        if (level == SimdLevel::AVX2 && detectSimdLevel() != SimdLevel::AVX2)
+            level = SimdLevel::SSE2;
+        switch (level) {
+#if defined(RTYPE_AABB_SSE2)
+            case SimdLevel::AVX2:
+                avx2Kernel(query, _minX.data(), _minY.data(), _maxX.data(), _maxY.data(), count, mask.data());
+                return;
+            case SimdLevel::SSE2:
+                sse2Kernel(query, _minX.data(), _minY.data(), _maxX.data(), _maxY.data(), count, mask.data());
+                return;
+#endif
+            default:
+                scalarKernel(query, _minX.data(), _minY.data(), _maxX.data(), _maxY.data(), 0, count, mask.data());
+                return;
+        }
+    }
+
+    SimdLevel detectSimdLevel(void)
+    {
+#if defined(RTYPE_AABB_SSE2)
+        static const SimdLevel level = cpuHasAvx2() ? SimdLevel::AVX2 : SimdLevel::SSE2;
+        return level;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    const char *toString(SimdLevel level)
+    {
+        switch (level) {
+            case SimdLevel::AVX2: return "avx2";
+            case SimdLevel::SSE2: return "sse2";
+            default: return "scalar";
+        }
+    }
+}
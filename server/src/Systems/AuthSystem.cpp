@@ -24,7 +24,7 @@ namespace rtp::server {
 
     std::tuple<bool, std::string, uint8_t> AuthSystem::handleLoginRequest(uint32_t sessionId, const net::Packet& packet)
     {
-        std::ifstream inFile("logins.txt");
+        std::ifstream inFile(_accountsPath);
 
         std::string username;
         std::string password;
@@ -40,7 +40,7 @@ namespace rtp::server {
                        sessionId, username, password);
 
         if (!inFile) {
-            log::error("Failed to open logins.txt for reading");
+            log::error("Failed to open {} for reading", _accountsPath);
             sendLoginResponse(sessionId, false, username);
             return {false, username, weaponKind};
         }
@@ -62,7 +62,7 @@ namespace rtp::server {
 
     std::pair<bool, std::string> AuthSystem::handleRegisterRequest(uint32_t sessionId, const net::Packet& packet)
     {
-        std::ofstream outFile("logins.txt", std::ios::app);
+        std::ofstream outFile(_accountsPath, std::ios::app);
 
         std::string username;
         std::string password;
@@ -77,7 +77,7 @@ namespace rtp::server {
                        username, password);
 
         if (!outFile) {
-            log::error("Failed to open logins.txt for writing");
+            log::error("Failed to open {} for writing", _accountsPath);
             sendRegisterResponse(sessionId, false, username);
             return {false, username};
         }
@@ -88,7 +88,7 @@ namespace rtp::server {
             return {false, username};
         }
 
-        std::ifstream inFile("logins.txt");
+        std::ifstream inFile(_accountsPath);
         std::string line;
         while (std::getline(inFile, line)) {
             size_t delimPos = line.find(':');
@@ -130,4 +130,14 @@ namespace rtp::server {
         _network.sendPacket(sessionId, responsePacket, net::NetworkMode::TCP);
     }
 
+    void AuthSystem::setAccountsPath(std::string path)
+    {
+        _accountsPath = std::move(path);
+    }
+
+    const std::string &AuthSystem::getAccountsPath(void) const
+    {
+        return _accountsPath;
+    }
+
 } // namespace rtp::server
\ No newline at end of file
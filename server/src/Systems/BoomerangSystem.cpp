@@ -8,8 +8,9 @@
 
 namespace rtp::server
 {
-    BoomerangSystem::BoomerangSystem(ecs::Registry &registry)
+    BoomerangSystem::BoomerangSystem(ecs::Registry &registry, EntityIndex &entityIndex)
         : _registry(registry)
+        , _entityIndex(entityIndex)
     {}
 
     void BoomerangSystem::update(float dt)
@@ -64,6 +65,7 @@ namespace rtp::server
                 if (!ownerFound) {
                     // Owner no longer exists: remove projectile
                     log::info("Boomerang {} owner not found (ownerIndex={}), despawning", e.index(), b.ownerIndex);
+                    _entityIndex.untrack(e);
                     _registry.kill(e);
                     continue;
                 }
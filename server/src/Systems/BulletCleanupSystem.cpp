@@ -7,12 +7,16 @@
 
 #include "Systems/BulletCleanupSystem.hpp"
 
+#include <cmath>
+#include <limits>
+
 namespace rtp::server
 {
     BulletCleanupSystem::BulletCleanupSystem(ecs::Registry& registry,
+                                             ProjectilePool& projectilePool,
                                              RoomSystem& roomSystem,
                                              NetworkSyncSystem& networkSync)
-        : _registry(registry), _roomSystem(roomSystem), _networkSync(networkSync)
+        : _registry(registry), _projectilePool(projectilePool), _roomSystem(roomSystem), _networkSync(networkSync)
     {
     }
 
@@ -38,28 +42,17 @@ namespace rtp::server
 
         auto room = _roomSystem.getRoom(roomId);
         if (!room) {
-            _registry.kill(entity);
-            return;
-        }
-
-        const auto players = room->getPlayers();
-        if (players.empty()) {
-            _registry.kill(entity);
+            _projectilePool.release(entity);
             return;
         }
 
-        net::Packet packet(net::OpCode::EntityDeath);
         net::EntityDeathPayload payload{};
         payload.netId = net.id;
         payload.type = static_cast<uint8_t>(type.type);
         payload.position = transform.position;
-        packet << payload;
+        room->queueEntityDeath(payload);
 
-        for (const auto& player : players) {
-            _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::TCP);
-        }
-
-        _registry.kill(entity);
+        _projectilePool.release(entity);
     }
 
     void BulletCleanupSystem::update(float dt)
@@ -78,6 +71,8 @@ namespace rtp::server
         auto &rooms = roomsRes->get();
 
         std::vector<std::pair<ecs::Entity, uint32_t>> pending;
+        _tracked.clear();
+        _positions.clear();
 
         for (auto entity : types.entities()) {
             if (!types.has(entity)) {
@@ -103,8 +98,18 @@ namespace rtp::server
             }
 
             const auto &tf = transforms[entity];
-            if (tf.position.x < _minX || tf.position.x > _maxX) {
-                pending.emplace_back(entity, rooms[entity].id);
+            _tracked.push_back(entity);
+            _positions.push(Aabb{tf.position.x, tf.position.y, tf.position.x, tf.position.y});
+        }
+
+        // Positions are points: strict overlap with a band widened by one
+        // ulp keeps them iff _minX <= x <= _maxX
+        constexpr float inf = std::numeric_limits<float>::infinity();
+        const Aabb playArea{std::nextafter(_minX, -inf), -inf, std::nextafter(_maxX, inf), inf};
+        _positions.overlapMask(playArea, _inside);
+        for (size_t i = 0; i < _tracked.size(); ++i) {
+            if (!AabbBatch::isSet(_inside, i)) {
+                pending.emplace_back(_tracked[i], rooms[_tracked[i]].id);
             }
         }
 
@@ -42,11 +42,17 @@ namespace rtp::server
     // Public API
     //////////////////////////////////////////////////////////////////////////
     CollisionSystem::CollisionSystem(ecs::Registry &registry,
+                                     EntityIndex &entityIndex,
+                                     ProjectilePool &projectilePool,
                                      RoomSystem &roomSystem,
-                                     NetworkSyncSystem &networkSync)
+                                     NetworkSyncSystem &networkSync,
+                                     std::mt19937 &rng)
         : _registry(registry)
+        , _entityIndex(entityIndex)
+        , _projectilePool(projectilePool)
         , _roomSystem(roomSystem)
         , _networkSync(networkSync)
+        , _rng(rng)
     {
     }
 
@@ -115,21 +121,15 @@ namespace rtp::server
             if (!room) {
                 return;
             }
-            const auto playersInRoom = room->getPlayers();
-            for (const auto &player : playersInRoom) {
-                if (!player) {
-                    continue;
-                }
-                if (player->getEntityId() != static_cast<uint32_t>(playerEntity.index())) {
-                    continue;
-                }
-                player->addScore(delta);
-                net::Packet packet(net::OpCode::ScoreUpdate);
-                net::ScoreUpdatePayload payload{player->getScore()};
-                packet << payload;
-                _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::TCP);
-                break;
+            const auto player = room->getPlayerByEntity(ecs::components::NetworkId::of(playerEntity));
+            if (!player) {
+                return;
             }
+            player->addScore(delta);
+            net::Packet packet(net::OpCode::ScoreUpdate);
+            net::ScoreUpdatePayload payload{player->getScore()};
+            packet << payload;
+            _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::ReliableUDP);
         };
 
         auto sendPlayerHealth = [&](uint32_t roomId, ecs::Entity playerEntity, const ecs::components::Health &health) {
@@ -137,20 +137,14 @@ namespace rtp::server
             if (!room) {
                 return;
             }
-            const auto playersInRoom = room->getPlayers();
-            for (const auto &player : playersInRoom) {
-                if (!player) {
-                    continue;
-                }
-                if (player->getEntityId() != static_cast<uint32_t>(playerEntity.index())) {
-                    continue;
-                }
-                net::Packet packet(net::OpCode::HealthUpdate);
-                net::HealthUpdatePayload payload{health.currentHealth, health.maxHealth};
-                packet << payload;
-                _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::TCP);
-                break;
+            const auto player = room->getPlayerByEntity(ecs::components::NetworkId::of(playerEntity));
+            if (!player) {
+                return;
             }
+            net::Packet packet(net::OpCode::HealthUpdate);
+            net::HealthUpdatePayload payload{health.currentHealth, health.maxHealth};
+            packet << payload;
+            _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::ReliableUDP);
         };
 
         auto sendGameOverIfNeeded = [&](const std::shared_ptr<Room> &room) {
@@ -198,75 +192,97 @@ namespace rtp::server
                 payload.bestScore = bestScore;
                 payload.playerScore = player->getScore();
                 packet << payload;
-                _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::TCP);
+                _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::ReliableUDP);
             }
         };
 
-        for (auto entity : types.entities()) {
-            if (!types.has(entity)) {
-                continue;
+        // Every entity of the registry belongs to this room, the index already grouped them
+        for (auto entity : _entityIndex.get(EntityCategory::Player)) {
+            if (transforms.has(entity) &&
+                boxes.has(entity) &&
+                rooms.has(entity) &&
+                healths.has(entity) &&
+                speeds.has(entity)) {
+                players.push_back(entity);
             }
-            const auto type = types[entity].type;
-            if (type == net::EntityType::Player) {
-                if (transforms.has(entity) &&
-                    boxes.has(entity) &&
-                    rooms.has(entity) &&
-                    healths.has(entity) &&
-                    speeds.has(entity)) {
-                    players.push_back(entity);
-                }
-            } else if ((type == net::EntityType::Enemy1 ||
-                        type == net::EntityType::Enemy2 ||
-                        type == net::EntityType::Enemy3 ||
-                        type == net::EntityType::Enemy4 ||
-                        type == net::EntityType::Tank ||
-                        type == net::EntityType::Boss ||
-                        type == net::EntityType::Boss2 ||
-                        type == net::EntityType::BossShield)) {
-                if (transforms.has(entity) &&
-                    boxes.has(entity) &&
-                    rooms.has(entity) &&
-                    healths.has(entity)) {
-                    enemies.push_back(entity);
-                }
-            } else if (type ==
-                       net::EntityType::Obstacle ||
-                       type == net::EntityType::ObstacleSolid) {
-                if (transforms.has(entity) &&
-                    boxes.has(entity) &&
-                    rooms.has(entity) &&
-                    healths.has(entity)) {
-                    obstacles.push_back(entity);
-                }
-            } else if (type ==
-                       net::EntityType::Bullet ||
-                       type == net::EntityType::ChargedBullet) {
-                if (transforms.has(entity) &&
-                    boxes.has(entity) &&
-                    rooms.has(entity) &&
-                    damages.has(entity)) {
-                    bullets.push_back(entity);
-                }
-            } else if (type == net::EntityType::EnemyBullet) {
-                if (transforms.has(entity) &&
-                    boxes.has(entity) &&
-                    rooms.has(entity) &&
-                    damages.has(entity)) {
-                    enemyBullets.push_back(entity);
-                }
-            } else if (type ==
-                       net::EntityType::PowerupHeal ||
-                       type == net::EntityType::PowerupSpeed ||
-                       type == net::EntityType::PowerupDoubleFire ||
-                       type == net::EntityType::PowerupShield) {
-                if (transforms.has(entity) &&
-                    boxes.has(entity) &&
-                    rooms.has(entity) &&
-                    powerups.has(entity)) {
-                    powerupEntities.push_back(entity);
-                }
+        }
+        for (auto entity : _entityIndex.get(EntityCategory::Enemy)) {
+            if (types.has(entity) &&
+                types[entity].type != net::EntityType::Boss3Invincible &&
+                transforms.has(entity) &&
+                boxes.has(entity) &&
+                rooms.has(entity) &&
+                healths.has(entity)) {
+                enemies.push_back(entity);
+            }
+        }
+        for (auto entity : _entityIndex.get(EntityCategory::Obstacle)) {
+            if (transforms.has(entity) &&
+                boxes.has(entity) &&
+                rooms.has(entity) &&
+                healths.has(entity)) {
+                obstacles.push_back(entity);
             }
         }
+        for (auto entity : _entityIndex.get(EntityCategory::PlayerBullet)) {
+            if (transforms.has(entity) &&
+                boxes.has(entity) &&
+                rooms.has(entity) &&
+                damages.has(entity)) {
+                bullets.push_back(entity);
+            }
+        }
+        for (auto entity : _entityIndex.get(EntityCategory::EnemyBullet)) {
+            if (types.has(entity) &&
+                types[entity].type == net::EntityType::EnemyBullet &&
+                transforms.has(entity) &&
+                boxes.has(entity) &&
+                rooms.has(entity) &&
+                damages.has(entity)) {
+                enemyBullets.push_back(entity);
+            }
+        }
+        for (auto entity : _entityIndex.get(EntityCategory::Powerup)) {
+            if (transforms.has(entity) &&
+                boxes.has(entity) &&
+                rooms.has(entity) &&
+                powerups.has(entity)) {
+                powerupEntities.push_back(entity);
+            }
+        }
+
+        // Candidates of each pair come from the grid cells both boxes cover
+        auto fillGrid = [&](SpatialHash &grid, AabbBatch &batch, const std::vector<ecs::Entity> &entities) {
+            grid.clear();
+            batch.clear();
+            for (size_t i = 0; i < entities.size(); ++i) {
+                const auto &tf = transforms[entities[i]];
+                const auto &box = boxes[entities[i]];
+                grid.insert(static_cast<uint32_t>(i), tf.position.x, tf.position.y, box.width, box.height);
+                batch.push(Aabb::fromSize(tf.position.x, tf.position.y, box.width, box.height));
+            }
+            grid.build();
+        };
+        // Then the batch kernel keeps those that really overlap, in increasing index order
+        auto findOverlaps = [&](const SpatialHash &grid, const AabbBatch &batch,
+                                const ecs::components::Transform &tf,
+                                const ecs::components::BoundingBox &box) -> const std::vector<uint32_t> & {
+            grid.query(tf.position.x, tf.position.y, box.width, box.height, _candidates);
+            _narrow.clear();
+            for (uint32_t candidate : _candidates)
+                _narrow.push(batch.get(candidate));
+            _narrow.overlapMask(Aabb::fromSize(tf.position.x, tf.position.y, box.width, box.height), _hits);
+
+            _overlapping.clear();
+            for (size_t k = 0; k < _candidates.size(); ++k) {
+                if (AabbBatch::isSet(_hits, k))
+                    _overlapping.push_back(_candidates[k]);
+            }
+            return _overlapping;
+        };
+        fillGrid(_powerupGrid, _powerupBoxes, powerupEntities);
+        fillGrid(_enemyGrid, _enemyBoxes, enemies);
+        fillGrid(_obstacleGrid, _obstacleBoxes, obstacles);
 
         for (auto player : players) {
             auto &ptf = transforms[player];
@@ -274,21 +290,12 @@ namespace rtp::server
             auto &proom = rooms[player];
             auto &health = healths[player];
             auto &speed = speeds[player];
-            auto *pvel = (velocities && velocities->has(player)) ? &(*velocities)[player] : nullptr;
 
-            for (auto powerEntity : powerupEntities) {
+            for (uint32_t candidate : findOverlaps(_powerupGrid, _powerupBoxes, ptf, pbox)) {
+                const auto powerEntity = powerupEntities[candidate];
                 if (removed.find(powerEntity.index()) != removed.end()) {
                     continue;
                 }
-                if (rooms[powerEntity].id != proom.id) {
-                    continue;
-                }
-
-                const auto &tf = transforms[powerEntity];
-                const auto &box = boxes[powerEntity];
-                if (!overlaps(ptf, pbox, tf, box)) {
-                    continue;
-                }
 
                 const auto &powerup = powerups[powerEntity];
                 log::info("=== Power-up collision! Type: {} ===", static_cast<int>(powerup.type));
@@ -346,16 +353,13 @@ namespace rtp::server
             }
         }
 
+        // Linear on purpose: each push moves the player out of the cells it was queried with
         for (auto player : players) {
             auto &ptf = transforms[player];
             auto &pbox = boxes[player];
-            auto &proom = rooms[player];
             auto *pvel = (velocities && velocities->has(player)) ? &(*velocities)[player] : nullptr;
 
             for (auto obstacle : obstacles) {
-                if (rooms[obstacle].id != proom.id) {
-                    continue;
-                }
                 const auto &otf = transforms[obstacle];
                 const auto &obox = boxes[obstacle];
                 if (!overlaps(ptf, pbox, otf, obox)) {
@@ -406,24 +410,17 @@ namespace rtp::server
             const auto &damage = damages[bullet];
 
             auto boomerResLocal = _registry.get<ecs::components::Boomerang>();
-            for (auto enemy : enemies) {
-                if (rooms[enemy].id != broom.id) {
-                    continue;
-                }
+            for (uint32_t candidate : findOverlaps(_enemyGrid, _enemyBoxes, btf, bbox)) {
+                const auto enemy = enemies[candidate];
                 const auto &etf = transforms[enemy];
-                const auto &ebox = boxes[enemy];
                 auto &health = healths[enemy];
-                if (!overlaps(btf, bbox, etf, ebox)) {
-                    continue;
-                }
 
                 // Check if enemy is a Boss and if there are shields protecting it
                 if (types[enemy].type == net::EntityType::Boss) {
-                    // Count living BossShields in the same room
+                    // Count living BossShields
                     int shieldCount = 0;
                     for (auto potentialShield : enemies) {
-                        if (rooms[potentialShield].id == broom.id &&
-                            types[potentialShield].type == net::EntityType::BossShield &&
+                        if (types[potentialShield].type == net::EntityType::BossShield &&
                             healths[potentialShield].currentHealth > 0) {
                             shieldCount++;
                         }
@@ -452,7 +449,7 @@ namespace rtp::server
                     const int award = getKillScore(types[enemy].type);
                     updatePlayerScore(broom.id, damage.sourceEntity, award);
                     // Enemy died - chance to drop power-up
-                    const int dropChance = std::rand() % 100;
+                    const int dropChance = std::uniform_int_distribution<int>(0, 99)(_rng);
                     if (dropChance < 30) { // 30% chance to drop
                         spawnPowerup(etf.position, broom.id, dropChance);
                     }
@@ -465,16 +462,9 @@ namespace rtp::server
                 continue;
             }
 
-            for (auto obstacle : obstacles) {
-                if (rooms[obstacle].id != broom.id) {
-                    continue;
-                }
-                const auto &otf = transforms[obstacle];
-                const auto &obox = boxes[obstacle];
+            for (uint32_t candidate : findOverlaps(_obstacleGrid, _obstacleBoxes, btf, bbox)) {
+                const auto obstacle = obstacles[candidate];
                 auto &health = healths[obstacle];
-                if (!overlaps(btf, bbox, otf, obox)) {
-                    continue;
-                }
 
                 if (types[obstacle].type == net::EntityType::Obstacle) {
                     health.currentHealth -= damage.amount;
@@ -492,6 +482,9 @@ namespace rtp::server
             }
         }
 
+        // Players were pushed out of obstacles, index their final positions
+        fillGrid(_playerGrid, _playerBoxes, players);
+
         // Handle boomerang returning to owner: recover ammo and despawn
         if (auto boomResCheck = _registry.get<ecs::components::Boomerang>()) {
             auto &boomers = boomResCheck->get();
@@ -505,12 +498,9 @@ namespace rtp::server
                 const auto &bbox = boxes[bullet];
 
                 // find owner entity in players list
-                for (auto player : players) {
-                    if (rooms[player].id != rooms[bullet].id) continue;
+                for (uint32_t candidate : findOverlaps(_playerGrid, _playerBoxes, btf, bbox)) {
+                    const auto player = players[candidate];
                     if (static_cast<uint32_t>(player.index()) != b.ownerIndex) continue;
-                    const auto &ptf = transforms[player];
-                    const auto &pbox = boxes[player];
-                    if (!overlaps(ptf, pbox, btf, bbox)) continue;
 
                     // Recover ammo for owner
                     if (auto ammoRes = _registry.get<ecs::components::Ammo>()) {
@@ -532,7 +522,7 @@ namespace rtp::server
                             if (auto netRes = _registry.get<ecs::components::NetworkId>()) {
                                 auto &nets = netRes->get();
                                 if (nets.has(player)) {
-                                    _networkSync.sendPacketToSession(nets[player].id, packet, net::NetworkMode::TCP);
+                                    _networkSync.sendPacketToSession(nets[player].id, packet, net::NetworkMode::ReliableUDP);
                                 }
                             }
                         }
@@ -553,16 +543,9 @@ namespace rtp::server
             const auto &broom = rooms[bullet];
             const auto &damage = damages[bullet];
 
-            for (auto player : players) {
-                if (rooms[player].id != broom.id) {
-                    continue;
-                }
-                const auto &ptf = transforms[player];
-                const auto &pbox = boxes[player];
+            for (uint32_t candidate : findOverlaps(_playerGrid, _playerBoxes, btf, bbox)) {
+                const auto player = players[candidate];
                 auto &health = healths[player];
-                if (!overlaps(btf, bbox, ptf, pbox)) {
-                    continue;
-                }
 
                 // Check if player has shield
                 bool shieldBlocked = false;
@@ -592,17 +575,10 @@ namespace rtp::server
                 if (!shieldBlocked && !_invincibleMode && health.currentHealth <= 0) {
                     auto room = _roomSystem.getRoom(broom.id);
                     if (room) {
-                        const auto playersInRoom = room->getPlayers();
-                        for (const auto &roomPlayer : playersInRoom) {
-                            if (!roomPlayer) {
-                                continue;
-                            }
-                            if (roomPlayer->getEntityId() == static_cast<uint32_t>(player.index())) {
-                                room->setPlayerType(roomPlayer->getId(), Room::PlayerType::Spectator);
-                                roomPlayer->setEntityId(0);
-                                _networkSync.unbindSession(roomPlayer->getId());
-                                break;
-                            }
+                        if (const auto roomPlayer = room->getPlayerByEntity(ecs::components::NetworkId::of(player))) {
+                            room->setPlayerType(roomPlayer->getId(), Room::PlayerType::Spectator);
+                            roomPlayer->setEntityId(0);
+                            _networkSync.unbindSession(roomPlayer->getId());
                         }
                         sendGameOverIfNeeded(room);
                     }
@@ -665,33 +641,21 @@ namespace rtp::server
 
         auto room = _roomSystem.getRoom(roomId);
         if (!room) {
-            _registry.kill(entity);
+            _projectilePool.release(entity);
             return;
         }
 
-        const auto players = room->getPlayers();
-        if (players.empty()) {
-            _registry.kill(entity);
-            return;
-        }
-
-        net::Packet packet(net::OpCode::EntityDeath);
         net::EntityDeathPayload payload{};
         payload.netId = net.id;
         payload.type = static_cast<uint8_t>(type.type);
         payload.position = transform.position;
-        packet << payload;
+        room->queueEntityDeath(payload);
 
-        log::debug("Sending EntityDeath packet for netId={}, type={} to {} players",
-                   net.id, static_cast<int>(type.type), players.size());
+        log::debug("Queued EntityDeath for netId={}, type={} in room {}",
+                   net.id, static_cast<int>(type.type), roomId);
 
-        for (const auto &player : players) {
-            _networkSync.sendPacketToSession(player->getId(), packet,
-                                             net::NetworkMode::TCP);
-        }
-
-        log::debug("Killing entity {} from registry", entity.index());
-        _registry.kill(entity);
+        log::debug("Releasing entity {} from registry", entity.index());
+        _projectilePool.release(entity);
     }
 
     void CollisionSystem::spawnPowerup(const Vec2f& position, uint32_t roomId, int dropRoll)
@@ -731,8 +695,9 @@ namespace rtp::server
         _registry.add<ecs::components::Powerup>(e, type, 1.0f, 0.0f);
         
         // Assign network ID
-        static uint32_t nextId = 1000;
-        _registry.add<ecs::components::NetworkId>(e, nextId++);
+        const uint32_t netId = ecs::components::NetworkId::of(e);
+        _registry.add<ecs::components::NetworkId>(e, netId);
+        _entityIndex.track(e, netType);
         
         log::info("Spawned power-up type {} at ({}, {})", static_cast<int>(type), position.x, position.y);
         
@@ -742,21 +707,11 @@ namespace rtp::server
             return;
         }
 
-        const auto players = room->getPlayers();
-        if (players.empty()) {
-            return;
-        }
-
-        net::Packet packet(net::OpCode::EntitySpawn);
         net::EntitySpawnPayload payload{};
-        payload.netId = nextId - 1;
+        payload.netId = netId;
         payload.type = static_cast<uint8_t>(netType);
         payload.posX = position.x;
         payload.posY = position.y;
-        packet << payload;
-
-        for (const auto &player : players) {
-            _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::TCP);
-        }
+        room->queueEntitySpawn(payload);
     }
 }
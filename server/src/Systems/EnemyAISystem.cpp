@@ -10,7 +10,8 @@
 #include <algorithm>
 #include <cmath>
 #include <limits>
-#include <unordered_map>
+#include <optional>
+#include <vector>
 
 namespace rtp::server
 {
@@ -18,54 +19,45 @@ namespace rtp::server
     // Public API
     //////////////////////////////////////////////////////////////////////////
 
-    EnemyAISystem::EnemyAISystem(ecs::Registry& registry)
-        : _registry(registry) {}
+    EnemyAISystem::EnemyAISystem(ecs::Registry& registry, const EntityIndex& entityIndex)
+        : _registry(registry), _entityIndex(entityIndex) {}
 
     void EnemyAISystem::update(float dt)
     {
         _time += dt;
 
-        std::unordered_map<uint32_t, float> frontX;
-        {
-            auto players = _registry.zipView<
-                ecs::components::Transform,
-                ecs::components::EntityType,
-                ecs::components::RoomId
-            >();
-            for (auto&& [tf, type, room] : players) {
-                if (type.type != net::EntityType::Player) {
-                    continue;
-                }
-                auto it = frontX.find(room.id);
-                if (it == frontX.end() || tf.position.x > it->second) {
-                    frontX[room.id] = tf.position.x;
-                }
-            }
-        }
-
         auto transformsRes = _registry.get<ecs::components::Transform>();
         auto velocitiesRes = _registry.get<ecs::components::Velocity>();
         auto patternsRes = _registry.get<ecs::components::MouvementPattern>();
         auto typesRes = _registry.get<ecs::components::EntityType>();
-        auto roomsRes = _registry.get<ecs::components::RoomId>();
-        if (!transformsRes || !velocitiesRes || !patternsRes || !typesRes || !roomsRes) {
+        if (!transformsRes || !velocitiesRes || !patternsRes || !typesRes) {
             return;
         }
         auto &transforms = transformsRes->get();
         auto &velocities = velocitiesRes->get();
         auto &patterns = patternsRes->get();
         auto &types = typesRes->get();
-        auto &rooms = roomsRes->get();
 
-        std::unordered_map<uint32_t, std::vector<std::pair<ecs::Entity, Vec2f>>> bosses;
-        for (auto entity : transforms.entities()) {
-            if (!types.has(entity) || !rooms.has(entity)) {
+        // The registry only holds this room, its players are the whole bucket
+        std::vector<Vec2f> players;
+        std::optional<float> frontX;
+        for (auto entity : _entityIndex.get(EntityCategory::Player)) {
+            if (!transforms.has(entity)) {
                 continue;
             }
-            const auto &type = types[entity];
-            const auto &room = rooms[entity];
-            if (type.type == net::EntityType::Boss) {
-                bosses[room.id].push_back({entity, transforms[entity].position});
+            const Vec2f &pos = transforms[entity].position;
+            players.push_back(pos);
+            if (!frontX || pos.x > *frontX) {
+                frontX = pos.x;
+            }
+        }
+
+        const auto &enemies = _entityIndex.get(EntityCategory::Enemy);
+        std::vector<std::pair<ecs::Entity, Vec2f>> bosses;
+        for (auto entity : enemies) {
+            if (transforms.has(entity) && types.has(entity) &&
+                types[entity].type == net::EntityType::Boss) {
+                bosses.push_back({entity, transforms[entity].position});
             }
         }
 
@@ -75,12 +67,9 @@ namespace rtp::server
         constexpr float anchorBoss = 1100.0f;
         constexpr float followGain = 2.0f;
 
-        static std::unordered_map<ecs::Entity, ecs::Entity> shieldBoss;
-        static std::unordered_map<ecs::Entity, Vec2f> shieldOffsets;
-
-        for (auto entity : transforms.entities()) {
-            if (!velocities.has(entity) || !patterns.has(entity) ||
-                !types.has(entity) || !rooms.has(entity)) {
+        for (auto entity : enemies) {
+            if (!transforms.has(entity) || !velocities.has(entity) ||
+                !patterns.has(entity) || !types.has(entity)) {
                 continue;
             }
 
@@ -88,7 +77,6 @@ namespace rtp::server
             auto &vel = velocities[entity];
             auto &pat = patterns[entity];
             auto &type = types[entity];
-            auto &room = rooms[entity];
             if (type.type != net::EntityType::Enemy1 &&
                 type.type != net::EntityType::Enemy2 &&
                 type.type != net::EntityType::Enemy3 &&
@@ -100,8 +88,7 @@ namespace rtp::server
             }
 
             if (type.type == net::EntityType::BossShield) {
-                auto itBosses = bosses.find(room.id);
-                if (itBosses == bosses.end() || itBosses->second.empty()) {
+                if (bosses.empty()) {
                     continue; // no boss to follow
                 }
 
@@ -109,10 +96,10 @@ namespace rtp::server
                 Vec2f bossPos{};
                 bool bossFound = false;
 
-                auto linkIt = shieldBoss.find(entity);
-                if (linkIt != shieldBoss.end()) {
+                auto linkIt = _shieldBoss.find(entity);
+                if (linkIt != _shieldBoss.end()) {
                     bossEntity = linkIt->second;
-                    for (const auto& [bEntity, bPos] : itBosses->second) {
+                    for (const auto& [bEntity, bPos] : bosses) {
                         if (bEntity == bossEntity) {
                             bossPos = bPos;
                             bossFound = true;
@@ -123,7 +110,7 @@ namespace rtp::server
 
                 if (bossEntity == ecs::NullEntity || !bossFound) {
                     float bestDist2 = std::numeric_limits<float>::max();
-                    for (const auto& [bEntity, bPos] : itBosses->second) {
+                    for (const auto& [bEntity, bPos] : bosses) {
                         const float dx = bPos.x - tf.position.x;
                         const float dy = bPos.y - tf.position.y;
                         const float dist2 = dx * dx + dy * dy;
@@ -134,14 +121,14 @@ namespace rtp::server
                             bossFound = true;
                         }
                     }
-                    shieldBoss[entity] = bossEntity;
-                    shieldOffsets[entity] = tf.position - bossPos;
+                    _shieldBoss[entity] = bossEntity;
+                    _shieldOffsets[entity] = tf.position - bossPos;
                 }
 
-                auto offIt = shieldOffsets.find(entity);
-                if (offIt == shieldOffsets.end()) {
-                    shieldOffsets[entity] = tf.position - bossPos;
-                    offIt = shieldOffsets.find(entity);
+                auto offIt = _shieldOffsets.find(entity);
+                if (offIt == _shieldOffsets.end()) {
+                    _shieldOffsets[entity] = tf.position - bossPos;
+                    offIt = _shieldOffsets.find(entity);
                 }
 
                 const Vec2f targetPos = bossPos + offIt->second;
@@ -153,13 +140,12 @@ namespace rtp::server
             }
 
             if (pat.pattern != ecs::components::Patterns::Kamikaze &&
-                tf.position.x < frontX[room.id] - 100.0f) {
+                tf.position.x < frontX.value_or(0.0f) - 100.0f) {
                 continue;
             }
             if (pat.pattern == ecs::components::Patterns::Kamikaze) {
-                auto it = frontX.find(room.id);
-                if (it != frontX.end()) {
-                    const float dx = it->second - tf.position.x;
+                if (frontX) {
+                    const float dx = *frontX - tf.position.x;
                     vel.direction.x = std::clamp(dx * followGain, -pat.speed, pat.speed);
                 } else {
                     vel.direction.x = 0.f;
@@ -170,9 +156,8 @@ namespace rtp::server
                 const float anchorX = isBoss ? anchorBoss : anchorDefault;
 
                 float targetX = anchorX;
-                auto it = frontX.find(room.id);
-                if (it != frontX.end()) {
-                    targetX = std::max(anchorX, it->second + minAhead);
+                if (frontX) {
+                    targetX = std::max(anchorX, *frontX + minAhead);
                 }
                 const float dx = targetX - tf.position.x;
                 const float maxXSpeed = std::max(60.0f, pat.speed);
@@ -208,22 +193,15 @@ namespace rtp::server
                 case ecs::components::Patterns::Kamikaze: {
                     float nearestDist = std::numeric_limits<float>::max();
                     Vec2f nearestPlayerPos = {tf.position.x, tf.position.y};
-                    
-                    auto players = _registry.zipView<
-                        ecs::components::Transform,
-                        ecs::components::EntityType,
-                        ecs::components::RoomId
-                    >();
-                    
-                    for (auto&& [pTf, pType, pRoom] : players) {
-                        if (pType.type == net::EntityType::Player && pRoom.id == room.id) {
-                            const float dx = pTf.position.x - tf.position.x;
-                            const float dy = pTf.position.y - tf.position.y;
-                            const float dist = std::sqrt(dx * dx + dy * dy);
-                            if (dist < nearestDist) {
-                                nearestDist = dist;
-                                nearestPlayerPos = pTf.position;
-                            }
+
+
+                    for (const Vec2f &playerPos : players) {
+                        const float dx = playerPos.x - tf.position.x;
+                        const float dy = playerPos.y - tf.position.y;
+                        const float dist = std::sqrt(dx * dx + dy * dy);
+                        if (dist < nearestDist) {
+                            nearestDist = dist;
+                            nearestPlayerPos = playerPos;
                         }
                     }
                     const float dx = nearestPlayerPos.x - tf.position.x;
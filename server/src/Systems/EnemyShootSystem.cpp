@@ -18,9 +18,10 @@ namespace rtp::server
     //////////////////////////////////////////////////////////////////////////
 
     EnemyShootSystem::EnemyShootSystem(ecs::Registry& registry,
+                                       ProjectilePool& projectilePool,
                                        RoomSystem& roomSystem,
                                        NetworkSyncSystem& networkSync)
-        : _registry(registry), _roomSystem(roomSystem), _networkSync(networkSync)
+        : _registry(registry), _projectilePool(projectilePool), _roomSystem(roomSystem), _networkSync(networkSync)
     {
     }
 
@@ -82,59 +83,36 @@ namespace rtp::server
         bool isBoomerang,
         uint32_t shooterIndex)
     {
-        auto entityRes = _registry.spawn();
-        if (!entityRes) {
-            log::error("Failed to spawn enemy bullet entity: {}", entityRes.error().message());
-            return;
-        }
-
-        ecs::Entity bullet = entityRes.value();
-
         const float x = tf.position.x + _spawnOffsetX;
         const float y = tf.position.y;
 
-        _registry.add<ecs::components::Transform>(
-            bullet,
-            ecs::components::Transform{ {x, y}, 0.f, {1.f, 1.f} }
-        );
-
         // Boomerang bullets go slower and curve back
         float bulletSpeed = isBoomerang ? -200.0f : _bulletSpeed;
-        _registry.add<ecs::components::Velocity>(
-            bullet,
-            ecs::components::Velocity{ {bulletSpeed, 0.f}, 0.f }
-        );
 
         // Larger hitbox for boomerang
         float bboxW = isBoomerang ? 24.0f : 8.0f;
         float bboxH = isBoomerang ? 24.0f : 4.0f;
-        _registry.add<ecs::components::BoundingBox>(
-            bullet,
-            ecs::components::BoundingBox{ bboxW, bboxH }
-        );
 
         // More damage for boomerang
         int damage = isBoomerang ? 25 : 10;
-        _registry.add<ecs::components::Damage>(
-            bullet,
-            ecs::components::Damage{ damage, ecs::NullEntity }
-        );
-
-        _registry.add<ecs::components::NetworkId>(
-            bullet,
-            ecs::components::NetworkId{ static_cast<uint32_t>(bullet.index()) }
-        );
 
         net::EntityType bulletType = isBoomerang ? net::EntityType::Boss2Bullet : net::EntityType::EnemyBullet;
-        _registry.add<ecs::components::EntityType>(
-            bullet,
-            ecs::components::EntityType{ bulletType }
-        );
+        auto entityRes = _projectilePool.acquire(ProjectileSpec{
+            bulletType,
+            {x, y},
+            ecs::components::Velocity{ {bulletSpeed, 0.f}, 0.f },
+            bboxW,
+            bboxH,
+            damage,
+            ecs::NullEntity,
+            roomId.id
+        });
+        if (!entityRes) {
+            log::error("Failed to spawn enemy bullet entity: {}", entityRes.error().message());
+            return;
+        }
 
-        _registry.add<ecs::components::RoomId>(
-            bullet,
-            ecs::components::RoomId{ roomId.id }
-        );
+        ecs::Entity bullet = entityRes.value();
 
         // Add boomerang component for Boss2 bullets
         if (isBoomerang) {
@@ -152,21 +130,12 @@ namespace rtp::server
         if (room->getState() != Room::State::InGame)
             return;
 
-        const auto players = room->getPlayers();
-        std::vector<uint32_t> sessions;
-        sessions.reserve(players.size());
-        for (const auto& player : players) {
-            sessions.push_back(player->getId());
-        }
-
-        net::Packet packet(net::OpCode::EntitySpawn);
         net::EntitySpawnPayload payload = {
-            static_cast<uint32_t>(bullet.index()),
+            ecs::components::NetworkId::of(bullet),
             static_cast<uint8_t>(bulletType),
             x,
             y
         };
-        packet << payload;
-        _networkSync.sendPacketToSessions(sessions, packet, net::NetworkMode::TCP);
+        room->queueEntitySpawn(payload);
     }
 } // namespace rtp::server
@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** EntityIndex
+*/
+
+#include "Systems/EntityIndex.hpp"
+
+#include "RType/ECS/Components/EntityType.hpp"
+
+namespace rtp::server
+{
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    EntityCategory categoryOf(net::EntityType type)
+    {
+        switch (type) {
+            case net::EntityType::Player:
+                return EntityCategory::Player;
+            case net::EntityType::Enemy1:
+            case net::EntityType::Enemy2:
+            case net::EntityType::Enemy3:
+            case net::EntityType::Enemy4:
+            case net::EntityType::Tank:
+            case net::EntityType::Boss:
+            case net::EntityType::Boss2:
+            case net::EntityType::Boss3Invincible:
+            case net::EntityType::BossShield:
+                return EntityCategory::Enemy;
+            case net::EntityType::Obstacle:
+            case net::EntityType::ObstacleSolid:
+                return EntityCategory::Obstacle;
+            case net::EntityType::Bullet:
+            case net::EntityType::ChargedBullet:
+                return EntityCategory::PlayerBullet;
+            case net::EntityType::EnemyBullet:
+            case net::EntityType::Boss2Bullet:
+                return EntityCategory::EnemyBullet;
+            case net::EntityType::PowerupHeal:
+            case net::EntityType::PowerupSpeed:
+            case net::EntityType::PowerupDoubleFire:
+            case net::EntityType::PowerupShield:
+                return EntityCategory::Powerup;
+            default:
+                return EntityCategory::Other;
+        }
+    }
+
+    EntityIndex::EntityIndex(ecs::Registry &registry)
+        : _registry(registry)
+    {
+    }
+
+    void EntityIndex::track(ecs::Entity entity, net::EntityType type)
+    {
+        _pending.push_back(Change{entity, categoryOf(type)});
+    }
+
+    void EntityIndex::untrack(ecs::Entity entity)
+    {
+        _pending.push_back(Change{entity, EntityCategory::Count});
+    }
+
+    void EntityIndex::flush(void)
+    {
+        for (const auto &change : _pending) {
+            if (change.category == EntityCategory::Count)
+                erase(change.entity);
+            else
+                insert(change.entity, change.category);
+        }
+        _pending.clear();
+    }
+
+    void EntityIndex::refresh(void)
+    {
+        _pending.clear();
+        for (auto &bucket : _buckets)
+            bucket.clear();
+        _slots.clear();
+
+        auto typesRes = _registry.get<ecs::components::EntityType>();
+        if (!typesRes)
+            return;
+
+        const auto &types = typesRes->get();
+        for (auto entity : types.entities())
+            insert(entity, categoryOf(types[entity].type));
+    }
+
+    const std::vector<ecs::Entity> &EntityIndex::get(EntityCategory category) const
+    {
+        return _buckets[static_cast<size_t>(category)];
+    }
+
+    size_t EntityIndex::size(void) const
+    {
+        size_t total = 0;
+        for (const auto &bucket : _buckets)
+            total += bucket.size();
+        return total;
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private API
+    //////////////////////////////////////////////////////////////////////////
+
+    void EntityIndex::insert(ecs::Entity entity, EntityCategory category)
+    {
+        const uint32_t idx = entity.index();
+        if (idx >= _slots.size())
+            _slots.resize(idx + 1);
+
+        // A listed index is either the same entity or one killed without untrack()
+        if (_slots[idx].category != EntityCategory::Count)
+            erase(_buckets[static_cast<size_t>(_slots[idx].category)][_slots[idx].position]);
+
+        auto &bucket = _buckets[static_cast<size_t>(category)];
+        _slots[idx] = Slot{category, static_cast<uint32_t>(bucket.size())};
+        bucket.push_back(entity);
+    }
+
+    void EntityIndex::erase(ecs::Entity entity)
+    {
+        const uint32_t idx = entity.index();
+        if (idx >= _slots.size() || _slots[idx].category == EntityCategory::Count)
+            return;
+
+        const Slot slot = _slots[idx];
+        auto &bucket = _buckets[static_cast<size_t>(slot.category)];
+        if (bucket[slot.position] != entity)
+            return;
+
+        // Swap-remove, like SparseArray::erase
+        bucket[slot.position] = bucket.back();
+        _slots[bucket[slot.position].index()].position = slot.position;
+        bucket.pop_back();
+        _slots[idx] = Slot{};
+    }
+}
@@ -8,6 +8,7 @@
 
 #include "Systems/EntitySystem.hpp"
 #include "RType/Config/WeaponConfig.hpp"
+#include "RType/Game/PlayerMovement.hpp"
 
 namespace rtp::server
 {
@@ -16,9 +17,11 @@ namespace rtp::server
     //////////////////////////////////////////////////////////////////////////
 
     EntitySystem::EntitySystem(ecs::Registry &registry,
+                               EntityIndex &entityIndex,
                                ServerNetwork &network,
                                NetworkSyncSystem &networkSync)
         : _registry(registry)
+        , _entityIndex(entityIndex)
         , _network(network)
         , _networkSync(networkSync)
     {
@@ -98,10 +101,10 @@ namespace rtp::server
             ammoComp);
 
         _registry.add<ecs::components::MovementSpeed>(
-            entity, ecs::components::MovementSpeed{200.0f, 1.0f, 0.0f});
+            entity, ecs::components::MovementSpeed{game::PLAYER_SPEED, 1.0f, 0.0f});
 
         _registry.add<ecs::components::NetworkId>(
-            entity, ecs::components::NetworkId{(uint32_t)entity});
+            entity, ecs::components::NetworkId{ecs::components::NetworkId::of(entity)});
 
         _registry.add<ecs::components::server::InputComponent>(
             entity, ecs::components::server::InputComponent{});
@@ -114,11 +117,13 @@ namespace rtp::server
             entity, ecs::components::Health{100, 100});
 
         _registry.add<ecs::components::BoundingBox>(
-            entity, ecs::components::BoundingBox{32.0f, 16.0f});
+            entity, ecs::components::BoundingBox{game::PLAYER_WIDTH, game::PLAYER_HEIGHT});
 
         _registry.add<ecs::components::RoomId>(
             entity, ecs::components::RoomId{player->getRoomId()});
 
+        _entityIndex.track(entity, net::EntityType::Player);
+
         return entity;
     }
 
@@ -189,7 +194,7 @@ namespace rtp::server
 
         _registry.add<ecs::components::NetworkId>(
             entity, ecs::components::NetworkId{
-                        static_cast<uint32_t>(entity.index())});
+                        ecs::components::NetworkId::of(entity)});
 
         _registry.add<ecs::components::EntityType>(
             entity, ecs::components::EntityType{type});
@@ -266,6 +271,8 @@ namespace rtp::server
         //     ecs::components::IABehavior::Passive, 500.0 }
         // );
 
+        _entityIndex.track(entity, type);
+
         return entity;
     }
 
@@ -318,11 +325,13 @@ namespace rtp::server
 
         _registry.add<ecs::components::NetworkId>(
             entity, ecs::components::NetworkId{
-                        static_cast<uint32_t>(entity.index())});
+                        ecs::components::NetworkId::of(entity)});
 
         _registry.add<ecs::components::RoomId>(
             entity, ecs::components::RoomId{roomId});
 
+        _entityIndex.track(entity, netType);
+
         return entity;
     }
 
@@ -359,11 +368,13 @@ namespace rtp::server
 
         _registry.add<ecs::components::NetworkId>(
             entity, ecs::components::NetworkId{
-                        static_cast<uint32_t>(entity.index())});
+                        ecs::components::NetworkId::of(entity)});
 
         _registry.add<ecs::components::RoomId>(
             entity, ecs::components::RoomId{roomId});
 
+        _entityIndex.track(entity, type);
+
         return entity;
     }
 } // namespace rtp::server
@@ -6,12 +6,13 @@
 #include "Systems/HomingSystem.hpp"
 #include "RType/Math/Vec2.hpp"
 #include "RType/Network/Packet.hpp"
-#include <limits>
+#include <algorithm>
 
 namespace rtp::server
 {
-    HomingSystem::HomingSystem(ecs::Registry &registry)
+    HomingSystem::HomingSystem(ecs::Registry &registry, const EntityIndex &entityIndex)
         : _registry(registry)
+        , _entityIndex(entityIndex)
     {}
 
     void HomingSystem::update(float dt)
@@ -19,7 +20,6 @@ namespace rtp::server
         using ecs::components::Transform;
         using ecs::components::Velocity;
         using ecs::components::EntityType;
-        using ecs::components::RoomId;
         using ecs::components::Health;
         using ecs::components::Homing;
 
@@ -27,52 +27,46 @@ namespace rtp::server
         auto homingRes = _registry.get<Homing>();
         auto tfRes = _registry.get<Transform>();
         auto velRes = _registry.get<Velocity>();
-        auto roomRes = _registry.get<RoomId>();
-        if (!homingRes || !tfRes || !velRes || !roomRes)
+        auto typeRes = _registry.get<EntityType>();
+        auto healthRes = _registry.get<Health>();
+        if (!homingRes || !tfRes || !velRes || !typeRes || !healthRes)
             return;
 
-        auto &homings = homingRes->get();
         auto &transforms = tfRes->get();
-        auto &vels = velRes->get();
-        auto &rooms = roomRes->get();
+        auto &types = typeRes->get();
+        auto &healths = healthRes->get();
 
-        // We'll iterate candidates for targets
-        auto targetView = _registry.zipView<Transform, EntityType, Health, RoomId>();
-
-        for (auto &&[homing, tf, vel, room] : _registry.zipView<Homing, Transform, Velocity, RoomId>()) {
-            // find nearest hostile (Enemy1/Enemy2/Enemy3/Enemy4/Tank/Boss) in same room
-            float bestDist2 = std::numeric_limits<float>::infinity();
-            bool found = false;
-            rtp::Vec2f targetPos{0.0f, 0.0f};
-
-            for (auto &&[otf, otype, ohealth, oroom] : targetView) {
-                if (oroom.id != room.id)
-                    continue;
-                // skip players and non-enemies
-                if (otype.type == net::EntityType::Player)
-                    continue;
-                if (otype.type != net::EntityType::Enemy1 && 
-                    otype.type != net::EntityType::Enemy2 && 
-                    otype.type != net::EntityType::Enemy3 && 
-                    otype.type != net::EntityType::Enemy4 && 
-                    otype.type != net::EntityType::Tank && 
-                    otype.type != net::EntityType::Boss &&
-                    otype.type != net::EntityType::Boss2)
-                    continue;
+        // Targets come from the enemy bucket, the registry only holds this room
+        _targets.clear();
+        for (auto entity : _entityIndex.get(EntityCategory::Enemy)) {
+            if (!transforms.has(entity) || !types.has(entity) || !healths.has(entity))
+                continue;
+            // shields and the invincible boss are not worth a missile
+            const auto type = types[entity].type;
+            if (type != net::EntityType::Enemy1 &&
+                type != net::EntityType::Enemy2 &&
+                type != net::EntityType::Enemy3 &&
+                type != net::EntityType::Enemy4 &&
+                type != net::EntityType::Tank &&
+                type != net::EntityType::Boss &&
+                type != net::EntityType::Boss2)
+                continue;
+            _targets.push_back(transforms[entity].position);
+        }
+        if (_targets.empty())
+            return;
 
-                const float dx = otf.position.x - tf.position.x;
-                const float dy = otf.position.y - tf.position.y;
-                const float d2 = dx * dx + dy * dy;
-                if (d2 < bestDist2 && d2 <= homing.range * homing.range) {
-                    bestDist2 = d2;
-                    targetPos.x = otf.position.x;
-                    targetPos.y = otf.position.y;
-                    found = true;
-                }
-            }
+        _targetGrid.clear();
+        for (size_t i = 0; i < _targets.size(); ++i)
+            _targetGrid.insert(static_cast<uint32_t>(i), _targets[i].x, _targets[i].y, 0.0f, 0.0f);
+        _targetGrid.build();
 
-            if (!found)
+        for (auto &&[homing, tf, vel] : _registry.zipView<Homing, Transform, Velocity>()) {
+            // find nearest hostile (Enemy1/Enemy2/Enemy3/Enemy4/Tank/Boss), first one on ties
+            _targetGrid.nearest(tf.position.x, tf.position.y, homing.range, 1, _nearest);
+            if (_nearest.empty())
                 continue;
+            const rtp::Vec2f targetPos = _targets[_nearest.front()];
 
             // Compute desired normalized direction
             rtp::Vec2f desired = rtp::Vec2f{targetPos.x - tf.position.x, targetPos.y - tf.position.y}.normalized();
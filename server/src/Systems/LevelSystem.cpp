@@ -11,6 +11,7 @@
 #include "RType/ECS/Components/EntityType.hpp"
 #include "RType/ECS/Components/RoomId.hpp"
 #include "RType/ECS/Components/Velocity.hpp"
+#include "RType/ECS/Components/Health.hpp"
 
 #include <cmath>
 
@@ -21,48 +22,31 @@ namespace rtp::server {
     //////////////////////////////////////////////////////////////////////////
 
     LevelSystem::LevelSystem(ecs::Registry& registry,
+                            const EntityIndex& entityIndex,
+                            LevelCache& levelCache,
                             EntitySystem& entitySystem,
                             RoomSystem& roomSystem,
-                            NetworkSyncSystem& networkSync)
+                            NetworkSyncSystem& networkSync,
+                            std::mt19937& rng)
         : _registry(registry)
+        , _entityIndex(entityIndex)
+        , _levelCache(levelCache)
         , _entitySystem(entitySystem)
         , _roomSystem(roomSystem)
         , _networkSync(networkSync)
+        , _rng(rng)
     {
     }
 
-    void LevelSystem::registerLevelPath(uint32_t levelId, const std::string& path)
-    {
-        _levelPaths[levelId] = path;
-    }
-
-    std::optional<LevelData> LevelSystem::loadLevel(uint32_t levelId) const
-    {
-        auto it = _levelPaths.find(levelId);
-        if (it == _levelPaths.end()) {
-            log::warning("No level path registered for level {}", levelId);
-            return std::nullopt;
-        }
-
-        std::string error;
-        auto level = loadLevelFromFile(it->second, error);
-        if (!level) {
-            log::error("Failed to load level {}: {}", levelId, error);
-            return std::nullopt;
-        }
-
-        return level;
-    }
-
     void LevelSystem::startLevelForRoom(uint32_t roomId, uint32_t levelId)
     {
-        auto level = loadLevel(levelId);
+        auto level = _levelCache.get(levelId);
         if (!level) {
             return;
         }
 
         ActiveLevel active{};
-        active.data = std::move(level.value());
+        active.data = std::move(level);
         _activeLevels[roomId] = std::move(active);
         log::info("Loaded level {} for room {}", levelId, roomId);
     }
@@ -86,23 +70,12 @@ namespace rtp::server {
             active.elapsed += dt;
 
             // --- Boss3Invincible logic (phase-driven) ---
-            if (active.boss3Active && active.data.boss3Data.has_value()) {
-                const auto& boss3Data = active.data.boss3Data.value();
+            if (active.boss3Active && active.data->boss3Data.has_value()) {
+                const auto& boss3Data = active.data->boss3Data.value();
                 active.boss3Timer += dt;
                 if (active.boss3Timer >= 60.0f) {
                     // WIN: 1 minute survived since boss spawn
-                    bool anyPlayerAlive = false;
-                    auto view = _registry.zipView<
-                        ecs::components::EntityType,
-                        ecs::components::RoomId,
-                        ecs::components::Health
-                    >();
-                    for (auto &&[type, roomComp, health] : view) {
-                        if (roomComp.id != roomId) continue;
-                        if (type.type == net::EntityType::Player && health.currentHealth > 0) {
-                            anyPlayerAlive = true;
-                        }
-                    }
+                    const bool anyPlayerAlive = anyAlive(EntityCategory::Player, net::EntityType::Player);
                     log::info("Level completed for room {}: players alive={}", roomId, anyPlayerAlive);
                     auto room = _roomSystem.getRoom(roomId);
                     if (room) {
@@ -124,7 +97,7 @@ namespace rtp::server {
                             payload.playerScore = p->getScore();
                             payload.isWin = anyPlayerAlive; // true if at least one player survived
                             packet << payload;
-                            _networkSync.sendPacketToSession(p->getId(), packet, rtp::net::NetworkMode::TCP);
+                            _networkSync.sendPacketToSession(p->getId(), packet, rtp::net::NetworkMode::ReliableUDP);
                         }
                         room->forceFinishGame();
                     }
@@ -141,11 +114,11 @@ namespace rtp::server {
                         // Calculate random Y positions for each enemy
                         float minY = phase.spawnAreaYMin;
                         float maxY = phase.spawnAreaYMax;
-                        float x = phase.spawnAreaX + (std::rand() % 101);
+                        float x = phase.spawnAreaX + std::uniform_int_distribution<int>(0, 100)(_rng);
                         for (int i = 0; i < phase.spawnCount; ++i) {
                             if (i < active.boss3EnemiesSpawnedThisPhase) continue;
                             // Y totalement aléatoire sur la plage
-                            float spawnY = minY + static_cast<float>(std::rand()) / RAND_MAX * (maxY - minY);
+                            float spawnY = minY + std::uniform_real_distribution<float>(0.0f, 1.0f)(_rng) * (maxY - minY);
                             // Determine enemy type from string
                             net::EntityType enemyType = net::EntityType::Enemy3;
                             if (phase.enemyType == "enemy1") enemyType = net::EntityType::Enemy1;
@@ -172,26 +145,8 @@ namespace rtp::server {
             }
 
             // Check level completion: all players dead OR all bosses defeated
-            bool anyPlayerAlive = false;
-            bool anyBossAlive = false;
-
-            auto view = _registry.zipView<
-                ecs::components::EntityType,
-                ecs::components::RoomId,
-                ecs::components::Health
-            >();
-
-            for (auto &&[type, roomComp, health] : view) {
-                if (roomComp.id != roomId) {
-                    continue;
-                }
-                if (type.type == net::EntityType::Player && health.currentHealth > 0) {
-                    anyPlayerAlive = true;
-                }
-                if (type.type == net::EntityType::Boss && health.currentHealth > 0) {
-                    anyBossAlive = true;
-                }
-            }
+            const bool anyPlayerAlive = anyAlive(EntityCategory::Player, net::EntityType::Player);
+            const bool anyBossAlive = anyAlive(EntityCategory::Enemy, net::EntityType::Boss);
 
             // Fin de niveau :
             // - tous les joueurs morts
@@ -218,43 +173,30 @@ namespace rtp::server {
                     payload.playerScore = p->getScore();
                     payload.isWin = false;
                     packet << payload;
-                    _networkSync.sendPacketToSession(p->getId(), packet, rtp::net::NetworkMode::TCP);
+                    _networkSync.sendPacketToSession(p->getId(), packet, rtp::net::NetworkMode::ReliableUDP);
                 }
                 room->forceFinishGame();
                 continue;
             }
 
-            auto getFrontPlayerX = [&]() -> float {
-                float maxX = 0.0f;
-                auto view = _registry.zipView<
-                    ecs::components::Transform,
-                    ecs::components::EntityType,
-                    ecs::components::RoomId
-                >();
-                for (auto &&[tf, type, room] : view) {
-                    if (room.id != roomId || type.type != net::EntityType::Player) {
-                        continue;
-                    }
-                    if (tf.position.x > maxX) {
-                        maxX = tf.position.x;
-                    }
-                }
-                return maxX;
-            };
+            // Players do not move while the level spawns, one lookup per tick is enough
+            std::optional<float> frontX;
 
-            while (active.nextSpawn < active.data.spawns.size() &&
-                active.data.spawns[active.nextSpawn].atTime <= active.elapsed) {
-                const auto& spawn = active.data.spawns[active.nextSpawn];
+            while (active.nextSpawn < active.data->spawns.size() &&
+                active.data->spawns[active.nextSpawn].atTime <= active.elapsed) {
+                const auto& spawn = active.data->spawns[active.nextSpawn];
                 Vec2f startPos = spawn.startPosition;
                 const int patternIndex = static_cast<int>(active.nextSpawn % 5);
                 const float xOffsets[5] = {0.0f, 100.0f, -40.0f, 80.0f, -80.0f};
                 startPos.x += xOffsets[patternIndex];
-                const float frontX = getFrontPlayerX();
+                if (!frontX) {
+                    frontX = frontPlayerX();
+                }
                 const float minAhead = (spawn.type == net::EntityType::Boss || spawn.type == net::EntityType::Boss2)
                     ? 450.0f   // boss plus éloigné
                     : 200.0f;  // distance standard pour scouts/tanks/etc.
-                if (startPos.x < frontX + minAhead) {
-                    startPos.x = frontX + minAhead;
+                if (startPos.x < *frontX + minAhead) {
+                    startPos.x = *frontX + minAhead;
                 }
                 auto entity = _entitySystem.creaetEnemyEntity(
                     roomId, startPos, spawn.pattern,
@@ -290,9 +232,9 @@ namespace rtp::server {
                 active.nextSpawn++;
             }
 
-            while (active.nextPowerup < active.data.powerups.size() &&
-                active.data.powerups[active.nextPowerup].atTime <= active.elapsed) {
-                const auto& powerup = active.data.powerups[active.nextPowerup];
+            while (active.nextPowerup < active.data->powerups.size() &&
+                active.data->powerups[active.nextPowerup].atTime <= active.elapsed) {
+                const auto& powerup = active.data->powerups[active.nextPowerup];
                 auto entity = _entitySystem.createPowerupEntity(
                     roomId, powerup.position, powerup.type, powerup.value, powerup.duration);
                 _registry.add<ecs::components::Velocity>(
@@ -302,9 +244,9 @@ namespace rtp::server {
                 active.nextPowerup++;
             }
 
-            while (active.nextObstacle < active.data.obstacles.size() &&
-                active.data.obstacles[active.nextObstacle].atTime <= active.elapsed) {
-                const auto& obstacle = active.data.obstacles[active.nextObstacle];
+            while (active.nextObstacle < active.data->obstacles.size() &&
+                active.data->obstacles[active.nextObstacle].atTime <= active.elapsed) {
+                const auto& obstacle = active.data->obstacles[active.nextObstacle];
                 auto entity = _entitySystem.createObstacleEntity(
                     roomId, obstacle.position, obstacle.size, obstacle.health, obstacle.type);
                 _registry.add<ecs::components::Velocity>(
@@ -320,6 +262,42 @@ namespace rtp::server {
     // Private API
     ///////////////////////////////////////////////////////////////////////////
 
+    bool LevelSystem::anyAlive(EntityCategory category, net::EntityType type) const
+    {
+        auto typesRes = _registry.get<ecs::components::EntityType>();
+        auto healthRes = _registry.get<ecs::components::Health>();
+        if (!typesRes || !healthRes) {
+            return false;
+        }
+
+        const auto& types = typesRes->get();
+        const auto& healths = healthRes->get();
+        for (auto entity : _entityIndex.get(category)) {
+            if (types.has(entity) && healths.has(entity) &&
+                types[entity].type == type && healths[entity].currentHealth > 0) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    float LevelSystem::frontPlayerX(void) const
+    {
+        auto transformRes = _registry.get<ecs::components::Transform>();
+        if (!transformRes) {
+            return 0.0f;
+        }
+
+        const auto& transforms = transformRes->get();
+        float maxX = 0.0f;
+        for (auto entity : _entityIndex.get(EntityCategory::Player)) {
+            if (transforms.has(entity) && transforms[entity].position.x > maxX) {
+                maxX = transforms[entity].position.x;
+            }
+        }
+        return maxX;
+    }
+
     void LevelSystem::spawnEntityForRoom(uint32_t roomId, const ecs::Entity& entity)
     {
         auto room = _roomSystem.getRoom(roomId);
@@ -327,17 +305,10 @@ namespace rtp::server {
             return;
         }
 
-        const auto players = room->getPlayers();
-        if (players.empty()) {
+        if (room->getCurrentPlayerCount() == 0) {
             return;
         }
 
-        std::vector<uint32_t> sessions;
-        sessions.reserve(players.size());
-        for (const auto& player : players) {
-            sessions.push_back(player->getId());
-        }
-
         auto transformRes = _registry.get<ecs::components::Transform>();
         auto typeRes = _registry.get<ecs::components::EntityType>();
         auto netRes = _registry.get<ecs::components::NetworkId>();
@@ -367,7 +338,6 @@ namespace rtp::server {
             sizeY = box.height;
         }
 
-        net::Packet packet(net::OpCode::EntitySpawn);
         net::EntitySpawnPayload payload = {
             net.id,
             static_cast<uint8_t>(type.type),
@@ -376,8 +346,7 @@ namespace rtp::server {
             sizeX,
             sizeY
         };
-        packet << payload;
-        _networkSync.sendPacketToSessions(sessions, packet, net::NetworkMode::TCP);
+        room->queueEntitySpawn(payload);
     }
 
     const LevelData* LevelSystem::getLevelData(uint32_t roomId) const
@@ -386,7 +355,7 @@ namespace rtp::server {
         if (it == _activeLevels.end()) {
             return nullptr;
         }
-        return &it->second.data;
+        return it->second.data.get();
     }
 
 }  // namespace rtp::server
@@ -6,6 +6,7 @@
  */
 
 #include "Systems/MovementSystem.hpp"
+#include "RType/Game/PlayerMovement.hpp"
 
 namespace rtp::server
 {
@@ -42,22 +43,11 @@ namespace rtp::server
             ecs::components::EntityType
         >();
 
-        constexpr float kWindowWidth = 1280.0f;
-        constexpr float kWindowHeight = 720.0f;
-
         for (auto&& [tf, box, type] : playerView) {
             if (type.type != net::EntityType::Player) {
                 continue;
             }
-
-            if (tf.position.x < 0.0f) tf.position.x = 0.0f;
-            if (tf.position.y < 0.0f) tf.position.y = 0.0f;
-
-            const float maxX = kWindowWidth - box.width;
-            const float maxY = kWindowHeight - box.height;
-
-            if (tf.position.x > maxX) tf.position.x = maxX;
-            if (tf.position.y > maxY) tf.position.y = maxY;
+            game::clampToArena(tf.position, box.width, box.height);
         }
     }
 } // namespace rtp::server
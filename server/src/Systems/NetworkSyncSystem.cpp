@@ -31,50 +31,109 @@ namespace rtp::server
     void NetworkSyncSystem::bindSessionToEntity(uint32_t sessionId,
                                                 ecs::Entity entity)
     {
+        unbindSession(sessionId);
+        auto previous = _entityToSession.find(ecs::components::NetworkId::of(entity));
+        if (previous != _entityToSession.end()) {
+            _sessionToEntity.erase(previous->second);
+        }
         _sessionToEntity[sessionId] = entity;
+        _entityToSession[ecs::components::NetworkId::of(entity)] = sessionId;
     }
 
     void NetworkSyncSystem::unbindSession(uint32_t sessionId)
     {
-        _sessionToEntity.erase(sessionId);
+        auto it = _sessionToEntity.find(sessionId);
+        if (it == _sessionToEntity.end()) {
+            return;
+        }
+        _entityToSession.erase(ecs::components::NetworkId::of(it->second));
+        _sessionToEntity.erase(it);
+    }
+
+    ecs::Entity NetworkSyncSystem::getEntityOfSession(uint32_t sessionId) const
+    {
+        auto it = _sessionToEntity.find(sessionId);
+        return it != _sessionToEntity.end() ? it->second : ecs::NullEntity;
+    }
+
+    std::optional<uint32_t> NetworkSyncSystem::getSessionOfEntity(uint32_t entityId) const
+    {
+        auto it = _entityToSession.find(entityId);
+        if (it == _entityToSession.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    ecs::Entity NetworkSyncSystem::findEntityByNetId(uint32_t netId) const
+    {
+        auto netsRes = _registry.get<ecs::components::NetworkId>();
+        if (!netsRes) {
+            return ecs::NullEntity;
+        }
+        // The registry knows the current generation of the index, the
+        // NetworkId check rejects IDs of an older entity at that index
+        const ecs::Entity entity = _registry.entityAt(ecs::components::NetworkId::indexOf(netId));
+        auto &nets = netsRes->get();
+        if (!nets.has(entity) || nets[entity].id != netId) {
+            return ecs::NullEntity;
+        }
+        return entity;
     }
 
     void NetworkSyncSystem::handleInput(uint32_t sessionId,
                                         const net::Packet &packet)
     {
-        net::InputPayload payload;
+        using Input = ecs::components::server::InputComponent;
+
         net::Packet tempPacket = packet;
-        tempPacket >> payload;
-        log::info("InputTick: session={} mask={}", sessionId,
-                  (int)payload.inputMask);
-        if (_sessionToEntity.find(sessionId) == _sessionToEntity.end()) {
+        tempPacket >> _inputBatch;
+        if (_inputBatch.empty() || _sessionToEntity.find(sessionId) == _sessionToEntity.end()) {
             return;
         }
 
         ecs::Entity entity = _sessionToEntity[sessionId];
 
-        auto inputsRes =
-            _registry.get<ecs::components::server::InputComponent>();
-        if (inputsRes) {
-            auto &inputs = inputsRes->get();
-            if (inputs.has(entity)) {
-                inputs[entity].lastMask = inputs[entity].mask;
-                inputs[entity].mask = payload.inputMask;
-                return;
-            }
+        auto inputsRes = _registry.get<Input>();
+        if (!inputsRes || !inputsRes->get().has(entity)) {
+            Input inputData{};
+            inputData.mask = _inputBatch.back().inputMask;
+            _registry.add<Input>(entity, inputData);
+            return;
         }
 
-        ecs::components::server::InputComponent inputData{};
-        inputData.mask = payload.inputMask;
-        _registry.add<ecs::components::server::InputComponent>(entity,
-                                                               inputData);
+        auto &input = inputsRes->get()[entity];
+        for (const auto &entry : _inputBatch) {
+            if (entry.sequence == 0)
+                input.mask = entry.inputMask;
+            else
+                input.pending.push({entry.sequence, entry.inputMask});
+        }
+    }
+
+    net::InputAckPayload NetworkSyncSystem::getInputAck(uint32_t sessionId) const
+    {
+        auto it = _sessionToEntity.find(sessionId);
+        if (it == _sessionToEntity.end())
+            return {0, 0};
+
+        auto inputsRes = _registry.get<ecs::components::server::InputComponent>();
+        auto netIdsRes = _registry.get<ecs::components::NetworkId>();
+        if (!inputsRes || !netIdsRes)
+            return {0, 0};
+
+        auto &inputs = inputsRes->get();
+        auto &netIds = netIdsRes->get();
+        if (!inputs.has(it->second) || !netIds.has(it->second))
+            return {0, 0};
+        return {netIds[it->second].id, inputs[it->second].lastInputSeq};
     }
 
     void NetworkSyncSystem::handleDisconnect(uint32_t sessionId)
     {
         if (_sessionToEntity.find(sessionId) != _sessionToEntity.end()) {
             ecs::Entity entity = _sessionToEntity[sessionId];
-            _sessionToEntity.erase(sessionId);
+            unbindSession(sessionId);
             log::info("Destroyed entity {} for disconnected session {}",
                       entity.index(), sessionId);
         }
@@ -96,14 +155,13 @@ namespace rtp::server
                                                const net::Packet &packet,
                                                net::NetworkMode mode)
     {
-        for (const auto &[sessionId, entity] : _sessionToEntity) {
-            if (entity.index() == entityId) {
-                log::info("sendPacketToEntity: sending packet to session {} "
-                          "for entity {}",
-                          sessionId, entityId);
-                _network.sendPacket(sessionId, packet, mode);
-                return;
-            }
+        auto it = _entityToSession.find(entityId);
+        if (it != _entityToSession.end()) {
+            log::debug("sendPacketToEntity: sending packet to session {} "
+                       "for entity {}",
+                       it->second, entityId);
+            _network.sendPacket(it->second, packet, mode);
+            return;
         }
         log::warning("sendPacketToEntity: no session bound to entity {}",
                      entityId);
@@ -124,4 +182,43 @@ namespace rtp::server
             _network.sendPacket(sessionId, packet, mode);
         }
     }
+
+    void NetworkSyncSystem::sendEntitySpawnBatches(
+        const std::vector<uint32_t> &sessions,
+        std::span<const net::EntitySpawnPayload> spawns)
+    {
+        sendBatches(sessions, net::OpCode::EntitySpawnBatch, spawns);
+    }
+
+    void NetworkSyncSystem::sendEntityDeathBatches(
+        const std::vector<uint32_t> &sessions,
+        std::span<const net::EntityDeathPayload> deaths)
+    {
+        sendBatches(sessions, net::OpCode::EntityDeathBatch, deaths);
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    template <typename Payload>
+    void NetworkSyncSystem::sendBatches(const std::vector<uint32_t> &sessions,
+                                        net::OpCode opCode,
+                                        std::span<const Payload> payloads)
+    {
+        if (sessions.empty()) {
+            return;
+        }
+        while (!payloads.empty()) {
+            const auto chunk = payloads.first(
+                std::min<size_t>(payloads.size(), net::ENTITY_BATCH_SIZE));
+            net::Packet packet(opCode);
+            packet << static_cast<uint32_t>(chunk.size());
+            for (const auto &payload : chunk) {
+                packet << payload;
+            }
+            sendPacketToSessions(sessions, packet, net::NetworkMode::ReliableUDP);
+            payloads = payloads.subspan(chunk.size());
+        }
+    }
 }
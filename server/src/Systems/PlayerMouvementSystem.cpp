@@ -8,6 +8,7 @@
  */
 
 #include "Systems/PlayerMouvementSystem.hpp"
+#include "RType/Game/PlayerMovement.hpp"
 
 namespace rtp::server
 {
@@ -22,7 +23,6 @@ namespace rtp::server
 
     void PlayerMouvementSystem::update(float dt)
     {
-        (void)dt;
         auto view =
             _registry.zipView<ecs::components::Transform,
                               ecs::components::Velocity,
@@ -42,40 +42,33 @@ namespace rtp::server
                 }
             }
 
-            const float finalSpeed = speed.baseSpeed * speed.multiplier;
+            const float topSpeed = speed.baseSpeed * speed.multiplier;
 
-            float dx = 0.f, dy = 0.f;
-            using Bits =
-                ecs::components::server::InputComponent::InputBits;
-
-            if (input.mask & Bits::MoveUp)
-                dy -= 1.f;
-            if (input.mask & Bits::MoveDown)
-                dy += 1.f;
-            if (input.mask & Bits::MoveLeft)
-                dx -= 1.f;
-            if (input.mask & Bits::MoveRight)
-                dx += 1.f;
-
-            const float len = std::sqrt(dx * dx + dy * dy);
-            if (len > 0.f) {
-                dx /= len;
-                dy /= len;
+            // Behind: each input but the last is simulated as a whole step here,
+            // the way the client predicted it, and MovementSystem integrates the last
+            for (size_t due = input.pending.due(); due > 1; --due) {
+                consumeInput(input);
+                game::PlayerMotion motion{tf.position, vel.direction};
+                game::stepPlayer(motion, input.mask, topSpeed, dt);
+                tf.position = motion.position;
+                vel.direction = motion.velocity;
             }
+            consumeInput(input);
+            game::steerPlayer(vel.direction, input.mask, topSpeed, dt);
+        }
+    }
 
-            const float targetX = dx * finalSpeed;
-            const float targetY = dy * finalSpeed;
-
-            constexpr float accel = 8.0f;
-            constexpr float decel = 10.0f;
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
 
-            if (dx != 0.f || dy != 0.f) {
-                vel.direction.x += (targetX - vel.direction.x) * accel * dt;
-                vel.direction.y += (targetY - vel.direction.y) * accel * dt;
-            } else {
-                vel.direction.x += (0.0f - vel.direction.x) * decel * dt;
-                vel.direction.y += (0.0f - vel.direction.y) * decel * dt;
-            }
-        }
+    void PlayerMouvementSystem::consumeInput(
+        ecs::components::server::InputComponent &input)
+    {
+        game::InputQueue::Input next;
+        if (!input.pending.pop(next))
+            return;
+        input.mask = next.mask;
+        input.lastInputSeq = next.sequence;
     }
 } // namespace rtp::server
@@ -18,9 +18,10 @@
 #include <cmath>
 
 #include <algorithm>
+#include <limits>
+#include <random>
 #include <tuple>
 #include <vector>
-#include <cstdlib>
 
 namespace rtp::server
 {
@@ -48,9 +49,12 @@ namespace rtp::server
     //////////////////////////////////////////////////////////////////////////
 
     PlayerShootSystem::PlayerShootSystem(ecs::Registry& registry,
+                                         EntityIndex& entityIndex,
+                                         ProjectilePool& projectilePool,
                                          RoomSystem& roomSystem,
-                                         NetworkSyncSystem& networkSync)
-        : _registry(registry), _roomSystem(roomSystem), _networkSync(networkSync)
+                                         NetworkSyncSystem& networkSync,
+                                         std::mt19937& rng)
+        : _registry(registry), _entityIndex(entityIndex), _projectilePool(projectilePool), _roomSystem(roomSystem), _networkSync(networkSync), _rng(rng)
     {
     }
 
@@ -74,21 +78,15 @@ namespace rtp::server
             if (!room) {
                 return;
             }
-            const auto playersInRoom = room->getPlayers();
-            for (const auto &player : playersInRoom) {
-                if (!player) {
-                    continue;
-                }
-                if (player->getEntityId() != static_cast<uint32_t>(owner.index())) {
-                    continue;
-                }
-                player->addScore(delta);
-                net::Packet packet(net::OpCode::ScoreUpdate);
-                net::ScoreUpdatePayload payload{player->getScore()};
-                packet << payload;
-                _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::TCP);
-                break;
+            const auto player = room->getPlayerByEntity(ecs::components::NetworkId::of(owner));
+            if (!player) {
+                return;
             }
+            player->addScore(delta);
+            net::Packet packet(net::OpCode::ScoreUpdate);
+            net::ScoreUpdatePayload payload{player->getScore()};
+            packet << payload;
+            _networkSync.sendPacketToSession(player->getId(), packet, net::NetworkMode::ReliableUDP);
         };
 
         constexpr float kChargeMax = 2.0f;
@@ -184,10 +182,9 @@ namespace rtp::server
                         auto *boxes = boxRes ? &boxRes->get() : nullptr;
                         auto room = _roomSystem.getRoom(roomId.id);
                         if (room) {
-                            const auto players = room->getPlayers();
-                            std::vector<uint32_t> sessions;
-                            sessions.reserve(players.size());
-                            for (const auto& p : players) sessions.push_back(p->getId());
+                            // Gather the targets once, then test them against each beam line in a batch
+                            _beamTargets.clear();
+                            _beamBoxes.clear();
                             for (auto target : healths.entities()) {
                                 ecs::Entity t = target;
                                 if (!transforms.has(t) || !types.has(t) || !roomIds.has(t) || !healths.has(t))
@@ -196,29 +193,37 @@ namespace rtp::server
                                     continue;
                                 if (types[t].type == net::EntityType::Player)
                                     continue;
-                                // Only hit entities located in front of player (x greater)
-                                const auto &ttf = transforms[t];
-                                if (ttf.position.x <= tf.position.x)
-                                    continue;
-                                // Y proximity check: support single or double beam offsets
-                                std::vector<float> centers;
-                                centers.push_back(tf.position.y);
-                                if (weapon.beamWasDouble) {
-                                    centers.clear();
-                                    centers.push_back(tf.position.y - 4.0f);
-                                    centers.push_back(tf.position.y + 4.0f);
-                                }
-
                                 float halfH = 8.0f;
                                 if (boxes && boxes->has(t)) {
                                     halfH = (*boxes)[t].height * 0.5f;
                                 }
+                                // Target as a vertical segment at its x
+                                const auto &ttf = transforms[t];
+                                _beamTargets.push_back(t);
+                                _beamBoxes.push(Aabb{ttf.position.x, ttf.position.y - halfH,
+                                                     ttf.position.x, ttf.position.y + halfH});
+                            }
 
+                            // Single or double beam offsets. A line hits targets in front of the
+                            // player (x greater) whose segment comes within 4 units of it.
+                            constexpr float inf = std::numeric_limits<float>::infinity();
+                            const float reach = std::nextafter(4.0f, inf);
+                            const size_t beamCount = weapon.beamWasDouble ? 2 : 1;
+                            const float centers[2] = {
+                                weapon.beamWasDouble ? tf.position.y - 4.0f : tf.position.y,
+                                tf.position.y + 4.0f
+                            };
+                            for (size_t c = 0; c < beamCount; ++c) {
+                                _beamBoxes.overlapMask(Aabb{tf.position.x, centers[c] - reach, inf, centers[c] + reach},
+                                                       _beamHits[c]);
+                            }
+
+                            for (size_t i = 0; i < _beamTargets.size(); ++i) {
+                                const ecs::Entity t = _beamTargets[i];
                                 // For each beam center, if within vertical range apply damage
-                                for (float centerY : centers) {
-                                    if (std::fabs(ttf.position.y - centerY) > halfH + 4.0f)
+                                for (size_t c = 0; c < beamCount; ++c) {
+                                    if (!AabbBatch::isSet(_beamHits[c], i))
                                         continue;
-
                                     // Apply damage for this beam
                                     auto &ht = healths[t];
                                     ht.currentHealth -= weapon.damage;
@@ -227,14 +232,13 @@ namespace rtp::server
                                         const int award = getKillScore(types[t].type);
                                         updatePlayerScore(roomId.id, entity, award);
                                         // 30% chance to drop a power-up (beam kills should drop too)
-                                        const int dropChance = std::rand() % 100;
+                                        const int dropChance = std::uniform_int_distribution<int>(0, 99)(_rng);
                                         if (dropChance < 30) {
                                             // spawn a powerup using this system's debug spawner
                                             spawnDebugPowerup(transforms[t].position, roomId.id, dropChance);
                                         }
 
-                                        // send death packet to players in room
-                                        net::Packet dpacket(net::OpCode::EntityDeath);
+                                        // queue death for the room's end-of-tick batch
                                         net::EntityDeathPayload dp{};
                                         if (auto netRes = _registry.get<ecs::components::NetworkId>()) {
                                             auto &nets = netRes->get();
@@ -242,8 +246,8 @@ namespace rtp::server
                                         }
                                         dp.type = static_cast<uint8_t>(types[t].type);
                                         dp.position = transforms[t].position;
-                                        dpacket << dp;
-                                        _networkSync.sendPacketToSessions(sessions, dpacket, net::NetworkMode::TCP);
+                                        room->queueEntityDeath(dp);
+                                        _entityIndex.untrack(t);
                                         _registry.kill(t);
                                         break; // entity dead, stop processing centers
                                     }
@@ -275,7 +279,7 @@ namespace rtp::server
                             bp1.length = 0.0f;
                             bp1.offsetY = -4.0f;
                             b1 << bp1;
-                            _networkSync.sendPacketToSessions(sessionsForEnd, b1, net::NetworkMode::TCP);
+                            _networkSync.sendPacketToSessions(sessionsForEnd, b1, net::NetworkMode::ReliableUDP);
 
                             net::Packet b2(net::OpCode::BeamState);
                             net::BeamStatePayload bp2{};
@@ -285,7 +289,7 @@ namespace rtp::server
                             bp2.length = 0.0f;
                             bp2.offsetY = 4.0f;
                             b2 << bp2;
-                            _networkSync.sendPacketToSessions(sessionsForEnd, b2, net::NetworkMode::TCP);
+                            _networkSync.sendPacketToSessions(sessionsForEnd, b2, net::NetworkMode::ReliableUDP);
                         } else {
                             net::Packet bpacket(net::OpCode::BeamState);
                             net::BeamStatePayload bp{};
@@ -295,7 +299,7 @@ namespace rtp::server
                             bp.length = 0.0f;
                             bp.offsetY = 0.0f;
                             bpacket << bp;
-                            _networkSync.sendPacketToSessions(sessionsForEnd, bpacket, net::NetworkMode::TCP);
+                            _networkSync.sendPacketToSessions(sessionsForEnd, bpacket, net::NetworkMode::ReliableUDP);
                         }
                     }
                     // reset captured double-fire flag after beam ended
@@ -341,7 +345,7 @@ namespace rtp::server
             // Debug: Spawn powerup on P key
             if ((input.mask & Bits::DebugPowerup) && !(input.lastMask & Bits::DebugPowerup)) {
                 // Spawn a random powerup at player position
-                const int debugRoll = std::rand() % 30;  // 0-29 for all powerup types
+                const int debugRoll = std::uniform_int_distribution<int>(0, 29)(_rng);  // 0-29 for all powerup types
                 Vec2f spawnPos = tf.position;
                 spawnPos.x += 50.0f;  // Spawn slightly ahead of player
                 spawnDebugPowerup(spawnPos, roomId.id, debugRoll);
@@ -395,7 +399,7 @@ namespace rtp::server
                                 bp1.length = visualLength;
                                 bp1.offsetY = -4.0f;
                                 bpacket1 << bp1;
-                                _networkSync.sendPacketToSessions(sessions, bpacket1, net::NetworkMode::TCP);
+                                _networkSync.sendPacketToSessions(sessions, bpacket1, net::NetworkMode::ReliableUDP);
 
                                 net::Packet bpacket2(net::OpCode::BeamState);
                                 net::BeamStatePayload bp2{};
@@ -405,7 +409,7 @@ namespace rtp::server
                                 bp2.length = visualLength;
                                 bp2.offsetY = 4.0f;
                                 bpacket2 << bp2;
-                                _networkSync.sendPacketToSessions(sessions, bpacket2, net::NetworkMode::TCP);
+                                _networkSync.sendPacketToSessions(sessions, bpacket2, net::NetworkMode::ReliableUDP);
                             } else {
                                 net::Packet bpacket(net::OpCode::BeamState);
                                 net::BeamStatePayload bp{};
@@ -415,7 +419,7 @@ namespace rtp::server
                                 bp.length = visualLength; // visual length in pixels (approx)
                                 bp.offsetY = 0.0f;
                                 bpacket << bp;
-                                _networkSync.sendPacketToSessions(sessions, bpacket, net::NetworkMode::TCP);
+                                _networkSync.sendPacketToSessions(sessions, bpacket, net::NetworkMode::ReliableUDP);
                             }
                         }
                     }
@@ -499,15 +503,6 @@ namespace rtp::server
         const ecs::components::RoomId& roomId,
         bool doubleFire)
     {
-        // Spawn first bullet
-        auto entityRes = _registry.spawn();
-        if (!entityRes) {
-            log::error("Failed to spawn bullet entity: {}", entityRes.error().message());
-            return;
-        }
-
-        ecs::Entity bullet = entityRes.value();
-
         const float x = tf.position.x + _spawnOffsetX;
         float y = tf.position.y;
         
@@ -516,16 +511,6 @@ namespace rtp::server
             y -= 4.0f; // Offset first bullet up by 4 pixels
         }
 
-        _registry.add<ecs::components::Transform>(
-            bullet,
-            ecs::components::Transform{ {x, y}, 0.f, {1.f, 1.f} }
-        );
-
-        _registry.add<ecs::components::Velocity>(
-            bullet,
-            ecs::components::Velocity{ {_bulletSpeed, 0.f}, 0.f }
-        );
-
         // Use owner's weapon damage and size if available
         int damageAmount = 25;
         float boxW = 8.0f;
@@ -542,30 +527,23 @@ namespace rtp::server
             }
         }
 
-        _registry.add<ecs::components::BoundingBox>(
-            bullet,
-            ecs::components::BoundingBox{ boxW, boxH }
-        );
-
-        _registry.add<ecs::components::Damage>(
-            bullet,
-            ecs::components::Damage{ damageAmount, owner }
-        );
-
-        _registry.add<ecs::components::NetworkId>(
-            bullet,
-            ecs::components::NetworkId{ static_cast<uint32_t>(bullet.index()) }
-        );
-
-        _registry.add<ecs::components::EntityType>(
-            bullet,
-            ecs::components::EntityType{ net::EntityType::Bullet }
-        );
+        // Spawn first bullet
+        auto entityRes = _projectilePool.acquire(ProjectileSpec{
+            net::EntityType::Bullet,
+            {x, y},
+            ecs::components::Velocity{ {_bulletSpeed, 0.f}, 0.f },
+            boxW,
+            boxH,
+            damageAmount,
+            owner,
+            roomId.id
+        });
+        if (!entityRes) {
+            log::error("Failed to spawn bullet entity: {}", entityRes.error().message());
+            return;
+        }
 
-        _registry.add<ecs::components::RoomId>(
-            bullet,
-            ecs::components::RoomId{ roomId.id }
-        );
+        ecs::Entity bullet = entityRes.value();
 
         // Attach boomerang component for charged bullet if applicable
         if (auto weaponRes = _registry.get<ecs::components::SimpleWeapon>()) {
@@ -621,14 +599,6 @@ namespace rtp::server
         if (room->getState() != Room::State::InGame)
             return;
 
-        const auto players = room->getPlayers();
-        std::vector<uint32_t> sessions;
-        sessions.reserve(players.size());
-        for (const auto& player : players) {
-            sessions.push_back(player->getId());
-        }
-
-        net::Packet packet(net::OpCode::EntitySpawn);
         uint8_t weaponKind = 0;
         if (auto weaponRes = _registry.get<ecs::components::SimpleWeapon>()) {
             auto &weapons = weaponRes->get();
@@ -638,7 +608,7 @@ namespace rtp::server
         }
 
         net::EntitySpawnPayload payload = {
-            static_cast<uint32_t>(bullet.index()),
+            ecs::components::NetworkId::of(bullet),
             static_cast<uint8_t>(net::EntityType::Bullet),
             x,
             y,
@@ -646,57 +616,29 @@ namespace rtp::server
             0.0f,
             weaponKind
         };
-        packet << payload;
-        _networkSync.sendPacketToSessions(sessions, packet, net::NetworkMode::TCP);
+        room->queueEntitySpawn(payload);
         
         // Spawn second bullet if double fire is active
         if (doubleFire) {
-            auto entityRes2 = _registry.spawn();
+            const float y2 = tf.position.y + 4.0f; // Offset second bullet down by 4 pixels
+
+            // second bullet uses same damage/size as first
+            auto entityRes2 = _projectilePool.acquire(ProjectileSpec{
+                net::EntityType::Bullet,
+                {x, y2},
+                ecs::components::Velocity{ {_bulletSpeed, 0.f}, 0.f },
+                boxW,
+                boxH,
+                damageAmount,
+                owner,
+                roomId.id
+            });
             if (!entityRes2) {
                 log::error("Failed to spawn second bullet entity: {}", entityRes2.error().message());
                 return;
             }
 
             ecs::Entity bullet2 = entityRes2.value();
-            const float y2 = tf.position.y + 4.0f; // Offset second bullet down by 4 pixels
-
-            _registry.add<ecs::components::Transform>(
-                bullet2,
-                ecs::components::Transform{ {x, y2}, 0.f, {1.f, 1.f} }
-            );
-
-            _registry.add<ecs::components::Velocity>(
-                bullet2,
-                ecs::components::Velocity{ {_bulletSpeed, 0.f}, 0.f }
-            );
-
-            // second bullet uses same damage/size as first
-            _registry.add<ecs::components::BoundingBox>(
-                bullet2,
-                ecs::components::BoundingBox{ boxW, boxH }
-            );
-
-            _registry.add<ecs::components::Damage>(
-                bullet2,
-                ecs::components::Damage{ damageAmount, owner }
-            );
-
-            _registry.add<ecs::components::NetworkId>(
-                bullet2,
-                ecs::components::NetworkId{ static_cast<uint32_t>(bullet2.index()) }
-            );
-
-            _registry.add<ecs::components::EntityType>(
-                bullet2,
-                ecs::components::EntityType{ net::EntityType::Bullet }
-            );
-
-            _registry.add<ecs::components::RoomId>(
-                bullet2,
-                ecs::components::RoomId{ roomId.id }
-            );
-
-                
 
             // Attach boomerang for second bullet if owner's weapon is boomerang
             if (auto weaponRes2 = _registry.get<ecs::components::SimpleWeapon>()) {
@@ -722,7 +664,6 @@ namespace rtp::server
                 }
             }
 
-            net::Packet packet2(net::OpCode::EntitySpawn);
             uint8_t weaponKind2 = 0;
             if (auto weaponRes2 = _registry.get<ecs::components::SimpleWeapon>()) {
                 auto &weapons = weaponRes2->get();
@@ -732,7 +673,7 @@ namespace rtp::server
             }
 
             net::EntitySpawnPayload payload2 = {
-                static_cast<uint32_t>(bullet2.index()),
+                ecs::components::NetworkId::of(bullet2),
                 static_cast<uint8_t>(net::EntityType::Bullet),
                 x,
                 y2,
@@ -740,8 +681,7 @@ namespace rtp::server
                 0.0f,
                 weaponKind2
             };
-            packet2 << payload2;
-            _networkSync.sendPacketToSessions(sessions, packet2, net::NetworkMode::TCP);
+            room->queueEntitySpawn(payload2);
         }
     }
 
@@ -752,14 +692,6 @@ namespace rtp::server
         float chargeRatio,
         bool doubleFire)
     {
-        auto entityRes = _registry.spawn();
-        if (!entityRes) {
-            log::error("Failed to spawn charged bullet entity: {}", entityRes.error().message());
-            return;
-        }
-
-        ecs::Entity bullet = entityRes.value();
-
         const float x = tf.position.x + _spawnOffsetX;
         float y = tf.position.y;
         
@@ -807,40 +739,22 @@ namespace rtp::server
 
         int damage = baseDamage * damageMultiplier;
 
-        _registry.add<ecs::components::Transform>(
-            bullet,
-            ecs::components::Transform{ {x, y}, 0.f, {1.f, 1.f} }
-        );
-
-        _registry.add<ecs::components::Velocity>(
-            bullet,
-            ecs::components::Velocity{ {_chargedBulletSpeed, 0.f}, 0.f }
-        );
-
-        _registry.add<ecs::components::BoundingBox>(
-            bullet,
-            ecs::components::BoundingBox{ sizeX, sizeY }
-        );
-
-        _registry.add<ecs::components::Damage>(
-            bullet,
-            ecs::components::Damage{ damage, owner }
-        );
-
-        _registry.add<ecs::components::NetworkId>(
-            bullet,
-            ecs::components::NetworkId{ static_cast<uint32_t>(bullet.index()) }
-        );
-
-        _registry.add<ecs::components::EntityType>(
-            bullet,
-            ecs::components::EntityType{ net::EntityType::ChargedBullet }
-        );
-
-        _registry.add<ecs::components::RoomId>(
-            bullet,
-            ecs::components::RoomId{ roomId.id }
-        );
+        auto entityRes = _projectilePool.acquire(ProjectileSpec{
+            net::EntityType::ChargedBullet,
+            {x, y},
+            ecs::components::Velocity{ {_chargedBulletSpeed, 0.f}, 0.f },
+            sizeX,
+            sizeY,
+            damage,
+            owner,
+            roomId.id
+        });
+        if (!entityRes) {
+            log::error("Failed to spawn charged bullet entity: {}", entityRes.error().message());
+            return;
+        }
+
+        ecs::Entity bullet = entityRes.value();
 
         // Attach boomerang component for charged bullet if applicable
         if (auto weaponRes = _registry.get<ecs::components::SimpleWeapon>()) {
@@ -872,16 +786,8 @@ namespace rtp::server
         if (room->getState() != Room::State::InGame)
             return;
 
-        const auto players = room->getPlayers();
-        std::vector<uint32_t> sessions;
-        sessions.reserve(players.size());
-        for (const auto& player : players) {
-            sessions.push_back(player->getId());
-        }
-
-        net::Packet packet(net::OpCode::EntitySpawn);
         net::EntitySpawnPayload payload = {
-            static_cast<uint32_t>(bullet.index()),
+            ecs::components::NetworkId::of(bullet),
             static_cast<uint8_t>(net::EntityType::ChargedBullet),
             x,
             y,
@@ -895,58 +801,31 @@ namespace rtp::server
                 payload.weaponKind = static_cast<uint8_t>(weapons[owner].kind);
             }
         }
-        packet << payload;
-        _networkSync.sendPacketToSessions(sessions, packet, net::NetworkMode::TCP);
+        room->queueEntitySpawn(payload);
         
         // Spawn second charged bullet if double fire is active
         if (doubleFire) {
-            auto entityRes2 = _registry.spawn();
+            const float y2 = tf.position.y + 4.0f; // Offset second bullet down by 4 pixels
+
+            auto entityRes2 = _projectilePool.acquire(ProjectileSpec{
+                net::EntityType::ChargedBullet,
+                {x, y2},
+                ecs::components::Velocity{ {_chargedBulletSpeed, 0.f}, 0.f },
+                sizeX,
+                sizeY,
+                damage,
+                owner,
+                roomId.id
+            });
             if (!entityRes2) {
                 log::error("Failed to spawn second charged bullet entity: {}", entityRes2.error().message());
                 return;
             }
 
             ecs::Entity bullet2 = entityRes2.value();
-            const float y2 = tf.position.y + 4.0f; // Offset second bullet down by 4 pixels
 
-            _registry.add<ecs::components::Transform>(
-                bullet2,
-                ecs::components::Transform{ {x, y2}, 0.f, {1.f, 1.f} }
-            );
-
-            _registry.add<ecs::components::Velocity>(
-                bullet2,
-                ecs::components::Velocity{ {_chargedBulletSpeed, 0.f}, 0.f }
-            );
-
-            _registry.add<ecs::components::BoundingBox>(
-                bullet2,
-                ecs::components::BoundingBox{ sizeX, sizeY }
-            );
-
-            _registry.add<ecs::components::Damage>(
-                bullet2,
-                ecs::components::Damage{ damage, owner }
-            );
-
-            _registry.add<ecs::components::NetworkId>(
-                bullet2,
-                ecs::components::NetworkId{ static_cast<uint32_t>(bullet2.index()) }
-            );
-
-            _registry.add<ecs::components::EntityType>(
-                bullet2,
-                ecs::components::EntityType{ net::EntityType::ChargedBullet }
-            );
-
-            _registry.add<ecs::components::RoomId>(
-                bullet2,
-                ecs::components::RoomId{ roomId.id }
-            );
-
-            net::Packet packet2(net::OpCode::EntitySpawn);
             net::EntitySpawnPayload payload2 = {
-                static_cast<uint32_t>(bullet2.index()),
+                ecs::components::NetworkId::of(bullet2),
                 static_cast<uint8_t>(net::EntityType::ChargedBullet),
                 x,
                 y2,
@@ -960,8 +839,7 @@ namespace rtp::server
                     payload2.weaponKind = static_cast<uint8_t>(weapons[owner].kind);
                 }
             }
-            packet2 << payload2;
-            _networkSync.sendPacketToSessions(sessions, packet2, net::NetworkMode::TCP);
+            room->queueEntitySpawn(payload2);
         }
     }
 
@@ -976,7 +854,7 @@ namespace rtp::server
             ? (ammo.reloadCooldown - ammo.reloadTimer)
             : 0.0f;
         packet << payload;
-        _networkSync.sendPacketToEntity(netId, packet, net::NetworkMode::TCP);
+        _networkSync.sendPacketToEntity(netId, packet, net::NetworkMode::ReliableUDP);
     }
 
     void PlayerShootSystem::spawnDebugPowerup(const Vec2f& position, uint32_t roomId, int dropRoll)
@@ -1011,27 +889,19 @@ namespace rtp::server
 
         _registry.add<ecs::components::EntityType>(e, ecs::components::EntityType{entityType});
         _registry.add<ecs::components::Powerup>(e, ecs::components::Powerup{powerupType, 1.0f, 0.0f});
-        _registry.add<ecs::components::NetworkId>(e, ecs::components::NetworkId{static_cast<uint32_t>(e.index())});
+        _registry.add<ecs::components::NetworkId>(e, ecs::components::NetworkId{ecs::components::NetworkId::of(e)});
+        _entityIndex.track(e, entityType);
 
         auto room = _roomSystem.getRoom(roomId);
         if (!room)
             return;
 
-        const auto players = room->getPlayers();
-        std::vector<uint32_t> sessions;
-        sessions.reserve(players.size());
-        for (const auto& player : players) {
-            sessions.push_back(player->getId());
-        }
-
-        net::Packet packet(net::OpCode::EntitySpawn);
         net::EntitySpawnPayload payload = {
-            static_cast<uint32_t>(e.index()),
+            ecs::components::NetworkId::of(e),
             static_cast<uint8_t>(entityType),
             position.x,
             position.y
         };
-        packet << payload;
-        _networkSync.sendPacketToSessions(sessions, packet, net::NetworkMode::TCP);
+        room->queueEntitySpawn(payload);
     }
 } // namespace rtp::server
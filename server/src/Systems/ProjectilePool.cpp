@@ -0,0 +1,106 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** ProjectilePool
+*/
+
+#include "Systems/ProjectilePool.hpp"
+
+namespace rtp::server
+{
+    namespace
+    {
+        template <ecs::Component T>
+        ecs::SparseArray<T> &arrayOf(ecs::Registry &registry)
+        {
+            auto arrayRes = registry.get<T>();
+            if (!arrayRes)
+                throw arrayRes.error();
+            return arrayRes->get();
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    ProjectilePool::ProjectilePool(ecs::Registry &registry, EntityIndex &entityIndex)
+        : _registry(registry)
+        , _entityIndex(entityIndex)
+        , _transforms(arrayOf<ecs::components::Transform>(registry))
+        , _boxes(arrayOf<ecs::components::BoundingBox>(registry))
+        , _damages(arrayOf<ecs::components::Damage>(registry))
+        , _rooms(arrayOf<ecs::components::RoomId>(registry))
+        , _velocities(arrayOf<ecs::components::Velocity>(registry))
+        , _netIds(arrayOf<ecs::components::NetworkId>(registry))
+        , _types(arrayOf<ecs::components::EntityType>(registry))
+        , _homings(arrayOf<ecs::components::Homing>(registry))
+        , _boomerangs(arrayOf<ecs::components::Boomerang>(registry))
+    {
+    }
+
+    std::expected<ecs::Entity, rtp::Error> ProjectilePool::acquire(const ProjectileSpec &spec)
+    {
+        ecs::Entity entity = ecs::NullEntity;
+        while (entity.isNull() && !_parked.empty()) {
+            const ecs::Entity candidate = _parked.front();
+            _parked.pop_front();
+            // Killed while parked otherwise, Transform goes with the entity
+            if (_transforms.has(candidate))
+                entity = candidate;
+        }
+
+        if (entity.isNull()) {
+            auto entityRes = _registry.spawn();
+            if (!entityRes)
+                return std::unexpected{entityRes.error()};
+            entity = entityRes.value();
+        }
+
+        // Overwritten in place when the entity was parked
+        _transforms.emplace(entity, ecs::components::Transform{spec.position, 0.0f, {1.0f, 1.0f}});
+        _boxes.emplace(entity, ecs::components::BoundingBox{spec.width, spec.height});
+        _damages.emplace(entity, ecs::components::Damage{spec.damage, spec.owner});
+        _rooms.emplace(entity, ecs::components::RoomId{spec.roomId});
+
+        // Stripped by release()
+        _velocities.emplace(entity, spec.velocity);
+        _netIds.emplace(entity, ecs::components::NetworkId{ecs::components::NetworkId::of(entity)});
+        _types.emplace(entity, ecs::components::EntityType{spec.type});
+        _entityIndex.track(entity, spec.type);
+        return entity;
+    }
+
+    void ProjectilePool::release(ecs::Entity entity)
+    {
+        _entityIndex.untrack(entity);
+        const bool pooled = _types.has(entity) && isPooled(_types[entity].type);
+        if (!pooled || _parked.size() >= MAX_PARKED) {
+            _registry.kill(entity);
+            return;
+        }
+
+        _types.erase(entity);
+        _netIds.erase(entity);
+        _velocities.erase(entity);
+        _homings.erase(entity);
+        _boomerangs.erase(entity);
+
+        const ecs::Entity renewed = _registry.renew(entity, _transforms, _boxes, _damages, _rooms);
+        if (!renewed.isNull())
+            _parked.push_back(renewed);
+    }
+
+    size_t ProjectilePool::parked(void) const
+    {
+        return _parked.size();
+    }
+
+    bool ProjectilePool::isPooled(net::EntityType type)
+    {
+        const EntityCategory category = categoryOf(type);
+        return category == EntityCategory::PlayerBullet
+            || category == EntityCategory::EnemyBullet;
+    }
+}
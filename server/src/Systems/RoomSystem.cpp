@@ -10,21 +10,31 @@
  */
 
 #include "Systems/RoomSystem.hpp"
+#include "Game/RoomSimulation.hpp"
 #include "RType/ECS/Components/RoomId.hpp"
 #include "RType/ECS/Components/Transform.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <random>
+
 namespace rtp::server
 {
     //////////////////////////////////////////////////////////////////////////
     // Public API
     //////////////////////////////////////////////////////////////////////////
 
-    RoomSystem::RoomSystem(ServerNetwork &network, ecs::Registry &registry, NetworkSyncSystem& networkSync)
+    RoomSystem::RoomSystem(ServerNetwork &network)
         : _network(network)
-        , _registry(registry)
-        , _networkSync(networkSync)
     {
-        auto lobby = std::make_shared<Room>(_registry, _networkSync, _nextRoomId++, "Global Lobby", 9999,
+        _levelCache.registerLevel(1, "config/levels/level_01.json");
+        _levelCache.registerLevel(2, "config/levels/level_02.json");
+        _levelCache.registerLevel(3, "config/levels/level_03.json");
+        _levelCache.registerLevel(4, "config/levels/level_04.json");
+
+        const uint32_t lobbyId = _nextRoomId++;
+        auto lobby = std::make_shared<Room>(std::make_unique<RoomSimulation>(_network, *this, roomSeed(lobbyId)),
+                                            lobbyId, "Global Lobby", 9999,
                                             0, 0, Room::RoomType::Lobby, 0, 0, 0, 0);
         _rooms[lobby->getId()] = lobby;
         _lobbyId = lobby->getId();
@@ -36,10 +46,95 @@ namespace rtp::server
         launchReadyRooms(dt);
         for (auto &[roomId, roomPtr] : _rooms) {
             // (void)roomId;
-            roomPtr->update(0, dt);
+            roomPtr->update(dt);
         }
     };
 
+    RoomSystem::~RoomSystem() = default;
+
+    void RoomSystem::simulate(float dt, thread::ThreadPool *pool)
+    {
+        {
+            std::shared_lock lock(_mutex);
+            for (auto &[roomId, roomPtr] : _rooms) {
+                if (roomPtr->isSimulated())
+                    _simulated.push_back(roomPtr);
+            }
+        }
+        _simulatedCount = _simulated.size();
+
+        if (pool == nullptr || _simulated.size() < 2) {
+            for (auto &roomPtr : _simulated)
+                roomPtr->getSimulation().update(dt, _profiler, roomPtr->getId());
+            _simulated.clear();
+            return;
+        }
+
+        for (auto &roomPtr : _simulated) {
+            auto task = pool->enqueue([room = roomPtr.get(), dt, profiler = _profiler]() {
+                room->getSimulation().update(dt, profiler, room->getId());
+            });
+            if (task)
+                _pending.push_back(std::move(*task));
+            else
+                roomPtr->getSimulation().update(dt, _profiler, roomPtr->getId());
+        }
+
+        // Barrier: no room may still be running when snapshots go out
+        std::exception_ptr error;
+        for (auto &future : _pending) {
+            try {
+                future.get();
+            } catch (...) {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+        _pending.clear();
+        _simulated.clear();
+        if (error)
+            std::rethrow_exception(error);
+    }
+
+    size_t RoomSystem::getSimulatedRoomCount(void) const
+    {
+        return _simulatedCount;
+    }
+
+    void RoomSystem::broadcastSnapshots(uint32_t serverTick)
+    {
+        if (serverTick % _snapshotInterval != 0)
+            return;
+        for (auto &[roomId, roomPtr] : _rooms) {
+            roomPtr->broadcastRoomState(serverTick);
+        }
+    }
+
+    void RoomSystem::setSnapshotInterval(uint32_t ticks)
+    {
+        _snapshotInterval = std::max<uint32_t>(ticks, 1);
+    }
+
+    void RoomSystem::setRandomSeed(uint32_t seed)
+    {
+        std::unique_lock lock(_mutex);
+        _randomSeed = seed;
+        for (auto &[roomId, roomPtr] : _rooms)
+            roomPtr->getSimulation().reseed(roomSeed(roomId));
+    }
+
+    void RoomSystem::setProfiler(TickProfiler *profiler)
+    {
+        _profiler = profiler;
+    }
+
+    void RoomSystem::flushEntityEvents(void)
+    {
+        for (auto &[roomId, roomPtr] : _rooms) {
+            roomPtr->flushEntityEvents();
+        }
+    }
+
     uint32_t RoomSystem::createRoom(uint32_t sessionId,
                                     const std::string &roomName,
                                     uint8_t maxPlayers, float difficulty,
@@ -48,13 +143,20 @@ namespace rtp::server
                                     uint32_t durationMinutes)
     {
         uint32_t newId = 0;
+        {
+            std::unique_lock lock(_mutex);
+            newId = _nextRoomId++;
+        }
 
-        newId = _nextRoomId++;
-
-        auto room = std::make_shared<Room>(_registry, _networkSync, newId, roomName, maxPlayers,
+        // Built unlocked, the simulation setup must not stall room lookups
+        auto room = std::make_shared<Room>(std::make_unique<RoomSimulation>(_network, *this, roomSeed(newId)),
+                                           newId, roomName, maxPlayers,
                                            difficulty, speed, type, sessionId,
                                            levelId, seed, durationMinutes);
-        _rooms.emplace(newId, room);
+        {
+            std::unique_lock lock(_mutex);
+            _rooms.emplace(newId, room);
+        }
 
         log::info("Room '{}' created with ID {} by session {}", roomName, newId,
                   sessionId);
@@ -184,6 +286,8 @@ namespace rtp::server
                 prevIt->second->removePlayer(player->getId(), false);
                 if (prevIt->second->getType() != Room::RoomType::Lobby &&
                     prevIt->second->getCurrentPlayerCount() == 0) {
+                    if (_profiler != nullptr)
+                        _profiler->dropRoom(previousRoomId);
                     _rooms.erase(prevIt);
                 }
             }
@@ -211,16 +315,13 @@ namespace rtp::server
             if (roomIt != _rooms.end()) {
                 room = roomIt->second;
                 if (room) {
-                    for (const auto& roomPlayer : room->getPlayers()) {
-                        if (roomPlayer && roomPlayer->getId() == sessionId) {
-                            player = roomPlayer;
-                            break;
-                        }
-                    }
+                    player = room->getPlayer(sessionId);
                 }
                 roomIt->second->removePlayer(sessionId, true);
                 if (roomIt->second->getType() != Room::RoomType::Lobby &&
                     roomIt->second->getCurrentPlayerCount() == 0) {
+                    if (_profiler != nullptr)
+                        _profiler->dropRoom(roomId);
                     _rooms.erase(roomIt);
                 }
             }
@@ -233,7 +334,7 @@ namespace rtp::server
 
     void RoomSystem::listAllRooms(uint32_t sessionId)
     {
-        std::lock_guard lock(_mutex);
+        std::shared_lock lock(_mutex);
         log::info("Handle List Rooms request from Session ID {}", sessionId);
 
         net::Packet responsePacket(net::OpCode::RoomList);
@@ -358,7 +459,7 @@ namespace rtp::server
 
     std::shared_ptr<Room> RoomSystem::getRoom(uint32_t roomId)
     {
-        std::lock_guard lock(_mutex);
+        std::shared_lock lock(_mutex);
 
         auto it = _rooms.find(roomId);
         if (it != _rooms.end()) {
@@ -367,72 +468,84 @@ namespace rtp::server
         return nullptr;
     }
 
+    std::shared_ptr<Room> RoomSystem::getRoomOfSession(uint32_t sessionId)
+    {
+        std::shared_lock lock(_mutex);
+
+        auto it = _playerRoomMap.find(sessionId);
+        if (it == _playerRoomMap.end()) {
+            return nullptr;
+        }
+        auto roomIt = _rooms.find(it->second);
+        return roomIt != _rooms.end() ? roomIt->second : nullptr;
+    }
+
+    LevelCache& RoomSystem::getLevelCache(void)
+    {
+        return _levelCache;
+    }
+
     void RoomSystem::despawnPlayerEntity(const PlayerPtr& player,
                                          const std::shared_ptr<Room>& room)
     {
         if (!player) {
             return;
         }
-
         const uint32_t entityId = player->getEntityId();
-        if (entityId == 0) {
-            _networkSync.unbindSession(player->getId());
+        if (!room) {
+            player->setEntityId(0);
             return;
         }
 
-        // Find the entity by scanning the NetworkId sparse array for matching id
-        // This is necessary because we only store the entity index in Player, not the generation
-        auto netsRes = _registry.get<ecs::components::NetworkId>();
-        if (!netsRes) {
-            _networkSync.unbindSession(player->getId());
+        // The entity lives in the registry of the room the player left
+        ecs::Registry &registry = room->getSimulation().getRegistry();
+        NetworkSyncSystem &networkSync = room->getSimulation().getNetworkSync();
+        if (entityId == 0) {
+            networkSync.unbindSession(player->getId());
             return;
         }
 
-        auto &nets = netsRes->get();
-        ecs::Entity entity = ecs::NullEntity;
-        for (auto e : nets.entities()) {
-            if (nets[e].id == entityId) {
-                entity = e;
-                break;
-            }
-        }
-
+        // Player stores the network ID, the lookup resolves the live entity
+        const ecs::Entity entity = networkSync.findEntityByNetId(entityId);
         if (entity.isNull()) {
-            _networkSync.unbindSession(player->getId());
+            networkSync.unbindSession(player->getId());
             return;
         }
 
-        auto transformsRes = _registry.get<ecs::components::Transform>();
-        auto typesRes = _registry.get<ecs::components::EntityType>();
-        auto roomsRes = _registry.get<ecs::components::RoomId>();
+        auto transformsRes = registry.get<ecs::components::Transform>();
+        auto typesRes = registry.get<ecs::components::EntityType>();
+        auto netsRes = registry.get<ecs::components::NetworkId>();
+        auto roomsRes = registry.get<ecs::components::RoomId>();
 
-        if (transformsRes && typesRes && roomsRes) {
+        if (transformsRes && typesRes && netsRes && roomsRes) {
+            auto &nets = netsRes->get();
             auto &transforms = transformsRes->get();
             auto &types = typesRes->get();
             auto &rooms = roomsRes->get();
             if (transforms.has(entity) && types.has(entity) && nets.has(entity) && rooms.has(entity)) {
                 const bool shouldBroadcast = room && room->getType() != Room::RoomType::Lobby;
                 if (shouldBroadcast) {
-                    const auto players = room->getPlayers();
-                    if (!players.empty()) {
-                        net::Packet packet(net::OpCode::EntityDeath);
-                        net::EntityDeathPayload payload{};
-                        payload.netId = nets[entity].id;
-                        payload.type = static_cast<uint8_t>(types[entity].type);
-                        payload.position = transforms[entity].position;
-                        packet << payload;
-
-                        for (const auto& roomPlayer : players) {
-                            _networkSync.sendPacketToSession(
-                                roomPlayer->getId(), packet, net::NetworkMode::TCP);
-                        }
-                    }
+                    net::EntityDeathPayload payload{};
+                    payload.netId = nets[entity].id;
+                    payload.type = static_cast<uint8_t>(types[entity].type);
+                    payload.position = transforms[entity].position;
+                    room->queueEntityDeath(payload);
                 }
             }
         }
 
-        _registry.kill(entity);
-        _networkSync.unbindSession(player->getId());
+        room->getSimulation().getEntityIndex().untrack(entity);
+        registry.kill(entity);
+        networkSync.unbindSession(player->getId());
         player->setEntityId(0);
     }
+
+    uint32_t RoomSystem::roomSeed(uint32_t roomId) const
+    {
+        // Rooms created in the same order get the same seeds on replay
+        std::seed_seq sequence{_randomSeed, roomId};
+        uint32_t seed = 0;
+        sequence.generate(&seed, &seed + 1);
+        return seed;
+    }
 }
@@ -0,0 +1,272 @@
+/*
+** EPITECH PROJECT, 2025
+** Air-Trap
+** File description:
+** SpatialHash
+*/
+
+#include "Systems/SpatialHash.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+namespace rtp::server
+{
+    namespace {
+        // Bounds cell coordinates so huge or non-finite positions stay valid
+        constexpr float MAX_CELL = 1.0e6f;
+
+        int32_t toCell(float value, float inverseCellSize)
+        {
+            const float cell = std::floor(value * inverseCellSize);
+            if (!(cell > -MAX_CELL))
+                return static_cast<int32_t>(-MAX_CELL);
+            if (!(cell < MAX_CELL))
+                return static_cast<int32_t>(MAX_CELL);
+            return static_cast<int32_t>(cell);
+        }
+
+        // Boxes covering more cells than this skip the grid and match every query
+        constexpr size_t MAX_SPAN_CELLS = 256;
+
+        size_t cellCount(int32_t minX, int32_t minY, int32_t maxX, int32_t maxY)
+        {
+            return static_cast<size_t>(static_cast<int64_t>(maxX) - minX + 1)
+                 * static_cast<size_t>(static_cast<int64_t>(maxY) - minY + 1);
+        }
+
+        // Squared distance from a point to a box, 0 inside it
+        float distance2(const Aabb &box, float x, float y)
+        {
+            const float dx = std::max({box.minX - x, 0.0f, x - box.maxX});
+            const float dy = std::max({box.minY - y, 0.0f, y - box.maxY});
+            return dx * dx + dy * dy;
+        }
+    } // namespace
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    SpatialHash::SpatialHash(float cellSize)
+        : _cellSize(std::max(cellSize, 1.0f))
+        , _inverseCellSize(1.0f / _cellSize)
+    {
+    }
+
+    void SpatialHash::clear(void)
+    {
+        _spans.clear();
+        _oversized.clear();
+        _entries.clear();
+        _bucketStart.clear();
+        _bucketMask = 0;
+    }
+
+    void SpatialHash::insert(uint32_t item, float x, float y, float width, float height)
+    {
+        const Span s = span(item, x, y, width, height);
+        if (cellCount(s.minX, s.minY, s.maxX, s.maxY) > MAX_SPAN_CELLS)
+            _oversized.push_back(s);
+        else
+            _spans.push_back(s);
+    }
+
+    void SpatialHash::build(void)
+    {
+        size_t cells = 0;
+        for (const Span &s : _spans)
+            cells += cellCount(s.minX, s.minY, s.maxX, s.maxY);
+
+        // Twice as many buckets as occupied cells keeps sharing rare
+        const size_t buckets = std::bit_ceil(std::max<size_t>(cells * 2, 16));
+        _bucketMask = buckets - 1;
+        _bucketStart.assign(buckets + 1, 0);
+        _entries.resize(cells);
+
+        for (const Span &s : _spans) {
+            for (int32_t cy = s.minY; cy <= s.maxY; ++cy)
+                for (int32_t cx = s.minX; cx <= s.maxX; ++cx)
+                    ++_bucketStart[bucketOf(cx, cy) + 1];
+        }
+        for (size_t i = 1; i <= buckets; ++i)
+            _bucketStart[i] += _bucketStart[i - 1];
+
+        // Spans are in item order, so each bucket ends up sorted
+        _cursor.assign(_bucketStart.begin(), _bucketStart.end() - 1);
+        for (uint32_t i = 0; i < _spans.size(); ++i) {
+            const Span &s = _spans[i];
+            for (int32_t cy = s.minY; cy <= s.maxY; ++cy)
+                for (int32_t cx = s.minX; cx <= s.maxX; ++cx)
+                    _entries[_cursor[bucketOf(cx, cy)]++] = i;
+        }
+    }
+
+    void SpatialHash::query(float x, float y, float width, float height,
+                            std::vector<uint32_t> &out) const
+    {
+        out.clear();
+        for (const Span &s : _oversized)
+            out.push_back(s.item);
+        if (_entries.empty()) {
+            std::ranges::sort(out);
+            return;
+        }
+
+        const Span area = span(0, x, y, width, height);
+        if (cellCount(area.minX, area.minY, area.maxX, area.maxY) > _bucketMask + 1) {
+            // Covers more cells than there are buckets: every bucket is hit anyway
+            for (const Span &s : _spans)
+                out.push_back(s.item);
+        } else {
+            for (int32_t cy = area.minY; cy <= area.maxY; ++cy) {
+                for (int32_t cx = area.minX; cx <= area.maxX; ++cx) {
+                    const size_t bucket = bucketOf(cx, cy);
+                    for (uint32_t e = _bucketStart[bucket]; e < _bucketStart[bucket + 1]; ++e)
+                        out.push_back(_spans[_entries[e]].item);
+                }
+            }
+        }
+        // A single bucket is already sorted, its duplicates are adjacent
+        if (!_oversized.empty() || area.minX != area.maxX || area.minY != area.maxY)
+            std::ranges::sort(out);
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    void SpatialHash::queryRadius(float x, float y, float radius,
+                                  std::vector<uint32_t> &out) const
+    {
+        out.clear();
+        if (!(radius >= 0.0f))
+            return;
+
+        const float radius2 = radius * radius;
+        for (const Span &s : _oversized) {
+            if (distance2(s.box, x, y) <= radius2)
+                out.push_back(s.item);
+        }
+
+        const Span area = span(0, x - radius, y - radius, radius * 2.0f, radius * 2.0f);
+        if (_entries.empty()) {
+            std::ranges::sort(out);
+            return;
+        }
+        if (cellCount(area.minX, area.minY, area.maxX, area.maxY) > _bucketMask + 1) {
+            for (const Span &s : _spans) {
+                if (distance2(s.box, x, y) <= radius2)
+                    out.push_back(s.item);
+            }
+        } else {
+            for (int32_t cy = area.minY; cy <= area.maxY; ++cy) {
+                for (int32_t cx = area.minX; cx <= area.maxX; ++cx) {
+                    const size_t bucket = bucketOf(cx, cy);
+                    for (uint32_t e = _bucketStart[bucket]; e < _bucketStart[bucket + 1]; ++e) {
+                        const Span &s = _spans[_entries[e]];
+                        if (distance2(s.box, x, y) <= radius2)
+                            out.push_back(s.item);
+                    }
+                }
+            }
+        }
+        std::ranges::sort(out);
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+
+    void SpatialHash::nearest(float x, float y, float radius, size_t k,
+                              std::vector<uint32_t> &out)
+    {
+        out.clear();
+        _best.clear();
+        if (k == 0 || !(radius >= 0.0f))
+            return;
+
+        const float radius2 = radius * radius;
+        for (const Span &s : _oversized)
+            keepNearest(s, x, y, radius2, k);
+
+        if (!_entries.empty()) {
+            // A box within the radius has a cell at most this many rings away
+            const int64_t maxRing = static_cast<int64_t>(std::min(radius * _inverseCellSize, MAX_CELL)) + 1;
+            const size_t side = static_cast<size_t>(maxRing * 2 + 1);
+            if (side * side > _bucketMask + 1) {
+                // The rings would hit every bucket anyway
+                for (const Span &s : _spans)
+                    keepNearest(s, x, y, radius2, k);
+            } else {
+                const int64_t cx = toCell(x, _inverseCellSize);
+                const int64_t cy = toCell(y, _inverseCellSize);
+                const auto visit = [&](int64_t cellX, int64_t cellY) {
+                    const size_t bucket = bucketOf(static_cast<int32_t>(cellX), static_cast<int32_t>(cellY));
+                    for (uint32_t e = _bucketStart[bucket]; e < _bucketStart[bucket + 1]; ++e)
+                        keepNearest(_spans[_entries[e]], x, y, radius2, k);
+                };
+                for (int64_t ring = 0; ring <= maxRing; ++ring) {
+                    // Boxes not seen yet are at least (ring - 1) cells away
+                    const float bound = static_cast<float>(ring - 1) * _cellSize;
+                    if (ring > 0 && _best.size() == k && _best.back().distance2 < bound * bound)
+                        break;
+                    if (ring == 0) {
+                        visit(cx, cy);
+                        continue;
+                    }
+                    for (int64_t dx = -ring; dx <= ring; ++dx) {
+                        visit(cx + dx, cy - ring);
+                        visit(cx + dx, cy + ring);
+                    }
+                    for (int64_t dy = -ring + 1; dy <= ring - 1; ++dy) {
+                        visit(cx - ring, cy + dy);
+                        visit(cx + ring, cy + dy);
+                    }
+                }
+            }
+        }
+
+        for (const Neighbour &neighbour : _best)
+            out.push_back(neighbour.item);
+    }
+
+    size_t SpatialHash::size(void) const
+    {
+        return _spans.size() + _oversized.size();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    SpatialHash::Span SpatialHash::span(uint32_t item, float x, float y, float width, float height) const
+    {
+        return Span{item,
+                    Aabb::fromSize(x, y, std::max(width, 0.0f), std::max(height, 0.0f)),
+                    toCell(x, _inverseCellSize),
+                    toCell(y, _inverseCellSize),
+                    toCell(x + std::max(width, 0.0f), _inverseCellSize),
+                    toCell(y + std::max(height, 0.0f), _inverseCellSize)};
+    }
+
+    size_t SpatialHash::bucketOf(int32_t cellX, int32_t cellY) const
+    {
+        // Teschner et al. primes, spread neighbouring cells over the table
+        const uint32_t hash = (static_cast<uint32_t>(cellX) * 73856093u)
+                            ^ (static_cast<uint32_t>(cellY) * 19349663u);
+        return hash & _bucketMask;
+    }
+
+    void SpatialHash::keepNearest(const Span &s, float x, float y, float radius2, size_t k)
+    {
+        const Neighbour candidate{distance2(s.box, x, y), s.item};
+        if (candidate.distance2 > radius2)
+            return;
+        if (_best.size() == k && !(candidate < _best.back()))
+            return;
+        // A box covering several cells shows up once per cell
+        for (const Neighbour &kept : _best) {
+            if (kept.item == candidate.item)
+                return;
+        }
+        if (_best.size() == k)
+            _best.pop_back();
+        _best.insert(std::upper_bound(_best.begin(), _best.end(), candidate), candidate);
+    }
+}
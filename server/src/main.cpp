@@ -9,10 +9,16 @@
 #include "Game/GameManager.hpp"
 #include "RType/Logger.hpp"
 #include "ServerNetwork/ServerNetwork.hpp"
+#include "RType/Config/SimpleJsonParser.hpp"
 
 #include <chrono>
 #include <csignal>
+#include <cstdlib>
+#include <fstream>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
 #include <thread>
 
 namespace rtp::server
@@ -26,16 +32,83 @@ namespace rtp::server
         }
     }
 
-    uint16_t parseArguments(int argc, char **argv)
+    struct ServerOptions {
+        uint16_t port = 5000;     /**< TCP/UDP listening port */
+        size_t ioThreads = 1;     /**< Number of I/O shards */
+        net::TcpFlushPolicy tcpFlush = net::TcpFlushPolicy::EndOfTick; /**< When TCP packets are written */
+        uint32_t snapshotInterval = 2;  /**< Ticks between entity snapshots */
+        uint32_t tickRate = 60;         /**< Simulation ticks per second */
+        size_t simThreads = 0;          /**< Room simulation workers, 0 to run rooms on the game thread */
+        uint32_t statsInterval = 30;    /**< Seconds between network summaries, 0 for none */
+        std::string capturePath;        /**< Inbound event capture for rtype_replay, empty for none */
+        bool profile = false;           /**< Time every system from startup */
+    };
+
+    /**
+     * @brief Read the "server" section of the configuration file
+     * @param path Configuration file, defaults are kept if it is missing
+     * @param options Options to fill
+     */
+    void loadServerConfig(const std::string &path, ServerOptions &options)
+    {
+        config::SimpleJson root;
+        if (!root.parse(path)) {
+            rtp::log::warning("Cannot read {}, using default settings", path);
+            return;
+        }
+        config::SimpleJson server;
+        server.parseContent(root.getString("server"));
+        const int tickRate = server.getInt("tickRate", static_cast<int>(options.tickRate));
+        if (tickRate > 0)
+            options.tickRate = static_cast<uint32_t>(tickRate);
+    }
+
+    ServerOptions parseArguments(int argc, char **argv)
     {
-        uint16_t port = 5000;
+        ServerOptions options;
+        loadServerConfig("config/server.json", options);
         for (int i = 1; i < argc; ++i) {
             std::string arg = argv[i];
             if (arg == "--port" && i + 1 < argc) {
-                port = static_cast<uint16_t>(std::stoi(argv[++i]));
+                options.port = static_cast<uint16_t>(std::stoi(argv[++i]));
+            } else if (arg == "--io-threads" && i + 1 < argc) {
+                options.ioThreads = static_cast<size_t>(std::stoul(argv[++i]));
+            } else if (arg == "--tcp-flush" && i + 1 < argc) {
+                const std::string policy = argv[++i];
+                options.tcpFlush = policy == "immediate"
+                    ? net::TcpFlushPolicy::Immediate
+                    : net::TcpFlushPolicy::EndOfTick;
+            } else if (arg == "--snapshot-interval" && i + 1 < argc) {
+                options.snapshotInterval = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else if (arg == "--stats" && i + 1 < argc) {
+                options.statsInterval = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else if (arg == "--sim-threads" && i + 1 < argc) {
+                options.simThreads = static_cast<size_t>(std::stoul(argv[++i]));
+            } else if (arg == "--tick-rate" && i + 1 < argc) {
+                options.tickRate = static_cast<uint32_t>(std::stoul(argv[++i]));
+            } else if (arg == "--capture" && i + 1 < argc) {
+                options.capturePath = argv[++i];
+            } else if (arg == "--profile") {
+                options.profile = true;
             }
         }
-        return port;
+        return options;
+    }
+
+    std::unique_ptr<EventRecorder> openCapture(const ServerOptions &options, GameManager &gameManager)
+    {
+        CaptureInfo info;
+        info.randSeed = std::random_device{}();
+        info.snapshotInterval = options.snapshotInterval;
+        info.tickRate = options.tickRate;
+        std::ifstream accounts("logins.txt", std::ios::binary);
+        info.accounts.assign(std::istreambuf_iterator<char>(accounts),
+                             std::istreambuf_iterator<char>());
+
+        // Replays reseed with the same value to take the same random decisions
+        gameManager.setRandomSeed(info.randSeed);
+        rtp::log::info("Capturing inbound events to {} (seed {})", options.capturePath, info.randSeed);
+        return std::make_unique<EventRecorder>(options.capturePath, info);
     }
 } // namespace rtp::server
 
@@ -43,12 +116,25 @@ int main(int ac, char **av)
 {
     std::signal(SIGINT, rtp::server::signal_handler);
 
-    uint16_t ServerPort = rtp::server::parseArguments(ac, av);
+    const auto options = rtp::server::parseArguments(ac, av);
     try {
-        rtp::log::info("Starting R-Type Server on port {}", ServerPort);
+        rtp::log::info("Starting R-Type Server on port {}", options.port);
 
-        rtp::server::ServerNetwork networkManager(ServerPort);
+        rtp::server::ServerNetwork networkManager(options.port, options.ioThreads);
+        networkManager.setTcpFlushPolicy(options.tcpFlush);
+        networkManager.setStatsInterval(std::chrono::seconds(options.statsInterval));
         rtp::server::GameManager gameManager(networkManager);
+        gameManager.setSnapshotInterval(options.snapshotInterval);
+        gameManager.setTickRate(options.tickRate);
+        gameManager.setStatsInterval(options.statsInterval);
+        gameManager.setSimulationThreads(options.simThreads);
+        gameManager.setProfiling(options.profile);
+
+        std::unique_ptr<rtp::server::EventRecorder> capture;
+        if (!options.capturePath.empty()) {
+            capture = rtp::server::openCapture(options, gameManager);
+            gameManager.setEventRecorder(capture.get());
+        }
 
         networkManager.start();
 
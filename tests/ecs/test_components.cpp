@@ -12,6 +12,7 @@
 #include "RType/ECS/Components/ParallaxLayer.hpp"
 #include "RType/ECS/Components/Controllable.hpp"
 #include "RType/ECS/Components/InputComponent.hpp"
+#include "RType/ECS/Components/NetworkId.hpp"
 
 using namespace rtp;
 using namespace rtp::ecs;
@@ -55,6 +56,15 @@ TEST(ECS_Component_Damage, Defaults) {
     EXPECT_TRUE(d.sourceEntity.isNull());
 }
 
+// NetworkId changes with the generation of a recycled index
+TEST(ECS_Component_NetworkId, EncodesIndexAndGeneration) {
+    const Entity first(7, 0);
+    const Entity recycled(7, 1);
+    EXPECT_EQ(NetworkId::of(first), 7u);
+    EXPECT_NE(NetworkId::of(recycled), NetworkId::of(first));
+    EXPECT_EQ(NetworkId::indexOf(NetworkId::of(recycled)), 7u);
+}
+
 // Sprite defaults
 TEST(ECS_Component_Sprite, Defaults) {
     Sprite s;
@@ -104,6 +104,93 @@ TEST_F(RegistryTest, ZipViewThreeComponentsAlign) {
     EXPECT_EQ(count, 1u);
 }
 
+TEST_F(RegistryTest, entityAt) {
+    ASSERT_TRUE(registry->subscribe<Health>().has_value());
+    EXPECT_EQ(registry->entityAt(5), NullEntity);
+
+    auto first = registry->spawn();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(registry->add<Health>(first.value(), Health{10, 10}).has_value());
+    EXPECT_EQ(registry->entityAt(first->index()), first.value());
+
+    registry->kill(first.value());
+    const Entity stale = registry->entityAt(first->index());
+    EXPECT_NE(stale, first.value());
+    EXPECT_FALSE(registry->has<Health>(stale));
+
+    auto second = registry->spawn();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(registry->entityAt(first->index()), second.value());
+}
+
+TEST_F(RegistryTest, renew) {
+    ASSERT_TRUE(registry->subscribe<Health>().has_value());
+    ASSERT_TRUE(registry->subscribe<Velocity>().has_value());
+
+    auto first = registry->spawn();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(registry->add<Health>(first.value(), Health{7, 10}).has_value());
+
+    const Entity renewed = registry->renew(first.value());
+    EXPECT_EQ(renewed.index(), first->index());
+    EXPECT_NE(renewed, first.value());
+    EXPECT_FALSE(registry->isAlive(first.value()));
+    EXPECT_TRUE(registry->isAlive(renewed));
+    EXPECT_FALSE(registry->has<Health>(first.value()));
+    ASSERT_TRUE(registry->has<Health>(renewed));
+    EXPECT_EQ(registry->get<Health>()->get()[renewed].currentHealth, 7);
+    EXPECT_FALSE(registry->has<Velocity>(renewed));
+    EXPECT_EQ(registry->entityCount(), 1u);
+
+    EXPECT_EQ(registry->renew(first.value()), NullEntity);
+}
+
+TEST_F(RegistryTest, renewListedComponents) {
+    ASSERT_TRUE(registry->subscribe<Health>().has_value());
+    ASSERT_TRUE(registry->subscribe<Velocity>().has_value());
+    ASSERT_TRUE(registry->subscribe<Transform>().has_value());
+
+    auto first = registry->spawn();
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(registry->add<Health>(first.value(), Health{7, 10}).has_value());
+    ASSERT_TRUE(registry->add<Velocity>(first.value()).has_value());
+    ASSERT_TRUE(registry->add<Transform>(first.value()).has_value());
+
+    registry->remove<Velocity>(first.value());
+    registry->remove<Transform>(first.value());
+
+    auto &healths = registry->get<Health>()->get();
+    const Entity renewed = registry->renew(first.value(), healths);
+    EXPECT_EQ(renewed.index(), first->index());
+    EXPECT_FALSE(registry->isAlive(first.value()));
+    ASSERT_TRUE(registry->has<Health>(renewed));
+    EXPECT_EQ(healths[renewed].currentHealth, 7);
+    EXPECT_EQ(registry->entityCount(), 1u);
+
+    EXPECT_EQ(registry->renew(first.value(), healths), NullEntity);
+}
+
+TEST_F(RegistryTest, NeverSpawnsNullEntity) {
+    EXPECT_FALSE(registry->isAlive(NullEntity));
+    EXPECT_EQ(registry->entityCount(), 0u);
+
+    auto first = registry->spawn();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_FALSE(first->isNull());
+    EXPECT_NE(first->index(), 0u);
+    EXPECT_EQ(registry->entityCount(), 1u);
+
+    registry->kill(NullEntity);
+    EXPECT_EQ(registry->renew(NullEntity), NullEntity);
+    EXPECT_TRUE(registry->isAlive(first.value()));
+
+    registry->clear();
+    EXPECT_EQ(registry->entityCount(), 0u);
+    auto again = registry->spawn();
+    ASSERT_TRUE(again.has_value());
+    EXPECT_FALSE(again->isNull());
+}
+
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
     return RUN_ALL_TESTS();
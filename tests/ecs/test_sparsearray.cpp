@@ -61,3 +61,24 @@ TEST(SparseArrayTest, EntitiesAndDataSizesStayConsistent) {
 
     EXPECT_EQ(arr.entities().size(), arr.data().size());
 }
+
+TEST(SparseArrayTest, RebindKeepsValueUnderNewHandle) {
+    SparseArray<DummyComponent> arr;
+    Entity e1{0, 0};
+    Entity e2{1, 0};
+    Entity renewed{1, 1};
+
+    arr.emplace(e1, DummyComponent{1});
+    arr.emplace(e2, DummyComponent{2});
+
+    arr.rebind(e2, renewed);
+
+    EXPECT_EQ(arr.size(), 2u);
+    EXPECT_FALSE(arr.has(e2));
+    ASSERT_TRUE(arr.has(renewed));
+    EXPECT_EQ(arr[renewed].value, 2);
+    EXPECT_EQ(arr[e1].value, 1);
+
+    arr.rebind(e2, Entity{1, 2});
+    EXPECT_TRUE(arr.has(renewed));
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include "Systems/AabbBatch.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace rtp::server;
+
+namespace {
+
+    AabbBatch makeBatch(std::mt19937 &rng, size_t count)
+    {
+        std::uniform_real_distribution<float> pos(0.0f, 1000.0f);
+        std::uniform_real_distribution<float> size(0.0f, 80.0f);
+        AabbBatch batch;
+        for (size_t i = 0; i < count; ++i)
+            batch.push(Aabb::fromSize(pos(rng), pos(rng), size(rng), size(rng)));
+        return batch;
+    }
+
+    template <typename Fn>
+    double nanosPerCall(size_t iterations, Fn &&fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+            fn();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    }
+
+}
+
+TEST(AabbBatchTest, OverlapIsStrict) {
+    AabbBatch batch;
+    batch.push(Aabb::fromSize(0.0f, 0.0f, 10.0f, 10.0f));    // overlaps
+    batch.push(Aabb::fromSize(10.0f, 0.0f, 10.0f, 10.0f));   // shares an edge
+    batch.push(Aabb::fromSize(50.0f, 50.0f, 1.0f, 1.0f));    // far away
+    batch.push(Aabb{std::numeric_limits<float>::quiet_NaN(), 0.0f, 1.0f, 1.0f});
+
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2}) {
+        std::vector<uint64_t> mask;
+        batch.overlapMask(Aabb::fromSize(5.0f, 5.0f, 5.0f, 5.0f), mask, level);
+        ASSERT_EQ(mask.size(), 1u);
+        EXPECT_EQ(mask[0], 0b0001u) << toString(level);
+    }
+}
+
+TEST(AabbBatchTest, KernelsAgreeOnEveryTailLength) {
+    std::mt19937 rng(3);
+    const Aabb query = Aabb::fromSize(400.0f, 400.0f, 200.0f, 200.0f);
+
+    for (size_t count : {0u, 1u, 3u, 4u, 7u, 8u, 9u, 63u, 64u, 65u, 1000u}) {
+        const AabbBatch batch = makeBatch(rng, count);
+        std::vector<uint64_t> scalar;
+        batch.overlapMask(query, scalar, SimdLevel::Scalar);
+        ASSERT_EQ(scalar.size(), (count + 63) / 64);
+
+        for (SimdLevel level : {SimdLevel::SSE2, SimdLevel::AVX2}) {
+            std::vector<uint64_t> simd;
+            batch.overlapMask(query, simd, level);
+            EXPECT_EQ(simd, scalar) << toString(level) << " with " << count << " boxes";
+        }
+        std::vector<uint64_t> detected;
+        batch.overlapMask(query, detected);
+        EXPECT_EQ(detected, scalar);
+    }
+}
+
+TEST(AabbBatchTest, KernelLoad) {
+    constexpr size_t BOXES = 2000;
+    constexpr size_t iterations = 2000;
+    std::mt19937 rng(11);
+    const AabbBatch batch = makeBatch(rng, BOXES);
+    const Aabb query = Aabb::fromSize(480.0f, 480.0f, 16.0f, 16.0f);
+    std::vector<uint64_t> mask;
+
+    std::cout << "[ LOAD     ] " << BOXES << " boxes vs one query, detected "
+              << toString(detectSimdLevel()) << ":";
+    for (SimdLevel level : {SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2}) {
+        const double ns = nanosPerCall(iterations, [&]() {
+            batch.overlapMask(query, mask, level);
+        });
+        std::cout << " " << toString(level) << " " << ns << "ns";
+        RecordProperty(std::string(toString(level)) + "_ns", static_cast<int>(ns));
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include "Systems/EntityIndex.hpp"
+
+#include "RType/ECS/Components/EntityType.hpp"
+
+using namespace rtp;
+using namespace rtp::server;
+
+namespace {
+
+    ecs::Entity spawn(ecs::Registry &registry, net::EntityType type)
+    {
+        auto entity = registry.spawn();
+        EXPECT_TRUE(entity.has_value());
+        registry.add<ecs::components::EntityType>(entity.value(), ecs::components::EntityType{type});
+        return entity.value();
+    }
+
+}
+
+TEST(EntityIndex, CategoriesCoverGameplayTypes)
+{
+    EXPECT_EQ(categoryOf(net::EntityType::Player), EntityCategory::Player);
+    EXPECT_EQ(categoryOf(net::EntityType::Boss2), EntityCategory::Enemy);
+    EXPECT_EQ(categoryOf(net::EntityType::BossShield), EntityCategory::Enemy);
+    EXPECT_EQ(categoryOf(net::EntityType::ObstacleSolid), EntityCategory::Obstacle);
+    EXPECT_EQ(categoryOf(net::EntityType::ChargedBullet), EntityCategory::PlayerBullet);
+    EXPECT_EQ(categoryOf(net::EntityType::Boss2Bullet), EntityCategory::EnemyBullet);
+    EXPECT_EQ(categoryOf(net::EntityType::PowerupShield), EntityCategory::Powerup);
+}
+
+TEST(EntityIndex, TrackListsAtFlush)
+{
+    ecs::Registry registry;
+    registry.subscribe<ecs::components::EntityType>();
+    EntityIndex index(registry);
+
+    const auto enemyA = spawn(registry, net::EntityType::Enemy1);
+    const auto player = spawn(registry, net::EntityType::Player);
+    const auto enemyB = spawn(registry, net::EntityType::Tank);
+    const auto bullet = spawn(registry, net::EntityType::Bullet);
+    index.track(enemyA, net::EntityType::Enemy1);
+    index.track(player, net::EntityType::Player);
+    index.track(enemyB, net::EntityType::Tank);
+    index.track(bullet, net::EntityType::Bullet);
+    EXPECT_EQ(index.size(), 0u);
+
+    index.flush();
+    EXPECT_EQ(index.size(), 4u);
+    EXPECT_EQ(index.get(EntityCategory::Player), std::vector<ecs::Entity>{player});
+    EXPECT_EQ(index.get(EntityCategory::Enemy), (std::vector<ecs::Entity>{enemyA, enemyB}));
+    EXPECT_EQ(index.get(EntityCategory::PlayerBullet), std::vector<ecs::Entity>{bullet});
+    EXPECT_TRUE(index.get(EntityCategory::Powerup).empty());
+}
+
+TEST(EntityIndex, UntrackDropsAtFlush)
+{
+    ecs::Registry registry;
+    registry.subscribe<ecs::components::EntityType>();
+    EntityIndex index(registry);
+
+    const auto enemyA = spawn(registry, net::EntityType::Enemy1);
+    const auto enemyB = spawn(registry, net::EntityType::Enemy2);
+    const auto enemyC = spawn(registry, net::EntityType::Enemy3);
+    for (auto enemy : {enemyA, enemyB, enemyC})
+        index.track(enemy, net::EntityType::Enemy1);
+    index.flush();
+
+    index.untrack(enemyA);
+    registry.kill(enemyA);
+    const auto powerup = spawn(registry, net::EntityType::PowerupHeal);
+    index.track(powerup, net::EntityType::PowerupHeal);
+
+    // Until the next flush the stale entry fails has() even if its index was recycled
+    auto &types = registry.get<ecs::components::EntityType>()->get();
+    ASSERT_EQ(index.get(EntityCategory::Enemy).size(), 3u);
+    EXPECT_FALSE(types.has(index.get(EntityCategory::Enemy).front()));
+
+    index.flush();
+    EXPECT_EQ(index.get(EntityCategory::Enemy), (std::vector<ecs::Entity>{enemyC, enemyB}));
+    EXPECT_EQ(index.get(EntityCategory::Powerup), std::vector<ecs::Entity>{powerup});
+
+    // A stale handle does not drop the entity that reuses its index
+    index.untrack(enemyA);
+    index.flush();
+    EXPECT_EQ(index.get(EntityCategory::Powerup), std::vector<ecs::Entity>{powerup});
+}
+
+TEST(EntityIndex, TrackReplacesARecycledIndex)
+{
+    ecs::Registry registry;
+    registry.subscribe<ecs::components::EntityType>();
+    EntityIndex index(registry);
+
+    const auto enemy = spawn(registry, net::EntityType::Enemy2);
+    index.track(enemy, net::EntityType::Enemy2);
+    index.flush();
+
+    // Killed without untrack(), the index comes back as a bullet
+    registry.kill(enemy);
+    const auto bullet = spawn(registry, net::EntityType::EnemyBullet);
+    ASSERT_EQ(bullet.index(), enemy.index());
+    index.track(bullet, net::EntityType::EnemyBullet);
+    index.flush();
+
+    EXPECT_TRUE(index.get(EntityCategory::Enemy).empty());
+    EXPECT_EQ(index.get(EntityCategory::EnemyBullet), std::vector<ecs::Entity>{bullet});
+    EXPECT_EQ(index.size(), 1u);
+}
+
+TEST(EntityIndex, RefreshRebuildsFromRegistry)
+{
+    ecs::Registry registry;
+    registry.subscribe<ecs::components::EntityType>();
+    EntityIndex index(registry);
+
+    const auto enemy = spawn(registry, net::EntityType::Enemy2);
+    const auto player = spawn(registry, net::EntityType::Player);
+    index.track(player, net::EntityType::Player);
+
+    index.refresh();
+    EXPECT_EQ(index.get(EntityCategory::Enemy), std::vector<ecs::Entity>{enemy});
+    EXPECT_EQ(index.get(EntityCategory::Player), std::vector<ecs::Entity>{player});
+
+    // The queued track() was dropped, flushing does not list the player twice
+    index.flush();
+    EXPECT_EQ(index.size(), 2u);
+}
@@ -0,0 +1,235 @@
+#include <gtest/gtest.h>
+#include "Game/LevelCache.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+using namespace rtp;
+using namespace rtp::server;
+
+namespace {
+
+    std::filesystem::path levelPath(const char *name)
+    {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    void writeJson(const std::filesystem::path &path, const std::string &name)
+    {
+        std::ofstream out(path, std::ios::trunc);
+        out << "{\n"
+            << "  \"level_id\": 7,\n"
+            << "  \"name\": \"" << name << "\",\n"
+            << "  \"game_metadata\": {\n"
+            << "    \"level_width_in_pixels\": 2400,\n"
+            << "    \"player_start_position\": { \"x\": 100, \"y\": 360 },\n"
+            << "    \"tileset_path\": \"\"\n"
+            << "  },\n"
+            << "  \"spawn_triggers\": [\n"
+            << "    { \"at_time\": 2, \"entity_type\": \"Scout\", \"start_position\": { \"x\": 1200, \"y\": 200 }, \"pattern\": \"StraightLine\" }\n"
+            << "  ]\n"
+            << "}\n";
+    }
+
+    LevelData sampleLevel(void)
+    {
+        LevelData level;
+        level.id = 3;
+        level.name = "Compiled";
+        level.playerStart = {80.0f, 300.0f};
+        level.widthPixels = 4800.0f;
+        level.tilesetPath = "assets/tiles/level_03.tmx";
+
+        SpawnEvent spawn;
+        spawn.atTime = 1.5f;
+        spawn.type = net::EntityType::Enemy2;
+        spawn.startPosition = {1200.0f, 250.0f};
+        spawn.pattern = ecs::components::Patterns::SineWave;
+        spawn.speed = 90.0f;
+        level.spawns.push_back(spawn);
+
+        PowerupEvent powerup;
+        powerup.atTime = 4.0f;
+        powerup.type = ecs::components::PowerupType::DoubleFire;
+        powerup.position = {900.0f, 100.0f};
+        powerup.value = 1.5f;
+        powerup.duration = 8.0f;
+        level.powerups.push_back(powerup);
+
+        ObstacleEvent obstacle;
+        obstacle.atTime = 6.0f;
+        obstacle.position = {1000.0f, 600.0f};
+        obstacle.size = {64.0f, 32.0f};
+        obstacle.health = 120;
+        level.obstacles.push_back(obstacle);
+
+        Boss3Data boss3Data;
+        BossPhase phase;
+        phase.duration = 20.0f;
+        phase.spawnCount = 5;
+        phase.spawnInterval = 2.0f;
+        phase.enemyType = "enemy3";
+        boss3Data.phases.push_back(phase);
+        level.boss3Data = boss3Data;
+        return level;
+    }
+
+}
+
+TEST(LevelBinaryTest, RoundTripsEveryField) {
+    const auto path = levelPath("rtype_test_roundtrip.lvl");
+    const LevelData level = sampleLevel();
+
+    std::string error;
+    ASSERT_TRUE(saveLevelBinary(level, path.string(), error)) << error;
+    auto loaded = loadLevelBinary(path.string(), error);
+    ASSERT_TRUE(loaded.has_value()) << error;
+
+    EXPECT_EQ(loaded->id, 3u);
+    EXPECT_EQ(loaded->name, "Compiled");
+    EXPECT_FLOAT_EQ(loaded->playerStart.y, 300.0f);
+    EXPECT_FLOAT_EQ(loaded->widthPixels, 4800.0f);
+    EXPECT_EQ(loaded->tilesetPath, level.tilesetPath);
+
+    ASSERT_EQ(loaded->spawns.size(), 1u);
+    EXPECT_EQ(loaded->spawns[0].type, net::EntityType::Enemy2);
+    EXPECT_EQ(loaded->spawns[0].pattern, ecs::components::Patterns::SineWave);
+    EXPECT_FLOAT_EQ(loaded->spawns[0].startPosition.x, 1200.0f);
+    EXPECT_FLOAT_EQ(loaded->spawns[0].speed, 90.0f);
+
+    ASSERT_EQ(loaded->powerups.size(), 1u);
+    EXPECT_EQ(loaded->powerups[0].type, ecs::components::PowerupType::DoubleFire);
+    EXPECT_FLOAT_EQ(loaded->powerups[0].duration, 8.0f);
+
+    ASSERT_EQ(loaded->obstacles.size(), 1u);
+    EXPECT_EQ(loaded->obstacles[0].health, 120);
+    EXPECT_FLOAT_EQ(loaded->obstacles[0].size.x, 64.0f);
+
+    ASSERT_TRUE(loaded->boss3Data.has_value());
+    ASSERT_EQ(loaded->boss3Data->phases.size(), 1u);
+    EXPECT_EQ(loaded->boss3Data->phases[0].enemyType, "enemy3");
+    EXPECT_EQ(loaded->boss3Data->phases[0].spawnCount, 5);
+
+    std::filesystem::remove(path);
+}
+
+TEST(LevelBinaryTest, RejectsTruncatedAndForeignFiles) {
+    const auto path = levelPath("rtype_test_truncated.lvl");
+    std::string error;
+    ASSERT_TRUE(saveLevelBinary(sampleLevel(), path.string(), error)) << error;
+
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 6);
+    EXPECT_FALSE(loadLevelBinary(path.string(), error).has_value());
+    EXPECT_FALSE(error.empty());
+
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        out << "{ \"level_id\": 1 }";
+    }
+    error.clear();
+    EXPECT_FALSE(loadLevelBinary(path.string(), error).has_value());
+    EXPECT_FALSE(error.empty());
+
+    std::filesystem::remove(path);
+}
+
+TEST(LevelBinaryTest, LoadLevelPrefersUpToDateCompiledFile) {
+    const auto json = levelPath("rtype_test_prefer.json");
+    const auto compiled = std::filesystem::path(compiledLevelPath(json.string()));
+    EXPECT_EQ(compiled.extension(), ".lvl");
+
+    writeJson(json, "From JSON");
+    std::string error;
+    ASSERT_TRUE(saveLevelBinary(sampleLevel(), compiled.string(), error)) << error;
+
+    const auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(json, now - std::chrono::hours(1));
+    std::filesystem::last_write_time(compiled, now);
+    auto level = loadLevel(json.string(), error);
+    ASSERT_TRUE(level.has_value()) << error;
+    EXPECT_EQ(level->name, "Compiled");
+
+    // Edited after the compile: the JSON wins
+    std::filesystem::last_write_time(json, now + std::chrono::hours(1));
+    level = loadLevel(json.string(), error);
+    ASSERT_TRUE(level.has_value()) << error;
+    EXPECT_EQ(level->name, "From JSON");
+
+    std::filesystem::remove(json);
+    std::filesystem::remove(compiled);
+}
+
+TEST(LevelBinaryTest, LoadLevelRejectsFileOlderThanTileset) {
+    const auto json = levelPath("rtype_test_tileset.json");
+    const auto tileset = levelPath("rtype_test_tileset.tmj");
+    const auto compiled = std::filesystem::path(compiledLevelPath(json.string()));
+
+    writeJson(json, "From JSON");
+    std::ofstream(tileset, std::ios::trunc) << "{}\n";
+    LevelData level = sampleLevel();
+    level.tilesetPath = tileset.string();
+    std::string error;
+    ASSERT_TRUE(saveLevelBinary(level, compiled.string(), error)) << error;
+
+    const auto now = std::filesystem::file_time_type::clock::now();
+    std::filesystem::last_write_time(json, now - std::chrono::hours(1));
+    std::filesystem::last_write_time(tileset, now - std::chrono::hours(1));
+    std::filesystem::last_write_time(compiled, now);
+    auto loaded = loadLevel(json.string(), error);
+    ASSERT_TRUE(loaded.has_value()) << error;
+    EXPECT_EQ(loaded->name, "Compiled");
+
+    // Tileset edited after the compile: its obstacles in the .lvl are stale
+    std::filesystem::last_write_time(tileset, now + std::chrono::hours(1));
+    loaded = loadLevel(json.string(), error);
+    ASSERT_TRUE(loaded.has_value()) << error;
+    EXPECT_EQ(loaded->name, "From JSON");
+
+    std::filesystem::remove(json);
+    std::filesystem::remove(tileset);
+    std::filesystem::remove(compiled);
+}
+
+TEST(LevelCacheTest, SharesOneParseBetweenCallers) {
+    const auto json = levelPath("rtype_test_cache.json");
+    writeJson(json, "Cached");
+
+    LevelCache cache;
+    cache.registerLevel(1, json.string());
+    cache.preload();
+
+    auto first = cache.get(1);
+    auto second = cache.get(1);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first.get(), second.get());
+    EXPECT_EQ(first->name, "Cached");
+    ASSERT_EQ(first->spawns.size(), 1u);
+
+    std::filesystem::remove(json);
+}
+
+TEST(LevelCacheTest, LoadsOnFirstUseWithoutPreload) {
+    const auto json = levelPath("rtype_test_deferred.json");
+    writeJson(json, "Deferred");
+
+    LevelCache cache;
+    cache.registerLevel(2, json.string());
+    EXPECT_EQ(cache.size(), 1u);
+
+    auto level = cache.get(2);
+    ASSERT_NE(level, nullptr);
+    EXPECT_EQ(level->name, "Deferred");
+
+    std::filesystem::remove(json);
+}
+
+TEST(LevelCacheTest, UnknownAndBrokenLevelsAreNull) {
+    LevelCache cache;
+    cache.registerLevel(5, levelPath("rtype_test_missing.json").string());
+
+    EXPECT_EQ(cache.get(4), nullptr);
+    EXPECT_EQ(cache.get(5), nullptr);
+    EXPECT_EQ(cache.get(5), nullptr);
+}
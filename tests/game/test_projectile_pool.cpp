@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+#include "Systems/ProjectilePool.hpp"
+
+#include "RType/ECS/Components/BoundingBox.hpp"
+#include "RType/ECS/Components/Boomerang.hpp"
+#include "RType/ECS/Components/Damage.hpp"
+#include "RType/ECS/Components/EntityType.hpp"
+#include "RType/ECS/Components/Homing.hpp"
+#include "RType/ECS/Components/NetworkId.hpp"
+#include "RType/ECS/Components/RoomId.hpp"
+#include "RType/ECS/Components/Transform.hpp"
+
+using namespace rtp;
+using namespace rtp::server;
+using namespace rtp::ecs::components;
+
+namespace {
+
+    void subscribe(ecs::Registry &registry)
+    {
+        registry.subscribe<Transform>();
+        registry.subscribe<Velocity>();
+        registry.subscribe<BoundingBox>();
+        registry.subscribe<Damage>();
+        registry.subscribe<NetworkId>();
+        registry.subscribe<EntityType>();
+        registry.subscribe<RoomId>();
+        registry.subscribe<Homing>();
+        registry.subscribe<Boomerang>();
+    }
+
+    ProjectileSpec bullet(float x, int damage)
+    {
+        return ProjectileSpec{
+            net::EntityType::Bullet,
+            {x, 10.0f},
+            Velocity{{500.0f, 0.0f}, 0.0f},
+            8.0f,
+            4.0f,
+            damage,
+            ecs::NullEntity,
+            1
+        };
+    }
+
+}
+
+TEST(ProjectilePool, AcquireSpawnsWithAllComponents)
+{
+    ecs::Registry registry;
+    subscribe(registry);
+    EntityIndex index(registry);
+    ProjectilePool pool(registry, index);
+
+    auto entity = pool.acquire(bullet(5.0f, 25));
+    ASSERT_TRUE(entity.has_value());
+
+    const auto e = entity.value();
+    EXPECT_EQ(registry.get<Transform>()->get()[e].position.x, 5.0f);
+    EXPECT_EQ(registry.get<Velocity>()->get()[e].direction.x, 500.0f);
+    EXPECT_EQ(registry.get<BoundingBox>()->get()[e].width, 8.0f);
+    EXPECT_EQ(registry.get<Damage>()->get()[e].amount, 25);
+    EXPECT_EQ(registry.get<NetworkId>()->get()[e].id, NetworkId::of(e));
+    EXPECT_EQ(registry.get<EntityType>()->get()[e].type, net::EntityType::Bullet);
+    EXPECT_EQ(registry.get<RoomId>()->get()[e].id, 1u);
+    EXPECT_EQ(pool.parked(), 0u);
+}
+
+TEST(ProjectilePool, ReleaseHidesAndReusesTheEntity)
+{
+    ecs::Registry registry;
+    subscribe(registry);
+    EntityIndex index(registry);
+    ProjectilePool pool(registry, index);
+
+    const auto first = pool.acquire(bullet(5.0f, 25)).value();
+    registry.add<Homing>(first, Homing{});
+    index.flush();
+    ASSERT_EQ(index.get(EntityCategory::PlayerBullet), std::vector<ecs::Entity>{first});
+    pool.release(first);
+    index.flush();
+    EXPECT_TRUE(index.get(EntityCategory::PlayerBullet).empty());
+
+    EXPECT_EQ(pool.parked(), 1u);
+    EXPECT_FALSE(registry.isAlive(first));
+    EXPECT_EQ(registry.get<EntityType>()->get().size(), 0u);
+    EXPECT_EQ(registry.get<NetworkId>()->get().size(), 0u);
+    EXPECT_EQ(registry.get<Velocity>()->get().size(), 0u);
+    EXPECT_EQ(registry.get<Homing>()->get().size(), 0u);
+
+    const auto second = pool.acquire(bullet(42.0f, 50)).value();
+    EXPECT_EQ(second.index(), first.index());
+    EXPECT_GT(second.generation(), first.generation());
+    EXPECT_EQ(pool.parked(), 0u);
+    EXPECT_EQ(registry.entityCount(), 1u);
+    EXPECT_EQ(registry.get<Transform>()->get().size(), 1u);
+    EXPECT_EQ(registry.get<Transform>()->get()[second].position.x, 42.0f);
+    EXPECT_EQ(registry.get<Damage>()->get()[second].amount, 50);
+    EXPECT_EQ(registry.get<NetworkId>()->get()[second].id, NetworkId::of(second));
+    EXPECT_NE(NetworkId::of(second), NetworkId::of(first));
+    EXPECT_FALSE(registry.has<Homing>(second));
+    index.flush();
+    EXPECT_EQ(index.get(EntityCategory::PlayerBullet), std::vector<ecs::Entity>{second});
+}
+
+TEST(ProjectilePool, ReleaseKillsOtherEntities)
+{
+    ecs::Registry registry;
+    subscribe(registry);
+    EntityIndex index(registry);
+    ProjectilePool pool(registry, index);
+
+    auto enemy = registry.spawn().value();
+    registry.add<EntityType>(enemy, EntityType{net::EntityType::Enemy1});
+    registry.add<Transform>(enemy, Transform{});
+    pool.release(enemy);
+
+    EXPECT_EQ(pool.parked(), 0u);
+    EXPECT_FALSE(registry.isAlive(enemy));
+    EXPECT_EQ(registry.get<Transform>()->get().size(), 0u);
+    EXPECT_EQ(registry.entityCount(), 0u);
+}
+
+TEST(ProjectilePool, ReusesOldestFirst)
+{
+    ecs::Registry registry;
+    subscribe(registry);
+    EntityIndex index(registry);
+    ProjectilePool pool(registry, index);
+
+    const auto a = pool.acquire(bullet(0.0f, 1)).value();
+    const auto b = pool.acquire(bullet(0.0f, 1)).value();
+    pool.release(b);
+    pool.release(a);
+
+    EXPECT_EQ(pool.acquire(bullet(0.0f, 1)).value().index(), b.index());
+    EXPECT_EQ(pool.acquire(bullet(0.0f, 1)).value().index(), a.index());
+    EXPECT_EQ(pool.acquire(bullet(0.0f, 1)).value().index(), b.index() + 1);
+}
+
+TEST(ProjectilePool, NeedsProjectileComponents)
+{
+    ecs::Registry registry;
+    registry.subscribe<Transform>();
+
+    EntityIndex index(registry);
+    EXPECT_THROW(ProjectilePool pool(registry, index), rtp::Error);
+}
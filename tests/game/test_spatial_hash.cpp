@@ -0,0 +1,284 @@
+#include <gtest/gtest.h>
+#include "Systems/SpatialHash.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace rtp::server;
+
+namespace {
+
+    struct Box {
+        float x, y, w, h;
+    };
+
+    // Same test as CollisionSystem::overlaps
+    bool overlaps(const Box &a, const Box &b)
+    {
+        return a.x < b.x + b.w && a.x + a.w > b.x && a.y < b.y + b.h && a.y + a.h > b.y;
+    }
+
+    std::vector<Box> makeBoxes(std::mt19937 &rng, size_t count, float minSize, float maxSize)
+    {
+        std::uniform_real_distribution<float> x(0.0f, 1920.0f);
+        std::uniform_real_distribution<float> y(0.0f, 1080.0f);
+        std::uniform_real_distribution<float> size(minSize, maxSize);
+        std::vector<Box> boxes;
+        boxes.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            boxes.push_back({x(rng), y(rng), size(rng), size(rng)});
+        return boxes;
+    }
+
+    void fill(SpatialHash &grid, const std::vector<Box> &boxes)
+    {
+        grid.clear();
+        for (size_t i = 0; i < boxes.size(); ++i)
+            grid.insert(static_cast<uint32_t>(i), boxes[i].x, boxes[i].y, boxes[i].w, boxes[i].h);
+        grid.build();
+    }
+
+    // First target hit by each bullet, as the collision loops pick it
+    std::vector<int> firstHitsLinear(const std::vector<Box> &bullets, const std::vector<Box> &targets)
+    {
+        std::vector<int> hits(bullets.size(), -1);
+        for (size_t b = 0; b < bullets.size(); ++b) {
+            for (size_t t = 0; t < targets.size(); ++t) {
+                if (overlaps(bullets[b], targets[t])) {
+                    hits[b] = static_cast<int>(t);
+                    break;
+                }
+            }
+        }
+        return hits;
+    }
+
+    std::vector<int> firstHitsGrid(SpatialHash &grid, const std::vector<Box> &bullets,
+                                   const std::vector<Box> &targets, std::vector<uint32_t> &candidates)
+    {
+        fill(grid, targets);
+        std::vector<int> hits(bullets.size(), -1);
+        for (size_t b = 0; b < bullets.size(); ++b) {
+            grid.query(bullets[b].x, bullets[b].y, bullets[b].w, bullets[b].h, candidates);
+            for (uint32_t t : candidates) {
+                if (overlaps(bullets[b], targets[t])) {
+                    hits[b] = static_cast<int>(t);
+                    break;
+                }
+            }
+        }
+        return hits;
+    }
+
+    struct Point {
+        float x, y;
+    };
+
+    std::vector<Point> makePoints(std::mt19937 &rng, size_t count)
+    {
+        std::uniform_real_distribution<float> x(0.0f, 1920.0f);
+        std::uniform_real_distribution<float> y(0.0f, 1080.0f);
+        std::vector<Point> points;
+        points.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            points.push_back({x(rng), y(rng)});
+        return points;
+    }
+
+    // Nearest target of each missile within range, as HomingSystem used to scan for it
+    std::vector<int> nearestLinear(const std::vector<Point> &missiles, const std::vector<Point> &targets, float range)
+    {
+        std::vector<int> found(missiles.size(), -1);
+        for (size_t m = 0; m < missiles.size(); ++m) {
+            float best = range * range;
+            for (size_t t = 0; t < targets.size(); ++t) {
+                const float dx = targets[t].x - missiles[m].x;
+                const float dy = targets[t].y - missiles[m].y;
+                const float d2 = dx * dx + dy * dy;
+                if (d2 <= best && (found[m] < 0 || d2 < best)) {
+                    best = d2;
+                    found[m] = static_cast<int>(t);
+                }
+            }
+        }
+        return found;
+    }
+
+    std::vector<int> nearestGrid(SpatialHash &grid, const std::vector<Point> &missiles,
+                                 const std::vector<Point> &targets, float range, std::vector<uint32_t> &out)
+    {
+        grid.clear();
+        for (size_t i = 0; i < targets.size(); ++i)
+            grid.insert(static_cast<uint32_t>(i), targets[i].x, targets[i].y, 0.0f, 0.0f);
+        grid.build();
+        std::vector<int> found(missiles.size(), -1);
+        for (size_t m = 0; m < missiles.size(); ++m) {
+            grid.nearest(missiles[m].x, missiles[m].y, range, 1, out);
+            if (!out.empty())
+                found[m] = static_cast<int>(out.front());
+        }
+        return found;
+    }
+
+    template <typename Fn>
+    double microsPerCall(size_t iterations, Fn &&fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+            fn();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::micro>(elapsed).count() / iterations;
+    }
+
+}
+
+TEST(SpatialHashTest, QueriesReturnSortedCandidatesOnce) {
+    SpatialHash grid(64.0f);
+    grid.insert(0, 10.0f, 10.0f, 20.0f, 20.0f);
+    grid.insert(1, 100.0f, 10.0f, 200.0f, 20.0f);   // spans four columns
+    grid.insert(2, 1000.0f, 1000.0f, 10.0f, 10.0f);
+    grid.build();
+    ASSERT_EQ(grid.size(), 3u);
+
+    std::vector<uint32_t> out;
+    grid.query(0.0f, 0.0f, 300.0f, 40.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{0, 1}));
+    grid.query(1005.0f, 1005.0f, 1.0f, 1.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{2}));
+
+    grid.clear();
+    grid.build();
+    grid.query(0.0f, 0.0f, 300.0f, 40.0f, out);
+    EXPECT_TRUE(out.empty());
+}
+
+TEST(SpatialHashTest, HandlesNegativeAndOversizedBoxes) {
+    SpatialHash grid(32.0f);
+    grid.insert(0, -50.0f, -50.0f, 10.0f, 10.0f);
+    grid.insert(1, 0.0f, 0.0f, 100000.0f, 10.0f);   // too wide for the grid
+    grid.build();
+
+    std::vector<uint32_t> out;
+    grid.query(-45.0f, -45.0f, 1.0f, 1.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{0, 1}));
+    grid.query(5000.0f, 5.0f, 1.0f, 1.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{1}));
+}
+
+TEST(SpatialHashTest, FirstHitsMatchLinearScan) {
+    std::mt19937 rng(42);
+    const auto targets = makeBoxes(rng, 200, 24.0f, 160.0f);
+    const auto bullets = makeBoxes(rng, 2000, 4.0f, 24.0f);
+
+    SpatialHash grid;
+    std::vector<uint32_t> candidates;
+    EXPECT_EQ(firstHitsGrid(grid, bullets, targets, candidates), firstHitsLinear(bullets, targets));
+}
+
+TEST(SpatialHashTest, BroadphaseLoad) {
+    constexpr size_t BULLETS = 2000;
+    constexpr size_t ENEMIES = 200;
+    constexpr size_t iterations = 50;
+    std::mt19937 rng(7);
+    const auto enemies = makeBoxes(rng, ENEMIES, 32.0f, 96.0f);
+    const auto bullets = makeBoxes(rng, BULLETS, 8.0f, 16.0f);
+
+    SpatialHash grid;
+    std::vector<uint32_t> candidates;
+    std::vector<int> linear;
+    std::vector<int> hashed;
+    const double linearUs = microsPerCall(iterations, [&]() {
+        linear = firstHitsLinear(bullets, enemies);
+    });
+    const double gridUs = microsPerCall(iterations, [&]() {
+        hashed = firstHitsGrid(grid, bullets, enemies, candidates);
+    });
+
+    EXPECT_EQ(hashed, linear);
+    std::cout << "[ LOAD     ] " << BULLETS << " bullets vs " << ENEMIES << " enemies, nested loops: "
+              << linearUs << "us, spatial hash (rebuild + queries): " << gridUs << "us" << std::endl;
+    RecordProperty("linear_us", static_cast<int>(linearUs));
+    RecordProperty("spatial_hash_us", static_cast<int>(gridUs));
+}
+
+TEST(SpatialHashTest, RadiusQueryMeasuresBoxes) {
+    SpatialHash grid(32.0f);
+    grid.insert(0, 0.0f, 0.0f, 10.0f, 10.0f);
+    grid.insert(1, 50.0f, 0.0f, 10.0f, 10.0f);      // 40 to the right of item 0
+    grid.insert(2, 0.0f, 0.0f, 100000.0f, 1.0f);    // oversized
+    grid.insert(3, 300.0f, 300.0f, 0.0f, 0.0f);
+    grid.build();
+
+    std::vector<uint32_t> out;
+    grid.queryRadius(5.0f, 0.5f, 0.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{0, 2}));
+    grid.queryRadius(10.0f, 5.0f, 40.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{0, 1, 2}));
+    grid.queryRadius(300.0f, 290.0f, 9.0f, out);
+    EXPECT_TRUE(out.empty());
+    grid.queryRadius(300.0f, 290.0f, 10.0f, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{3}));
+}
+
+TEST(SpatialHashTest, NearestMatchesLinearScan) {
+    std::mt19937 rng(11);
+    const auto targets = makePoints(rng, 500);
+    const auto missiles = makePoints(rng, 200);
+
+    SpatialHash grid;
+    std::vector<uint32_t> out;
+    for (float range : {0.0f, 30.0f, 600.0f, 5000.0f})
+        EXPECT_EQ(nearestGrid(grid, missiles, targets, range, out), nearestLinear(missiles, targets, range)) << range;
+
+    // A sparse grid falls back to scanning every box
+    const std::vector<Point> few(targets.begin(), targets.begin() + 3);
+    EXPECT_EQ(nearestGrid(grid, missiles, few, 600.0f, out), nearestLinear(missiles, few, 600.0f));
+}
+
+TEST(SpatialHashTest, NearestKeepsKClosestInOrder) {
+    SpatialHash grid(16.0f);
+    grid.insert(0, 100.0f, 0.0f, 0.0f, 0.0f);
+    grid.insert(1, 10.0f, 0.0f, 0.0f, 0.0f);
+    grid.insert(2, -10.0f, 0.0f, 0.0f, 0.0f);       // tie with item 1
+    grid.insert(3, 40.0f, 0.0f, 20.0f, 20.0f);      // spans several cells
+    grid.insert(4, 500.0f, 0.0f, 0.0f, 0.0f);
+    grid.build();
+
+    std::vector<uint32_t> out;
+    grid.nearest(0.0f, 0.0f, 200.0f, 3, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{1, 2, 3}));
+    grid.nearest(0.0f, 0.0f, 200.0f, 10, out);
+    EXPECT_EQ(out, (std::vector<uint32_t>{1, 2, 3, 0}));
+    grid.nearest(0.0f, 0.0f, 200.0f, 0, out);
+    EXPECT_TRUE(out.empty());
+}
+
+TEST(SpatialHashTest, HomingNearestLoad) {
+    constexpr size_t MISSILES = 200;
+    constexpr size_t ENEMIES = 500;
+    constexpr float RANGE = 600.0f;                 // Homing::range default
+    constexpr size_t iterations = 50;
+    std::mt19937 rng(3);
+    const auto enemies = makePoints(rng, ENEMIES);
+    const auto missiles = makePoints(rng, MISSILES);
+
+    SpatialHash grid;
+    std::vector<uint32_t> out;
+    std::vector<int> linear;
+    std::vector<int> hashed;
+    const double linearUs = microsPerCall(iterations, [&]() {
+        linear = nearestLinear(missiles, enemies, RANGE);
+    });
+    const double gridUs = microsPerCall(iterations, [&]() {
+        hashed = nearestGrid(grid, missiles, enemies, RANGE, out);
+    });
+
+    EXPECT_EQ(hashed, linear);
+    std::cout << "[ LOAD     ] " << MISSILES << " homing missiles vs " << ENEMIES << " enemies, full scan: "
+              << linearUs << "us, spatial hash (rebuild + nearest): " << gridUs << "us" << std::endl;
+    RecordProperty("linear_us", static_cast<int>(linearUs));
+    RecordProperty("spatial_hash_us", static_cast<int>(gridUs));
+}
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "Game/TickProfiler.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+using namespace rtp::server;
+using namespace std::chrono_literals;
+using Clock = TickProfiler::Clock;
+
+TEST(TickProfilerTest, DisabledZonesRecordNothing) {
+    TickProfiler profiler;
+    {
+        ProfileZone zone(&profiler, "CollisionSystem", 3);
+    }
+    {
+        ProfileZone zone(nullptr, "CollisionSystem", 3);
+    }
+    EXPECT_TRUE(profiler.getStats().empty());
+}
+
+TEST(TickProfilerTest, KeepsOneHistogramPerZoneAndRoom) {
+    TickProfiler profiler;
+    profiler.setEnabled(true);
+    const auto start = Clock::now();
+
+    for (int i = 1; i <= 100; ++i)
+        profiler.record("CollisionSystem", 1, start, start + std::chrono::microseconds(i * 10));
+    profiler.record("CollisionSystem", 2, start, start + 5ms);
+    profiler.record("tick", TickProfiler::NO_ROOM, start, start + 7ms);
+
+    const auto stats = profiler.getStats();
+    ASSERT_EQ(stats.size(), 3u);
+    EXPECT_EQ(stats[0].name, "CollisionSystem");
+    EXPECT_EQ(stats[0].roomId, 1u);
+    EXPECT_EQ(stats[0].calls, 100u);
+    EXPECT_EQ(stats[0].totalUs, 50500u);
+    EXPECT_EQ(stats[0].p50Us, 500u);
+    EXPECT_EQ(stats[0].p99Us, 990u);
+    EXPECT_EQ(stats[0].maxUs, 1000u);
+    EXPECT_EQ(stats[1].roomId, 2u);
+    EXPECT_EQ(stats[1].maxUs, 5000u);
+    EXPECT_EQ(stats[2].name, "tick");
+
+    profiler.dropRoom(1);
+    EXPECT_EQ(profiler.getStats().size(), 2u);
+}
+
+TEST(TickProfilerTest, ExportsChromeTraceEvents) {
+    TickProfiler profiler;
+    profiler.setEnabled(true);
+    {
+        ProfileZone zone(&profiler, "processNetworkEvents");
+    }
+    {
+        ProfileZone zone(&profiler, "HomingSystem", 4);
+    }
+
+    const auto path = std::filesystem::temp_directory_path() / "rtype_test_trace.json";
+    EXPECT_EQ(profiler.exportTrace(path.string()), 2u);
+
+    std::ifstream in(path);
+    std::stringstream content;
+    content << in.rdbuf();
+    std::filesystem::remove(path);
+
+    const std::string json = content.str();
+    EXPECT_EQ(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0), 0u);
+    EXPECT_NE(json.find("\"name\":\"thread_name\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"processNetworkEvents\",\"cat\":\"server\",\"ph\":\"X\""), std::string::npos);
+    EXPECT_NE(json.find("\"name\":\"HomingSystem\",\"cat\":\"room\""), std::string::npos);
+    EXPECT_NE(json.find("\"args\":{\"room\":4}"), std::string::npos);
+    EXPECT_EQ(json.substr(json.size() - 3), "]}\n");
+}
@@ -0,0 +1,74 @@
+#include <gtest/gtest.h>
+#include "Game/TickScheduler.hpp"
+
+#include <chrono>
+
+using namespace rtp::server;
+using namespace std::chrono_literals;
+using Clock = TickScheduler::Clock;
+
+TEST(TickSchedulerTest, DeadlinesAreAbsolute) {
+    const auto start = Clock::time_point{} + 1h;
+    TickScheduler scheduler(50, start);
+    ASSERT_EQ(scheduler.getPeriod(), Clock::duration(20ms));
+
+    EXPECT_EQ(scheduler.collectDueTicks(start + 19ms), 0u);
+    EXPECT_EQ(scheduler.collectDueTicks(start + 20ms), 1u);
+    // A tick that started 1 ms late does not delay the next deadline
+    EXPECT_EQ(scheduler.getDeadline(), start + 40ms);
+    EXPECT_EQ(scheduler.collectDueTicks(start + 41ms), 1u);
+    EXPECT_EQ(scheduler.getDeadline(), start + 60ms);
+    EXPECT_EQ(scheduler.getStats().lateTicks, 0u);
+}
+
+TEST(TickSchedulerTest, CatchesUpWithinTheCap) {
+    const auto start = Clock::time_point{} + 1h;
+    TickScheduler scheduler(50, start);
+
+    // Three deadlines passed: 20, 40 and 60 ms
+    EXPECT_EQ(scheduler.collectDueTicks(start + 65ms), 3u);
+    EXPECT_EQ(scheduler.getDeadline(), start + 80ms);
+    EXPECT_EQ(scheduler.getStats().lateTicks, 3u);
+    EXPECT_EQ(scheduler.getStats().skippedTicks, 0u);
+}
+
+TEST(TickSchedulerTest, DropsTheBacklogPastTheCap) {
+    const auto start = Clock::time_point{} + 1h;
+    TickScheduler scheduler(50, start);
+
+    // Ten ticks due, only MAX_CATCH_UP_TICKS run and the rest are skipped
+    const auto now = start + 205ms;
+    EXPECT_EQ(scheduler.collectDueTicks(now), TickScheduler::MAX_CATCH_UP_TICKS);
+    EXPECT_EQ(scheduler.getStats().skippedTicks, 10u - TickScheduler::MAX_CATCH_UP_TICKS);
+    EXPECT_EQ(scheduler.getDeadline(), now + 20ms);
+}
+
+TEST(TickSchedulerTest, CountsOverrunsAndPercentiles) {
+    TickScheduler scheduler(100);
+
+    for (int i = 1; i <= 100; ++i)
+        scheduler.recordTick(std::chrono::microseconds(i * 100));
+
+    const TickStats stats = scheduler.getStats();
+    EXPECT_EQ(stats.tickRate, 100u);
+    EXPECT_EQ(stats.ticks, 100u);
+    // Period is 10 ms, the longest tick only reaches it
+    EXPECT_EQ(stats.overruns, 0u);
+    EXPECT_EQ(stats.p50Us, 5000u);
+    EXPECT_EQ(stats.p90Us, 9000u);
+    EXPECT_EQ(stats.p99Us, 9900u);
+    EXPECT_EQ(stats.maxUs, 10000u);
+
+    scheduler.recordTick(25ms);
+    EXPECT_EQ(scheduler.getStats().overruns, 1u);
+    EXPECT_EQ(scheduler.getStats().maxUs, 25000u);
+}
+
+TEST(TickSchedulerTest, WaitsUntilTheDeadline) {
+    TickScheduler scheduler(200);
+    const auto deadline = scheduler.getDeadline();
+
+    scheduler.waitForDeadline();
+    EXPECT_GE(Clock::now(), deadline);
+    EXPECT_GE(scheduler.collectDueTicks(Clock::now()), 1u);
+}
@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include "Game/EventCapture.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+using namespace rtp;
+
+namespace {
+
+    std::filesystem::path capturePath(const char *name)
+    {
+        return std::filesystem::temp_directory_path() / name;
+    }
+
+    net::NetworkEvent makeEvent(uint32_t sessionId, net::OpCode opCode, std::vector<uint8_t> body)
+    {
+        net::NetworkEvent event{sessionId, net::Packet(opCode)};
+        event.packet.body.assign(body.begin(), body.end());
+        event.packet.header.bodySize = static_cast<uint32_t>(body.size());
+        return event;
+    }
+
+}
+
+TEST(EventCaptureTest, RoundTripsEventsAndHeader) {
+    const auto path = capturePath("rtype_test_capture.bin");
+    server::CaptureInfo info;
+    info.randSeed = 1234;
+    info.snapshotInterval = 3;
+    info.tickRate = 30;
+    info.accounts = "alice:pw\nbob:pw\n";
+
+    std::vector<uint8_t> large(4000, 0xAB);
+    {
+        server::EventRecorder recorder(path.string(), info);
+        recorder.record(0, makeEvent(1, net::OpCode::Hello, {}));
+        recorder.record(0, makeEvent(1, net::OpCode::LoginRequest, {1, 2, 3}));
+        recorder.record(5, makeEvent(300, net::OpCode::InputTick, {9, 8}));
+        recorder.record(100000, makeEvent(2, net::OpCode::RoomChatSended, large));
+        EXPECT_EQ(recorder.getEventCount(), 4u);
+    }
+
+    server::CaptureReader reader(path.string());
+    EXPECT_EQ(reader.getInfo().randSeed, 1234u);
+    EXPECT_EQ(reader.getInfo().snapshotInterval, 3u);
+    EXPECT_EQ(reader.getInfo().tickRate, 30u);
+    EXPECT_EQ(reader.getInfo().accounts, info.accounts);
+
+    std::vector<server::CapturedEvent> events;
+    server::CapturedEvent event;
+    while (reader.next(event))
+        events.push_back(std::move(event));
+
+    ASSERT_EQ(events.size(), 4u);
+    EXPECT_EQ(events[0].tick, 0u);
+    EXPECT_EQ(events[0].event.packet.header.opCode, net::OpCode::Hello);
+    EXPECT_TRUE(events[0].event.packet.body.empty());
+    EXPECT_EQ(events[1].event.packet.body.size(), 3u);
+    EXPECT_EQ(events[2].tick, 5u);
+    EXPECT_EQ(events[2].event.sessionId, 300u);
+    EXPECT_EQ(events[2].event.packet.header.sessionId, 300u);
+    EXPECT_EQ(events[2].event.packet.header.bodySize, 2u);
+    EXPECT_EQ(events[2].event.packet.body[0], 9);
+    EXPECT_EQ(events[3].tick, 100000u);
+    EXPECT_EQ(events[3].event.packet.body.size(), large.size());
+
+    // Header, then four framing bytes per small event and seven for the large one
+    const size_t header = 6 * 4 + info.accounts.size();
+    const size_t bodies = 3 + 2 + large.size();
+    EXPECT_EQ(std::filesystem::file_size(path), header + bodies + 4 + 4 + 5 + 7);
+
+    std::filesystem::remove(path);
+}
+
+TEST(EventCaptureTest, RejectsForeignAndTruncatedFiles) {
+    const auto path = capturePath("rtype_test_capture_bad.bin");
+    std::ofstream(path, std::ios::binary) << "not a capture";
+    EXPECT_THROW(server::CaptureReader reader(path.string()), std::runtime_error);
+
+    {
+        server::EventRecorder recorder(path.string(), {});
+        recorder.record(1, makeEvent(1, net::OpCode::InputTick, {1, 2, 3, 4}));
+    }
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) - 2);
+
+    server::CaptureReader reader(path.string());
+    server::CapturedEvent event;
+    EXPECT_THROW(reader.next(event), std::runtime_error);
+
+    std::filesystem::remove(path);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "RType/Network/INetwork.hpp"
+#include "RType/Thread/MpscRing.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+using namespace rtp;
+
+namespace {
+
+    constexpr size_t PRODUCERS = 4;
+
+    net::NetworkEvent makeEvent(uint32_t producer, uint32_t index)
+    {
+        net::NetworkEvent event{producer, net::Packet(net::OpCode::InputTick)};
+        event.packet << index;
+        return event;
+    }
+
+    struct LockedQueue {
+        std::mutex mutex;
+        std::queue<net::NetworkEvent> queue;
+
+        bool push(net::NetworkEvent &&event)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.push(std::move(event));
+            return true;
+        }
+
+        size_t drain(std::span<net::NetworkEvent> out)
+        {
+            size_t count = 0;
+            while (count < out.size()) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (queue.empty())
+                    break;
+                out[count++] = std::move(queue.front());
+                queue.pop();
+            }
+            return count;
+        }
+    };
+
+    struct RingQueue {
+        thread::MpscRing<net::NetworkEvent> ring{net::EVENT_QUEUE_CAPACITY};
+
+        bool push(net::NetworkEvent &&event)
+        {
+            return ring.tryPush(std::move(event));
+        }
+
+        size_t drain(std::span<net::NetworkEvent> out)
+        {
+            return ring.popBatch(out);
+        }
+    };
+
+    template<typename Queue>
+    double eventsPerSecond(Queue &queue, size_t perProducer)
+    {
+        std::vector<net::NetworkEvent> batch(256);
+        std::vector<std::thread> producers;
+        std::atomic<bool> go{false};
+
+        for (uint32_t p = 0; p < PRODUCERS; ++p) {
+            producers.emplace_back([&, p]() {
+                while (!go.load(std::memory_order_acquire))
+                    std::this_thread::yield();
+                for (uint32_t i = 0; i < perProducer; ++i) {
+                    auto event = makeEvent(p, i);
+                    while (!queue.push(std::move(event)))
+                        std::this_thread::yield();
+                }
+            });
+        }
+
+        const size_t expected = PRODUCERS * perProducer;
+        size_t received = 0;
+        const auto start = std::chrono::steady_clock::now();
+        go.store(true, std::memory_order_release);
+        while (received < expected)
+            received += queue.drain(batch);
+        const double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+
+        for (auto &producer : producers)
+            producer.join();
+        return seconds > 0.0 ? expected / seconds : 0.0;
+    }
+
+}
+
+TEST(MpscRingTest, CapacityRoundsUpToPowerOfTwo) {
+    thread::MpscRing<int> ring(100);
+    EXPECT_EQ(ring.capacity(), 128u);
+}
+
+TEST(MpscRingTest, FifoAndFullRing) {
+    thread::MpscRing<int> ring(4);
+    for (int i = 0; i < 4; ++i)
+        EXPECT_TRUE(ring.tryPush(int{i}));
+    EXPECT_FALSE(ring.tryPush(42));
+
+    EXPECT_EQ(ring.tryPop(), 0);
+    EXPECT_TRUE(ring.tryPush(4));
+
+    std::array<int, 8> out{};
+    ASSERT_EQ(ring.popBatch(out), 4u);
+    EXPECT_EQ(out[0], 1);
+    EXPECT_EQ(out[3], 4);
+    EXPECT_FALSE(ring.tryPop().has_value());
+}
+
+TEST(MpscRingTest, MovesEventsWithoutCopyingBodies) {
+    thread::MpscRing<net::NetworkEvent> ring(8);
+    auto event = makeEvent(7, 99);
+    const uint8_t *body = event.packet.body.data();
+    ASSERT_TRUE(ring.tryPush(std::move(event)));
+
+    auto popped = ring.tryPop();
+    ASSERT_TRUE(popped.has_value());
+    EXPECT_EQ(popped->sessionId, 7u);
+    EXPECT_EQ(popped->packet.body.data(), body);
+}
+
+TEST(MpscRingTest, FourProducersKeepPerProducerOrder) {
+    constexpr uint32_t perProducer = 20000;
+    thread::MpscRing<uint64_t> ring(1024);
+    std::vector<std::thread> producers;
+
+    for (uint64_t p = 0; p < PRODUCERS; ++p) {
+        producers.emplace_back([&ring, p]() {
+            for (uint64_t i = 0; i < perProducer; ++i) {
+                while (!ring.tryPush((p << 32) | i))
+                    std::this_thread::yield();
+            }
+        });
+    }
+
+    std::array<uint64_t, PRODUCERS> next{};
+    std::array<uint64_t, 64> batch{};
+    size_t received = 0;
+    while (received < PRODUCERS * perProducer) {
+        const size_t count = ring.popBatch(batch);
+        for (size_t i = 0; i < count; ++i) {
+            const uint64_t producer = batch[i] >> 32;
+            ASSERT_LT(producer, PRODUCERS);
+            ASSERT_EQ(batch[i] & 0xFFFFFFFFu, next[producer]++);
+        }
+        received += count;
+    }
+    for (auto &producer : producers)
+        producer.join();
+}
+
+TEST(MpscRingLoadTest, FourProducerContention) {
+    constexpr size_t perProducer = 100000;
+
+    LockedQueue locked;
+    RingQueue ring;
+    const double lockedRate = eventsPerSecond(locked, perProducer);
+    const double ringRate = eventsPerSecond(ring, perProducer);
+
+    std::cout << "[ LOAD     ] mutex + std::queue: " << static_cast<uint64_t>(lockedRate)
+              << " events/s" << std::endl;
+    std::cout << "[ LOAD     ] MpscRing + batch:   " << static_cast<uint64_t>(ringRate)
+              << " events/s" << std::endl;
+    RecordProperty("locked_events_per_sec", static_cast<int>(lockedRate));
+    RecordProperty("ring_events_per_sec", static_cast<int>(ringRate));
+}
@@ -0,0 +1,331 @@
+#include <gtest/gtest.h>
+#include "NetSimProxy.hpp"
+#include "RType/Network/ImpairedLink.hpp"
+#include "RType/Network/ReliableChannel.hpp"
+
+#include <algorithm>
+#include <asio.hpp>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace rtp;
+using namespace std::chrono_literals;
+using Clock = net::ImpairedLink::Clock;
+
+namespace {
+
+    /**
+     * UDP and TCP echo server on one ephemeral port, like the game server
+     */
+    struct EchoServer {
+        asio::io_context io;
+        asio::ip::tcp::acceptor acceptor{io, {asio::ip::tcp::v4(), 0}};
+        asio::ip::udp::socket udp{io, {asio::ip::udp::v4(), acceptor.local_endpoint().port()}};
+        std::array<uint8_t, 2048> datagram{};
+        asio::ip::udp::endpoint sender;
+        std::thread thread;
+
+        EchoServer()
+        {
+            receive();
+            accept();
+            thread = std::thread([this]() { io.run(); });
+        }
+
+        ~EchoServer()
+        {
+            io.stop();
+            thread.join();
+        }
+
+        uint16_t port() const
+        {
+            return acceptor.local_endpoint().port();
+        }
+
+        void receive()
+        {
+            udp.async_receive_from(asio::buffer(datagram), sender,
+                [this](const asio::error_code &ec, std::size_t bytes) {
+                    if (ec)
+                        return;
+                    udp.send_to(asio::buffer(datagram.data(), bytes), sender);
+                    receive();
+                });
+        }
+
+        void accept()
+        {
+            acceptor.async_accept([this](const asio::error_code &ec, asio::ip::tcp::socket socket) {
+                if (ec)
+                    return;
+                auto peer = std::make_shared<asio::ip::tcp::socket>(std::move(socket));
+                auto buffer = std::make_shared<std::array<uint8_t, 4096>>();
+                echo(peer, buffer);
+                accept();
+            });
+        }
+
+        void echo(std::shared_ptr<asio::ip::tcp::socket> peer,
+                  std::shared_ptr<std::array<uint8_t, 4096>> buffer)
+        {
+            peer->async_read_some(asio::buffer(*buffer),
+                [this, peer, buffer](const asio::error_code &ec, std::size_t bytes) {
+                    if (ec)
+                        return;
+                    asio::write(*peer, asio::buffer(buffer->data(), bytes));
+                    echo(peer, buffer);
+                });
+        }
+    };
+
+    netsim::ProxyConfig proxyTo(uint16_t serverPort, const net::Impairment &both)
+    {
+        netsim::ProxyConfig config;
+        config.serverPort = serverPort;
+        config.upstream = both;
+        config.downstream = both;
+        return config;
+    }
+
+}
+
+TEST(ImpairedLinkTest, PassesThroughByDefault) {
+    net::ImpairedLink link;
+    std::array<Clock::time_point, 2> arrivals{};
+    const Clock::time_point now{};
+    ASSERT_EQ(link.scheduleDatagram(now, 100, arrivals), 1u);
+    EXPECT_EQ(arrivals[0], now);
+    EXPECT_EQ(link.scheduleStream(now, 100), now);
+}
+
+TEST(ImpairedLinkTest, DropsAndDuplicatesAtConfiguredRates) {
+    net::ImpairedLink link({.delay = 30ms, .jitter = 10ms, .loss = 0.1, .duplicate = 0.05}, 7);
+    std::array<Clock::time_point, 2> arrivals{};
+    const Clock::time_point now{};
+    constexpr size_t count = 100000;
+
+    for (size_t i = 0; i < count; ++i) {
+        const size_t copies = link.scheduleDatagram(now, 64, arrivals);
+        for (size_t c = 0; c < copies; ++c) {
+            EXPECT_GE(arrivals[c], now + 20ms);
+            EXPECT_LE(arrivals[c], now + 40ms);
+        }
+    }
+    const auto stats = link.getStats();
+    EXPECT_EQ(stats.packets, count);
+    EXPECT_NEAR(static_cast<double>(stats.dropped) / count, 0.10, 0.01);
+    EXPECT_NEAR(static_cast<double>(stats.duplicated) / (count - stats.dropped), 0.05, 0.01);
+    EXPECT_EQ(stats.delivered, count - stats.dropped + stats.duplicated);
+}
+
+TEST(ImpairedLinkTest, SameSeedSameSchedule) {
+    const net::Impairment bad{.delay = 50ms, .jitter = 25ms, .loss = 0.2, .duplicate = 0.1,
+                              .reorder = 0.1};
+    net::ImpairedLink first(bad, 42);
+    net::ImpairedLink second(bad, 42);
+    std::array<Clock::time_point, 2> a{};
+    std::array<Clock::time_point, 2> b{};
+    Clock::time_point now{};
+
+    for (int i = 0; i < 1000; ++i, now += 1ms) {
+        const size_t copies = first.scheduleDatagram(now, 200, a);
+        ASSERT_EQ(second.scheduleDatagram(now, 200, b), copies);
+        for (size_t c = 0; c < copies; ++c)
+            ASSERT_EQ(a[c], b[c]);
+    }
+}
+
+TEST(ImpairedLinkTest, StreamStaysOrderedThroughLoss) {
+    net::ImpairedLink link({.delay = 20ms, .jitter = 15ms, .loss = 0.1}, 3);
+    Clock::time_point now{};
+    Clock::time_point previous{};
+    Clock::duration worst{};
+
+    for (int i = 0; i < 5000; ++i, now += 2ms) {
+        const auto arrival = link.scheduleStream(now, 1000);
+        ASSERT_GE(arrival, previous);
+        worst = std::max(worst, arrival - now);
+        previous = arrival;
+    }
+    const auto stats = link.getStats();
+    EXPECT_EQ(stats.delivered, stats.packets);
+    EXPECT_EQ(stats.dropped, 0u);
+    EXPECT_GT(stats.retransmits, 0u);
+    EXPECT_GE(worst, net::ImpairedLink::MIN_RETRANSMIT);
+}
+
+TEST(ImpairedLinkTest, BandwidthCapPacesAndTailDrops) {
+    // 1 Mbit/s: a 1250-byte datagram takes 10 ms to go out
+    net::ImpairedLink link({.bandwidth = 125000, .queueLimit = 12500});
+    std::array<Clock::time_point, 2> arrivals{};
+    const Clock::time_point now{};
+
+    size_t sent = 0;
+    for (int i = 0; i < 20; ++i) {
+        if (link.scheduleDatagram(now, 1250, arrivals) == 0)
+            continue;
+        ++sent;
+        EXPECT_EQ(arrivals[0], now + sent * 10ms);
+    }
+    EXPECT_EQ(sent, 10u);
+    EXPECT_EQ(link.getStats().dropped, 10u);
+
+    ASSERT_EQ(link.scheduleDatagram(now + 50ms, 1250, arrivals), 1u);
+    EXPECT_EQ(arrivals[0], now + 110ms);
+}
+
+TEST(ImpairedLinkTest, ReorderHoldsDatagramsBack) {
+    net::ImpairedLink link({.delay = 10ms, .reorder = 0.25, .reorderGap = 30ms}, 9);
+    std::array<Clock::time_point, 2> arrivals{};
+    Clock::time_point now{};
+    std::vector<Clock::time_point> order;
+
+    for (int i = 0; i < 400; ++i, now += 5ms) {
+        ASSERT_EQ(link.scheduleDatagram(now, 64, arrivals), 1u);
+        order.push_back(arrivals[0]);
+    }
+    EXPECT_FALSE(std::is_sorted(order.begin(), order.end()));
+    EXPECT_NEAR(static_cast<double>(link.getStats().reordered) / 400, 0.25, 0.07);
+}
+
+TEST(ImpairedLinkLoadTest, ReliableChannelOverVirtualNetwork) {
+    constexpr uint32_t count = 2000;
+    constexpr auto tick = 16ms;
+    const net::Impairment bad{.delay = 40ms, .jitter = 20ms, .loss = 0.1, .duplicate = 0.02,
+                              .reorder = 0.05};
+    net::ImpairedLink down(bad, 1);
+    net::ImpairedLink up(bad, 2);
+    net::ReliableChannel server;
+    net::ReliableChannel client;
+
+    struct InFlight {
+        Clock::time_point at;
+        net::Packet datagram;
+    };
+    std::vector<InFlight> toClient;
+    std::vector<InFlight> toServer;
+    const auto transmit = [](net::ImpairedLink &link, Clock::time_point now,
+                             std::vector<net::Packet> &wire, std::vector<InFlight> &inFlight) {
+        std::array<Clock::time_point, 2> arrivals{};
+        for (const auto &datagram : wire) {
+            const size_t copies = link.scheduleDatagram(now, datagram.body.size(), arrivals);
+            for (size_t c = 0; c < copies; ++c)
+                inFlight.push_back({arrivals[c], datagram});
+        }
+        wire.clear();
+    };
+    const auto deliver = [](Clock::time_point now, std::vector<InFlight> &inFlight,
+                            net::ReliableChannel &to, std::vector<net::Packet> &out) {
+        std::stable_sort(inFlight.begin(), inFlight.end(),
+            [](const InFlight &a, const InFlight &b) { return a.at < b.at; });
+        auto it = inFlight.begin();
+        for (; it != inFlight.end() && it->at <= now; ++it) {
+            it->datagram.resetRead();
+            to.receive(it->datagram, now, out);
+        }
+        inFlight.erase(inFlight.begin(), it);
+    };
+
+    for (uint32_t i = 0; i < count; ++i) {
+        net::Packet message(net::OpCode::EntityDeath);
+        message << i;
+        server.send(message);
+    }
+
+    Clock::time_point now{};
+    std::vector<net::Packet> wire;
+    std::vector<net::Packet> delivered;
+    std::vector<net::Packet> ignored;
+    for (int guard = 0; delivered.size() < count && guard < 100000; ++guard) {
+        server.flush(now, wire);
+        transmit(down, now, wire, toClient);
+        client.flush(now, wire);
+        transmit(up, now, wire, toServer);
+        now += tick;
+        deliver(now, toClient, client, delivered);
+        deliver(now, toServer, server, ignored);
+    }
+
+    ASSERT_EQ(delivered.size(), count);
+    for (uint32_t i = 0; i < count; ++i) {
+        uint32_t index = 0;
+        delivered[i] >> index;
+        ASSERT_EQ(index, i);
+    }
+    const double seconds = std::chrono::duration<double>(now.time_since_epoch()).count();
+    std::cout << "[ LOAD     ] " << count << " reliable messages over 40+-20ms, 10% loss: "
+              << seconds << "s virtual, " << server.getStats().messagesResent << " resent"
+              << std::endl;
+    RecordProperty("virtual_ms", static_cast<int>(seconds * 1000.0));
+}
+
+TEST(NetSimProxyTest, ForwardsDatagramsWithLatencyAndLoss) {
+    EchoServer echo;
+    netsim::NetSimProxy proxy(proxyTo(echo.port(), {.delay = 15ms}));
+    proxy.start();
+
+    asio::io_context io;
+    asio::ip::udp::socket socket(io, {asio::ip::udp::v4(), 0});
+    const asio::ip::udp::endpoint target(asio::ip::make_address("127.0.0.1"), proxy.getPort());
+    std::array<uint8_t, 64> reply{};
+
+    const auto start = std::chrono::steady_clock::now();
+    socket.send_to(asio::buffer("ping", 4), target);
+    asio::ip::udp::endpoint from;
+    ASSERT_EQ(socket.receive_from(asio::buffer(reply), from), 4u);
+    EXPECT_GE(std::chrono::steady_clock::now() - start, 30ms);
+
+    proxy.setImpairment(netsim::Direction::Upstream, {.loss = 0.5});
+    proxy.setImpairment(netsim::Direction::Downstream, {});
+    std::this_thread::sleep_for(20ms);
+    for (int i = 0; i < 200; ++i)
+        socket.send_to(asio::buffer("ping", 4), target);
+
+    socket.non_blocking(true);
+    size_t echoed = 0;
+    const auto deadline = std::chrono::steady_clock::now() + 500ms;
+    while (std::chrono::steady_clock::now() < deadline) {
+        asio::error_code ec;
+        if (socket.receive_from(asio::buffer(reply), from, 0, ec) > 0)
+            ++echoed;
+        else
+            std::this_thread::sleep_for(1ms);
+    }
+    EXPECT_GT(echoed, 60u);
+    EXPECT_LT(echoed, 140u);
+
+    proxy.stop();
+    const auto up = proxy.getStats(netsim::Direction::Upstream);
+    EXPECT_EQ(up.packets, 201u);
+    EXPECT_EQ(up.dropped, 200u - echoed);
+}
+
+TEST(NetSimProxyTest, KeepsStreamIntactThroughLossAndJitter) {
+    EchoServer echo;
+    netsim::NetSimProxy proxy(proxyTo(echo.port(), {.delay = 5ms, .jitter = 5ms, .loss = 0.05}));
+    proxy.start();
+
+    asio::io_context io;
+    asio::ip::tcp::socket socket(io);
+    socket.connect({asio::ip::make_address("127.0.0.1"), proxy.getPort()});
+
+    std::vector<uint8_t> sent(64 * 1024);
+    for (size_t i = 0; i < sent.size(); ++i)
+        sent[i] = static_cast<uint8_t>(i * 31 + 7);
+    std::thread writer([&]() {
+        for (size_t offset = 0; offset < sent.size(); offset += 1000)
+            asio::write(socket, asio::buffer(sent.data() + offset,
+                                             std::min<size_t>(1000, sent.size() - offset)));
+    });
+
+    std::vector<uint8_t> received(sent.size());
+    asio::read(socket, asio::buffer(received));
+    writer.join();
+    EXPECT_EQ(received, sent);
+
+    proxy.stop();
+    EXPECT_GE(proxy.getStats(netsim::Direction::Upstream).bytes, sent.size());
+}
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+#include "ServerNetwork/ServerNetwork.hpp"
+#include "RType/Network/TrafficStats.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace rtp;
+using asio::ip::tcp;
+using asio::ip::udp;
+
+namespace {
+
+    constexpr auto In = net::TrafficDirection::Inbound;
+    constexpr auto Out = net::TrafficDirection::Outbound;
+
+    struct Client {
+        tcp::socket tcpSocket;
+        udp::socket udpSocket;
+        uint32_t sessionId = 0;
+
+        Client(asio::io_context &io, uint16_t port)
+            : tcpSocket(io), udpSocket(io)
+        {
+            const auto loopback = asio::ip::address_v4::loopback();
+            tcpSocket.connect(tcp::endpoint(loopback, port));
+
+            std::array<uint8_t, sizeof(net::Header) + sizeof(uint32_t)> welcome{};
+            asio::read(tcpSocket, asio::buffer(welcome));
+            std::memcpy(&sessionId, welcome.data() + sizeof(net::Header), sizeof(sessionId));
+            sessionId = net::Packet::from_network(sessionId);
+
+            udpSocket.open(udp::v4());
+            udpSocket.connect(udp::endpoint(loopback, port));
+        }
+
+        void send(const net::Packet &packet)
+        {
+            asio::error_code ec;
+            udpSocket.send(packet.getBufferSequence(), 0, ec);
+        }
+
+        void hello(void)
+        {
+            net::Packet packet(net::OpCode::Hello);
+            packet.header.sessionId = sessionId;
+            send(packet);
+        }
+    };
+
+    template <typename Predicate>
+    bool waitFor(Predicate predicate, std::chrono::milliseconds timeout = std::chrono::milliseconds(2000))
+    {
+        const auto end = std::chrono::steady_clock::now() + timeout;
+        while (std::chrono::steady_clock::now() < end) {
+            if (predicate())
+                return true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return predicate();
+    }
+
+    const server::NetworkStats::SessionEntry *findSession(const server::NetworkStats &stats, uint32_t id)
+    {
+        for (const auto &entry : stats.sessions) {
+            if (entry.sessionId == id)
+                return &entry;
+        }
+        return nullptr;
+    }
+
+}
+
+TEST(TrafficCountersTest, CountsPerOpCodeDirectionAndTransport) {
+    net::TrafficCounters counters;
+    counters.record(In, net::NetworkMode::UDP, net::OpCode::InputTick, 20);
+    counters.record(In, net::NetworkMode::UDP, net::OpCode::InputTick, 30);
+    counters.record(Out, net::NetworkMode::ReliableUDP, net::OpCode::Reliable, 100);
+    counters.record(Out, net::NetworkMode::TCP, net::OpCode::RoomList, 7);
+
+    const auto snapshot = counters.snapshot();
+    EXPECT_EQ(snapshot.at(In, net::NetworkMode::UDP, net::OpCode::InputTick).packets, 2u);
+    EXPECT_EQ(snapshot.at(In, net::NetworkMode::UDP, net::OpCode::InputTick).bytes, 50u);
+    EXPECT_EQ(snapshot.at(In, net::NetworkMode::TCP, net::OpCode::InputTick).packets, 0u);
+    EXPECT_EQ(snapshot.at(Out, net::NetworkMode::UDP, net::OpCode::Reliable).bytes, 100u);
+    EXPECT_EQ(snapshot.total(Out, net::NetworkMode::UDP).packets, 1u);
+    EXPECT_EQ(snapshot.total(Out, net::NetworkMode::TCP).bytes, 7u);
+    EXPECT_EQ(snapshot.total(In, net::NetworkMode::TCP).packets, 0u);
+    EXPECT_EQ(net::toString(net::OpCode::RoomUpdate), "RoomUpdate");
+    EXPECT_EQ(net::toString(static_cast<net::OpCode>(0xFF)), "Unknown");
+}
+
+TEST(NetworkStatsTest, CountsTrafficAndUdpDrops) {
+    constexpr uint16_t port = 47341;
+    server::ServerNetwork network(port);
+    network.setTcpFlushPolicy(net::TcpFlushPolicy::EndOfTick);
+    network.start();
+
+    asio::io_context io;
+    Client client(io, port);
+
+    net::Packet input(net::OpCode::InputTick);
+    input << net::InputPayload{1, 1};
+    client.send(input);
+    client.hello();
+    ASSERT_TRUE(waitFor([&] { return network.getNetworkStats().traffic
+        .at(In, net::NetworkMode::UDP, net::OpCode::Hello).packets == 1; }));
+    for (int i = 0; i < 3; ++i)
+        client.send(input);
+
+    std::array<uint8_t, sizeof(net::Header)> truncated{};
+    net::Header header{};
+    header.magic = net::Packet::to_network(net::MAGIC_NUMBER);
+    header.bodySize = net::Packet::to_network(uint32_t{16});
+    header.opCode = net::OpCode::InputTick;
+    std::memcpy(truncated.data(), &header, sizeof(header));
+    client.udpSocket.send(asio::buffer(truncated));
+
+    const size_t inputBytes = sizeof(net::Header) + input.body.size();
+    ASSERT_TRUE(waitFor([&] {
+        const auto stats = network.getNetworkStats();
+        return stats.traffic.at(In, net::NetworkMode::UDP, net::OpCode::InputTick).packets == 4
+            && stats.udpSizeMismatch == 1;
+    }));
+
+    auto stats = network.getNetworkStats();
+    EXPECT_EQ(stats.traffic.at(In, net::NetworkMode::UDP, net::OpCode::InputTick).bytes, 4 * inputBytes);
+    EXPECT_EQ(stats.udpUnbound, 1u);
+    EXPECT_EQ(stats.traffic.at(Out, net::NetworkMode::TCP, net::OpCode::Welcome).packets, 1u);
+
+    net::Packet list(net::OpCode::RoomList);
+    list << uint32_t{0};
+    for (int i = 0; i < 3; ++i)
+        network.sendPacket(client.sessionId, list, net::NetworkMode::TCP);
+    network.sendPacket(client.sessionId, net::Packet(net::OpCode::Pong), net::NetworkMode::UDP);
+
+    stats = network.getNetworkStats();
+    EXPECT_EQ(stats.traffic.at(Out, net::NetworkMode::TCP, net::OpCode::RoomList).packets, 3u);
+    EXPECT_EQ(stats.traffic.at(Out, net::NetworkMode::UDP, net::OpCode::Pong).bytes, sizeof(net::Header));
+    const auto *session = findSession(stats, client.sessionId);
+    ASSERT_NE(session, nullptr);
+    EXPECT_EQ(session->link.writeQueueDepth, 3u);
+    EXPECT_EQ(session->link.writeQueuePeak, 3u);
+
+    network.flushTcp();
+    network.flushUdp();
+    ASSERT_TRUE(waitFor([&] {
+        const auto current = network.getNetworkStats();
+        const auto *entry = findSession(current, client.sessionId);
+        return entry != nullptr && entry->link.writeQueueDepth == 0;
+    }));
+    stats = network.getNetworkStats();
+    EXPECT_EQ(findSession(stats, client.sessionId)->link.writeQueuePeak, 3u);
+
+    network.stop();
+}
+
+TEST(NetworkStatsTest, MeasuresRttFromPingProbes) {
+    constexpr uint16_t port = 47342;
+    server::ServerNetwork network(port);
+    network.setStatsInterval(std::chrono::seconds(1));
+    network.start();
+
+    asio::io_context io;
+    Client client(io, port);
+    client.hello();
+
+    // Answer the server probe the way ClientNetwork does
+    std::array<uint8_t, 256> buffer{};
+    client.udpSocket.non_blocking(false);
+    size_t bytes = 0;
+    net::Header header{};
+    do {
+        bytes = client.udpSocket.receive(asio::buffer(buffer));
+        std::memcpy(&header, buffer.data(), sizeof(header));
+    } while (header.opCode != net::OpCode::Ping);
+    EXPECT_EQ(bytes, sizeof(net::Header) + sizeof(uint64_t));
+
+    header.opCode = net::OpCode::Pong;
+    std::memcpy(buffer.data(), &header, sizeof(header));
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    client.udpSocket.send(asio::buffer(buffer.data(), bytes));
+
+    ASSERT_TRUE(waitFor([&] {
+        const auto current = network.getNetworkStats();
+        const auto *entry = findSession(current, client.sessionId);
+        return entry != nullptr && entry->link.rttUs > 0;
+    }));
+    const auto stats = network.getNetworkStats();
+    EXPECT_GE(findSession(stats, client.sessionId)->link.rttUs, 5000u);
+    EXPECT_EQ(stats.traffic.at(In, net::NetworkMode::UDP, net::OpCode::Pong).packets, 1u);
+
+    network.stop();
+}
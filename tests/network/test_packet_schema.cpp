@@ -0,0 +1,199 @@
+#include <gtest/gtest.h>
+#include "RType/Network/Packet.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+using namespace rtp::net;
+
+namespace {
+
+    constexpr uint32_t SNAPSHOT_ENTITIES = 500;
+
+    static_assert(schema::IS_BULK<EntitySnapshotPayload>);
+    static_assert(schema::IS_BULK<EntitySpawnPayload>);
+    static_assert(schema::IS_BULK<EntityDeathPayload>);
+    static_assert(!schema::IS_BULK<RoomInfo>);
+    static_assert(!schema::IS_BULK<GameOverPayload>);
+    static_assert(schema::wireSize<EntitySnapshotPayload>() == 24);
+    static_assert(schema::wireSize<LoginPayload>() == 0);
+
+    std::vector<EntitySnapshotPayload> makeSnapshots(uint32_t count)
+    {
+        std::vector<EntitySnapshotPayload> snapshots;
+        snapshots.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            const float f = static_cast<float>(i);
+            snapshots.push_back({i, {f * 2.0f, f + 0.5f}, {-f, 1.0f}, f / 3.0f});
+        }
+        return snapshots;
+    }
+
+    /**
+     * Snapshot encoding as the hand-written specializations did it, one field at a time
+     */
+    void writeFieldByField(Packet &packet, const RoomSnapshotPayload &room,
+                           const std::vector<EntitySnapshotPayload> &snapshots)
+    {
+        packet << room.roomId << room.currentPlayers << room.serverTick
+               << room.entityCount << room.inGame;
+        packet << static_cast<uint32_t>(snapshots.size());
+        for (const auto &s : snapshots) {
+            packet << s.netId << s.position.x << s.position.y
+                   << s.velocity.x << s.velocity.y << s.rotation;
+        }
+    }
+
+    void readFieldByField(Packet &packet, RoomSnapshotPayload &room,
+                          std::vector<EntitySnapshotPayload> &snapshots)
+    {
+        packet >> room.roomId >> room.currentPlayers >> room.serverTick
+               >> room.entityCount >> room.inGame;
+        uint32_t count = 0;
+        packet >> count;
+        snapshots.clear();
+        snapshots.reserve(count);
+        for (uint32_t i = 0; i < count; ++i) {
+            EntitySnapshotPayload s{};
+            packet >> s.netId >> s.position.x >> s.position.y
+                   >> s.velocity.x >> s.velocity.y >> s.rotation;
+            snapshots.push_back(s);
+        }
+    }
+
+    template <typename Fn>
+    double nanosPerCall(size_t iterations, Fn &&fn)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; ++i)
+            fn();
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+    }
+
+}
+
+TEST(PacketSchemaTest, BulkArraysMatchFieldByFieldEncoding) {
+    const RoomSnapshotPayload room{7, 4, 1234, 64, 1};
+    const auto snapshots = makeSnapshots(64);
+
+    Packet bulk(OpCode::RoomUpdate);
+    bulk << room << snapshots;
+    Packet reference(OpCode::RoomUpdate);
+    writeFieldByField(reference, room, snapshots);
+    ASSERT_EQ(bulk.body.size(), reference.body.size());
+    EXPECT_EQ(std::memcmp(bulk.body.data(), reference.body.data(), bulk.body.size()), 0);
+
+    RoomSnapshotPayload roomOut{};
+    std::vector<EntitySnapshotPayload> decoded;
+    bulk >> roomOut >> decoded;
+    EXPECT_EQ(roomOut.serverTick, 1234u);
+    EXPECT_EQ(roomOut.entityCount, 64);
+    ASSERT_EQ(decoded.size(), snapshots.size());
+    for (size_t i = 0; i < snapshots.size(); ++i) {
+        EXPECT_EQ(uint32_t{decoded[i].netId}, uint32_t{snapshots[i].netId});
+        EXPECT_FLOAT_EQ(decoded[i].position.x, snapshots[i].position.x);
+        EXPECT_FLOAT_EQ(decoded[i].position.y, snapshots[i].position.y);
+        EXPECT_FLOAT_EQ(decoded[i].velocity.x, snapshots[i].velocity.x);
+        EXPECT_FLOAT_EQ(decoded[i].rotation, snapshots[i].rotation);
+    }
+}
+
+TEST(PacketSchemaTest, MixedWidthArraysMatchFieldByFieldEncoding) {
+    const std::vector<EntityDeathPayload> deaths{{1, 2, {3.0f, 4.0f}}, {0x01020304, 9, {-1.0f, 0.25f}}};
+
+    Packet bulk(OpCode::EntityDeathBatch);
+    bulk << deaths;
+    Packet reference(OpCode::EntityDeathBatch);
+    reference << static_cast<uint32_t>(deaths.size());
+    for (const auto &d : deaths)
+        reference << d.netId << d.type << d.position.x << d.position.y;
+    ASSERT_EQ(bulk.body.size(), reference.body.size());
+    EXPECT_EQ(std::memcmp(bulk.body.data(), reference.body.data(), bulk.body.size()), 0);
+
+    std::vector<EntityDeathPayload> decoded;
+    bulk >> decoded;
+    ASSERT_EQ(decoded.size(), 2u);
+    EXPECT_EQ(uint32_t{decoded[1].netId}, 0x01020304u);
+    EXPECT_EQ(decoded[1].type, 9);
+    EXPECT_FLOAT_EQ(decoded[1].position.y, 0.25f);
+}
+
+TEST(PacketSchemaTest, StringPayloadsRoundTrip) {
+    RoomInfo room{};
+    room.roomId = 3;
+    std::strcpy(room.roomName, "nebula");
+    room.maxPlayers = 4;
+    room.difficulty = 1.5f;
+    room.levelId = 2;
+    room.roomType = 1;
+    GameOverPayload over{};
+    std::strcpy(over.bestPlayer, "ace");
+    over.bestScore = 900;
+    over.isWin = true;
+
+    Packet packet(OpCode::RoomList);
+    packet << std::vector<RoomInfo>{room} << over;
+
+    std::vector<RoomInfo> rooms;
+    GameOverPayload overOut{};
+    packet >> rooms >> overOut;
+    ASSERT_EQ(rooms.size(), 1u);
+    EXPECT_STREQ(rooms[0].roomName, "nebula");
+    EXPECT_FLOAT_EQ(rooms[0].difficulty, 1.5f);
+    EXPECT_EQ(rooms[0].levelId, 2u);
+    EXPECT_EQ(rooms[0].roomType, 0);
+    EXPECT_STREQ(overOut.bestPlayer, "ace");
+    EXPECT_EQ(overOut.bestScore, 900);
+    EXPECT_TRUE(overOut.isWin);
+}
+
+TEST(PacketSchemaTest, TruncatedArrayThrows) {
+    Packet packet(OpCode::RoomUpdate);
+    packet << makeSnapshots(4);
+    packet.body.resize(packet.body.size() - 1);
+
+    std::vector<EntitySnapshotPayload> decoded;
+    EXPECT_THROW(packet >> decoded, std::out_of_range);
+}
+
+TEST(PacketSchemaLoadTest, RoomSnapshotEncodeDecode) {
+    constexpr size_t iterations = 2000;
+    const RoomSnapshotPayload room{1, 4, 42, SNAPSHOT_ENTITIES, 1};
+    const auto snapshots = makeSnapshots(SNAPSHOT_ENTITIES);
+    RoomSnapshotPayload roomOut{};
+    std::vector<EntitySnapshotPayload> decoded;
+    decoded.reserve(SNAPSHOT_ENTITIES);
+
+    Packet packet(OpCode::RoomUpdate);
+    const double fieldEncode = nanosPerCall(iterations, [&]() {
+        packet.body.clear();
+        writeFieldByField(packet, room, snapshots);
+    });
+    const double fieldDecode = nanosPerCall(iterations, [&]() {
+        packet.resetRead();
+        readFieldByField(packet, roomOut, decoded);
+    });
+    const double schemaEncode = nanosPerCall(iterations, [&]() {
+        packet.body.clear();
+        packet << room << snapshots;
+    });
+    const double schemaDecode = nanosPerCall(iterations, [&]() {
+        packet.resetRead();
+        packet >> roomOut >> decoded;
+    });
+
+    ASSERT_EQ(decoded.size(), SNAPSHOT_ENTITIES);
+    EXPECT_EQ(uint32_t{decoded.back().netId}, SNAPSHOT_ENTITIES - 1);
+    std::cout << "[ LOAD     ] " << SNAPSHOT_ENTITIES << "-entity snapshot ("
+              << packet.body.size() << " bytes), field by field: encode "
+              << fieldEncode << "ns decode " << fieldDecode << "ns" << std::endl;
+    std::cout << "[ LOAD     ] " << SNAPSHOT_ENTITIES << "-entity snapshot, schema bulk:"
+              << "     encode " << schemaEncode << "ns decode " << schemaDecode << "ns" << std::endl;
+    RecordProperty("field_encode_ns", static_cast<int>(fieldEncode));
+    RecordProperty("field_decode_ns", static_cast<int>(fieldDecode));
+    RecordProperty("schema_encode_ns", static_cast<int>(schemaEncode));
+    RecordProperty("schema_decode_ns", static_cast<int>(schemaDecode));
+}
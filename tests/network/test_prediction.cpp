@@ -0,0 +1,274 @@
+#include <gtest/gtest.h>
+#include "RType/Game/PlayerPredictor.hpp"
+#include "RType/Game/InputQueue.hpp"
+#include "RType/ECS/Components/InputComponent.hpp"
+#include "RType/Network/Packet.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <iostream>
+#include <random>
+
+using namespace rtp;
+using game::PlayerMotion;
+using game::PlayerPredictor;
+using Bits = ecs::components::server::InputComponent::InputBits;
+
+namespace {
+
+    constexpr float STEP = PlayerPredictor::STEP;
+
+    uint8_t maskAt(uint32_t sequence)
+    {
+        if (sequence % 40 < 15)
+            return Bits::MoveRight | Bits::MoveDown;
+        if (sequence % 40 < 25)
+            return 0;
+        return Bits::MoveUp;
+    }
+
+    /**
+     * Seed a predictor the way the first snapshot does
+     */
+    PlayerPredictor seeded(const PlayerMotion &start)
+    {
+        PlayerPredictor predictor;
+        predictor.advance(STEP, 0);
+        predictor.reconcile(1, predictor.getSequence(), start);
+        return predictor;
+    }
+
+    /**
+     * Send the client's recent inputs every other step over a lossy,
+     * jittery link and apply InputQueue::due() of them per server tick
+     * @return Sequences applied, in application order
+     */
+    std::vector<uint32_t> simulateInputLink(uint32_t steps, double loss, int maxDelay,
+                                            size_t &datagrams, size_t &delivered)
+    {
+        constexpr uint32_t interval = 2;
+        constexpr uint32_t redundancy = 6;
+        std::mt19937 rng(11);
+        std::bernoulli_distribution lost(loss);
+        std::uniform_int_distribution<int> delay(0, maxDelay);
+
+        game::InputQueue queue;
+        std::vector<std::pair<int, std::vector<game::InputQueue::Input>>> inFlight;
+        std::vector<uint32_t> applied;
+
+        for (uint32_t tick = 1; tick <= steps + 16; ++tick) {
+            if (tick <= steps && tick % interval == 0) {
+                std::vector<game::InputQueue::Input> history;
+                for (uint32_t seq = tick > redundancy ? tick - redundancy + 1 : 1; seq <= tick; ++seq)
+                    history.push_back({seq, maskAt(seq)});
+                ++datagrams;
+                if (!lost(rng))
+                    inFlight.emplace_back(delay(rng), std::move(history));
+            }
+            for (auto it = inFlight.begin(); it != inFlight.end();) {
+                if (it->first-- > 0) {
+                    ++it;
+                    continue;
+                }
+                for (const auto &input : it->second)
+                    delivered += queue.push(input);
+                it = inFlight.erase(it);
+            }
+            EXPECT_LE(queue.size(), game::InputQueue::MAX_BACKLOG + redundancy);
+            for (size_t due = queue.due(); due > 0; --due) {
+                game::InputQueue::Input next;
+                if (!queue.pop(next))
+                    break;
+                EXPECT_EQ(next.mask, maskAt(next.sequence));
+                applied.push_back(next.sequence);
+            }
+        }
+        // Every delivered step is simulated, the ack never skips one
+        EXPECT_EQ(applied.size(), delivered);
+        EXPECT_EQ(queue.size(), 0u);
+        return applied;
+    }
+
+}
+
+TEST(PlayerPredictorTest, InactiveUntilFirstSnapshot) {
+    PlayerPredictor predictor;
+    EXPECT_EQ(predictor.advance(STEP * 3.5f, Bits::MoveRight), 3u);
+    EXPECT_EQ(predictor.getSequence(), 3u);
+    EXPECT_FALSE(predictor.isActive());
+
+    predictor.reconcile(10, 1, {{100.0f, 100.0f}, {}});
+    ASSERT_TRUE(predictor.isActive());
+    EXPECT_GT(predictor.getMotion().position.x, 100.0f);
+    EXPECT_FLOAT_EQ(predictor.getMotion().position.y, 100.0f);
+}
+
+TEST(PlayerPredictorTest, ReplaysUnackedInputsOverLatency) {
+    const PlayerMotion start{{200.0f, 300.0f}, {}};
+    PlayerPredictor predictor = seeded(start);
+    PlayerMotion server = start;
+    std::deque<std::pair<uint32_t, uint8_t>> inFlight;
+    constexpr size_t latencySteps = 9;
+
+    for (uint32_t tick = 2; tick < 400; ++tick) {
+        const uint8_t mask = maskAt(tick);
+        ASSERT_EQ(predictor.advance(STEP, mask), 1u);
+        inFlight.emplace_back(predictor.getSequence(), mask);
+
+        if (inFlight.size() > latencySteps) {
+            const auto [sequence, applied] = inFlight.front();
+            inFlight.pop_front();
+            game::stepPlayer(server, applied, game::PLAYER_SPEED, STEP);
+            if (tick % 2 == 0)
+                predictor.reconcile(tick, sequence, server);
+        }
+    }
+
+    PlayerMotion expected = server;
+    PlayerMotion previous = server;
+    for (const auto &[sequence, mask] : inFlight) {
+        previous = expected;
+        game::stepPlayer(expected, mask, game::PLAYER_SPEED, STEP);
+    }
+    EXPECT_NEAR(predictor.getMotion().position.x, expected.position.x, 1e-3f);
+    EXPECT_NEAR(predictor.getMotion().position.y, expected.position.y, 1e-3f);
+    // No time left in the accumulator: drawn at the start of the last step, uncorrected
+    EXPECT_NEAR(predictor.getRenderPosition().x, previous.position.x, 1e-3f);
+    EXPECT_NEAR(predictor.getRenderPosition().y, previous.position.y, 1e-3f);
+}
+
+TEST(PlayerPredictorTest, SmoothsSmallCorrectionsAndSnapsLargeOnes) {
+    PlayerPredictor predictor = seeded({{100.0f, 100.0f}, {}});
+    predictor.advance(STEP, 0);
+    const Vec2f before = predictor.getRenderPosition();
+
+    predictor.reconcile(2, predictor.getSequence(), {{110.0f, 100.0f}, {}});
+    EXPECT_FLOAT_EQ(predictor.getRenderPosition().x, before.x);
+    EXPECT_FLOAT_EQ(predictor.getMotion().position.x, 110.0f);
+
+    for (int i = 0; i < 30; ++i)
+        predictor.advance(STEP, 0);
+    EXPECT_NEAR(predictor.getRenderPosition().x, 110.0f, 0.1f);
+
+    predictor.reconcile(1, predictor.getSequence(), {{0.0f, 0.0f}, {}});
+    EXPECT_FLOAT_EQ(predictor.getMotion().position.x, 110.0f);
+
+    predictor.reconcile(3, predictor.getSequence(), {{500.0f, 100.0f}, {}});
+    EXPECT_FLOAT_EQ(predictor.getRenderPosition().x, 500.0f);
+}
+
+TEST(PlayerPredictorTest, StaysInsideArena) {
+    PlayerPredictor predictor = seeded({{5.0f, 5.0f}, {}});
+    for (int i = 0; i < 120; ++i)
+        predictor.advance(STEP, Bits::MoveUp | Bits::MoveLeft);
+    EXPECT_FLOAT_EQ(predictor.getMotion().position.x, 0.0f);
+    EXPECT_FLOAT_EQ(predictor.getMotion().position.y, 0.0f);
+}
+
+TEST(PlayerPredictorTest, SnapshotCarriesInputAck) {
+    net::Packet packet(net::OpCode::RoomUpdate);
+    packet << net::RoomSnapshotPayload{1, 2, 30, 1, 1} << net::InputAckPayload{7, 1234}
+           << std::vector<net::EntitySnapshotPayload>{{7, {1.0f, 2.0f}, {3.0f, 4.0f}, 0.0f}};
+
+    net::RoomSnapshotPayload header{};
+    net::InputAckPayload ack{};
+    std::vector<net::EntitySnapshotPayload> snapshots;
+    packet >> header >> ack >> snapshots;
+    EXPECT_EQ(uint32_t{header.serverTick}, 30u);
+    EXPECT_EQ(uint32_t{ack.netId}, 7u);
+    EXPECT_EQ(uint32_t{ack.sequence}, 1234u);
+    ASSERT_EQ(snapshots.size(), 1u);
+    EXPECT_FLOAT_EQ(snapshots[0].velocity.y, 4.0f);
+
+    net::Packet input(net::OpCode::InputTick);
+    input << std::vector<net::InputPayload>{{0, 98}, {Bits::MoveLeft, 99}};
+    std::vector<net::InputPayload> decoded;
+    input >> decoded;
+    ASSERT_EQ(decoded.size(), 2u);
+    EXPECT_EQ(decoded[1].inputMask, Bits::MoveLeft);
+    EXPECT_EQ(decoded[1].sequence, 99u);
+}
+
+TEST(InputQueueTest, DropsRepeatsAndStaleSequences) {
+    game::InputQueue queue;
+    EXPECT_TRUE(queue.push({1, 1}));
+    EXPECT_TRUE(queue.push({2, 2}));
+    EXPECT_FALSE(queue.push({2, 2}));
+    EXPECT_FALSE(queue.push({1, 1}));
+    EXPECT_TRUE(queue.push({5, 5}));
+    EXPECT_FALSE(queue.push({4, 4}));
+    EXPECT_EQ(queue.size(), 3u);
+    EXPECT_EQ(queue.getNewest(), 5u);
+
+    game::InputQueue::Input out;
+    ASSERT_TRUE(queue.pop(out));
+    EXPECT_EQ(out.sequence, 1u);
+    ASSERT_TRUE(queue.pop(out));
+    EXPECT_EQ(out.sequence, 2u);
+    ASSERT_TRUE(queue.pop(out));
+    EXPECT_EQ(out.mask, 5);
+    EXPECT_FALSE(queue.pop(out));
+}
+
+TEST(InputQueueTest, CapsOnlyRealBursts) {
+    game::InputQueue queue;
+    for (uint32_t seq = 1; seq <= game::InputQueue::CAPACITY + 3; ++seq)
+        queue.push({seq, static_cast<uint8_t>(seq)});
+    EXPECT_EQ(queue.size(), game::InputQueue::CAPACITY);
+
+    game::InputQueue::Input out;
+    ASSERT_TRUE(queue.pop(out));
+    EXPECT_EQ(out.sequence, 4u);
+    EXPECT_EQ(queue.size(), game::InputQueue::CAPACITY - 1);
+}
+
+TEST(InputQueueTest, CatchesUpWithoutSkipping) {
+    game::InputQueue queue;
+    EXPECT_EQ(queue.due(), 0u);
+    for (uint32_t seq = 1; seq <= game::InputQueue::MAX_BACKLOG + 2; ++seq)
+        queue.push({seq, Bits::MoveUp});
+
+    std::vector<uint32_t> applied;
+    std::vector<size_t> perTick;
+    while (const size_t due = queue.due()) {
+        perTick.push_back(due);
+        for (size_t i = 0; i < due; ++i) {
+            game::InputQueue::Input out;
+            ASSERT_TRUE(queue.pop(out));
+            applied.push_back(out.sequence);
+        }
+    }
+    // Two per tick until the backlog is back to MAX_BACKLOG, then one
+    ASSERT_EQ(perTick.size(), game::InputQueue::MAX_BACKLOG + 1);
+    EXPECT_EQ(perTick.front(), game::InputQueue::CATCH_UP);
+    EXPECT_EQ(perTick.back(), 1u);
+    ASSERT_EQ(applied.size(), game::InputQueue::MAX_BACKLOG + 2);
+    for (size_t i = 0; i < applied.size(); ++i)
+        EXPECT_EQ(applied[i], i + 1);
+}
+
+TEST(InputQueueTest, RedundantHistorySurvivesLoss) {
+    constexpr uint32_t steps = 6000;
+    size_t datagrams = 0;
+    size_t delivered = 0;
+    const std::vector<uint32_t> applied = simulateInputLink(steps, 0.2, 0, datagrams, delivered);
+
+    EXPECT_TRUE(std::is_sorted(applied.begin(), applied.end()));
+    EXPECT_EQ(std::adjacent_find(applied.begin(), applied.end()), applied.end());
+    const double coverage = static_cast<double>(delivered) / steps;
+    std::cout << "[ LOAD     ] " << steps << " inputs over " << datagrams
+              << " datagrams at 20% loss: " << coverage * 100.0 << "% delivered, "
+              << applied.size() << " applied" << std::endl;
+    RecordProperty("delivered_percent", static_cast<int>(coverage * 100.0));
+    EXPECT_GT(coverage, 0.98);
+}
+
+TEST(InputQueueTest, AppliesOnceInOrderDespiteReordering) {
+    size_t datagrams = 0;
+    size_t delivered = 0;
+    const std::vector<uint32_t> applied = simulateInputLink(6000, 0.2, 3, datagrams, delivered);
+
+    ASSERT_FALSE(applied.empty());
+    EXPECT_TRUE(std::is_sorted(applied.begin(), applied.end()));
+    EXPECT_EQ(std::adjacent_find(applied.begin(), applied.end()), applied.end());
+}
@@ -1,11 +1,101 @@
 #include <gtest/gtest.h>
 #include "RType/Network/Packet.hpp"
+#include "RType/Network/PacketBufferPool.hpp"
 
-using namespace net;
+#include <cstring>
+
+using namespace rtp::net;
 
 TEST(PacketTest, DefaultConstruction) {
     Packet packet;
-    EXPECT_TRUE(true); // Basic compilation test
+    EXPECT_TRUE(packet.body.empty());
+    EXPECT_GE(packet.body.capacity(), MTU_SIZE);
+}
+
+TEST(PacketTest, PrimitiveRoundTrip) {
+    Packet packet(OpCode::Ping);
+    packet << static_cast<uint32_t>(0xDEADBEEF) << 3.5f << static_cast<uint8_t>(7);
+    EXPECT_EQ(packet.header.bodySize, 9u);
+
+    uint32_t u = 0;
+    float f = 0.0f;
+    uint8_t b = 0;
+    packet >> u >> f >> b;
+    EXPECT_EQ(u, 0xDEADBEEF);
+    EXPECT_FLOAT_EQ(f, 3.5f);
+    EXPECT_EQ(b, 7);
+    EXPECT_THROW(packet >> b, std::out_of_range);
+}
+
+TEST(PacketTest, FixedStringRoundTripTruncates) {
+    LoginResponsePayload in{};
+    in.success = 1;
+    std::strcpy(in.username, "pilot");
+    Packet response(OpCode::LoginResponse);
+    response << in;
+
+    LoginResponsePayload out{};
+    std::memset(out.username, 'x', sizeof(out.username));
+    response >> out;
+    EXPECT_EQ(out.success, 1);
+    EXPECT_STREQ(out.username, "pilot");
+    EXPECT_EQ(out.username[sizeof(out.username) - 1], '\0');
+
+    Packet tooLong(OpCode::LoginResponse);
+    tooLong << static_cast<uint8_t>(1) << std::string_view(std::string(40, 'a'));
+    tooLong << static_cast<uint8_t>(9);
+    LoginResponsePayload cut{};
+    uint8_t trailer = 0;
+    tooLong >> cut >> trailer;
+    EXPECT_EQ(std::strlen(cut.username), sizeof(cut.username) - 1);
+    EXPECT_EQ(trailer, 9);
+}
+
+TEST(PacketTest, WriteIsBoundedByMaxBodySize) {
+    Packet packet(OpCode::RoomUpdate);
+    packet.body.resize(MAX_BODY_SIZE - 2);
+    EXPECT_THROW(packet << static_cast<uint32_t>(1), std::length_error);
+    EXPECT_NO_THROW(packet << static_cast<uint16_t>(1));
+}
+
+TEST(PacketTest, FullEntitySpawnBatchFitsInMtu) {
+    std::vector<EntitySpawnPayload> spawns;
+    for (uint32_t i = 0; i < ENTITY_BATCH_SIZE; ++i)
+        spawns.push_back({i, 3, 10.0f * i, 20.0f, 32.0f, 16.0f, 1});
+
+    Packet packet(OpCode::EntitySpawnBatch);
+    packet << spawns;
+    EXPECT_LE(packet.body.size(), MTU_SIZE);
+
+    std::vector<EntitySpawnPayload> decoded;
+    packet >> decoded;
+    ASSERT_EQ(decoded.size(), spawns.size());
+    EXPECT_EQ(decoded.back().netId, ENTITY_BATCH_SIZE - 1);
+    EXPECT_FLOAT_EQ(decoded.back().posX, 10.0f * (ENTITY_BATCH_SIZE - 1));
+    EXPECT_EQ(decoded.back().weaponKind, 1);
+}
+
+TEST(PacketBufferPoolTest, ReleasedBuffersAreReused) {
+    const uint8_t *first = nullptr;
+    {
+        Packet packet(OpCode::InputTick);
+        packet << InputPayload{1};
+        first = packet.body.data();
+    }
+    Packet again(OpCode::InputTick);
+    EXPECT_EQ(again.body.data(), first);
+    EXPECT_TRUE(again.body.empty());
+}
+
+TEST(PacketBufferPoolTest, LocalOverflowSpillsToShared) {
+    std::vector<PacketBufferPool::Buffer> held;
+    for (std::size_t i = 0; i < PacketBufferPool::LOCAL_LIMIT * 2; ++i)
+        held.push_back(PacketBufferPool::acquire());
+    const std::size_t sharedBefore = PacketBufferPool::sharedCount();
+    for (auto &buffer : held)
+        PacketBufferPool::release(std::move(buffer));
+    EXPECT_LE(PacketBufferPool::localCount(), PacketBufferPool::LOCAL_LIMIT);
+    EXPECT_GT(PacketBufferPool::sharedCount(), sharedBefore);
 }
 
 int main(int argc, char **argv) {
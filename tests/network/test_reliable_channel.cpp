@@ -0,0 +1,213 @@
+#include <gtest/gtest.h>
+#include "RType/Network/ReliableChannel.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace rtp::net;
+using namespace std::chrono_literals;
+using Clock = ReliableChannel::Clock;
+
+namespace {
+
+    /**
+     * One direction of a simulated network path, driven by virtual time
+     */
+    struct LossyLink {
+        struct InFlight {
+            Clock::time_point deliverAt;
+            Packet datagram;
+        };
+
+        double loss = 0.0;
+        double duplicate = 0.0;
+        Clock::duration latency = 30ms;
+        Clock::duration jitter = 0ms;
+        std::mt19937 rng{1234};
+        std::vector<InFlight> inFlight;
+
+        void push(Clock::time_point now, const Packet &datagram)
+        {
+            std::uniform_real_distribution<double> chance(0.0, 1.0);
+            const int copies = chance(rng) < duplicate ? 2 : 1;
+            for (int i = 0; i < copies; ++i) {
+                if (chance(rng) < loss)
+                    continue;
+                std::uniform_int_distribution<long> extra(0, jitter.count());
+                inFlight.push_back({now + latency + Clock::duration(extra(rng)), datagram});
+            }
+        }
+
+        void deliver(Clock::time_point now, ReliableChannel &to, std::vector<Packet> &out)
+        {
+            std::stable_sort(inFlight.begin(), inFlight.end(),
+                [](const InFlight &a, const InFlight &b) { return a.deliverAt < b.deliverAt; });
+            auto it = inFlight.begin();
+            for (; it != inFlight.end() && it->deliverAt <= now; ++it) {
+                it->datagram.resetRead();
+                ASSERT_TRUE(to.receive(it->datagram, now, out));
+            }
+            inFlight.erase(inFlight.begin(), it);
+        }
+    };
+
+    Packet makeMessage(uint32_t index)
+    {
+        Packet message(OpCode::EntityDeath);
+        message << index << static_cast<uint8_t>(index & 0xFF);
+        return message;
+    }
+
+    uint32_t messageIndex(Packet &message)
+    {
+        uint32_t index = 0;
+        message >> index;
+        return index;
+    }
+
+    /**
+     * Pump both channels at a fixed tick until every message is delivered
+     */
+    void pump(ReliableChannel &server, ReliableChannel &client, LossyLink &down, LossyLink &up,
+              Clock::time_point &now, std::vector<Packet> &delivered, size_t expected,
+              Clock::duration tick = 16ms)
+    {
+        std::vector<Packet> wire;
+        std::vector<Packet> ignored;
+        for (int guard = 0; delivered.size() < expected && guard < 100000; ++guard) {
+            wire.clear();
+            server.flush(now, wire);
+            for (const auto &datagram : wire)
+                down.push(now, datagram);
+            wire.clear();
+            client.flush(now, wire);
+            for (const auto &datagram : wire)
+                up.push(now, datagram);
+
+            now += tick;
+            down.deliver(now, client, delivered);
+            up.deliver(now, server, ignored);
+        }
+    }
+
+}
+
+TEST(ReliableChannelTest, PacksMessagesAndDeliversInOrder) {
+    ReliableChannel server;
+    ReliableChannel client;
+    for (uint32_t i = 0; i < 100; ++i)
+        server.send(makeMessage(i));
+
+    std::vector<Packet> wire;
+    Clock::time_point now{};
+    const size_t expectedDatagrams =
+        (100 + ReliableChannel::MAX_MESSAGES_PER_DATAGRAM - 1) / ReliableChannel::MAX_MESSAGES_PER_DATAGRAM;
+    ASSERT_EQ(server.flush(now, wire), expectedDatagrams);
+
+    std::vector<Packet> delivered;
+    for (auto it = wire.rbegin(); it != wire.rend(); ++it) {
+        EXPECT_LE(it->body.size(), MTU_SIZE);
+        ASSERT_TRUE(client.receive(*it, now, delivered));
+    }
+    ASSERT_EQ(delivered.size(), 100u);
+    for (uint32_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(delivered[i].header.opCode, OpCode::EntityDeath);
+        EXPECT_EQ(messageIndex(delivered[i]), i);
+    }
+
+    wire.clear();
+    EXPECT_EQ(client.flush(now + 5ms, wire), 1u);
+    std::vector<Packet> none;
+    ASSERT_TRUE(server.receive(wire.front(), now + 10ms, none));
+    EXPECT_TRUE(none.empty());
+    EXPECT_EQ(server.getPendingCount(), 0u);
+}
+
+TEST(ReliableChannelTest, RejectsTruncatedDatagram) {
+    ReliableChannel channel;
+    Packet garbage(OpCode::Reliable);
+    garbage << static_cast<uint16_t>(1);
+    std::vector<Packet> delivered;
+    EXPECT_FALSE(channel.receive(garbage, Clock::time_point{}, delivered));
+}
+
+TEST(ReliableChannelTest, SurvivesLossDuplicationAndReordering) {
+    constexpr uint32_t count = 3000;
+    ReliableChannel server;
+    ReliableChannel client;
+    LossyLink down{.loss = 0.2, .duplicate = 0.1, .latency = 20ms, .jitter = 40ms};
+    LossyLink up{.loss = 0.2, .duplicate = 0.1, .latency = 20ms, .jitter = 40ms};
+
+    for (uint32_t i = 0; i < count; ++i)
+        server.send(makeMessage(i));
+
+    Clock::time_point now{};
+    std::vector<Packet> delivered;
+    pump(server, client, down, up, now, delivered, count);
+
+    ASSERT_EQ(delivered.size(), count);
+    for (uint32_t i = 0; i < count; ++i)
+        ASSERT_EQ(messageIndex(delivered[i]), i);
+    EXPECT_GT(server.getStats().messagesResent, 0u);
+}
+
+TEST(ReliableChannelLoadTest, EventLatencyUnderTwoPercentLoss) {
+    constexpr uint32_t ticks = 60 * 60;
+    constexpr uint32_t perTick = 4;
+    constexpr auto tick = 16ms;
+    ReliableChannel server;
+    ReliableChannel client;
+    LossyLink down{.loss = 0.02, .latency = 30ms, .jitter = 5ms};
+    LossyLink up{.loss = 0.02, .latency = 30ms, .jitter = 5ms};
+
+    std::vector<Clock::time_point> sentAt;
+    std::vector<double> latencies;
+    std::vector<Packet> wire;
+    std::vector<Packet> delivered;
+    std::vector<Packet> ignored;
+    Clock::time_point now{};
+
+    const uint32_t total = ticks * perTick;
+    for (uint32_t t = 0; latencies.size() < total && t < ticks * 4; ++t) {
+        for (uint32_t i = 0; i < perTick && sentAt.size() < total; ++i) {
+            server.send(makeMessage(static_cast<uint32_t>(sentAt.size())));
+            sentAt.push_back(now);
+        }
+        wire.clear();
+        server.flush(now, wire);
+        for (const auto &datagram : wire)
+            down.push(now, datagram);
+        wire.clear();
+        client.flush(now, wire);
+        for (const auto &datagram : wire)
+            up.push(now, datagram);
+
+        now += tick;
+        delivered.clear();
+        down.deliver(now, client, delivered);
+        up.deliver(now, server, ignored);
+        for (auto &message : delivered) {
+            const uint32_t index = messageIndex(message);
+            ASSERT_EQ(index, latencies.size());
+            latencies.push_back(std::chrono::duration<double, std::milli>(now - sentAt[index]).count());
+        }
+    }
+
+    ASSERT_EQ(latencies.size(), total);
+    std::sort(latencies.begin(), latencies.end());
+    const double p50 = latencies[latencies.size() / 2];
+    const double p99 = latencies[latencies.size() * 99 / 100];
+    const double worst = latencies.back();
+    const auto stats = server.getStats();
+
+    std::cout << "[ LOAD     ] 2% loss, 30ms one-way: p50=" << p50 << "ms p99=" << p99
+              << "ms max=" << worst << "ms, resent " << stats.messagesResent << "/"
+              << stats.messagesSent << " messages in " << stats.datagramsSent
+              << " datagrams" << std::endl;
+    RecordProperty("latency_p50_ms", static_cast<int>(p50));
+    RecordProperty("latency_p99_ms", static_cast<int>(p99));
+    EXPECT_LT(p50, 80.0);
+}
@@ -0,0 +1,219 @@
+#include <gtest/gtest.h>
+#include "ServerNetwork/ServerNetwork.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace rtp;
+using asio::ip::tcp;
+using asio::ip::udp;
+
+namespace {
+
+    struct BotClient {
+        tcp::socket tcpSocket;
+        udp::socket udpSocket;
+        uint32_t sessionId = 0;
+
+        BotClient(asio::io_context &io, uint16_t port)
+            : tcpSocket(io), udpSocket(io)
+        {
+            const auto loopback = asio::ip::address_v4::loopback();
+            tcpSocket.connect(tcp::endpoint(loopback, port));
+
+            net::Header header{};
+            asio::read(tcpSocket, asio::buffer(&header, sizeof(header)));
+            uint32_t id = 0;
+            asio::read(tcpSocket, asio::buffer(&id, sizeof(id)));
+            sessionId = net::Packet::from_network(id);
+
+            udpSocket.open(udp::v4());
+            udpSocket.connect(udp::endpoint(loopback, port));
+        }
+
+        void send(const net::Packet &packet)
+        {
+            asio::error_code ec;
+            udpSocket.send(packet.getBufferSequence(), 0, ec);
+        }
+
+        void hello(void)
+        {
+            net::Packet packet(net::OpCode::Hello);
+            packet.header.sessionId = sessionId;
+            send(packet);
+        }
+    };
+
+    struct LoadResult {
+        size_t sent = 0;
+        size_t received = 0;
+        double seconds = 0.0;
+    };
+
+    LoadResult runLoad(uint16_t port, size_t shards, size_t clients, size_t producers,
+                       std::chrono::milliseconds duration)
+    {
+        server::ServerNetwork network(port, shards);
+        network.start();
+
+        asio::io_context io;
+        std::vector<std::unique_ptr<BotClient>> bots;
+        for (size_t i = 0; i < clients; ++i)
+            bots.push_back(std::make_unique<BotClient>(io, port));
+        for (auto &bot : bots)
+            bot->hello();
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+        std::atomic<bool> running{true};
+        std::atomic<size_t> sent{0};
+        size_t received = 0;
+
+        std::thread consumer([&]() {
+            while (running.load(std::memory_order_relaxed)) {
+                bool drained = true;
+                while (auto event = network.pollEvent()) {
+                    drained = false;
+                    received += event->packet.header.opCode == net::OpCode::InputTick;
+                }
+                if (drained)
+                    std::this_thread::yield();
+            }
+        });
+
+        const auto start = std::chrono::steady_clock::now();
+        std::vector<std::thread> senders;
+        for (size_t p = 0; p < producers; ++p) {
+            senders.emplace_back([&, p]() {
+                net::Packet input(net::OpCode::InputTick);
+                input << net::InputPayload{1};
+                size_t local = 0;
+                while (std::chrono::steady_clock::now() - start < duration) {
+                    for (size_t i = p; i < bots.size(); i += producers) {
+                        bots[i]->send(input);
+                        ++local;
+                    }
+                }
+                sent += local;
+            });
+        }
+        for (auto &sender : senders)
+            sender.join();
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        running = false;
+        consumer.join();
+        const double seconds = std::chrono::duration<double>(
+            std::chrono::steady_clock::now() - start).count();
+
+        network.stop();
+        return {sent.load(), received, seconds};
+    }
+
+}
+
+TEST(ServerShardsTest, SessionIsPinnedToHelloShard) {
+    constexpr uint16_t port = 47311;
+    server::ServerNetwork network(port, 4);
+    network.start();
+
+    asio::io_context io;
+    BotClient bot(io, port);
+    bot.hello();
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    net::Packet input(net::OpCode::InputTick);
+    input << net::InputPayload{3};
+    bot.send(input);
+
+    std::optional<net::NetworkEvent> event;
+    for (int i = 0; i < 100 && !event; ++i) {
+        while (auto polled = network.pollEvent()) {
+            if (polled->packet.header.opCode == net::OpCode::InputTick) {
+                event = std::move(polled);
+                break;
+            }
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    }
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->sessionId, bot.sessionId);
+
+    net::Packet ping(net::OpCode::Ping);
+    network.sendPacket(bot.sessionId, ping, net::NetworkMode::UDP);
+    network.flushUdp();
+
+    std::array<uint8_t, 64> buffer{};
+    bot.udpSocket.non_blocking(false);
+    const size_t bytes = bot.udpSocket.receive(asio::buffer(buffer));
+    EXPECT_EQ(bytes, sizeof(net::Header));
+
+    network.stop();
+}
+
+TEST(ServerEventQueueTest, FullRingKeepsControlEvents) {
+    // Never started: events are only published and polled
+    server::ServerNetwork network(0);
+
+    net::Packet input(net::OpCode::InputTick);
+    input << net::InputPayload{1};
+    for (size_t i = 0; i < net::EVENT_QUEUE_CAPACITY; ++i)
+        network.publishEvent({1, input});
+    network.publishEvent({1, net::Packet(net::OpCode::Disconnect)});
+    network.publishEvent({1, input});
+    network.publishEvent({2, net::Packet(net::OpCode::Hello)});
+
+    std::vector<net::NetworkEvent> batch(256);
+    std::vector<net::NetworkEvent> controls;
+    size_t inputs = 0;
+    while (const size_t count = network.pollEvents(batch)) {
+        for (size_t i = 0; i < count; ++i) {
+            if (batch[i].packet.header.opCode == net::OpCode::InputTick)
+                ++inputs;
+            else
+                controls.push_back(std::move(batch[i]));
+        }
+    }
+
+    EXPECT_EQ(inputs, net::EVENT_QUEUE_CAPACITY);
+    EXPECT_EQ(network.getNetworkStats().droppedEvents, 1u);
+    ASSERT_EQ(controls.size(), 2u);
+    EXPECT_EQ(controls[0].packet.header.opCode, net::OpCode::Disconnect);
+    EXPECT_EQ(controls[0].sessionId, 1u);
+    EXPECT_EQ(controls[1].packet.header.opCode, net::OpCode::Hello);
+
+    // Drained, the ring takes control events again
+    network.publishEvent({3, net::Packet(net::OpCode::Disconnect)});
+    auto event = network.pollEvent();
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->sessionId, 3u);
+    EXPECT_FALSE(network.pollEvent().has_value());
+}
+
+TEST(ServerShardsLoadTest, OneVersusFourShards) {
+    constexpr size_t clients = 32;
+    constexpr size_t producers = 4;
+    constexpr auto duration = std::chrono::milliseconds(1000);
+
+    for (size_t shards : {1u, 4u}) {
+        const auto result = runLoad(static_cast<uint16_t>(47320 + shards), shards,
+                                    clients, producers, duration);
+        const double rate = result.seconds > 0.0 ? result.received / result.seconds : 0.0;
+        const double loss = result.sent > 0
+            ? 100.0 * (1.0 - static_cast<double>(result.received) / result.sent) : 0.0;
+        std::cout << "[ LOAD     ] " << shards << " shard(s): "
+                  << static_cast<uint64_t>(rate) << " events/s, sent " << result.sent
+                  << ", dropped " << loss << "%" << std::endl;
+        RecordProperty("events_per_sec_" + std::to_string(shards) + "_shards",
+                       static_cast<int>(rate));
+        EXPECT_GT(result.received, 0u);
+    }
+}
+
+int main(int argc, char **argv) {
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
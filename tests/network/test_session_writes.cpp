@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+#include "ServerNetwork/ServerNetwork.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#if defined(__linux__)
+    #include <netinet/tcp.h>
+    #include <sys/socket.h>
+#endif
+
+using namespace rtp;
+using asio::ip::tcp;
+
+namespace {
+
+    constexpr size_t WELCOME_BYTES = sizeof(net::Header) + sizeof(uint32_t);
+
+#if defined(__linux__)
+    /**
+     * Kernel tcp_info tail that glibc's struct tcp_info does not declare
+     */
+    struct TcpInfo {
+        ::tcp_info base;
+        uint64_t pacingRate;
+        uint64_t maxPacingRate;
+        uint64_t bytesAcked;
+        uint64_t bytesReceived;
+        uint32_t segsOut;
+        uint32_t segsIn;
+        uint32_t notsentBytes;
+        uint32_t minRtt;
+        uint32_t dataSegsIn;
+        uint32_t dataSegsOut;
+    };
+#endif
+
+    /**
+     * Data segments received on a socket, or -1 when the kernel does not tell
+     */
+    long dataSegmentsIn(tcp::socket &socket)
+    {
+#if defined(__linux__)
+        TcpInfo info{};
+        socklen_t size = sizeof(info);
+        if (::getsockopt(socket.native_handle(), IPPROTO_TCP, TCP_INFO, &info, &size) == 0 &&
+            size >= offsetof(TcpInfo, dataSegsIn) + sizeof(info.dataSegsIn))
+            return info.dataSegsIn;
+#else
+        (void)socket;
+#endif
+        return -1;
+    }
+
+    struct Connection {
+        server::ServerNetwork network;
+        asio::io_context io;
+        tcp::socket client{io};
+        uint32_t sessionId = 0;
+
+        Connection(uint16_t port, net::TcpFlushPolicy policy)
+            : network(port)
+        {
+            network.setTcpFlushPolicy(policy);
+            network.start();
+            client.connect(tcp::endpoint(asio::ip::address_v4::loopback(), port));
+
+            std::vector<uint8_t> welcome(WELCOME_BYTES);
+            asio::read(client, asio::buffer(welcome));
+            std::memcpy(&sessionId, welcome.data() + sizeof(net::Header), sizeof(sessionId));
+            sessionId = net::Packet::from_network(sessionId);
+        }
+
+        ~Connection()
+        {
+            network.stop();
+        }
+    };
+
+    /**
+     * Counters are bumped once the write completes, possibly after the peer read the bytes
+     */
+    net::Session::WriteStats waitForPackets(server::ServerNetwork &network, uint64_t packets)
+    {
+        auto stats = network.getTcpWriteStats();
+        for (int i = 0; i < 200 && stats.packets < packets; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            stats = network.getTcpWriteStats();
+        }
+        return stats;
+    }
+
+    std::vector<net::Packet> tickPackets(size_t players)
+    {
+        std::vector<net::Packet> packets;
+        for (uint32_t p = 0; p < players; ++p) {
+            net::Packet death(net::OpCode::EntityDeath);
+            death << net::EntityDeathPayload{p, 0, {}};
+            packets.push_back(death);
+            net::Packet score(net::OpCode::ScoreUpdate);
+            score << net::ScoreUpdatePayload{static_cast<int32_t>(p * 100)};
+            packets.push_back(score);
+            net::Packet health(net::OpCode::HealthUpdate);
+            health << net::HealthUpdatePayload{static_cast<int32_t>(p), 100};
+            packets.push_back(health);
+        }
+        return packets;
+    }
+
+    size_t wireSize(const std::vector<net::Packet> &packets)
+    {
+        size_t bytes = 0;
+        for (const auto &packet : packets)
+            bytes += sizeof(net::Header) + packet.body.size();
+        return bytes;
+    }
+
+}
+
+TEST(SessionWriteTest, EndOfTickHoldsPacketsUntilFlush) {
+    constexpr uint16_t port = 47331;
+    Connection connection(port, net::TcpFlushPolicy::EndOfTick);
+    const auto packets = tickPackets(2);
+
+    for (const auto &packet : packets)
+        connection.network.sendPacket(connection.sessionId, packet, net::NetworkMode::TCP);
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(connection.client.available(), 0u);
+
+    connection.network.flushTcp();
+    std::vector<uint8_t> bytes(wireSize(packets));
+    asio::read(connection.client, asio::buffer(bytes));
+
+    const auto stats = waitForPackets(connection.network, packets.size() + 1);
+    EXPECT_EQ(stats.writes, 2u);
+    EXPECT_EQ(stats.packets, packets.size() + 1);
+    EXPECT_EQ(stats.bytes, bytes.size() + WELCOME_BYTES);
+
+    net::Header header{};
+    std::memcpy(&header, bytes.data(), sizeof(header));
+    EXPECT_EQ(header.opCode, net::OpCode::EntityDeath);
+}
+
+TEST(SessionWriteLoadTest, WritesAndSegmentsPerTick) {
+    constexpr size_t ticks = 120;
+    constexpr size_t players = 4;
+    const auto packets = tickPackets(players);
+    std::vector<uint8_t> bytes(wireSize(packets));
+
+    auto report = [&](const char *name, double writes, long segmentsBefore, long segmentsAfter) {
+        std::cout << "[ LOAD     ] " << name << ": " << packets.size() << " packets/tick, "
+                  << writes << " writes/tick";
+        if (segmentsBefore >= 0 && segmentsAfter >= 0) {
+            std::cout << ", " << static_cast<double>(segmentsAfter - segmentsBefore) / ticks
+                      << " segments/tick";
+        }
+        std::cout << std::endl;
+    };
+
+    {
+        /* One write per packet, as the session writer used to do */
+        asio::io_context io;
+        tcp::acceptor acceptor(io, tcp::endpoint(asio::ip::address_v4::loopback(), 0));
+        tcp::socket client(io);
+        client.connect(acceptor.local_endpoint());
+        tcp::socket server = acceptor.accept();
+        server.set_option(tcp::no_delay(true));
+
+        const long segmentsBefore = dataSegmentsIn(client);
+        size_t writes = 0;
+        for (size_t tick = 0; tick < ticks; ++tick) {
+            for (const auto &packet : packets) {
+                asio::write(server, packet.getBufferSequence());
+                ++writes;
+            }
+            asio::read(client, asio::buffer(bytes));
+        }
+        report("per packet", static_cast<double>(writes) / ticks, segmentsBefore,
+               dataSegmentsIn(client));
+    }
+
+    Connection connection(47332, net::TcpFlushPolicy::EndOfTick);
+    const auto before = waitForPackets(connection.network, 1);
+    const long segmentsBefore = dataSegmentsIn(connection.client);
+    for (size_t tick = 0; tick < ticks; ++tick) {
+        for (const auto &packet : packets)
+            connection.network.sendPacket(connection.sessionId, packet, net::NetworkMode::TCP);
+        connection.network.flushTcp();
+        asio::read(connection.client, asio::buffer(bytes));
+    }
+    const auto after = waitForPackets(connection.network, before.packets + ticks * packets.size());
+    const double writes = static_cast<double>(after.writes - before.writes) / ticks;
+    report("end of tick", writes, segmentsBefore, dataSegmentsIn(connection.client));
+    RecordProperty("writes_per_tick_x100", static_cast<int>(writes * 100));
+
+    EXPECT_EQ(after.packets - before.packets, ticks * packets.size());
+    EXPECT_EQ(after.writes - before.writes, ticks);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+#include "RType/Network/SnapshotBuffer.hpp"
+
+#include <random>
+
+using namespace rtp::net;
+using Sample = SnapshotBuffer::Sample;
+
+namespace {
+
+    constexpr float TICK_RATE = 60.0f;
+
+    /**
+     * Entity moving along x at 120 units per second, one sample per tick
+     */
+    Sample linearSample(uint32_t tick)
+    {
+        const float x = static_cast<float>(tick) * 2.0f;
+        return Sample{tick, {x, 10.0f}, {120.0f, 0.0f}, 0.0f};
+    }
+
+}
+
+TEST(SnapshotBufferTest, InterpolatesBetweenSamples) {
+    SnapshotBuffer buffer;
+    buffer.push(linearSample(10));
+    buffer.push(linearSample(14));
+
+    Sample out{};
+    ASSERT_TRUE(buffer.sample(11.0, TICK_RATE, out));
+    EXPECT_FLOAT_EQ(out.position.x, 22.0f);
+    ASSERT_TRUE(buffer.sample(13.5, TICK_RATE, out));
+    EXPECT_FLOAT_EQ(out.position.x, 27.0f);
+    EXPECT_FLOAT_EQ(out.position.y, 10.0f);
+}
+
+TEST(SnapshotBufferTest, ClampsBeforeOldestAndCapsExtrapolation) {
+    SnapshotBuffer buffer;
+    Sample out{};
+    EXPECT_FALSE(buffer.sample(0.0, TICK_RATE, out));
+
+    buffer.push(linearSample(10));
+    ASSERT_TRUE(buffer.sample(2.0, TICK_RATE, out));
+    EXPECT_FLOAT_EQ(out.position.x, 20.0f);
+
+    ASSERT_TRUE(buffer.sample(13.0, TICK_RATE, out));
+    EXPECT_FLOAT_EQ(out.position.x, 26.0f);
+    ASSERT_TRUE(buffer.sample(1000.0, TICK_RATE, out));
+    EXPECT_FLOAT_EQ(out.position.x, 20.0f + 120.0f * SnapshotBuffer::MAX_EXTRAPOLATION);
+}
+
+TEST(SnapshotBufferTest, OrdersLateAndDuplicateSamples) {
+    SnapshotBuffer buffer;
+    EXPECT_TRUE(buffer.push(linearSample(20)));
+    EXPECT_TRUE(buffer.push(linearSample(16)));
+    EXPECT_TRUE(buffer.push(linearSample(18)));
+    EXPECT_FALSE(buffer.push(linearSample(18)));
+    EXPECT_EQ(buffer.size(), 3u);
+
+    Sample out{};
+    ASSERT_TRUE(buffer.sample(17.0, TICK_RATE, out));
+    EXPECT_FLOAT_EQ(out.position.x, 34.0f);
+    ASSERT_TRUE(buffer.sample(19.0, TICK_RATE, out));
+    EXPECT_FLOAT_EQ(out.position.x, 38.0f);
+}
+
+TEST(SnapshotBufferTest, DropsOldestWhenFull) {
+    SnapshotBuffer buffer;
+    for (uint32_t tick = 1; tick <= SnapshotBuffer::CAPACITY + 4; ++tick)
+        buffer.push(linearSample(tick * 2));
+    EXPECT_EQ(buffer.size(), SnapshotBuffer::CAPACITY);
+
+    EXPECT_FALSE(buffer.push(linearSample(1)));
+    EXPECT_TRUE(buffer.push(linearSample(11)));
+    EXPECT_EQ(buffer.size(), SnapshotBuffer::CAPACITY);
+
+    Sample out{};
+    ASSERT_TRUE(buffer.sample(0.0, TICK_RATE, out));
+    EXPECT_EQ(out.tick, 0u);
+    EXPECT_FLOAT_EQ(out.position.x, 22.0f);
+    ASSERT_TRUE(buffer.sample(11.5, TICK_RATE, out));
+    EXPECT_FLOAT_EQ(out.position.x, 23.0f);
+}
+
+TEST(InterpolationClockTest, RendersDelayBehindNewestSnapshot) {
+    InterpolationClock clock(0.1f, TICK_RATE);
+    EXPECT_FALSE(clock.isSynced());
+
+    const auto start = InterpolationClock::Clock::now();
+    clock.onSnapshot(600, start);
+    ASSERT_TRUE(clock.isSynced());
+    EXPECT_DOUBLE_EQ(clock.getRenderTick(), 594.0);
+
+    clock.reset();
+    EXPECT_FALSE(clock.isSynced());
+    clock.onSnapshot(10, start);
+    EXPECT_DOUBLE_EQ(clock.getRenderTick(), 4.0);
+}
+
+TEST(InterpolationClockTest, AbsorbsJitterAndTracksTickRate) {
+    using namespace std::chrono;
+    constexpr float serverRate = 30.0f;
+    constexpr float frame = 1.0f / 144.0f;
+
+    InterpolationClock clock(0.1f, TICK_RATE);
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> jitter(0.0, 0.03);
+
+    auto start = InterpolationClock::Clock::now();
+    double now = 0.0;
+    double nextSnapshot = 0.0;
+    uint32_t serverTick = 100;
+    double maxStep = 0.0;
+    double previous = 0.0;
+
+    for (int i = 0; i < 144 * 20; ++i) {
+        now += frame;
+        while (nextSnapshot <= now) {
+            const double arrival = nextSnapshot + jitter(rng);
+            clock.onSnapshot(serverTick, start + duration_cast<InterpolationClock::Clock::duration>(
+                duration<double>(arrival)));
+            serverTick += 2;
+            nextSnapshot += 2.0 / serverRate;
+        }
+        const double rendered = clock.advance(frame);
+        if (i > 144 * 10)
+            maxStep = std::max(maxStep, std::abs(rendered - previous));
+        previous = rendered;
+    }
+
+    EXPECT_NEAR(clock.getTickRate(), serverRate, 1.0f);
+    const double expected = serverTick - 2 - 0.1 * serverRate;
+    EXPECT_NEAR(clock.getRenderTick(), expected, 2.0);
+    EXPECT_LT(maxStep, 2.0 * frame * serverRate);
+}
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include "RType/Network/UdpBatch.hpp"
+
+#include <chrono>
+#include <ctime>
+#include <iostream>
+
+#if defined(RTYPE_HAS_UDP_MMSG)
+
+using namespace rtp::net;
+using asio::ip::udp;
+
+namespace {
+
+    struct LoopbackPair {
+        asio::io_context io;
+        udp::socket receiver{io, udp::endpoint(asio::ip::address_v4::loopback(), 0)};
+        udp::socket sender{io, udp::endpoint(asio::ip::address_v4::loopback(), 0)};
+
+        LoopbackPair()
+        {
+            receiver.set_option(asio::socket_base::receive_buffer_size(4 * 1024 * 1024));
+            sender.set_option(asio::socket_base::send_buffer_size(4 * 1024 * 1024));
+        }
+    };
+
+    Packet makeSnapshot(uint32_t index)
+    {
+        Packet packet(OpCode::RoomUpdate);
+        packet << RoomSnapshotPayload{1, 4, index, 8, 1};
+        for (uint32_t i = 0; i < 8; ++i)
+            packet << EntitySnapshotPayload{i, {1.0f, 2.0f}, {0.0f, 0.0f}, 0.0f};
+        return packet;
+    }
+
+    double cpuSeconds(void)
+    {
+        return static_cast<double>(std::clock()) / CLOCKS_PER_SEC;
+    }
+
+}
+
+TEST(UdpBatchTest, SendAndReceiveRoundTrip) {
+    LoopbackPair pair;
+    UdpBatchSender sender;
+    auto receiver = std::make_unique<UdpBatchReceiver>();
+
+    for (uint32_t i = 0; i < 10; ++i)
+        sender.push(pair.receiver.local_endpoint(), makeSnapshot(i));
+    EXPECT_EQ(sender.pending(), 10u);
+
+    asio::error_code ec;
+    EXPECT_EQ(sender.flush(pair.sender, ec), 10u);
+    EXPECT_FALSE(ec);
+    EXPECT_EQ(sender.pending(), 0u);
+
+    const size_t count = receiver->receive(pair.receiver, ec);
+    ASSERT_EQ(count, 10u);
+    for (size_t i = 0; i < count; ++i) {
+        const auto data = receiver->data(i);
+        Header header;
+        ASSERT_GE(data.size(), sizeof(Header));
+        std::memcpy(&header, data.data(), sizeof(Header));
+        EXPECT_EQ(Packet::from_network(header.magic), MAGIC_NUMBER);
+        EXPECT_EQ(data.size(), sizeof(Header) + Packet::from_network(header.bodySize));
+        EXPECT_EQ(receiver->endpoint(i), pair.sender.local_endpoint());
+    }
+
+    receiver->receive(pair.receiver, ec);
+    EXPECT_EQ(ec, asio::error::would_block);
+}
+
+TEST(UdpBatchLoadTest, PacketsPerSecondPerCore) {
+    constexpr size_t rounds = 2000;
+    LoopbackPair pair;
+    const auto target = pair.receiver.local_endpoint();
+    const Packet snapshot = makeSnapshot(0);
+    std::array<uint8_t, UDP_DATAGRAM_CAPACITY> buffer{};
+    udp::endpoint from;
+
+    double start = cpuSeconds();
+    size_t single = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < UDP_BATCH_SIZE; ++i)
+            pair.sender.send_to(snapshot.getBufferSequence(), target);
+        for (size_t i = 0; i < UDP_BATCH_SIZE; ++i)
+            single += pair.receiver.receive_from(asio::buffer(buffer), from) > 0;
+    }
+    const double singleCpu = cpuSeconds() - start;
+
+    UdpBatchSender sender;
+    auto receiver = std::make_unique<UdpBatchReceiver>();
+    asio::error_code ec;
+    start = cpuSeconds();
+    size_t batched = 0;
+    for (size_t r = 0; r < rounds; ++r) {
+        for (size_t i = 0; i < UDP_BATCH_SIZE; ++i)
+            sender.push(target, snapshot);
+        sender.flush(pair.sender, ec);
+        batched += receiver->receive(pair.receiver, ec);
+    }
+    const double batchedCpu = cpuSeconds() - start;
+
+    const size_t expected = rounds * UDP_BATCH_SIZE;
+    EXPECT_EQ(single, expected);
+    EXPECT_EQ(batched, expected);
+
+    const double singleRate = singleCpu > 0.0 ? single / singleCpu : 0.0;
+    const double batchedRate = batchedCpu > 0.0 ? batched / batchedCpu : 0.0;
+    std::cout << "[ LOAD     ] send_to/receive_from: " << static_cast<uint64_t>(singleRate)
+              << " pkt/s/core" << std::endl;
+    std::cout << "[ LOAD     ] sendmmsg/recvmmsg:    " << static_cast<uint64_t>(batchedRate)
+              << " pkt/s/core" << std::endl;
+    RecordProperty("single_pps_per_core", static_cast<int>(singleRate));
+    RecordProperty("batched_pps_per_core", static_cast<int>(batchedRate));
+}
+
+#endif /* RTYPE_HAS_UDP_MMSG */
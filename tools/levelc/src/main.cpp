@@ -0,0 +1,110 @@
+/**
+ * File   : main.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "Game/LevelData.hpp"
+#include "RType/Logger.hpp"
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace rtp::levelc
+{
+    struct CompileOptions {
+        std::vector<std::string> levels;    /**< Level JSON files to compile */
+        std::string output;                 /**< Output of a single level, next to the JSON when empty */
+        bool help = false;                  /**< Print usage and exit */
+    };
+
+    void printUsage(void)
+    {
+        std::cout
+            << "Usage: rtype_levelc [options] LEVEL.json...\n"
+            << "  -o FILE  Output of a single level (LEVEL.lvl next to the JSON)\n"
+            << "The server loads LEVEL.lvl instead of LEVEL.json while it is\n"
+            << "not older than the JSON. Recompile after editing a level or its\n"
+            << "tileset, tile obstacles are baked into the compiled file.\n";
+    }
+
+    CompileOptions parseArguments(int argc, char **argv)
+    {
+        CompileOptions options;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h")
+                options.help = true;
+            else if (arg == "-o" && i + 1 < argc)
+                options.output = argv[++i];
+            else if (arg.rfind("-", 0) != 0)
+                options.levels.push_back(arg);
+            else
+                log::warning("levelc: ignoring argument '{}'", arg);
+        }
+        return options;
+    }
+
+    bool compileLevel(const std::string &jsonPath, const std::string &output)
+    {
+        std::string error;
+        auto level = server::loadLevelFromFile(jsonPath, error);
+        if (!level) {
+            log::error("levelc: {}", error);
+            return false;
+        }
+
+        const std::string compiled = output.empty() ? server::compiledLevelPath(jsonPath) : output;
+        if (!server::saveLevelBinary(*level, compiled, error)) {
+            log::error("levelc: {}", error);
+            return false;
+        }
+
+        // Read it back so a broken writer never ships a level the server rejects
+        auto check = server::loadLevelBinary(compiled, error);
+        if (!check || check->spawns.size() != level->spawns.size()
+            || check->obstacles.size() != level->obstacles.size()) {
+            log::error("levelc: {} does not read back: {}", compiled, error);
+            return false;
+        }
+
+        log::info("levelc: {} -> {} ({} spawns, {} powerups, {} obstacles)",
+                  jsonPath, compiled, level->spawns.size(),
+                  level->powerups.size(), level->obstacles.size());
+        return true;
+    }
+
+    int runCompile(const CompileOptions &options)
+    {
+        if (!options.output.empty() && options.levels.size() > 1) {
+            log::error("levelc: -o takes a single level");
+            return 84;
+        }
+
+        size_t failed = 0;
+        for (const std::string &level : options.levels) {
+            if (!compileLevel(level, options.output))
+                ++failed;
+        }
+        return failed == 0 ? 0 : 84;
+    }
+} // namespace rtp::levelc
+
+int main(int ac, char **av)
+{
+    try {
+        const auto options = rtp::levelc::parseArguments(ac, av);
+        if (options.help || options.levels.empty()) {
+            rtp::levelc::printUsage();
+            return options.help ? 0 : 84;
+        }
+        return rtp::levelc::runCompile(options);
+    } catch (const std::exception &e) {
+        rtp::log::fatal("levelc: {}", e.what());
+        return 84;
+    }
+}
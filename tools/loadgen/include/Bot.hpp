@@ -0,0 +1,221 @@
+/**
+ * File   : Bot.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_LOADGEN_BOT_HPP_
+    #define RTYPE_LOADGEN_BOT_HPP_
+
+    #include "Network/ClientNetwork.hpp"
+    #include "RType/Game/PlayerPredictor.hpp"
+    #include "RType/Network/Packet.hpp"
+
+    #include <cstdint>
+    #include <string>
+    #include <vector>
+
+/**
+ * @namespace rtp::loadgen
+ * @brief Headless bot clients for load testing the server
+ */
+namespace rtp::loadgen
+{
+    /**
+     * @struct BotStats
+     * @brief What a bot measured since the last reset
+     */
+    struct BotStats {
+        uint64_t bytesSent = 0;             /**< Header and body bytes of every packet sent */
+        uint64_t bytesReceived = 0;         /**< Header and body bytes of every packet received */
+        uint64_t packetsReceived = 0;       /**< Packets received, TCP and UDP */
+        uint64_t snapshots = 0;             /**< RoomUpdate snapshots received in game */
+        uint32_t firstSnapshotTick = 0;     /**< Server tick of the first snapshot, 0 before */
+        uint32_t lastSnapshotTick = 0;      /**< Newest server tick received */
+        uint64_t pingsSent = 0;             /**< Ping requests sent */
+        uint64_t pongs = 0;                 /**< Pong replies received */
+        std::vector<uint32_t> rttMs;        /**< Round trip of every Pong */
+        uint64_t inputsSent = 0;            /**< InputTick datagrams sent */
+        uint64_t inputLagSum = 0;           /**< Sum of sent minus acked input sequences */
+        uint64_t inputLagSamples = 0;       /**< Snapshots contributing to inputLagSum */
+    };
+
+    /**
+     * @class Bot
+     * @brief One scripted player driving a ClientNetwork without a window
+     *
+     * The bot registers (or logs in if the name already exists), then
+     * waits for the load generator to tell it to create or join a room
+     * and get ready. In game it plays a fixed movement and fire pattern,
+     * sending its input history like the real client, pings the server
+     * and consumes snapshots.
+     */
+    class Bot final {
+        public:
+            /**
+             * @enum State
+             * @brief Where the bot is in the login and matchmaking flow
+             */
+            enum class State : uint8_t {
+                Connecting,         /**< Waiting for Welcome */
+                Authenticating,     /**< Register or login sent */
+                InLobby,            /**< Logged in, not in a room */
+                CreatingRoom,       /**< CreateRoom sent */
+                FindingRoom,        /**< Polling the room list for the target */
+                JoiningRoom,        /**< JoinRoom sent */
+                InRoom,             /**< In a room, waiting for the game */
+                InGame,             /**< StartGame received */
+                Failed              /**< Gave up, see the log */
+            };
+
+            static constexpr float PING_INTERVAL = 0.5f;        /**< Seconds between pings */
+            static constexpr float STEP_TIMEOUT = 10.0f;        /**< Seconds a flow step may take */
+            static constexpr float ROOM_POLL_INTERVAL = 0.25f;  /**< Seconds between room list requests */
+            static constexpr uint32_t INPUT_SEND_INTERVAL = 2;  /**< Steps between InputTick datagrams */
+            static constexpr uint32_t INPUT_REDUNDANCY = 6;     /**< Steps repeated in each InputTick */
+
+            /**
+             * @brief Constructor for Bot
+             * @param host Server address
+             * @param port Server TCP and UDP port
+             * @param username Account name, registered on first use
+             * @param seed Offsets the input script so bots do not move in lockstep
+             */
+            Bot(const std::string &host, uint16_t port, std::string username, uint32_t seed);
+
+            /**
+             * @brief Connect to the server
+             */
+            void start(void);
+
+            /**
+             * @brief Disconnect from the server
+             */
+            void stop(void);
+
+            /**
+             * @brief Handle received packets and act for one frame
+             * @param dt Frame time in seconds
+             */
+            void update(float dt);
+
+            /**
+             * @brief Create a public room and enter it
+             * @param name Room name, unique for the run
+             * @param maxPlayers Room capacity
+             */
+            void createRoom(const std::string &name, uint32_t maxPlayers);
+
+            /**
+             * @brief Find a room by name and join it as a player
+             * @param name Room name
+             */
+            void joinRoom(const std::string &name);
+
+            /**
+             * @brief Tell the server the bot is ready to start
+             */
+            void setReady(void);
+
+            /**
+             * @brief Current state
+             * @return State
+             */
+            State getState(void) const;
+
+            /**
+             * @brief Account name
+             * @return Username
+             */
+            const std::string &getUsername(void) const;
+
+            /**
+             * @brief Measurements since the last reset
+             * @return Stats
+             */
+            const BotStats &getStats(void) const;
+
+            /**
+             * @brief Drop the measurements, e.g. after the warm-up
+             */
+            void resetStats(void);
+
+        private:
+            /**
+             * @brief React to a packet from the server
+             * @param packet Received packet
+             */
+            void handlePacket(net::Packet &packet);
+
+            /**
+             * @brief Enter the lobby, or fall back from register to login
+             * @param success Whether the server accepted the request
+             */
+            void onAuthResponse(bool success);
+
+            /**
+             * @brief Look for the target room in a room list
+             * @param packet RoomList packet
+             */
+            void onRoomList(net::Packet &packet);
+
+            /**
+             * @brief Record a snapshot and the input ack it carries
+             * @param packet RoomUpdate packet
+             */
+            void onRoomUpdate(net::Packet &packet);
+
+            /**
+             * @brief Record a round trip
+             * @param packet Pong packet
+             */
+            void onPong(net::Packet &packet);
+
+            /**
+             * @brief Sample the input script and send the input history
+             * @param dt Frame time in seconds
+             */
+            void play(float dt);
+
+            /**
+             * @brief Input of the current step
+             * @return Input mask
+             */
+            uint8_t scriptedInput(void) const;
+
+            /**
+             * @brief Send a packet and count its bytes
+             * @param packet Packet to send
+             * @param mode Transport
+             */
+            void send(const net::Packet &packet, net::NetworkMode mode);
+
+            /**
+             * @brief Move to a state and restart its timeout
+             * @param state New state
+             */
+            void enter(State state);
+
+        private:
+            client::ClientNetwork _network;                 /**< Connection to the server */
+            std::string _username;                          /**< Account name */
+            uint32_t _seed;                                 /**< Input script offset */
+            State _state = State::Connecting;               /**< Flow state */
+            float _stateTime = 0.0f;                        /**< Seconds spent in _state */
+            bool _registering = true;                       /**< Register sent, login not tried yet */
+            std::string _targetRoom;                        /**< Room to find and join */
+            float _roomPollTimer = 0.0f;                    /**< Seconds since the last room list request */
+            float _pingTimer = 0.0f;                        /**< Seconds since the last ping */
+
+            game::PlayerPredictor _predictor;               /**< Input sequencing and history */
+            uint32_t _stepsSinceSend = 0;                   /**< Steps taken since the last InputTick */
+            std::vector<net::InputPayload> _inputHistory;   /**< Scratch InputTick payload */
+
+            std::vector<net::NetworkEvent> _events;         /**< Events drained per update */
+            std::vector<net::EntitySnapshotPayload> _snapshots; /**< Scratch snapshot decode */
+            BotStats _stats;                                /**< Measurements */
+    };
+}
+
+#endif /* !RTYPE_LOADGEN_BOT_HPP_ */
@@ -0,0 +1,120 @@
+/**
+ * File   : LoadGenerator.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_LOADGEN_LOADGENERATOR_HPP_
+    #define RTYPE_LOADGEN_LOADGENERATOR_HPP_
+
+    #include "Bot.hpp"
+
+    #include <atomic>
+    #include <cstddef>
+    #include <cstdint>
+    #include <memory>
+    #include <string>
+    #include <vector>
+
+/**
+ * @namespace rtp::loadgen
+ * @brief Headless bot clients for load testing the server
+ */
+namespace rtp::loadgen
+{
+    /**
+     * @struct LoadConfig
+     * @brief Size and length of a load test
+     */
+    struct LoadConfig {
+        std::string host = "127.0.0.1";     /**< Server address */
+        uint16_t port = 5000;               /**< Server TCP and UDP port */
+        size_t bots = 8;                    /**< Bots to connect */
+        size_t botsPerRoom = 4;             /**< Players per room, the last room may have fewer */
+        uint32_t duration = 30;             /**< Seconds measured once every room is in game */
+        uint32_t rampMs = 20;               /**< Delay between two bot connections */
+        uint32_t reportInterval = 5;        /**< Seconds between progress reports, 0 for none */
+        uint32_t snapshotInterval = 2;      /**< Server ticks between snapshots, to count gaps */
+        std::string prefix = "bot";         /**< Username and room name prefix */
+    };
+
+    /**
+     * @class LoadGenerator
+     * @brief Connects bots, groups them into rooms and reports what they see
+     *
+     * Every bot is updated from one thread at 60 Hz; each keeps its own
+     * ClientNetwork I/O thread. The first bot of a group creates the room,
+     * the others join it by name, and all get ready once the room is full
+     * so it starts with everyone. Measurement starts when every room that
+     * could be filled is in game, so the login burst is not counted.
+     */
+    class LoadGenerator final {
+        public:
+            static constexpr float FRAME_TIME = 1.0f / 60.0f;   /**< Bot update period, in seconds */
+            static constexpr float SETUP_TIMEOUT = 60.0f;       /**< Seconds allowed to get rooms in game */
+
+            /**
+             * @brief Constructor for LoadGenerator
+             * @param config Size and length of the test
+             */
+            explicit LoadGenerator(const LoadConfig &config);
+
+            /**
+             * @brief Run the test
+             * @param running Cleared to stop early, e.g. on SIGINT
+             * @return false if no bot made it into a game
+             */
+            bool run(const std::atomic<bool> &running);
+
+        private:
+            /**
+             * @struct Group
+             * @brief Bots sharing a room
+             */
+            struct Group {
+                std::string room;               /**< Room name */
+                std::vector<size_t> bots;       /**< Indexes in _bots, the first creates the room */
+                bool created = false;           /**< CreateRoom sent */
+                bool joined = false;            /**< JoinRoom sent by the others */
+                bool ready = false;             /**< SetReady sent by everyone */
+            };
+
+            /**
+             * @brief Connect the bots, spaced by the ramp delay
+             * @param running Cleared to stop early
+             */
+            void connectBots(const std::atomic<bool> &running);
+
+            /**
+             * @brief Update every bot once
+             * @param dt Frame time in seconds
+             */
+            void updateBots(float dt);
+
+            /**
+             * @brief Move each group one step closer to being in game
+             */
+            void orchestrate(void);
+
+            /**
+             * @brief Whether every group has either started or failed
+             * @return true once setup is over
+             */
+            bool setupDone(void) const;
+
+            /**
+             * @brief Print what the bots measured
+             * @param seconds Length of the measurement so far
+             * @param final Whether this is the closing report
+             */
+            void report(double seconds, bool final) const;
+
+        private:
+            LoadConfig _config;                             /**< Size and length of the test */
+            std::vector<std::unique_ptr<Bot>> _bots;        /**< Every bot */
+            std::vector<Group> _groups;                     /**< Bots by room */
+    };
+}
+
+#endif /* !RTYPE_LOADGEN_LOADGENERATOR_HPP_ */
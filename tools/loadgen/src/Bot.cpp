@@ -0,0 +1,341 @@
+/**
+ * File   : Bot.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "Bot.hpp"
+#include "RType/ECS/Components/InputComponent.hpp"
+#include "RType/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string_view>
+
+namespace rtp::loadgen
+{
+    namespace
+    {
+        constexpr const char *BOT_PASSWORD = "loadgen";
+        constexpr size_t EVENT_BATCH_SIZE = 128;
+
+        uint64_t nowMs(void)
+        {
+            const auto now = std::chrono::steady_clock::now().time_since_epoch();
+            return static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::milliseconds>(now).count());
+        }
+
+        uint64_t wireSize(const net::Packet &packet)
+        {
+            return sizeof(net::Header) + packet.body.size();
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    Bot::Bot(const std::string &host, uint16_t port, std::string username, uint32_t seed)
+        : _network(host, port), _username(std::move(username)), _seed(seed),
+          _events(EVENT_BATCH_SIZE)
+    {
+    }
+
+    void Bot::start(void)
+    {
+        _network.start();
+    }
+
+    void Bot::stop(void)
+    {
+        _network.stop();
+    }
+
+    void Bot::update(float dt)
+    {
+        size_t count = 0;
+        while ((count = _network.pollEvents(_events)) > 0) {
+            for (size_t i = 0; i < count; ++i) {
+                ++_stats.packetsReceived;
+                _stats.bytesReceived += wireSize(_events[i].packet);
+                handlePacket(_events[i].packet);
+            }
+        }
+        _network.flushReliable();
+
+        _stateTime += dt;
+        switch (_state) {
+            case State::Connecting:
+            case State::Authenticating:
+            case State::CreatingRoom:
+            case State::JoiningRoom:
+                if (_stateTime > STEP_TIMEOUT) {
+                    log::error("Bot {} timed out in state {}", _username, static_cast<int>(_state));
+                    enter(State::Failed);
+                }
+                return;
+            case State::FindingRoom:
+                _roomPollTimer += dt;
+                if (_roomPollTimer >= ROOM_POLL_INTERVAL) {
+                    _roomPollTimer = 0.0f;
+                    send(net::Packet(net::OpCode::ListRooms), net::NetworkMode::TCP);
+                }
+                if (_stateTime > STEP_TIMEOUT)
+                    enter(State::Failed);
+                break;
+            case State::InGame:
+                play(dt);
+                break;
+            default:
+                break;
+        }
+
+        if (_state == State::Failed || _state == State::Connecting)
+            return;
+        _pingTimer += dt;
+        if (_pingTimer >= PING_INTERVAL) {
+            _pingTimer = 0.0f;
+            net::Packet ping(net::OpCode::Ping);
+            ping << net::PingPayload{nowMs()};
+            send(ping, net::NetworkMode::UDP);
+            ++_stats.pingsSent;
+        }
+    }
+
+    void Bot::createRoom(const std::string &name, uint32_t maxPlayers)
+    {
+        net::CreateRoomPayload payload{};
+        std::strncpy(payload.roomName, name.c_str(), sizeof(payload.roomName) - 1);
+        payload.maxPlayers = maxPlayers;
+        payload.difficulty = 0.5f;
+        payload.speed = 1.0f;
+        payload.levelId = 1;
+        payload.seed = _seed;
+        payload.duration = 10;
+        payload.roomType = static_cast<uint8_t>(net::roomType::Public);
+
+        net::Packet packet(net::OpCode::CreateRoom);
+        packet << payload;
+        send(packet, net::NetworkMode::TCP);
+        enter(State::CreatingRoom);
+    }
+
+    void Bot::joinRoom(const std::string &name)
+    {
+        _targetRoom = name;
+        _roomPollTimer = ROOM_POLL_INTERVAL;
+        enter(State::FindingRoom);
+    }
+
+    void Bot::setReady(void)
+    {
+        net::Packet packet(net::OpCode::SetReady);
+        packet << static_cast<uint8_t>(1);
+        send(packet, net::NetworkMode::TCP);
+    }
+
+    Bot::State Bot::getState(void) const
+    {
+        return _state;
+    }
+
+    const std::string &Bot::getUsername(void) const
+    {
+        return _username;
+    }
+
+    const BotStats &Bot::getStats(void) const
+    {
+        return _stats;
+    }
+
+    void Bot::resetStats(void)
+    {
+        _stats = BotStats{};
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    void Bot::handlePacket(net::Packet &packet)
+    {
+        switch (packet.header.opCode) {
+            case net::OpCode::Welcome: {
+                net::RegisterPayload payload{};
+                std::strncpy(payload.username, _username.c_str(), sizeof(payload.username) - 1);
+                std::strncpy(payload.password, BOT_PASSWORD, sizeof(payload.password) - 1);
+                net::Packet request(net::OpCode::RegisterRequest);
+                request << payload;
+                send(request, net::NetworkMode::TCP);
+                enter(State::Authenticating);
+                break;
+            }
+            case net::OpCode::RegisterResponse: {
+                net::RegisterResponsePayload payload{};
+                packet >> payload;
+                onAuthResponse(payload.success != 0);
+                break;
+            }
+            case net::OpCode::LoginResponse: {
+                net::LoginResponsePayload payload{};
+                packet >> payload;
+                onAuthResponse(payload.success != 0);
+                break;
+            }
+            case net::OpCode::RoomList:
+                onRoomList(packet);
+                break;
+            case net::OpCode::CreateRoom:
+            case net::OpCode::JoinRoom: {
+                uint8_t success = 0;
+                packet >> success;
+                if (_state != State::CreatingRoom && _state != State::JoiningRoom)
+                    break;
+                enter(success ? State::InRoom : State::Failed);
+                break;
+            }
+            case net::OpCode::StartGame:
+                _predictor.reset();
+                _stepsSinceSend = 0;
+                enter(State::InGame);
+                break;
+            case net::OpCode::RoomUpdate:
+                onRoomUpdate(packet);
+                break;
+            case net::OpCode::Pong:
+                onPong(packet);
+                break;
+            case net::OpCode::Kicked:
+                log::warning("Bot {} was kicked", _username);
+                enter(State::Failed);
+                break;
+            default:
+                break;
+        }
+    }
+
+    void Bot::onAuthResponse(bool success)
+    {
+        if (success) {
+            enter(State::InLobby);
+            return;
+        }
+        if (!_registering) {
+            log::error("Bot {} could not register nor log in", _username);
+            enter(State::Failed);
+            return;
+        }
+
+        _registering = false;
+        net::LoginPayload payload{};
+        std::strncpy(payload.username, _username.c_str(), sizeof(payload.username) - 1);
+        std::strncpy(payload.password, BOT_PASSWORD, sizeof(payload.password) - 1);
+        net::Packet request(net::OpCode::LoginRequest);
+        request << payload;
+        send(request, net::NetworkMode::TCP);
+    }
+
+    void Bot::onRoomList(net::Packet &packet)
+    {
+        if (_state != State::FindingRoom)
+            return;
+
+        uint32_t roomCount = 0;
+        packet >> roomCount;
+        for (uint32_t i = 0; i < roomCount; ++i) {
+            net::RoomInfo room{};
+            packet >> room;
+            if (_targetRoom != std::string_view(room.roomName, strnlen(room.roomName, sizeof(room.roomName))))
+                continue;
+
+            net::Packet request(net::OpCode::JoinRoom);
+            request << net::JoinRoomPayload{room.roomId, 0};
+            send(request, net::NetworkMode::TCP);
+            enter(State::JoiningRoom);
+            return;
+        }
+    }
+
+    void Bot::onRoomUpdate(net::Packet &packet)
+    {
+        if (_state != State::InGame)
+            return;
+
+        net::RoomSnapshotPayload header{};
+        net::InputAckPayload ack{};
+        packet >> header >> ack >> _snapshots;
+
+        ++_stats.snapshots;
+        if (_stats.firstSnapshotTick == 0)
+            _stats.firstSnapshotTick = header.serverTick;
+        _stats.lastSnapshotTick = std::max<uint32_t>(_stats.lastSnapshotTick, header.serverTick);
+
+        const uint32_t sent = _predictor.getSequence();
+        if (ack.netId != 0 && ack.sequence <= sent) {
+            _stats.inputLagSum += sent - ack.sequence;
+            ++_stats.inputLagSamples;
+        }
+    }
+
+    void Bot::onPong(net::Packet &packet)
+    {
+        net::PingPayload payload{};
+        packet >> payload;
+        const uint64_t now = nowMs();
+        ++_stats.pongs;
+        _stats.rttMs.push_back(static_cast<uint32_t>(now >= payload.clientTimeMs
+                                                     ? now - payload.clientTimeMs : 0));
+    }
+
+    void Bot::play(float dt)
+    {
+        _stepsSinceSend += _predictor.advance(dt, scriptedInput());
+        if (_stepsSinceSend < INPUT_SEND_INTERVAL)
+            return;
+        _stepsSinceSend = 0;
+
+        const uint32_t newest = _predictor.getSequence();
+        const uint32_t count = std::min<uint32_t>(newest, INPUT_REDUNDANCY);
+        _inputHistory.clear();
+        for (uint32_t seq = newest - count + 1; seq <= newest; ++seq)
+            _inputHistory.push_back({_predictor.getInput(seq), seq});
+
+        net::Packet packet(net::OpCode::InputTick);
+        packet << _inputHistory;
+        send(packet, net::NetworkMode::UDP);
+        ++_stats.inputsSent;
+    }
+
+    uint8_t Bot::scriptedInput(void) const
+    {
+        using Bits = ecs::components::server::InputComponent::InputBits;
+
+        const uint32_t step = _predictor.getSequence() + _seed * 37;
+        uint8_t mask = 0;
+        switch ((step / 60) % 4) {
+            case 0: mask = Bits::MoveUp; break;
+            case 1: mask = Bits::MoveRight; break;
+            case 2: mask = Bits::MoveDown; break;
+            default: mask = Bits::MoveLeft; break;
+        }
+        if ((step / 10) % 2 == 0)
+            mask |= Bits::Shoot;
+        return mask;
+    }
+
+    void Bot::send(const net::Packet &packet, net::NetworkMode mode)
+    {
+        _stats.bytesSent += wireSize(packet);
+        _network.sendPacket(packet, mode);
+    }
+
+    void Bot::enter(State state)
+    {
+        _state = state;
+        _stateTime = 0.0f;
+    }
+}
@@ -0,0 +1,247 @@
+/**
+ * File   : LoadGenerator.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "LoadGenerator.hpp"
+#include "RType/Logger.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <format>
+#include <thread>
+
+namespace rtp::loadgen
+{
+    namespace
+    {
+        using Clock = std::chrono::steady_clock;
+
+        uint32_t percentile(const std::vector<uint32_t> &sorted, double p)
+        {
+            if (sorted.empty())
+                return 0;
+            const auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+            return sorted[std::min(index, sorted.size() - 1)];
+        }
+
+        double ratio(uint64_t part, uint64_t whole)
+        {
+            return whole == 0 ? 0.0 : 100.0 * static_cast<double>(part) / static_cast<double>(whole);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    LoadGenerator::LoadGenerator(const LoadConfig &config)
+        : _config(config)
+    {
+        _config.botsPerRoom = std::max<size_t>(_config.botsPerRoom, 1);
+        _config.snapshotInterval = std::max<uint32_t>(_config.snapshotInterval, 1);
+
+        _bots.reserve(_config.bots);
+        for (size_t i = 0; i < _config.bots; ++i) {
+            _bots.push_back(std::make_unique<Bot>(_config.host, _config.port,
+                std::format("{}{}", _config.prefix, i), static_cast<uint32_t>(i)));
+
+            if (i % _config.botsPerRoom == 0)
+                _groups.push_back({std::format("{}-room-{}", _config.prefix, _groups.size()), {}});
+            _groups.back().bots.push_back(i);
+        }
+    }
+
+    bool LoadGenerator::run(const std::atomic<bool> &running)
+    {
+        log::info("loadgen: {} bots in {} rooms against {}:{}",
+                  _bots.size(), _groups.size(), _config.host, _config.port);
+        connectBots(running);
+
+        const auto frame = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<float>(FRAME_TIME));
+        auto nextFrame = Clock::now();
+        const auto setupEnd = nextFrame + std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<float>(SETUP_TIMEOUT));
+        bool measuring = false;
+        Clock::time_point measureStart{};
+        Clock::time_point nextReport{};
+
+        while (running) {
+            updateBots(FRAME_TIME);
+            const auto now = Clock::now();
+
+            if (!measuring) {
+                orchestrate();
+                if (setupDone() || now >= setupEnd) {
+                    for (auto &bot : _bots)
+                        bot->resetStats();
+                    measuring = true;
+                    measureStart = now;
+                    nextReport = now + std::chrono::seconds(_config.reportInterval);
+                    log::info("loadgen: setup done, measuring for {}s", _config.duration);
+                }
+            } else {
+                const double elapsed = std::chrono::duration<double>(now - measureStart).count();
+                if (elapsed >= _config.duration)
+                    break;
+                if (_config.reportInterval > 0 && now >= nextReport) {
+                    report(elapsed, false);
+                    nextReport += std::chrono::seconds(_config.reportInterval);
+                }
+            }
+
+            nextFrame += frame;
+            if (nextFrame < now)
+                nextFrame = now;
+            std::this_thread::sleep_until(nextFrame);
+        }
+
+        const double elapsed = measuring
+            ? std::chrono::duration<double>(Clock::now() - measureStart).count() : 0.0;
+        report(elapsed, true);
+        for (auto &bot : _bots)
+            bot->stop();
+
+        return std::ranges::any_of(_bots, [](const auto &bot) {
+            return bot->getState() == Bot::State::InGame;
+        });
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    void LoadGenerator::connectBots(const std::atomic<bool> &running)
+    {
+        const auto ramp = std::chrono::milliseconds(_config.rampMs);
+        auto next = Clock::now();
+
+        for (size_t i = 0; i < _bots.size() && running; ++i) {
+            _bots[i]->start();
+            next += ramp;
+            while (running && Clock::now() < next) {
+                updateBots(0.0f);
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+        }
+    }
+
+    void LoadGenerator::updateBots(float dt)
+    {
+        for (auto &bot : _bots)
+            bot->update(dt);
+    }
+
+    void LoadGenerator::orchestrate(void)
+    {
+        for (auto &group : _groups) {
+            Bot &leader = *_bots[group.bots.front()];
+
+            if (!group.created) {
+                if (leader.getState() == Bot::State::InLobby) {
+                    leader.createRoom(group.room, static_cast<uint32_t>(_config.botsPerRoom));
+                    group.created = true;
+                }
+                continue;
+            }
+            if (!group.joined) {
+                if (leader.getState() != Bot::State::InRoom)
+                    continue;
+                const bool lobby = std::ranges::all_of(group.bots, [this](size_t i) {
+                    const auto state = _bots[i]->getState();
+                    return state != Bot::State::Connecting && state != Bot::State::Authenticating;
+                });
+                if (!lobby)
+                    continue;
+                for (size_t i = 1; i < group.bots.size(); ++i) {
+                    if (_bots[group.bots[i]]->getState() == Bot::State::InLobby)
+                        _bots[group.bots[i]]->joinRoom(group.room);
+                }
+                group.joined = true;
+                continue;
+            }
+            if (!group.ready) {
+                const bool settled = std::ranges::none_of(group.bots, [this](size_t i) {
+                    const auto state = _bots[i]->getState();
+                    return state == Bot::State::FindingRoom || state == Bot::State::JoiningRoom;
+                });
+                if (!settled)
+                    continue;
+                for (const size_t i : group.bots) {
+                    if (_bots[i]->getState() == Bot::State::InRoom)
+                        _bots[i]->setReady();
+                }
+                group.ready = true;
+            }
+        }
+    }
+
+    bool LoadGenerator::setupDone(void) const
+    {
+        return std::ranges::all_of(_groups, [this](const Group &group) {
+            return std::ranges::all_of(group.bots, [this](size_t i) {
+                const auto state = _bots[i]->getState();
+                return state == Bot::State::InGame || state == Bot::State::Failed;
+            });
+        });
+    }
+
+    void LoadGenerator::report(double seconds, bool final) const
+    {
+        size_t inGame = 0;
+        size_t failed = 0;
+        BotStats total{};
+        uint64_t expectedSnapshots = 0;
+
+        for (const auto &bot : _bots) {
+            const BotStats &stats = bot->getStats();
+            if (bot->getState() == Bot::State::InGame)
+                ++inGame;
+            else if (bot->getState() == Bot::State::Failed)
+                ++failed;
+
+            total.bytesSent += stats.bytesSent;
+            total.bytesReceived += stats.bytesReceived;
+            total.packetsReceived += stats.packetsReceived;
+            total.snapshots += stats.snapshots;
+            total.pingsSent += stats.pingsSent;
+            total.pongs += stats.pongs;
+            total.inputsSent += stats.inputsSent;
+            total.inputLagSum += stats.inputLagSum;
+            total.inputLagSamples += stats.inputLagSamples;
+            total.rttMs.insert(total.rttMs.end(), stats.rttMs.begin(), stats.rttMs.end());
+            if (stats.snapshots > 0)
+                expectedSnapshots += (stats.lastSnapshotTick - stats.firstSnapshotTick)
+                                   / _config.snapshotInterval + 1;
+        }
+
+        std::ranges::sort(total.rttMs);
+        const double span = std::max(seconds, 1e-3);
+        const double players = static_cast<double>(std::max<size_t>(inGame, 1));
+        const uint64_t missed = expectedSnapshots > total.snapshots ? expectedSnapshots - total.snapshots : 0;
+        const uint64_t lostPings = total.pingsSent > total.pongs ? total.pingsSent - total.pongs : 0;
+
+        log::info("loadgen: {} {:.1f}s, {}/{} bots in game, {} failed",
+                  final ? "final" : "at", seconds, inGame, _bots.size(), failed);
+        log::info("loadgen:   rtt ms p50={} p95={} p99={} max={}, ping loss {:.2f}% ({}/{})",
+                  percentile(total.rttMs, 0.50), percentile(total.rttMs, 0.95),
+                  percentile(total.rttMs, 0.99), total.rttMs.empty() ? 0 : total.rttMs.back(),
+                  ratio(lostPings, total.pingsSent), lostPings, total.pingsSent);
+        log::info("loadgen:   snapshots {:.1f}/s per bot, missed {:.2f}% ({}/{})",
+                  static_cast<double>(total.snapshots) / span / players,
+                  ratio(missed, expectedSnapshots), missed, expectedSnapshots);
+        log::info("loadgen:   rx {:.1f} KB/s ({:.2f} per bot, {:.0f} pkt/s), tx {:.1f} KB/s ({:.2f} per bot)",
+                  static_cast<double>(total.bytesReceived) / span / 1024.0,
+                  static_cast<double>(total.bytesReceived) / span / 1024.0 / players,
+                  static_cast<double>(total.packetsReceived) / span,
+                  static_cast<double>(total.bytesSent) / span / 1024.0,
+                  static_cast<double>(total.bytesSent) / span / 1024.0 / players);
+        log::info("loadgen:   {} InputTick sent, acked input lag {:.2f} steps",
+                  total.inputsSent,
+                  total.inputLagSamples == 0 ? 0.0
+                      : static_cast<double>(total.inputLagSum) / static_cast<double>(total.inputLagSamples));
+    }
+}
@@ -0,0 +1,106 @@
+/**
+ * File   : main.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "LoadGenerator.hpp"
+#include "RType/Logger.hpp"
+
+#include <atomic>
+#include <csignal>
+#include <iostream>
+#include <string>
+
+namespace rtp::loadgen
+{
+    std::atomic<bool> running{true};
+
+    void signal_handler(int signum)
+    {
+        if (signum == SIGINT)
+            running = false;
+    }
+
+    struct LoadGenOptions {
+        LoadConfig load{};              /**< Size and length of the test */
+        bool help = false;              /**< Print usage and exit */
+    };
+
+    void printUsage(void)
+    {
+        std::cout
+            << "Usage: rtype_loadgen [options]\n"
+            << "  --host HOST              Server address (127.0.0.1)\n"
+            << "  --port PORT              Server TCP/UDP port (5000)\n"
+            << "  --bots N                 Bots to connect (8)\n"
+            << "  --bots-per-room N        Players per room (4)\n"
+            << "  --duration SECONDS       Measured time once rooms are in game (30)\n"
+            << "  --ramp MS                Delay between two bot connections (20)\n"
+            << "  --report SECONDS         Progress report interval, 0 to disable (5)\n"
+            << "  --snapshot-interval N    Server ticks between snapshots (2)\n"
+            << "  --prefix NAME            Username and room name prefix (bot)\n"
+            << "Accounts are registered on first use with a fixed password.\n";
+    }
+
+    LoadGenOptions parseArguments(int argc, char **argv)
+    {
+        LoadGenOptions options;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h") {
+                options.help = true;
+                continue;
+            }
+            if (arg.rfind("--", 0) != 0 || i + 1 >= argc) {
+                log::warning("loadgen: ignoring argument '{}'", arg);
+                continue;
+            }
+
+            const std::string name = arg.substr(2);
+            const std::string value = argv[++i];
+            if (name == "host")
+                options.load.host = value;
+            else if (name == "port")
+                options.load.port = static_cast<uint16_t>(std::stoi(value));
+            else if (name == "bots")
+                options.load.bots = static_cast<size_t>(std::stoul(value));
+            else if (name == "bots-per-room")
+                options.load.botsPerRoom = static_cast<size_t>(std::stoul(value));
+            else if (name == "duration")
+                options.load.duration = static_cast<uint32_t>(std::stoul(value));
+            else if (name == "ramp")
+                options.load.rampMs = static_cast<uint32_t>(std::stoul(value));
+            else if (name == "report")
+                options.load.reportInterval = static_cast<uint32_t>(std::stoul(value));
+            else if (name == "snapshot-interval")
+                options.load.snapshotInterval = static_cast<uint32_t>(std::stoul(value));
+            else if (name == "prefix")
+                options.load.prefix = value;
+            else
+                log::warning("loadgen: unknown option '{}'", arg);
+        }
+        return options;
+    }
+} // namespace rtp::loadgen
+
+int main(int ac, char **av)
+{
+    std::signal(SIGINT, rtp::loadgen::signal_handler);
+
+    try {
+        const auto options = rtp::loadgen::parseArguments(ac, av);
+        if (options.help) {
+            rtp::loadgen::printUsage();
+            return 0;
+        }
+
+        rtp::loadgen::LoadGenerator generator(options.load);
+        return generator.run(rtp::loadgen::running) ? 0 : 84;
+    } catch (const std::exception &e) {
+        rtp::log::fatal("loadgen: {}", e.what());
+        return 84;
+    }
+}
@@ -0,0 +1,199 @@
+/**
+ * File   : NetSimProxy.hpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#ifndef RTYPE_NETSIM_PROXY_HPP_
+    #define RTYPE_NETSIM_PROXY_HPP_
+
+    #include "RType/Network/ImpairedLink.hpp"
+
+    #include <asio.hpp>
+    #include <array>
+    #include <map>
+    #include <memory>
+    #include <mutex>
+    #include <string>
+    #include <thread>
+    #include <vector>
+
+/**
+ * @namespace rtp::netsim
+ * @brief Network impairment proxy for testing the netcode on localhost
+ */
+namespace rtp::netsim
+{
+    /**
+     * @enum Direction
+     * @brief Side of the proxy traffic flows towards
+     */
+    enum class Direction : uint8_t {
+        Upstream = 0,       /**< Client to server */
+        Downstream = 1      /**< Server to client */
+    };
+
+    /**
+     * @struct ProxyConfig
+     * @brief Where the proxy listens, forwards, and what it does to the traffic
+     */
+    struct ProxyConfig {
+        uint16_t listenPort = 0;                    /**< TCP and UDP port clients connect to, 0 for any */
+        std::string serverHost = "127.0.0.1";       /**< Server address */
+        uint16_t serverPort = 5000;                 /**< Server TCP and UDP port */
+        net::Impairment upstream{};                 /**< Conditions from client to server */
+        net::Impairment downstream{};               /**< Conditions from server to client */
+        uint32_t seed = 1;                          /**< Seed of the first link, incremented per link */
+    };
+
+    /**
+     * @class NetSimProxy
+     * @brief Forwards a client's TCP and UDP traffic through impaired links
+     *
+     * Listens on one port for both protocols, like the server, so a client
+     * only needs to be pointed at the proxy. Each TCP connection and each
+     * UDP source endpoint gets its own pair of links, and reaches the
+     * server from its own socket so sessions stay distinct.
+     *
+     * The proxy runs its own I/O thread: tests can start one on port 0,
+     * read getPort(), and change the conditions while traffic flows.
+     *
+     * @note Impairments apply to every datagram, including the UDP Hello
+     *       a client sends once after logging in
+     */
+    class NetSimProxy final {
+        public:
+            /**
+             * @brief Constructor for NetSimProxy
+             * @param config Ports and conditions
+             * @note Binds the listening sockets, throws if the port is taken
+             */
+            explicit NetSimProxy(const ProxyConfig &config);
+
+            /**
+             * @brief Destructor for NetSimProxy
+             * @note Stops the proxy
+             */
+            ~NetSimProxy();
+
+            /**
+             * @brief Start forwarding on the proxy's I/O thread
+             */
+            void start(void);
+
+            /**
+             * @brief Stop forwarding and close every connection
+             */
+            void stop(void);
+
+            /**
+             * @brief Port the proxy listens on
+             * @return TCP and UDP port
+             */
+            uint16_t getPort(void) const;
+
+            /**
+             * @brief Change the conditions of existing and future links
+             * @param direction Direction to change
+             * @param impairment Conditions to apply
+             */
+            void setImpairment(Direction direction, const net::Impairment &impairment);
+
+            /**
+             * @brief Counters of every link in a direction, TCP and UDP together
+             * @param direction Direction to read
+             * @return Sum of the links' stats
+             */
+            net::ImpairedLink::Stats getStats(Direction direction) const;
+
+        private:
+            static constexpr size_t MAX_PENDING_CHUNKS = 256;  /**< TCP chunks held before reading pauses */
+
+            struct Lane;
+            struct TcpPipe;
+            struct UdpFlow;
+
+            /**
+             * @brief Accept the next client connection
+             */
+            void acceptTcp(void);
+
+            /**
+             * @brief Receive the next datagram from a client
+             */
+            void receiveUdp(void);
+
+            /**
+             * @brief Receive the next datagram from the server for a flow
+             * @param flow Client flow
+             */
+            void receiveFromServer(const std::shared_ptr<UdpFlow> &flow);
+
+            /**
+             * @brief Pump one direction of a TCP connection
+             * @param pipe Connection
+             * @param direction Direction to read
+             */
+            void readTcp(const std::shared_ptr<TcpPipe> &pipe, Direction direction);
+
+            /**
+             * @brief Write the next chunk of a TCP direction once it is due
+             * @param pipe Connection
+             * @param direction Direction to write
+             */
+            void writeTcp(const std::shared_ptr<TcpPipe> &pipe, Direction direction);
+
+            /**
+             * @brief Send a datagram through a flow's link
+             * @param flow Client flow
+             * @param direction Direction it travels
+             * @param data Datagram
+             */
+            void forwardDatagram(const std::shared_ptr<UdpFlow> &flow, Direction direction,
+                                 std::vector<uint8_t> data);
+
+            /**
+             * @brief Send a flow's datagrams as they become due
+             * @param flow Client flow
+             * @param direction Direction to send
+             */
+            void sendDatagrams(const std::shared_ptr<UdpFlow> &flow, Direction direction);
+
+            /**
+             * @brief Create a link with the current conditions of a direction
+             * @param direction Direction of the link
+             * @return Link
+             */
+            net::ImpairedLink makeLink(Direction direction);
+
+            /**
+             * @brief Add what a link did since before to the direction's totals
+             * @param direction Direction of the link
+             * @param before Link stats before the operation
+             * @param after Link stats after the operation
+             */
+            void record(Direction direction, const net::ImpairedLink::Stats &before,
+                        const net::ImpairedLink::Stats &after);
+
+        private:
+            ProxyConfig _config;                            /**< Ports and conditions */
+            asio::io_context _ioContext;                    /**< Context of every socket and timer */
+            asio::ip::tcp::acceptor _acceptor;              /**< Client TCP connections */
+            asio::ip::udp::socket _udpSocket;               /**< Client datagrams */
+            asio::ip::tcp::endpoint _serverTcp;             /**< Server TCP endpoint */
+            asio::ip::udp::endpoint _serverUdp;             /**< Server UDP endpoint */
+            std::thread _ioThread;                          /**< Runs _ioContext */
+            uint32_t _nextSeed = 0;                         /**< Seed of the next link */
+
+            std::array<uint8_t, 65536> _udpBuffer{};        /**< Datagram from a client */
+            asio::ip::udp::endpoint _udpSender;             /**< Source of _udpBuffer */
+            std::map<asio::ip::udp::endpoint, std::shared_ptr<UdpFlow>> _udpFlows; /**< Flows by client endpoint */
+            std::vector<std::weak_ptr<TcpPipe>> _tcpPipes;  /**< Open connections */
+
+            mutable std::mutex _statsMutex;                 /**< Protects _stats */
+            std::array<net::ImpairedLink::Stats, 2> _stats{}; /**< Totals by direction */
+    };
+}
+
+#endif /* !RTYPE_NETSIM_PROXY_HPP_ */
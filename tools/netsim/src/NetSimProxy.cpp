@@ -0,0 +1,412 @@
+/**
+ * File   : NetSimProxy.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "NetSimProxy.hpp"
+#include "RType/Logger.hpp"
+
+#include <algorithm>
+#include <deque>
+
+namespace rtp::netsim
+{
+    using Clock = net::ImpairedLink::Clock;
+
+    /**
+     * One direction of a TCP connection or UDP flow: its link and the
+     * traffic waiting for its arrival time
+     */
+    struct NetSimProxy::Lane {
+        struct Pending {
+            Clock::time_point at;       /**< Arrival time */
+            std::vector<uint8_t> data;  /**< Chunk or datagram */
+        };
+
+        Lane(asio::io_context &io, net::ImpairedLink impaired)
+            : link(std::move(impaired)), timer(io)
+        {
+        }
+
+        net::ImpairedLink link;
+        asio::steady_timer timer;
+        std::deque<Pending> queue;
+        std::array<uint8_t, 4096> buffer{};
+        bool reading = false;
+        bool eof = false;
+    };
+
+    struct NetSimProxy::TcpPipe {
+        TcpPipe(asio::io_context &io, asio::ip::tcp::socket socket,
+                net::ImpairedLink upLink, net::ImpairedLink downLink)
+            : client(std::move(socket)), server(io),
+              up(io, std::move(upLink)), down(io, std::move(downLink))
+        {
+        }
+
+        Lane &lane(Direction direction)
+        {
+            return direction == Direction::Upstream ? up : down;
+        }
+
+        asio::ip::tcp::socket &source(Direction direction)
+        {
+            return direction == Direction::Upstream ? client : server;
+        }
+
+        asio::ip::tcp::socket &sink(Direction direction)
+        {
+            return direction == Direction::Upstream ? server : client;
+        }
+
+        void close(void)
+        {
+            asio::error_code ec;
+            client.close(ec);
+            server.close(ec);
+            up.timer.cancel();
+            down.timer.cancel();
+        }
+
+        asio::ip::tcp::socket client;
+        asio::ip::tcp::socket server;
+        Lane up;
+        Lane down;
+    };
+
+    struct NetSimProxy::UdpFlow {
+        UdpFlow(asio::io_context &io, const asio::ip::udp::endpoint &from,
+                net::ImpairedLink upLink, net::ImpairedLink downLink)
+            : client(from), socket(io),
+              up(io, std::move(upLink)), down(io, std::move(downLink))
+        {
+        }
+
+        Lane &lane(Direction direction)
+        {
+            return direction == Direction::Upstream ? up : down;
+        }
+
+        void close(void)
+        {
+            asio::error_code ec;
+            socket.close(ec);
+            up.timer.cancel();
+            down.timer.cancel();
+        }
+
+        asio::ip::udp::endpoint client;
+        asio::ip::udp::socket socket;
+        std::array<uint8_t, 65536> buffer{};
+        Lane up;
+        Lane down;
+    };
+
+    //////////////////////////////////////////////////////////////////////////
+    // Public API
+    //////////////////////////////////////////////////////////////////////////
+
+    NetSimProxy::NetSimProxy(const ProxyConfig &config)
+        : _config(config),
+          _acceptor(_ioContext, asio::ip::tcp::endpoint(asio::ip::tcp::v4(), config.listenPort)),
+          _udpSocket(_ioContext, asio::ip::udp::endpoint(asio::ip::udp::v4(),
+                                                         _acceptor.local_endpoint().port())),
+          _nextSeed(config.seed)
+    {
+        asio::ip::tcp::resolver resolver(_ioContext);
+        _serverTcp = *resolver.resolve(asio::ip::tcp::v4(), config.serverHost,
+                                       std::to_string(config.serverPort)).begin();
+        _serverUdp = asio::ip::udp::endpoint(_serverTcp.address(), _serverTcp.port());
+    }
+
+    NetSimProxy::~NetSimProxy()
+    {
+        stop();
+    }
+
+    void NetSimProxy::start(void)
+    {
+        acceptTcp();
+        receiveUdp();
+        _ioThread = std::thread([this]() { _ioContext.run(); });
+        log::info("netsim: {} -> {}:{}", getPort(),
+                  _serverTcp.address().to_string(), _serverTcp.port());
+    }
+
+    void NetSimProxy::stop(void)
+    {
+        if (!_ioThread.joinable())
+            return;
+        _ioContext.stop();
+        _ioThread.join();
+
+        asio::error_code ec;
+        _acceptor.close(ec);
+        _udpSocket.close(ec);
+        for (auto &weak : _tcpPipes) {
+            if (auto pipe = weak.lock())
+                pipe->close();
+        }
+        for (auto &[endpoint, flow] : _udpFlows)
+            flow->close();
+        _tcpPipes.clear();
+        _udpFlows.clear();
+
+        _ioContext.restart();
+        _ioContext.poll();
+    }
+
+    uint16_t NetSimProxy::getPort(void) const
+    {
+        return _acceptor.local_endpoint().port();
+    }
+
+    void NetSimProxy::setImpairment(Direction direction, const net::Impairment &impairment)
+    {
+        asio::post(_ioContext, [this, direction, impairment]() {
+            (direction == Direction::Upstream ? _config.upstream : _config.downstream) = impairment;
+            for (auto &[endpoint, flow] : _udpFlows)
+                flow->lane(direction).link.setImpairment(impairment);
+            for (auto &weak : _tcpPipes) {
+                if (auto pipe = weak.lock())
+                    pipe->lane(direction).link.setImpairment(impairment);
+            }
+        });
+    }
+
+    net::ImpairedLink::Stats NetSimProxy::getStats(Direction direction) const
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        return _stats[static_cast<size_t>(direction)];
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+    // Private Implementation
+    //////////////////////////////////////////////////////////////////////////
+
+    void NetSimProxy::acceptTcp(void)
+    {
+        _acceptor.async_accept(
+            [this](const asio::error_code &error, asio::ip::tcp::socket socket)
+            {
+                if (error) {
+                    if (error == asio::error::operation_aborted)
+                        return;
+                    log::error("netsim: accept error: {}", error.message());
+                    acceptTcp();
+                    return;
+                }
+
+                socket.set_option(asio::ip::tcp::no_delay(true));
+                auto pipe = std::make_shared<TcpPipe>(_ioContext, std::move(socket),
+                    makeLink(Direction::Upstream), makeLink(Direction::Downstream));
+                std::erase_if(_tcpPipes, [](const auto &weak) { return weak.expired(); });
+                _tcpPipes.push_back(pipe);
+
+                pipe->server.async_connect(_serverTcp,
+                    [this, pipe](const asio::error_code &ec)
+                    {
+                        if (ec) {
+                            log::warning("netsim: server unreachable: {}", ec.message());
+                            pipe->close();
+                            return;
+                        }
+                        pipe->server.set_option(asio::ip::tcp::no_delay(true));
+                        readTcp(pipe, Direction::Upstream);
+                        readTcp(pipe, Direction::Downstream);
+                    });
+                acceptTcp();
+            }
+        );
+    }
+
+    void NetSimProxy::readTcp(const std::shared_ptr<TcpPipe> &pipe, Direction direction)
+    {
+        Lane &lane = pipe->lane(direction);
+        if (lane.queue.size() >= MAX_PENDING_CHUNKS) {
+            lane.reading = false;
+            return;
+        }
+        lane.reading = true;
+
+        pipe->source(direction).async_read_some(asio::buffer(lane.buffer),
+            [this, pipe, direction](const asio::error_code &error, std::size_t bytes)
+            {
+                Lane &lane = pipe->lane(direction);
+                lane.reading = false;
+                if (error) {
+                    if (error == asio::error::operation_aborted)
+                        return;
+                    lane.eof = true;
+                    if (lane.queue.empty()) {
+                        asio::error_code ec;
+                        pipe->sink(direction).shutdown(asio::ip::tcp::socket::shutdown_send, ec);
+                    }
+                    return;
+                }
+
+                const auto before = lane.link.getStats();
+                const auto at = lane.link.scheduleStream(Clock::now(), bytes);
+                record(direction, before, lane.link.getStats());
+
+                lane.queue.push_back({at, {lane.buffer.begin(), lane.buffer.begin() + bytes}});
+                if (lane.queue.size() == 1)
+                    writeTcp(pipe, direction);
+                readTcp(pipe, direction);
+            }
+        );
+    }
+
+    void NetSimProxy::writeTcp(const std::shared_ptr<TcpPipe> &pipe, Direction direction)
+    {
+        Lane &lane = pipe->lane(direction);
+        lane.timer.expires_at(lane.queue.front().at);
+        lane.timer.async_wait([this, pipe, direction](const asio::error_code &error)
+        {
+            if (error)
+                return;
+            Lane &lane = pipe->lane(direction);
+            asio::async_write(pipe->sink(direction), asio::buffer(lane.queue.front().data),
+                [this, pipe, direction](const asio::error_code &ec, std::size_t)
+                {
+                    Lane &lane = pipe->lane(direction);
+                    if (ec) {
+                        pipe->close();
+                        return;
+                    }
+                    lane.queue.pop_front();
+                    if (!lane.queue.empty()) {
+                        writeTcp(pipe, direction);
+                    } else if (lane.eof) {
+                        asio::error_code ignored;
+                        pipe->sink(direction).shutdown(asio::ip::tcp::socket::shutdown_send, ignored);
+                    }
+                    if (!lane.reading && !lane.eof)
+                        readTcp(pipe, direction);
+                });
+        });
+    }
+
+    void NetSimProxy::receiveUdp(void)
+    {
+        _udpSocket.async_receive_from(asio::buffer(_udpBuffer), _udpSender,
+            [this](const asio::error_code &error, std::size_t bytes)
+            {
+                if (error) {
+                    if (error == asio::error::operation_aborted)
+                        return;
+                    receiveUdp();
+                    return;
+                }
+
+                auto it = _udpFlows.find(_udpSender);
+                if (it == _udpFlows.end()) {
+                    auto flow = std::make_shared<UdpFlow>(_ioContext, _udpSender,
+                        makeLink(Direction::Upstream), makeLink(Direction::Downstream));
+                    asio::error_code ec;
+                    flow->socket.open(asio::ip::udp::v4(), ec);
+                    if (!ec)
+                        flow->socket.connect(_serverUdp, ec);
+                    if (ec) {
+                        log::error("netsim: cannot reach server over UDP: {}", ec.message());
+                        receiveUdp();
+                        return;
+                    }
+                    it = _udpFlows.emplace(_udpSender, flow).first;
+                    receiveFromServer(flow);
+                }
+
+                forwardDatagram(it->second, Direction::Upstream,
+                                {_udpBuffer.begin(), _udpBuffer.begin() + bytes});
+                receiveUdp();
+            }
+        );
+    }
+
+    void NetSimProxy::receiveFromServer(const std::shared_ptr<UdpFlow> &flow)
+    {
+        flow->socket.async_receive(asio::buffer(flow->buffer),
+            [this, flow](const asio::error_code &error, std::size_t bytes)
+            {
+                if (error == asio::error::operation_aborted)
+                    return;
+                if (!error) {
+                    forwardDatagram(flow, Direction::Downstream,
+                                    {flow->buffer.begin(), flow->buffer.begin() + bytes});
+                }
+                receiveFromServer(flow);
+            }
+        );
+    }
+
+    void NetSimProxy::forwardDatagram(const std::shared_ptr<UdpFlow> &flow, Direction direction,
+                                      std::vector<uint8_t> data)
+    {
+        Lane &lane = flow->lane(direction);
+        std::array<Clock::time_point, 2> arrivals{};
+
+        const auto before = lane.link.getStats();
+        const size_t copies = lane.link.scheduleDatagram(Clock::now(), data.size(), arrivals);
+        record(direction, before, lane.link.getStats());
+
+        bool rearm = false;
+        for (size_t i = 0; i < copies; ++i) {
+            auto at = std::upper_bound(lane.queue.begin(), lane.queue.end(), arrivals[i],
+                [](Clock::time_point t, const Lane::Pending &p) { return t < p.at; });
+            rearm |= at == lane.queue.begin();
+            if (i + 1 < copies)
+                lane.queue.insert(at, {arrivals[i], data});
+            else
+                lane.queue.insert(at, {arrivals[i], std::move(data)});
+        }
+        if (rearm)
+            sendDatagrams(flow, direction);
+    }
+
+    void NetSimProxy::sendDatagrams(const std::shared_ptr<UdpFlow> &flow, Direction direction)
+    {
+        Lane &lane = flow->lane(direction);
+        lane.timer.expires_at(lane.queue.front().at);
+        lane.timer.async_wait([this, flow, direction](const asio::error_code &error)
+        {
+            if (error)
+                return;
+            Lane &lane = flow->lane(direction);
+            const auto now = Clock::now();
+            asio::error_code ec;
+            while (!lane.queue.empty() && lane.queue.front().at <= now) {
+                const auto &data = lane.queue.front().data;
+                if (direction == Direction::Upstream)
+                    flow->socket.send(asio::buffer(data), 0, ec);
+                else
+                    _udpSocket.send_to(asio::buffer(data), flow->client, 0, ec);
+                lane.queue.pop_front();
+            }
+            if (!lane.queue.empty())
+                sendDatagrams(flow, direction);
+        });
+    }
+
+    net::ImpairedLink NetSimProxy::makeLink(Direction direction)
+    {
+        const auto &impairment = direction == Direction::Upstream
+            ? _config.upstream : _config.downstream;
+        return net::ImpairedLink(impairment, _nextSeed++);
+    }
+
+    void NetSimProxy::record(Direction direction, const net::ImpairedLink::Stats &before,
+                             const net::ImpairedLink::Stats &after)
+    {
+        std::lock_guard<std::mutex> lock(_statsMutex);
+        auto &total = _stats[static_cast<size_t>(direction)];
+        total.packets += after.packets - before.packets;
+        total.delivered += after.delivered - before.delivered;
+        total.bytes += after.bytes - before.bytes;
+        total.dropped += after.dropped - before.dropped;
+        total.duplicated += after.duplicated - before.duplicated;
+        total.reordered += after.reordered - before.reordered;
+        total.retransmits += after.retransmits - before.retransmits;
+    }
+}
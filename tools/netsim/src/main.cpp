@@ -0,0 +1,167 @@
+/**
+ * File   : main.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "NetSimProxy.hpp"
+#include "RType/Logger.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace rtp::netsim
+{
+    std::atomic<bool> running{true};
+
+    void signal_handler(int signum)
+    {
+        if (signum == SIGINT)
+            running = false;
+    }
+
+    struct NetSimOptions {
+        ProxyConfig proxy{};            /**< Ports and conditions */
+        uint32_t statsInterval = 5;     /**< Seconds between stats lines, 0 for none */
+        bool help = false;              /**< Print usage and exit */
+    };
+
+    void printUsage(void)
+    {
+        std::cout
+            << "Usage: rtype_netsim [options]\n"
+            << "  --listen PORT        TCP/UDP port clients connect to (5001)\n"
+            << "  --server HOST        Server address (127.0.0.1)\n"
+            << "  --server-port PORT   Server TCP/UDP port (5000)\n"
+            << "  --seed N             Seed of the random decisions (1)\n"
+            << "  --stats SECONDS      Stats interval, 0 to disable (5)\n"
+            << "Conditions, for both directions or prefixed with up- or down-:\n"
+            << "  --delay MS           One-way latency\n"
+            << "  --jitter MS          Latency varies by up to this much either way\n"
+            << "  --loss PERCENT       Datagrams dropped; TCP chunks delayed by a retransmission\n"
+            << "  --dup PERCENT        Datagrams delivered twice\n"
+            << "  --reorder PERCENT    Datagrams held back by the reorder gap\n"
+            << "  --reorder-gap MS     Extra latency of a held back datagram (20)\n"
+            << "  --bandwidth KBPS     Bandwidth cap in kilobits per second\n"
+            << "  --queue BYTES        Bytes queued behind the cap before dropping (65536)\n"
+            << "Loss also applies to the client's one-shot UDP Hello.\n";
+    }
+
+    bool parseCondition(const std::string &name, const std::string &value, net::Impairment &impairment)
+    {
+        using std::chrono::microseconds;
+
+        if (name == "delay")
+            impairment.delay = microseconds(static_cast<long long>(std::stod(value) * 1000.0));
+        else if (name == "jitter")
+            impairment.jitter = microseconds(static_cast<long long>(std::stod(value) * 1000.0));
+        else if (name == "loss")
+            impairment.loss = std::stod(value) / 100.0;
+        else if (name == "dup")
+            impairment.duplicate = std::stod(value) / 100.0;
+        else if (name == "reorder")
+            impairment.reorder = std::stod(value) / 100.0;
+        else if (name == "reorder-gap")
+            impairment.reorderGap = microseconds(static_cast<long long>(std::stod(value) * 1000.0));
+        else if (name == "bandwidth")
+            impairment.bandwidth = static_cast<uint64_t>(std::stod(value) * 1000.0 / 8.0);
+        else if (name == "queue")
+            impairment.queueLimit = static_cast<size_t>(std::stoul(value));
+        else
+            return false;
+        return true;
+    }
+
+    NetSimOptions parseArguments(int argc, char **argv)
+    {
+        NetSimOptions options;
+        options.proxy.listenPort = 5001;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h") {
+                options.help = true;
+                continue;
+            }
+            if (arg.rfind("--", 0) != 0 || i + 1 >= argc) {
+                log::warning("netsim: ignoring argument '{}'", arg);
+                continue;
+            }
+
+            const std::string name = arg.substr(2);
+            const std::string value = argv[++i];
+            if (name == "listen") {
+                options.proxy.listenPort = static_cast<uint16_t>(std::stoi(value));
+            } else if (name == "server") {
+                options.proxy.serverHost = value;
+            } else if (name == "server-port") {
+                options.proxy.serverPort = static_cast<uint16_t>(std::stoi(value));
+            } else if (name == "seed") {
+                options.proxy.seed = static_cast<uint32_t>(std::stoul(value));
+            } else if (name == "stats") {
+                options.statsInterval = static_cast<uint32_t>(std::stoul(value));
+            } else if (name.rfind("up-", 0) == 0) {
+                if (!parseCondition(name.substr(3), value, options.proxy.upstream))
+                    log::warning("netsim: unknown option '{}'", arg);
+            } else if (name.rfind("down-", 0) == 0) {
+                if (!parseCondition(name.substr(5), value, options.proxy.downstream))
+                    log::warning("netsim: unknown option '{}'", arg);
+            } else if (parseCondition(name, value, options.proxy.upstream)) {
+                parseCondition(name, value, options.proxy.downstream);
+            } else {
+                log::warning("netsim: unknown option '{}'", arg);
+            }
+        }
+        return options;
+    }
+
+    void printStats(const NetSimProxy &proxy)
+    {
+        for (const auto direction : {Direction::Upstream, Direction::Downstream}) {
+            const auto stats = proxy.getStats(direction);
+            log::info("netsim: {} packets={} delivered={} bytes={} dropped={} dup={} "
+                      "reordered={} retransmits={}",
+                      direction == Direction::Upstream ? "up  " : "down",
+                      stats.packets, stats.delivered, stats.bytes, stats.dropped,
+                      stats.duplicated, stats.reordered, stats.retransmits);
+        }
+    }
+} // namespace rtp::netsim
+
+int main(int ac, char **av)
+{
+    std::signal(SIGINT, rtp::netsim::signal_handler);
+
+    const auto options = rtp::netsim::parseArguments(ac, av);
+    if (options.help) {
+        rtp::netsim::printUsage();
+        return 0;
+    }
+
+    try {
+        rtp::netsim::NetSimProxy proxy(options.proxy);
+        proxy.start();
+
+        auto nextStats = std::chrono::steady_clock::now()
+                       + std::chrono::seconds(options.statsInterval);
+        while (rtp::netsim::running) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            if (options.statsInterval == 0 || std::chrono::steady_clock::now() < nextStats)
+                continue;
+            nextStats += std::chrono::seconds(options.statsInterval);
+            rtp::netsim::printStats(proxy);
+        }
+
+        proxy.stop();
+        rtp::netsim::printStats(proxy);
+    } catch (const std::exception &e) {
+        rtp::log::fatal("netsim: {}", e.what());
+        return 84;
+    }
+    return 0;
+}
@@ -0,0 +1,275 @@
+/**
+ * File   : main.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "Systems/ProjectilePool.hpp"
+#include "RType/Logger.hpp"
+
+#include "RType/ECS/Components/InputComponent.hpp"
+#include "RType/ECS/Components/Transform.hpp"
+#include "RType/ECS/Components/Velocity.hpp"
+#include "RType/ECS/Components/NetworkId.hpp"
+#include "RType/ECS/Components/EntityType.hpp"
+#include "RType/ECS/Components/RoomId.hpp"
+#include "RType/ECS/Components/SimpleWeapon.hpp"
+#include "RType/ECS/Components/Ammo.hpp"
+#include "RType/ECS/Components/MouvementPattern.hpp"
+#include "RType/ECS/Components/Health.hpp"
+#include "RType/ECS/Components/BoundingBox.hpp"
+#include "RType/ECS/Components/Damage.hpp"
+#include "RType/ECS/Components/Powerup.hpp"
+#include "RType/ECS/Components/MovementSpeed.hpp"
+#include "RType/ECS/Components/Shield.hpp"
+#include "RType/ECS/Components/DoubleFire.hpp"
+#include "RType/ECS/Components/Homing.hpp"
+#include "RType/ECS/Components/Boomerang.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace rtp::poolbench
+{
+    struct BenchOptions {
+        size_t bullets = 256;       /**< Live projectiles */
+        size_t others = 64;         /**< Players and enemies sharing the registry */
+        size_t turnover = 32;       /**< Projectiles replaced per tick */
+        size_t ticks = 20000;       /**< Ticks per run */
+        size_t runs = 5;            /**< Runs per mode, the median is reported */
+        bool help = false;          /**< Print usage and exit */
+    };
+
+    void printUsage(void)
+    {
+        std::cout
+            << "Usage: rtype_poolbench [options]\n"
+            << "  --bullets N   Live projectiles (256)\n"
+            << "  --others N    Players and enemies in the registry (64)\n"
+            << "  --turnover N  Projectiles destroyed and fired per tick (32)\n"
+            << "  --ticks N     Ticks per run (20000)\n"
+            << "  --runs N      Runs per mode, the median is reported (5)\n"
+            << "Times ProjectilePool acquire()/release() against spawn()/kill()\n"
+            << "on a registry holding every component a room subscribes.\n";
+    }
+
+    BenchOptions parseArguments(int argc, char **argv)
+    {
+        BenchOptions options;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h") {
+                options.help = true;
+                continue;
+            }
+            if (arg.rfind("--", 0) != 0 || i + 1 >= argc) {
+                log::warning("poolbench: ignoring argument '{}'", arg);
+                continue;
+            }
+
+            const std::string name = arg.substr(2);
+            const size_t value = static_cast<size_t>(std::stoul(argv[++i]));
+            if (name == "bullets")
+                options.bullets = std::max<size_t>(value, 1);
+            else if (name == "others")
+                options.others = value;
+            else if (name == "turnover")
+                options.turnover = value;
+            else if (name == "ticks")
+                options.ticks = std::max<size_t>(value, 1);
+            else if (name == "runs")
+                options.runs = std::max<size_t>(value, 1);
+            else
+                log::warning("poolbench: unknown option '{}'", arg);
+        }
+        options.turnover = std::min(options.turnover, options.bullets);
+        return options;
+    }
+
+    void subscribeRoomComponents(ecs::Registry &registry)
+    {
+        registry.subscribe<ecs::components::Transform>();
+        registry.subscribe<ecs::components::Velocity>();
+        registry.subscribe<ecs::components::NetworkId>();
+        registry.subscribe<ecs::components::server::InputComponent>();
+        registry.subscribe<ecs::components::EntityType>();
+        registry.subscribe<ecs::components::RoomId>();
+        registry.subscribe<ecs::components::SimpleWeapon>();
+        registry.subscribe<ecs::components::Ammo>();
+        registry.subscribe<ecs::components::MouvementPattern>();
+        registry.subscribe<ecs::components::Health>();
+        registry.subscribe<ecs::components::BoundingBox>();
+        registry.subscribe<ecs::components::Damage>();
+        registry.subscribe<ecs::components::Powerup>();
+        registry.subscribe<ecs::components::MovementSpeed>();
+        registry.subscribe<ecs::components::Shield>();
+        registry.subscribe<ecs::components::DoubleFire>();
+        registry.subscribe<ecs::components::Homing>();
+        registry.subscribe<ecs::components::Boomerang>();
+    }
+
+    void spawnOthers(ecs::Registry &registry, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            const ecs::Entity entity = registry.spawn().value();
+            registry.add<ecs::components::Transform>(entity);
+            registry.add<ecs::components::Velocity>(entity);
+            registry.add<ecs::components::Health>(entity);
+            registry.add<ecs::components::BoundingBox>(entity);
+            registry.add<ecs::components::EntityType>(
+                entity, ecs::components::EntityType{net::EntityType::Enemy1});
+            registry.add<ecs::components::NetworkId>(
+                entity, ecs::components::NetworkId{ecs::components::NetworkId::of(entity)});
+            registry.add<ecs::components::RoomId>(entity, ecs::components::RoomId{1});
+        }
+    }
+
+    server::ProjectileSpec bulletSpec(size_t n)
+    {
+        return server::ProjectileSpec{
+            net::EntityType::Bullet,
+            {static_cast<float>(n % 1280), 360.0f},
+            ecs::components::Velocity{{1.0f, 0.0f}, 500.0f},
+            8.0f,
+            4.0f,
+            10,
+            ecs::NullEntity,
+            1
+        };
+    }
+
+    // What PlayerShootSystem did before the pool: the components acquire() writes
+    ecs::Entity spawnBullet(ecs::Registry &registry, server::EntityIndex &index,
+                            const server::ProjectileSpec &spec)
+    {
+        const ecs::Entity entity = registry.spawn().value();
+        registry.add<ecs::components::Transform>(
+            entity, ecs::components::Transform{spec.position, 0.0f, {1.0f, 1.0f}});
+        registry.add<ecs::components::BoundingBox>(
+            entity, ecs::components::BoundingBox{spec.width, spec.height});
+        registry.add<ecs::components::Damage>(
+            entity, ecs::components::Damage{spec.damage, spec.owner});
+        registry.add<ecs::components::RoomId>(
+            entity, ecs::components::RoomId{spec.roomId});
+        registry.add<ecs::components::Velocity>(entity, spec.velocity);
+        registry.add<ecs::components::NetworkId>(
+            entity, ecs::components::NetworkId{ecs::components::NetworkId::of(entity)});
+        registry.add<ecs::components::EntityType>(
+            entity, ecs::components::EntityType{spec.type});
+        index.track(entity, spec.type);
+        return entity;
+    }
+
+    using Create = std::function<ecs::Entity(size_t)>;
+    using Destroy = std::function<void(ecs::Entity)>;
+
+    /**
+     * @brief Replace the oldest projectiles every tick
+     * @return Nanoseconds per projectile destroyed and fired again
+     * @note The index is flushed once per tick, as RoomSimulation does
+     */
+    double runTicks(const BenchOptions &options, server::EntityIndex &index,
+                    const Create &create, const Destroy &destroy)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        std::deque<ecs::Entity> live;
+        size_t fired = 0;
+        for (; fired < options.bullets; ++fired)
+            live.push_back(create(fired));
+
+        const auto start = Clock::now();
+        for (size_t tick = 0; tick < options.ticks; ++tick) {
+            for (size_t i = 0; i < options.turnover; ++i) {
+                destroy(live.front());
+                live.pop_front();
+                live.push_back(create(fired++));
+            }
+            index.flush();
+        }
+        const auto elapsed = std::chrono::duration<double, std::nano>(Clock::now() - start);
+
+        const double replaced = static_cast<double>(options.ticks * options.turnover);
+        return replaced > 0.0 ? elapsed.count() / replaced : 0.0;
+    }
+
+    double runKillSpawn(const BenchOptions &options)
+    {
+        ecs::Registry registry;
+        subscribeRoomComponents(registry);
+        spawnOthers(registry, options.others);
+        server::EntityIndex index(registry);
+        index.refresh();
+
+        return runTicks(options, index,
+            [&](size_t n) { return spawnBullet(registry, index, bulletSpec(n)); },
+            [&](ecs::Entity entity) {
+                index.untrack(entity);
+                registry.kill(entity);
+            });
+    }
+
+    double runPool(const BenchOptions &options)
+    {
+        ecs::Registry registry;
+        subscribeRoomComponents(registry);
+        spawnOthers(registry, options.others);
+        server::EntityIndex index(registry);
+        index.refresh();
+        server::ProjectilePool pool(registry, index);
+
+        return runTicks(options, index,
+            [&](size_t n) { return pool.acquire(bulletSpec(n)).value(); },
+            [&](ecs::Entity entity) { pool.release(entity); });
+    }
+
+    double median(std::vector<double> samples)
+    {
+        std::ranges::sort(samples);
+        return samples[samples.size() / 2];
+    }
+
+    int runBench(const BenchOptions &options)
+    {
+        std::vector<double> killSpawn;
+        std::vector<double> pooled;
+
+        // Interleaved so both modes see the same machine load
+        for (size_t run = 0; run < options.runs; ++run) {
+            killSpawn.push_back(runKillSpawn(options));
+            pooled.push_back(runPool(options));
+        }
+
+        const double killNs = median(killSpawn);
+        const double poolNs = median(pooled);
+        log::info("poolbench: {} live bullets, {} other entities, {} replaced per tick, {} ticks x {} runs",
+                  options.bullets, options.others, options.turnover, options.ticks, options.runs);
+        log::info("poolbench: spawn/kill  {:>8.1f} ns per bullet", killNs);
+        log::info("poolbench: pool        {:>8.1f} ns per bullet ({:.2f}x)",
+                  poolNs, poolNs > 0.0 ? killNs / poolNs : 0.0);
+        return 0;
+    }
+} // namespace rtp::poolbench
+
+int main(int ac, char **av)
+{
+    try {
+        const auto options = rtp::poolbench::parseArguments(ac, av);
+        if (options.help) {
+            rtp::poolbench::printUsage();
+            return 0;
+        }
+        return rtp::poolbench::runBench(options);
+    } catch (const std::exception &e) {
+        rtp::log::fatal("poolbench: {}", e.what());
+        return 84;
+    }
+}
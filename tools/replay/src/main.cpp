@@ -0,0 +1,224 @@
+/**
+ * File   : main.cpp
+ * License: MIT
+ * Author : Elias Josué HAJJAR LLAUQUEN <elias-josue.hajjar-llauquen@epitech.eu>
+ * Date   : 11/12/2025
+ */
+
+#include "Game/EventCapture.hpp"
+#include "Game/GameManager.hpp"
+#include "ServerNetwork/ServerNetwork.hpp"
+#include "RType/Logger.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace rtp::replay
+{
+    std::atomic<bool> running{true};
+
+    void signal_handler(int signum)
+    {
+        if (signum == SIGINT)
+            running = false;
+    }
+
+    struct ReplayOptions {
+        std::string capturePath;        /**< Capture written by r-type_server --capture */
+        uint32_t tailTicks = 0;         /**< Ticks run after the last event */
+        uint32_t maxTicks = 0;          /**< Stop after this many ticks, 0 for the whole capture */
+        size_t simThreads = 0;          /**< Room simulation workers, 0 for the game thread */
+        std::string tracePath;          /**< Chrome trace of the replay, empty for none */
+        bool verbose = false;           /**< Keep the server log on stdout */
+        bool help = false;              /**< Print usage and exit */
+    };
+
+    void printUsage(void)
+    {
+        std::cout
+            << "Usage: rtype_replay [options] CAPTURE\n"
+            << "  --tail TICKS     Ticks run after the last event (0)\n"
+            << "  --ticks N        Stop after N ticks, 0 for the whole capture (0)\n"
+            << "  --sim-threads N  Simulate rooms on N worker threads (0)\n"
+            << "  --profile FILE   Time every system and write a Chrome trace to FILE\n"
+            << "  --verbose        Keep the server log, which slows the replay down\n"
+            << "Run it from a directory holding the server's config/ folder.\n"
+            << "Accounts come from the capture, logins.txt is not touched.\n";
+    }
+
+    ReplayOptions parseArguments(int argc, char **argv)
+    {
+        ReplayOptions options;
+
+        for (int i = 1; i < argc; ++i) {
+            const std::string arg = argv[i];
+            if (arg == "--help" || arg == "-h")
+                options.help = true;
+            else if (arg == "--verbose")
+                options.verbose = true;
+            else if (arg == "--tail" && i + 1 < argc)
+                options.tailTicks = static_cast<uint32_t>(std::stoul(argv[++i]));
+            else if (arg == "--ticks" && i + 1 < argc)
+                options.maxTicks = static_cast<uint32_t>(std::stoul(argv[++i]));
+            else if (arg == "--sim-threads" && i + 1 < argc)
+                options.simThreads = static_cast<size_t>(std::stoul(argv[++i]));
+            else if (arg == "--profile" && i + 1 < argc)
+                options.tracePath = argv[++i];
+            else if (arg.rfind("--", 0) != 0)
+                options.capturePath = arg;
+            else
+                log::warning("replay: ignoring argument '{}'", arg);
+        }
+        return options;
+    }
+
+    /**
+     * @brief Discards the server log while the replay is timed
+     */
+    class MuteStdout final {
+        public:
+            explicit MuteStdout(bool mute)
+                : _saved(mute ? std::cout.rdbuf(nullptr) : nullptr) {}
+
+            ~MuteStdout()
+            {
+                if (_saved != nullptr) {
+                    std::cout.rdbuf(_saved);
+                    std::cout.clear();
+                }
+            }
+
+        private:
+            std::streambuf *_saved;
+    };
+
+    double percentile(const std::vector<double> &sorted, double p)
+    {
+        if (sorted.empty())
+            return 0.0;
+        const auto index = static_cast<size_t>(p * static_cast<double>(sorted.size() - 1) + 0.5);
+        return sorted[std::min(index, sorted.size() - 1)];
+    }
+
+    int runReplay(const ReplayOptions &options)
+    {
+        using Clock = std::chrono::steady_clock;
+
+        server::CaptureReader reader(options.capturePath);
+        const server::CaptureInfo &info = reader.getInfo();
+        std::vector<server::CapturedEvent> events;
+        server::CapturedEvent captured;
+        while (reader.next(captured))
+            events.push_back(std::move(captured));
+        const uint32_t lastTick = events.empty() ? 0 : events.back().tick;
+
+        const auto accountsPath = std::filesystem::temp_directory_path()
+            / std::format("rtype_replay_{}.txt", std::random_device{}());
+        std::ofstream(accountsPath, std::ios::binary) << info.accounts;
+
+        const double tickRate = std::max<uint32_t>(info.tickRate, 1);
+        log::info("replay: {} events over {} ticks ({:.1f}s of play at {} Hz), seed {}",
+                  events.size(), lastTick + 1, (lastTick + 1) / tickRate, info.tickRate, info.randSeed);
+
+        std::vector<double> tickMs;
+        double seconds = 0.0;
+        uint64_t droppedEvents = 0;
+        size_t peakMatches = 0;
+        std::vector<server::ZoneStats> zones;
+        size_t traced = 0;
+        {
+            MuteStdout mute(!options.verbose);
+
+            // Never started: no socket is served and sends find no session
+            server::ServerNetwork network(0);
+            server::GameManager game(network);
+            game.setSnapshotInterval(info.snapshotInterval);
+            game.setTickRate(info.tickRate);
+            game.setAccountsPath(accountsPath.string());
+            game.setSimulationThreads(options.simThreads);
+            game.getProfiler().setEnabled(!options.tracePath.empty());
+            game.setRandomSeed(info.randSeed);
+
+            uint32_t endTick = lastTick + 1 + options.tailTicks;
+            if (options.maxTicks > 0)
+                endTick = std::min(endTick, options.maxTicks);
+            tickMs.reserve(endTick);
+
+            size_t next = 0;
+            const auto start = Clock::now();
+            while (running && game.getServerTick() < endTick) {
+                const uint32_t tick = game.getServerTick();
+                for (; next < events.size() && events[next].tick == tick; ++next)
+                    network.publishEvent(std::move(events[next].event));
+
+                const auto tickStart = Clock::now();
+                game.tick();
+                tickMs.push_back(std::chrono::duration<double, std::milli>(Clock::now() - tickStart).count());
+                peakMatches = std::max(peakMatches, game.getSimulatedRoomCount());
+            }
+            seconds = std::chrono::duration<double>(Clock::now() - start).count();
+            droppedEvents = network.getNetworkStats().droppedEvents;
+            if (!options.tracePath.empty()) {
+                zones = game.getProfiler().getStats();
+                traced = game.getProfiler().exportTrace(options.tracePath);
+            }
+        }
+        std::filesystem::remove(accountsPath);
+
+        const double played = static_cast<double>(tickMs.size()) / tickRate;
+        std::vector<double> sorted = tickMs;
+        std::ranges::sort(sorted);
+        log::info("replay: {} ticks in {:.3f}s, {:.0f} ticks/s, {:.1f}x real time",
+                  tickMs.size(), seconds, tickMs.size() / std::max(seconds, 1e-9),
+                  played / std::max(seconds, 1e-9));
+        log::info("replay: tick ms p50 {:.3f} p90 {:.3f} p99 {:.3f} max {:.3f}",
+                  percentile(sorted, 0.50), percentile(sorted, 0.90),
+                  percentile(sorted, 0.99), sorted.empty() ? 0.0 : sorted.back());
+        if (peakMatches > 0 && !sorted.empty()) {
+            // Matches one core could run at this p99 within the tick budget
+            const double budgetMs = 1000.0 / tickRate;
+            const double p99 = std::max(percentile(sorted, 0.99), 1e-6);
+            const double cores = static_cast<double>(std::max<size_t>(options.simThreads, 1));
+            log::info("replay: {} matches at peak, ~{:.1f} matches per core at {} Hz",
+                      peakMatches, peakMatches * budgetMs / p99 / cores, info.tickRate);
+        }
+        if (!options.tracePath.empty())
+            log::info("replay: {} trace events written to {}", traced, options.tracePath);
+        std::ranges::sort(zones, std::greater{}, &server::ZoneStats::totalUs);
+        for (const server::ZoneStats &zone : zones) {
+            log::info("replay: {:<22} room {:>3} {:>8} calls {:>10.3f} ms total, p50 {} us p99 {} us max {} us",
+                      zone.name, zone.roomId, zone.calls, zone.totalUs / 1000.0,
+                      zone.p50Us, zone.p99Us, zone.maxUs);
+        }
+        if (droppedEvents > 0)
+            log::warning("replay: {} events dropped by a full event queue", droppedEvents);
+        return 0;
+    }
+} // namespace rtp::replay
+
+int main(int ac, char **av)
+{
+    std::signal(SIGINT, rtp::replay::signal_handler);
+
+    try {
+        const auto options = rtp::replay::parseArguments(ac, av);
+        if (options.help || options.capturePath.empty()) {
+            rtp::replay::printUsage();
+            return options.help ? 0 : 84;
+        }
+        return rtp::replay::runReplay(options);
+    } catch (const std::exception &e) {
+        rtp::log::fatal("replay: {}", e.what());
+        return 84;
+    }
+}